@@ -116,7 +116,7 @@ QSharedPointer<LibraryComponent> ApiDefinition::clone() const
 //-----------------------------------------------------------------------------
 // Function: ApiDefinition::write()
 //-----------------------------------------------------------------------------
-void ApiDefinition::write(QFile& file)
+void ApiDefinition::write(QIODevice& file)
 {
     QXmlStreamWriter writer(&file);
 
@@ -66,7 +66,7 @@ public:
      *
      *      @param [in] file The file handle.
      */
-    virtual void write(QFile& file);
+    virtual void write(QIODevice& file);
 
     /*!
      *  Returns true if the contents are valid.
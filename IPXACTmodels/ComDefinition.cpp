@@ -101,7 +101,7 @@ QSharedPointer<LibraryComponent> ComDefinition::clone() const
 //-----------------------------------------------------------------------------
 // Function: ComDefinition::write()
 //-----------------------------------------------------------------------------
-void ComDefinition::write(QFile& file)
+void ComDefinition::write(QIODevice& file)
 {
     QXmlStreamWriter writer(&file);
 
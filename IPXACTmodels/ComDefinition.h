@@ -68,7 +68,7 @@ public:
      *
      *      @param [in] file The file handle.
      */
-    virtual void write(QFile& file);
+    virtual void write(QIODevice& file);
 
     /*!
      *  Returns true if the communication definition is valid.
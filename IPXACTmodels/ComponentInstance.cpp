@@ -12,6 +12,7 @@
 #include "ComponentInstance.h"
 
 #include "GenericVendorExtension.h"
+#include "StringPool.h"
 #include "XmlUtils.h"
 
 #include <IPXACTmodels/VendorExtension.h>
@@ -133,7 +134,7 @@ ComponentInstance::ComponentInstance(QDomNode& node)
 
                 QDomNamedNodeMap attributes = confNode.attributes();
                 QString reference = attributes.namedItem("spirit:referenceId").nodeValue();
-                configurableElementValues_.insert(reference, value);
+                configurableElementValues_.insert(StringPool::intern(reference), value);
             }
         }
         else if (node.nodeName() == "spirit:vendorExtensions")
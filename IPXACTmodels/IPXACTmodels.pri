@@ -115,7 +115,18 @@ HEADERS += ../resource.h \
     ./validators/namevalidator.h \
     ./validators/NMTokenValidator.h \
     ./AbstractMemoryMap.h \
-    ./MemoryRemap.h
+    ./MemoryRemap.h \
+    ./streamReaders/DocumentStreamReader.h \
+    ./streamReaders/ComponentStreamReader.h \
+    ./streamReaders/DesignStreamReader.h \
+    ./streamReaders/DesignConfigurationStreamReader.h \
+    ./streamReaders/BusDefinitionStreamReader.h \
+    ./streamReaders/AbstractionDefinitionStreamReader.h \
+    ./PackedRegisterTable.h \
+    ./StringPool.h \
+    ./NameIndex.h \
+    ./validators/ComponentValidationContext.h \
+    ./validators/ParallelValidator.h
 SOURCES += ./abstractiondefinition.cpp \
     ./addressblock.cpp \
     ./addressspace.cpp \
@@ -220,4 +231,14 @@ SOURCES += ./abstractiondefinition.cpp \
     ./validators/ParameterValidator.cpp \
     ./validators/ParameterValidator2014.cpp \
     ./AbstractMemoryMap.cpp \
-    ./MemoryRemap.cpp
+    ./MemoryRemap.cpp \
+    ./streamReaders/DocumentStreamReader.cpp \
+    ./streamReaders/ComponentStreamReader.cpp \
+    ./streamReaders/DesignStreamReader.cpp \
+    ./streamReaders/DesignConfigurationStreamReader.cpp \
+    ./streamReaders/BusDefinitionStreamReader.cpp \
+    ./streamReaders/AbstractionDefinitionStreamReader.cpp \
+    ./PackedRegisterTable.cpp \
+    ./StringPool.cpp \
+    ./validators/ComponentValidationContext.cpp \
+    ./validators/ParallelValidator.cpp
@@ -115,7 +115,7 @@ QString MemoryRemap::getRemapState() const
 // Function: MemoryRemap::isValid()
 //-----------------------------------------------------------------------------
 bool MemoryRemap::isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices,
-    QStringList remapStateNames, QStringList& errorList, const QString& parentIdentifier) const
+    const QSet<QString>& remapStateNames, QStringList& errorList, const QString& parentIdentifier) const
 {
     bool valid = AbstractMemoryMap::isValid(componentChoices, errorList, parentIdentifier);
 
@@ -20,6 +20,7 @@
 #include <QSharedPointer>
 #include <QDomNode>
 #include <QXmlStreamWriter>
+#include <QSet>
 #include <QTextStream>
 
 //-----------------------------------------------------------------------------
@@ -78,7 +79,7 @@ public:
      *
      *      @return True, if the memory remap is in a valid state, false otherwise
 	 */
-	bool isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices, QStringList remapStateNames,
+	bool isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices, const QSet<QString>& remapStateNames,
         QStringList& errorList, const QString& parentIdentifier) const;
 
 	/*!
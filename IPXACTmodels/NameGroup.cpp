@@ -12,8 +12,17 @@
 #include "NameGroup.h"
 #include <IPXACTmodels/generaldeclarations.h>
 
+#include "StringPool.h"
 #include "XmlUtils.h"
 
+#include <QAtomicInt>
+
+namespace
+{
+    //! Counts the renames of all the name groups.
+    QAtomicInt nameRevision;
+}
+
 //-----------------------------------------------------------------------------
 // Function: NameGroup::NameGroup()
 //-----------------------------------------------------------------------------
@@ -39,7 +48,7 @@ NameGroup::NameGroup(QDomNode& node):
 
         if (tempNode.nodeName() == QString("spirit:name")) {
             name_ = tempNode.childNodes().at(0).nodeValue();
-            name_ = XmlUtils::removeWhiteSpace(name_);
+            name_ = StringPool::intern(XmlUtils::removeWhiteSpace(name_));
         }
         else if (tempNode.nodeName() == QString("spirit:displayName")) {
             displayName_ = tempNode.childNodes().at(0).nodeValue();
@@ -80,6 +89,7 @@ NameGroup& NameGroup::operator=( const NameGroup& other ) {
         name_ = other.name_;
         displayName_ = other.displayName_;
         description_ = other.description_;
+        nameRevision.ref();
     }
     return *this;
 }
@@ -98,6 +108,7 @@ QString NameGroup::name() const
 void NameGroup::setName(QString const& name)
 {
     name_ = name;
+    nameRevision.ref();
 }
 
 //-----------------------------------------------------------------------------
@@ -147,3 +158,11 @@ void NameGroup::write(QXmlStreamWriter& writer) const
         writer.writeTextElement("spirit:description", description_);
     }
 }
+
+//-----------------------------------------------------------------------------
+// Function: NameGroup::getNameRevision()
+//-----------------------------------------------------------------------------
+int NameGroup::getNameRevision()
+{
+    return nameRevision.load();
+}
@@ -106,6 +106,13 @@ public:
      */
     void write(QXmlStreamWriter& writer) const;
 
+    /*!
+     *  Gets the revision of the names. The revision changes whenever any name group is renamed.
+     *
+     *      @return The current name revision.
+     */
+    static int getNameRevision();
+
 private:
 
     //! The name matches the spirit:name field within nameGroup.
@@ -0,0 +1,213 @@
+//-----------------------------------------------------------------------------
+// File: NameIndex.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Lazily built index for finding the named elements of a list.
+//-----------------------------------------------------------------------------
+
+#ifndef NAMEINDEX_H
+#define NAMEINDEX_H
+
+#include "NameGroup.h"
+
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSharedPointer>
+#include <QString>
+
+//-----------------------------------------------------------------------------
+//! Lazily built index for finding the named elements of a list.
+//
+// The index maps the element names to their positions in the list owned by a model. It is built on the
+// first search and rebuilt on the next search after the index has become stale. The models give out
+// modifiable references to their lists and the elements can be renamed directly, so the index keeps a
+// shared copy of the indexed list and the name revision of NameGroup. Any change to the list detaches
+// it from the copy and any rename changes the revision, which both make the index stale. A search on
+// a current index, including one for a name not in the list, takes constant time.
+//
+// The index may be searched from several threads at the same time.
+//-----------------------------------------------------------------------------
+template <typename T>
+class NameIndex
+{
+public:
+
+    //! The constructor.
+    NameIndex();
+
+    //! The copy constructor. The index of a copied list is built separately.
+    NameIndex(NameIndex const& other);
+
+    //! The destructor.
+    ~NameIndex();
+
+    //! The assignment operator. The index of an assigned list is built separately.
+    NameIndex& operator=(NameIndex const& other);
+
+    /*!
+     *  Finds the element with the given name.
+     *
+     *      @param [in] items   The list of elements the index is for.
+     *      @param [in] name    The name of the element to find.
+     *
+     *      @return The element with the given name or a null pointer, if not found.
+     */
+    QSharedPointer<T> find(QList<QSharedPointer<T> > const& items, QString const& name) const;
+
+    /*!
+     *  Clears the index. It is rebuilt on the next search.
+     */
+    void invalidate();
+
+private:
+
+    /*!
+     *  Checks if the index is built from the given list and no element has been renamed since.
+     *
+     *      @param [in] items   The list of elements the index is for.
+     *
+     *      @return True, if the index is current, otherwise false.
+     */
+    bool isCurrent(QList<QSharedPointer<T> > const& items) const;
+
+    /*!
+     *  Builds the index from the given list. The first element with each name is indexed.
+     *
+     *      @param [in] items   The list of elements to index.
+     */
+    void rebuild(QList<QSharedPointer<T> > const& items) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The positions of the elements in the list by their names.
+    mutable QHash<QString, int> positions_;
+
+    //! The list the index was built from, sharing its data with the list of the model until either changes.
+    mutable QList<QSharedPointer<T> > indexedItems_;
+
+    //! The name revision when the index was built.
+    mutable int indexedRevision_;
+
+    //! True, if the index has been built and not invalidated since.
+    mutable bool built_;
+
+    //! The lock guarding the index.
+    mutable QMutex mutex_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: NameIndex::NameIndex()
+//-----------------------------------------------------------------------------
+template <typename T>
+NameIndex<T>::NameIndex(): positions_(), indexedItems_(), indexedRevision_(0), built_(false), mutex_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: NameIndex::NameIndex()
+//-----------------------------------------------------------------------------
+template <typename T>
+NameIndex<T>::NameIndex(NameIndex const& /*other*/): positions_(), indexedItems_(), indexedRevision_(0),
+    built_(false), mutex_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: NameIndex::~NameIndex()
+//-----------------------------------------------------------------------------
+template <typename T>
+NameIndex<T>::~NameIndex()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: NameIndex::operator=()
+//-----------------------------------------------------------------------------
+template <typename T>
+NameIndex<T>& NameIndex<T>::operator=(NameIndex const& other)
+{
+    if (this != &other)
+    {
+        invalidate();
+    }
+
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+// Function: NameIndex::find()
+//-----------------------------------------------------------------------------
+template <typename T>
+QSharedPointer<T> NameIndex<T>::find(QList<QSharedPointer<T> > const& items, QString const& name) const
+{
+    QMutexLocker locker(&mutex_);
+
+    if (!isCurrent(items))
+    {
+        rebuild(items);
+    }
+
+    int position = positions_.value(name, -1);
+    if (position >= 0)
+    {
+        return items.at(position);
+    }
+
+    return QSharedPointer<T>();
+}
+
+//-----------------------------------------------------------------------------
+// Function: NameIndex::invalidate()
+//-----------------------------------------------------------------------------
+template <typename T>
+void NameIndex<T>::invalidate()
+{
+    QMutexLocker locker(&mutex_);
+    positions_.clear();
+    indexedItems_.clear();
+    built_ = false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: NameIndex::isCurrent()
+//-----------------------------------------------------------------------------
+template <typename T>
+bool NameIndex<T>::isCurrent(QList<QSharedPointer<T> > const& items) const
+{
+    // The lists share the same data only if the list of the model has not been changed.
+    return built_ && indexedRevision_ == NameGroup::getNameRevision() &&
+        items.size() == indexedItems_.size() && items.constBegin() == indexedItems_.constBegin();
+}
+
+//-----------------------------------------------------------------------------
+// Function: NameIndex::rebuild()
+//-----------------------------------------------------------------------------
+template <typename T>
+void NameIndex<T>::rebuild(QList<QSharedPointer<T> > const& items) const
+{
+    // The revision is read first so that a rename during the rebuild makes the index stale.
+    indexedRevision_ = NameGroup::getNameRevision();
+    indexedItems_ = items;
+    built_ = true;
+
+    positions_.clear();
+    positions_.reserve(items.size());
+
+    for (int i = items.size() - 1; i >= 0; --i)
+    {
+        positions_.insert(items.at(i)->getName(), i);
+    }
+}
+
+#endif // NAMEINDEX_H
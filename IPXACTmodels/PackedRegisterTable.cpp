@@ -0,0 +1,628 @@
+//-----------------------------------------------------------------------------
+// File: PackedRegisterTable.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Column-oriented storage for the registers of an address block.
+//-----------------------------------------------------------------------------
+
+#include "PackedRegisterTable.h"
+
+#include "field.h"
+#include "register.h"
+#include "registerdefinition.h"
+#include "registermodel.h"
+#include "reset.h"
+#include "XmlUtils.h"
+
+#include <QDomNamedNodeMap>
+#include <QDomNodeList>
+#include <QObject>
+
+namespace
+{
+    /*!
+     *  Gets the text of the given element as the DOM constructors of the models read it.
+     */
+    QString textOf(QDomNode const& node)
+    {
+        return node.childNodes().at(0).nodeValue();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::PackedRegisterTable()
+//-----------------------------------------------------------------------------
+PackedRegisterTable::PackedRegisterTable(): strings_(), stringIndices_(), registerNames_(),
+    registerDisplayNames_(), registerDescriptions_(), registerTypeIdentifiers_(), addressOffsets_(),
+    resetValues_(), resetMasks_(), dims_(), sizes_(), registerVolatiles_(), registerAccesses_(),
+    firstFields_(), fieldNames_(), fieldDisplayNames_(), fieldDescriptions_(), fieldTypeIdentifiers_(),
+    bitOffsets_(), bitWidths_(), fieldAccesses_(), modifiedWrites_(), readActions_(), testConstraints_(),
+    fieldFlags_()
+{
+    firstFields_.append(0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::~PackedRegisterTable()
+//-----------------------------------------------------------------------------
+PackedRegisterTable::~PackedRegisterTable()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::append()
+//-----------------------------------------------------------------------------
+bool PackedRegisterTable::append(QDomNode const& registerNode)
+{
+    if (!isPackable(registerNode))
+    {
+        return false;
+    }
+
+    int name = -1;
+    int displayName = -1;
+    int description = -1;
+    int typeIdentifier = -1;
+    int addressOffset = -1;
+    int resetValue = -1;
+    int resetMask = -1;
+    int dim = -1;
+    int size = 0;
+    General::BooleanValue volatileValue = General::BOOL_UNSPECIFIED;
+    General::Access access = General::ACCESS_COUNT;
+
+    // The values are read as in the DOM constructors of Register and its members.
+    QDomNodeList children = registerNode.childNodes();
+    for (int i = 0; i < children.count(); ++i)
+    {
+        QDomNode child = children.at(i);
+        QString nodeName = child.nodeName();
+
+        if (nodeName == QLatin1String("spirit:name"))
+        {
+            name = intern(XmlUtils::removeWhiteSpace(textOf(child)));
+        }
+        else if (nodeName == QLatin1String("spirit:displayName"))
+        {
+            displayName = intern(textOf(child));
+        }
+        else if (nodeName == QLatin1String("spirit:description"))
+        {
+            description = intern(textOf(child));
+        }
+        else if (nodeName == QLatin1String("spirit:dim"))
+        {
+            dim = textOf(child).toInt();
+        }
+        else if (nodeName == QLatin1String("spirit:addressOffset"))
+        {
+            addressOffset = intern(textOf(child));
+        }
+        else if (nodeName == QLatin1String("spirit:typeIdentifier"))
+        {
+            typeIdentifier = intern(XmlUtils::removeWhiteSpace(textOf(child)));
+        }
+        else if (nodeName == QLatin1String("spirit:size"))
+        {
+            size = textOf(child).toInt();
+        }
+        else if (nodeName == QLatin1String("spirit:volatile"))
+        {
+            volatileValue = General::str2BooleanValue(textOf(child));
+        }
+        else if (nodeName == QLatin1String("spirit:access"))
+        {
+            access = General::str2Access(textOf(child), General::ACCESS_COUNT);
+        }
+        else if (nodeName == QLatin1String("spirit:reset"))
+        {
+            resetValue = intern(QString());
+
+            QDomNodeList resetChildren = child.childNodes();
+            for (int j = 0; j < resetChildren.count(); ++j)
+            {
+                QDomNode resetChild = resetChildren.at(j);
+                if (resetChild.nodeName() == QLatin1String("spirit:value"))
+                {
+                    resetValue = intern(textOf(resetChild));
+                }
+                else if (resetChild.nodeName() == QLatin1String("spirit:mask"))
+                {
+                    resetMask = intern(textOf(resetChild));
+                }
+            }
+        }
+        else if (nodeName == QLatin1String("spirit:field"))
+        {
+            appendField(child);
+        }
+    }
+
+    registerNames_.append(name);
+    registerDisplayNames_.append(displayName);
+    registerDescriptions_.append(description);
+    registerTypeIdentifiers_.append(typeIdentifier);
+    addressOffsets_.append(addressOffset);
+    resetValues_.append(resetValue);
+    resetMasks_.append(resetMask);
+    dims_.append(dim);
+    sizes_.append(size);
+    registerVolatiles_.append(quint8(volatileValue));
+    registerAccesses_.append(quint8(access));
+    firstFields_.append(fieldNames_.size());
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::size()
+//-----------------------------------------------------------------------------
+int PackedRegisterTable::size() const
+{
+    return registerNames_.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::fieldCount()
+//-----------------------------------------------------------------------------
+int PackedRegisterTable::fieldCount() const
+{
+    return fieldNames_.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::name()
+//-----------------------------------------------------------------------------
+QString PackedRegisterTable::name(int index) const
+{
+    return stringAt(registerNames_.at(index));
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::addressOffset()
+//-----------------------------------------------------------------------------
+QString PackedRegisterTable::addressOffset(int index) const
+{
+    return stringAt(addressOffsets_.at(index));
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::dim()
+//-----------------------------------------------------------------------------
+int PackedRegisterTable::dim(int index) const
+{
+    return dims_.at(index);
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::registerSize()
+//-----------------------------------------------------------------------------
+int PackedRegisterTable::registerSize(int index) const
+{
+    return sizes_.at(index);
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::createRegister()
+//-----------------------------------------------------------------------------
+QSharedPointer<Register> PackedRegisterTable::createRegister(int index) const
+{
+    QSharedPointer<Register> reg(new Register());
+
+    reg->setName(stringAt(registerNames_.at(index)));
+    reg->setDisplayName(stringAt(registerDisplayNames_.at(index)));
+    reg->setDescription(stringAt(registerDescriptions_.at(index)));
+    reg->setDim(dims_.at(index));
+    reg->setAddressOffset(stringAt(addressOffsets_.at(index)));
+    reg->setTypeIdentifier(stringAt(registerTypeIdentifiers_.at(index)));
+    reg->setSize(sizes_.at(index));
+    reg->setVolatile(General::BooleanValue(registerVolatiles_.at(index)));
+    reg->setAccess(General::Access(registerAccesses_.at(index)));
+
+    if (resetValues_.at(index) != -1)
+    {
+        reg->setRegisterValue(stringAt(resetValues_.at(index)));
+    }
+
+    if (resetMasks_.at(index) != -1)
+    {
+        reg->setRegisterMask(stringAt(resetMasks_.at(index)));
+    }
+
+    QList<QSharedPointer<Field> >& fields = reg->getFields();
+    for (int i = firstFields_.at(index); i < firstFields_.at(index + 1); ++i)
+    {
+        QSharedPointer<Field> field(new Field());
+        field->setName(stringAt(fieldNames_.at(i)));
+        field->setDisplayName(stringAt(fieldDisplayNames_.at(i)));
+        field->setDescription(stringAt(fieldDescriptions_.at(i)));
+        field->setTypeIdentifier(stringAt(fieldTypeIdentifiers_.at(i)));
+        field->setBitOffset(bitOffsets_.at(i));
+        field->setBitWidth(bitWidths_.at(i));
+        field->setAccess(General::Access(fieldAccesses_.at(i)));
+        field->setModifiedWrite(General::ModifiedWrite(modifiedWrites_.at(i)));
+        field->setReadAction(General::ReadAction(readActions_.at(i)));
+        field->setTestConstraint(General::TestConstraint(testConstraints_.at(i)));
+        field->setVolatile((fieldFlags_.at(i) & FIELD_VOLATILE) != 0);
+        field->setTestable((fieldFlags_.at(i) & FIELD_TESTABLE) != 0);
+
+        fields.append(field);
+    }
+
+    return reg;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::createRegisters()
+//-----------------------------------------------------------------------------
+QList<QSharedPointer<RegisterModel> > PackedRegisterTable::createRegisters() const
+{
+    QList<QSharedPointer<RegisterModel> > registers;
+    registers.reserve(size());
+
+    for (int i = 0; i < size(); ++i)
+    {
+        registers.append(createRegister(i));
+    }
+
+    return registers;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::isValid()
+//-----------------------------------------------------------------------------
+bool PackedRegisterTable::isValid(int index, QStringList& errorList, QString const& parentIdentifier) const
+{
+    return validate(index, &errorList, parentIdentifier);
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::isValid()
+//-----------------------------------------------------------------------------
+bool PackedRegisterTable::isValid(int index) const
+{
+    return validate(index, 0, QString());
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::write()
+//-----------------------------------------------------------------------------
+void PackedRegisterTable::write(QXmlStreamWriter& writer, int index) const
+{
+    // The elements are written in the same order and under the same conditions as in Register::write().
+    writer.writeStartElement("spirit:register");
+
+    writer.writeTextElement("spirit:name", stringAt(registerNames_.at(index)));
+    writeOptionalElement(writer, "spirit:displayName", registerDisplayNames_.at(index));
+    writeOptionalElement(writer, "spirit:description", registerDescriptions_.at(index));
+
+    if (dims_.at(index) >= 0)
+    {
+        writer.writeTextElement("spirit:dim", QString::number(dims_.at(index)));
+    }
+
+    writer.writeTextElement("spirit:addressOffset", stringAt(addressOffsets_.at(index)));
+    writeOptionalElement(writer, "spirit:typeIdentifier", registerTypeIdentifiers_.at(index));
+    writer.writeTextElement("spirit:size", QString::number(sizes_.at(index)));
+
+    General::BooleanValue volatileValue = General::BooleanValue(registerVolatiles_.at(index));
+    if (volatileValue != General::BOOL_UNSPECIFIED)
+    {
+        writer.writeTextElement("spirit:volatile", General::booleanValue2Str(volatileValue));
+    }
+
+    General::Access access = General::Access(registerAccesses_.at(index));
+    if (access != General::ACCESS_COUNT)
+    {
+        writer.writeTextElement("spirit:access", General::access2Str(access));
+    }
+
+    QString resetValue = stringAt(resetValues_.at(index));
+    if (!resetValue.isEmpty())
+    {
+        writer.writeStartElement("spirit:reset");
+        writer.writeTextElement("spirit:value", resetValue);
+        writeOptionalElement(writer, "spirit:mask", resetMasks_.at(index));
+        writer.writeEndElement(); // spirit:reset
+    }
+
+    for (int i = firstFields_.at(index); i < firstFields_.at(index + 1); ++i)
+    {
+        writeField(writer, i);
+    }
+
+    writer.writeEndElement(); // spirit:register
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::isPackable()
+//-----------------------------------------------------------------------------
+bool PackedRegisterTable::isPackable(QDomNode const& registerNode) const
+{
+    if (!registerNode.attributes().namedItem("spirit:id").isNull())
+    {
+        return false;
+    }
+
+    QDomNodeList children = registerNode.childNodes();
+    for (int i = 0; i < children.count(); ++i)
+    {
+        QDomNode child = children.at(i);
+        QString nodeName = child.nodeName();
+
+        if (nodeName == QLatin1String("spirit:parameters") ||
+            nodeName == QLatin1String("spirit:alternateRegisters") ||
+            nodeName == QLatin1String("spirit:vendorExtensions") ||
+            (nodeName == QLatin1String("spirit:size") && child.attributes().count() != 0) ||
+            (nodeName == QLatin1String("spirit:field") && !isPackableField(child)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::isPackableField()
+//-----------------------------------------------------------------------------
+bool PackedRegisterTable::isPackableField(QDomNode const& fieldNode) const
+{
+    if (!fieldNode.attributes().namedItem("spirit:id").isNull())
+    {
+        return false;
+    }
+
+    QDomNodeList children = fieldNode.childNodes();
+    for (int i = 0; i < children.count(); ++i)
+    {
+        QDomNode child = children.at(i);
+        QString nodeName = child.nodeName();
+
+        if (nodeName == QLatin1String("spirit:enumeratedValues") ||
+            nodeName == QLatin1String("spirit:parameters") ||
+            nodeName == QLatin1String("spirit:writeValueConstraint") ||
+            nodeName == QLatin1String("spirit:vendorExtensions") ||
+            (nodeName == QLatin1String("spirit:bitWidth") && child.attributes().count() != 0))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::appendField()
+//-----------------------------------------------------------------------------
+void PackedRegisterTable::appendField(QDomNode const& fieldNode)
+{
+    int name = -1;
+    int displayName = -1;
+    int description = -1;
+    int typeIdentifier = -1;
+    int bitOffset = 0;
+    int bitWidth = 0;
+    General::Access access = General::ACCESS_COUNT;
+    General::ModifiedWrite modifiedWrite = General::MODIFIED_WRITE_COUNT;
+    General::ReadAction readAction = General::READ_ACTION_COUNT;
+    General::TestConstraint testConstraint = General::TEST_UNCONSTRAINED;
+    bool volatileValue = false;
+    bool testable = true;
+
+    QDomNodeList children = fieldNode.childNodes();
+    for (int i = 0; i < children.count(); ++i)
+    {
+        QDomNode child = children.at(i);
+        QString nodeName = child.nodeName();
+
+        if (nodeName == QLatin1String("spirit:name"))
+        {
+            name = intern(XmlUtils::removeWhiteSpace(textOf(child)));
+        }
+        else if (nodeName == QLatin1String("spirit:displayName"))
+        {
+            displayName = intern(textOf(child));
+        }
+        else if (nodeName == QLatin1String("spirit:description"))
+        {
+            description = intern(textOf(child));
+        }
+        else if (nodeName == QLatin1String("spirit:bitOffset"))
+        {
+            bitOffset = textOf(child).toInt();
+        }
+        else if (nodeName == QLatin1String("spirit:typeIdentifier"))
+        {
+            typeIdentifier = intern(XmlUtils::removeWhiteSpace(textOf(child)));
+        }
+        else if (nodeName == QLatin1String("spirit:bitWidth"))
+        {
+            bitWidth = textOf(child).toInt();
+        }
+        else if (nodeName == QLatin1String("spirit:volatile"))
+        {
+            volatileValue = General::str2Bool(textOf(child), false);
+        }
+        else if (nodeName == QLatin1String("spirit:access"))
+        {
+            access = General::str2Access(textOf(child), General::ACCESS_COUNT);
+        }
+        else if (nodeName == QLatin1String("spirit:modifiedWriteValue"))
+        {
+            modifiedWrite = General::str2ModifiedWrite(textOf(child));
+        }
+        else if (nodeName == QLatin1String("spirit:readAction"))
+        {
+            readAction = General::str2ReadAction(textOf(child));
+        }
+        else if (nodeName == QLatin1String("spirit:testable"))
+        {
+            testable = General::str2Bool(textOf(child), true);
+            testConstraint = General::str2TestConstraint(
+                child.attributes().namedItem("spirit:testConstraint").nodeValue());
+        }
+    }
+
+    quint8 flags = 0;
+    if (volatileValue)
+    {
+        flags |= FIELD_VOLATILE;
+    }
+    if (testable)
+    {
+        flags |= FIELD_TESTABLE;
+    }
+
+    fieldNames_.append(name);
+    fieldDisplayNames_.append(displayName);
+    fieldDescriptions_.append(description);
+    fieldTypeIdentifiers_.append(typeIdentifier);
+    bitOffsets_.append(bitOffset);
+    bitWidths_.append(bitWidth);
+    fieldAccesses_.append(quint8(access));
+    modifiedWrites_.append(quint8(modifiedWrite));
+    readActions_.append(quint8(readAction));
+    testConstraints_.append(quint8(testConstraint));
+    fieldFlags_.append(flags);
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::intern()
+//-----------------------------------------------------------------------------
+int PackedRegisterTable::intern(QString const& value)
+{
+    QHash<QString, int>::const_iterator existing = stringIndices_.constFind(value);
+    if (existing != stringIndices_.constEnd())
+    {
+        return existing.value();
+    }
+
+    int index = strings_.size();
+    strings_.append(value);
+    stringIndices_.insert(value, index);
+
+    return index;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::stringAt()
+//-----------------------------------------------------------------------------
+QString PackedRegisterTable::stringAt(int index) const
+{
+    if (index == -1)
+    {
+        return QString();
+    }
+
+    return strings_.at(index);
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::validate()
+//-----------------------------------------------------------------------------
+bool PackedRegisterTable::validate(int index, QStringList* errorList, QString const& parentIdentifier) const
+{
+    QString registerName = name(index);
+    unsigned int size = sizes_.at(index);
+
+    // The identifier is needed only for the error messages.
+    QString thisIdentifier;
+    if (errorList)
+    {
+        thisIdentifier = Register::getIdentifier(registerName);
+    }
+
+    bool valid = Register::isValidValues(registerName, addressOffset(index), errorList, parentIdentifier);
+
+    if (!RegisterDefinition::isValidSize(size, errorList, thisIdentifier))
+    {
+        valid = false;
+    }
+
+    // A register object has a reset element only if a reset value or mask was given.
+    QString resetValue = stringAt(resetValues_.at(index));
+    if ((!resetValue.isEmpty() || !stringAt(resetMasks_.at(index)).isEmpty()) &&
+        !Reset::isValidValue(resetValue, errorList, thisIdentifier))
+    {
+        valid = false;
+    }
+
+    for (int i = firstFields_.at(index); i < firstFields_.at(index + 1) && (valid || errorList); ++i)
+    {
+        if (!Field::isValidValues(stringAt(fieldNames_.at(i)), bitOffsets_.at(i), bitWidths_.at(i), size,
+            errorList, thisIdentifier))
+        {
+            valid = false;
+        }
+    }
+
+    return valid;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::writeField()
+//-----------------------------------------------------------------------------
+void PackedRegisterTable::writeField(QXmlStreamWriter& writer, int fieldIndex) const
+{
+    // The elements are written in the same order and under the same conditions as in Field::write().
+    writer.writeStartElement("spirit:field");
+
+    writer.writeTextElement("spirit:name", stringAt(fieldNames_.at(fieldIndex)));
+    writeOptionalElement(writer, "spirit:displayName", fieldDisplayNames_.at(fieldIndex));
+    writeOptionalElement(writer, "spirit:description", fieldDescriptions_.at(fieldIndex));
+    writer.writeTextElement("spirit:bitOffset", QString::number(bitOffsets_.at(fieldIndex)));
+    writeOptionalElement(writer, "spirit:typeIdentifier", fieldTypeIdentifiers_.at(fieldIndex));
+    writer.writeTextElement("spirit:bitWidth", QString::number(bitWidths_.at(fieldIndex)));
+
+    quint8 flags = fieldFlags_.at(fieldIndex);
+    writer.writeTextElement("spirit:volatile", General::bool2Str((flags & FIELD_VOLATILE) != 0));
+
+    General::Access access = General::Access(fieldAccesses_.at(fieldIndex));
+    if (access != General::ACCESS_COUNT)
+    {
+        writer.writeTextElement("spirit:access", General::access2Str(access));
+    }
+
+    General::ModifiedWrite modifiedWrite = General::ModifiedWrite(modifiedWrites_.at(fieldIndex));
+    if (modifiedWrite != General::MODIFIED_WRITE_COUNT)
+    {
+        writer.writeTextElement("spirit:modifiedWriteValue", General::modifiedWrite2Str(modifiedWrite));
+    }
+
+    General::ReadAction readAction = General::ReadAction(readActions_.at(fieldIndex));
+    if (readAction != General::READ_ACTION_COUNT)
+    {
+        writer.writeTextElement("spirit:readAction", General::readAction2Str(readAction));
+    }
+
+    bool testable = (flags & FIELD_TESTABLE) != 0;
+    writer.writeStartElement("spirit:testable");
+    if (testable)
+    {
+        writer.writeAttribute("spirit:testConstraint",
+            General::testConstraint2Str(General::TestConstraint(testConstraints_.at(fieldIndex))));
+    }
+    writer.writeCharacters(General::bool2Str(testable));
+    writer.writeEndElement(); // spirit:testable
+
+    writer.writeEndElement(); // spirit:field
+}
+
+//-----------------------------------------------------------------------------
+// Function: PackedRegisterTable::writeOptionalElement()
+//-----------------------------------------------------------------------------
+void PackedRegisterTable::writeOptionalElement(QXmlStreamWriter& writer, QString const& elementName,
+    int stringIndex) const
+{
+    QString value = stringAt(stringIndex);
+    if (!value.isEmpty())
+    {
+        writer.writeTextElement(elementName, value);
+    }
+}
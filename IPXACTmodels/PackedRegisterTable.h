@@ -0,0 +1,247 @@
+//-----------------------------------------------------------------------------
+// File: PackedRegisterTable.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Column-oriented storage for the registers of an address block.
+//-----------------------------------------------------------------------------
+
+#ifndef PACKEDREGISTERTABLE_H
+#define PACKEDREGISTERTABLE_H
+
+#include "generaldeclarations.h"
+#include "ipxactmodels_global.h"
+
+#include <QDomNode>
+#include <QHash>
+#include <QList>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QXmlStreamWriter>
+
+class Register;
+class RegisterModel;
+
+//-----------------------------------------------------------------------------
+//! Column-oriented storage for the registers of an address block.
+//
+// Generated register maps consist of a large number of plain registers and fields. The table stores
+// them in contiguous arrays of offsets, widths and access values with the names and descriptions in
+// a pool of unique strings, instead of allocating a Register and Field objects for each of them.
+// Only registers without parameters, alternate registers, enumerated values or vendor extensions can
+// be packed. The Register objects are created from the table when they are needed.
+//
+// The table is not changed after the registers have been appended, so it can be shared between the
+// copies of an address block.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT PackedRegisterTable
+{
+public:
+
+    //! The constructor.
+    PackedRegisterTable();
+
+    //! The destructor.
+    ~PackedRegisterTable();
+
+    /*!
+     *  Appends a register to the table, if it can be packed.
+     *
+     *      @param [in] registerNode    The spirit:register element to append.
+     *
+     *      @return True, if the register was appended, otherwise false.
+     */
+    bool append(QDomNode const& registerNode);
+
+    /*!
+     *  Returns the number of registers in the table.
+     */
+    int size() const;
+
+    /*!
+     *  Returns the number of fields in all the registers in the table.
+     */
+    int fieldCount() const;
+
+    /*!
+     *  Gets the name of the register in the given index.
+     */
+    QString name(int index) const;
+
+    /*!
+     *  Gets the address offset of the register in the given index.
+     */
+    QString addressOffset(int index) const;
+
+    /*!
+     *  Gets the dimension of the register in the given index or -1, if it is not defined.
+     */
+    int dim(int index) const;
+
+    /*!
+     *  Gets the size of the register in the given index.
+     */
+    int registerSize(int index) const;
+
+    /*!
+     *  Creates a register object of the register in the given index.
+     *
+     *      @param [in] index   The index of the register.
+     *
+     *      @return The created register.
+     */
+    QSharedPointer<Register> createRegister(int index) const;
+
+    /*!
+     *  Creates the register objects of all the registers in the table.
+     */
+    QList<QSharedPointer<RegisterModel> > createRegisters() const;
+
+    /*!
+     *  Checks if the register in the given index is valid, without creating the register object.
+     *  The rules and the error messages are shared with the register, reset and field objects.
+     *
+     *      @param [in] index               The index of the register.
+     *      @param [out] errorList          The error messages are appended to this list.
+     *      @param [in] parentIdentifier    Identifies the containing address block in the messages.
+     *
+     *      @return True, if the register is valid, otherwise false.
+     */
+    bool isValid(int index, QStringList& errorList, QString const& parentIdentifier) const;
+
+    /*!
+     *  Checks if the register in the given index is valid, without creating the register object.
+     *
+     *      @param [in] index   The index of the register.
+     *
+     *      @return True, if the register is valid, otherwise false.
+     */
+    bool isValid(int index) const;
+
+    /*!
+     *  Writes the register in the given index as a spirit:register element directly from the table.
+     *  The register is written exactly as the register object created from the table would write itself.
+     *
+     *      @param [in] writer  The writer to use.
+     *      @param [in] index   The index of the register.
+     */
+    void write(QXmlStreamWriter& writer, int index) const;
+
+private:
+
+    // Disable copying.
+    PackedRegisterTable(PackedRegisterTable const& rhs);
+    PackedRegisterTable& operator=(PackedRegisterTable const& rhs);
+
+    //! The flags of a packed field.
+    enum FieldFlag
+    {
+        FIELD_VOLATILE = 0x1,
+        FIELD_TESTABLE = 0x2
+    };
+
+    /*!
+     *  Checks if the given register element contains only the information stored in the table.
+     */
+    bool isPackable(QDomNode const& registerNode) const;
+
+    /*!
+     *  Checks if the given field element contains only the information stored in the table.
+     */
+    bool isPackableField(QDomNode const& fieldNode) const;
+
+    /*!
+     *  Appends a field to the table.
+     *
+     *      @param [in] fieldNode   The spirit:field element to append.
+     */
+    void appendField(QDomNode const& fieldNode);
+
+    /*!
+     *  Finds the index of the given string in the string pool and adds it, if it does not exist.
+     *
+     *      @param [in] value   The string to find.
+     *
+     *      @return The index of the string.
+     */
+    int intern(QString const& value);
+
+    /*!
+     *  Gets the string in the given index of the string pool or an empty string for index -1.
+     */
+    QString stringAt(int index) const;
+
+    /*!
+     *  Checks if the register in the given index is valid.
+     *
+     *      @param [in] index               The index of the register.
+     *      @param [out] errorList          The error messages are appended to this list or null, if not needed.
+     *      @param [in] parentIdentifier    Identifies the containing address block in the messages.
+     *
+     *      @return True, if the register is valid, otherwise false.
+     */
+    bool validate(int index, QStringList* errorList, QString const& parentIdentifier) const;
+
+    /*!
+     *  Writes the field in the given index as a spirit:field element.
+     *
+     *      @param [in] writer      The writer to use.
+     *      @param [in] fieldIndex  The index of the field in the field columns.
+     */
+    void writeField(QXmlStreamWriter& writer, int fieldIndex) const;
+
+    /*!
+     *  Writes an element with the string in the given index of the string pool, if the string is not empty.
+     *
+     *      @param [in] writer          The writer to use.
+     *      @param [in] elementName     The name of the element.
+     *      @param [in] stringIndex     The index of the string.
+     */
+    void writeOptionalElement(QXmlStreamWriter& writer, QString const& elementName, int stringIndex) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The unique names, descriptions and values of the registers and fields.
+    QVector<QString> strings_;
+
+    //! The indices of the strings in the pool.
+    QHash<QString, int> stringIndices_;
+
+    //! The register columns. The strings are stored as indices to the string pool, -1 for undefined.
+    QVector<int> registerNames_;
+    QVector<int> registerDisplayNames_;
+    QVector<int> registerDescriptions_;
+    QVector<int> registerTypeIdentifiers_;
+    QVector<int> addressOffsets_;
+    QVector<int> resetValues_;
+    QVector<int> resetMasks_;
+    QVector<int> dims_;
+    QVector<int> sizes_;
+    QVector<quint8> registerVolatiles_;
+    QVector<quint8> registerAccesses_;
+
+    //! The index of the first field of each register. The last item is the total number of fields.
+    QVector<int> firstFields_;
+
+    //! The field columns.
+    QVector<int> fieldNames_;
+    QVector<int> fieldDisplayNames_;
+    QVector<int> fieldDescriptions_;
+    QVector<int> fieldTypeIdentifiers_;
+    QVector<int> bitOffsets_;
+    QVector<int> bitWidths_;
+    QVector<quint8> fieldAccesses_;
+    QVector<quint8> modifiedWrites_;
+    QVector<quint8> readActions_;
+    QVector<quint8> testConstraints_;
+    QVector<quint8> fieldFlags_;
+};
+
+#endif // PACKEDREGISTERTABLE_H
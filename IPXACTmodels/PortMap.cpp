@@ -13,6 +13,7 @@
 
 #include "vector.h"
 #include "port.h"
+#include "StringPool.h"
 #include "XmlUtils.h"
 
 //-----------------------------------------------------------------------------
@@ -51,7 +52,7 @@ physicalVector_()
 					// get the logical name and strip whitespace characters
 					logicalPort_= tempNode.childNodes().at(j).childNodes().
 							at(0).nodeValue();
-					logicalPort_ = XmlUtils::removeWhiteSpace(logicalPort_);
+					logicalPort_ = StringPool::intern(XmlUtils::removeWhiteSpace(logicalPort_));
 				}
 
 				else if (tempNode.childNodes().at(j).nodeName() ==
@@ -75,7 +76,7 @@ physicalVector_()
 					// get the physical name and strip the whitespace characters
 					physicalPort_ = tempNode.childNodes().at(j).childNodes().
 							at(0).nodeValue();
-					physicalPort_ = XmlUtils::removeWhiteSpace(physicalPort_);
+					physicalPort_ = StringPool::intern(XmlUtils::removeWhiteSpace(physicalPort_));
 				}
 
 				else if (tempNode.childNodes().at(j).nodeName() ==
@@ -138,7 +139,7 @@ PortMap& PortMap::operator=( const PortMap& other )
 //-----------------------------------------------------------------------------
 // Function: PortMap::isValid()
 //-----------------------------------------------------------------------------
-bool PortMap::isValid( const QList<General::PortBounds>& physicalPorts, 
+bool PortMap::isValid(QHash<QString, General::PortBounds> const& physicalPorts, 
 							   QStringList& errorList, 
 							   const QString& parentIdentifier ) const
 {
@@ -186,30 +187,25 @@ bool PortMap::isValid( const QList<General::PortBounds>& physicalPorts,
 	// if there is a physical port specified
 	if (!physicalPort_.isEmpty()) {
 		
-		bool foundPhysPort = false;
-		foreach (General::PortBounds port, physicalPorts) {
-
-			// if the referenced physical port was found
-			if (port.portName_ == physicalPort_) {
-				foundPhysPort = true;
-
-				// calculate the size of the actual physical port.
-				int actualPortSize = port.left_ - port.right_ + 1;
-
-				// if the actual port size is smaller than the referenced vector in 
-				// the port map
-				if (actualPortSize < physSize) {
-					errorList.append(QObject::tr("The port map within %1 is larger"
-						" than the actual size of the port %2.").arg(
-						parentIdentifier).arg(physicalPort_));
-					valid = false;
-				}
+		QHash<QString, General::PortBounds>::const_iterator port = physicalPorts.constFind(physicalPort_);
+
+		// if the referenced physical port was found
+		if (port != physicalPorts.constEnd()) {
+
+			// calculate the size of the actual physical port.
+			int actualPortSize = port->left_ - port->right_ + 1;
 
-				break;
+			// if the actual port size is smaller than the referenced vector in 
+			// the port map
+			if (actualPortSize < physSize) {
+				errorList.append(QObject::tr("The port map within %1 is larger"
+					" than the actual size of the port %2.").arg(
+					parentIdentifier).arg(physicalPort_));
+				valid = false;
 			}
 		}
 		// if the referenced port was not found within the component
-		if (!foundPhysPort) {
+		else {
 			errorList.append(QObject::tr("The port map within %1 contained reference to"
 				" physical port %2 which is not found in the component.").arg(
 				parentIdentifier).arg(physicalPort_));
@@ -223,7 +219,7 @@ bool PortMap::isValid( const QList<General::PortBounds>& physicalPorts,
 //-----------------------------------------------------------------------------
 // Function: PortMap::isValid()
 //-----------------------------------------------------------------------------
-bool PortMap::isValid( const QList<General::PortBounds>& physicalPorts ) const
+bool PortMap::isValid(QHash<QString, General::PortBounds> const& physicalPorts) const
 {
 	if (physicalPort_.isEmpty()) {
 		return false;
@@ -259,27 +255,19 @@ bool PortMap::isValid( const QList<General::PortBounds>& physicalPorts ) const
 	// if there is a physical port specified
 	if (!physicalPort_.isEmpty()) {
 
-		bool foundPhysPort = false;
-		foreach (General::PortBounds port, physicalPorts) {
-
-			// if the referenced physical port was found
-			if (port.portName_ == physicalPort_) {
-				foundPhysPort = true;
+		QHash<QString, General::PortBounds>::const_iterator port = physicalPorts.constFind(physicalPort_);
 
-				// calculate the size of the actual physical port.
-				int actualPortSize = abs(port.left_ - port.right_) + 1;
+		// if the referenced port was not found within the component
+		if (port == physicalPorts.constEnd()) {
+			return false;
+		}
 
-				// if the actual port size is smaller than the referenced vector in 
-				// the port map
-				if (actualPortSize < physSize) {
-					return false;
-				}
+		// calculate the size of the actual physical port.
+		int actualPortSize = abs(port->left_ - port->right_) + 1;
 
-				break;
-			}
-		}
-		// if the referenced port was not found within the component
-		if (!foundPhysPort) {
+		// if the actual port size is smaller than the referenced vector in 
+		// the port map
+		if (actualPortSize < physSize) {
 			return false;
 		}
 	}
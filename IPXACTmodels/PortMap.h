@@ -16,6 +16,7 @@
 
 #include "generaldeclarations.h"
 
+#include <QHash>
 #include <QSharedPointer>
 
 class Port;
@@ -63,23 +64,23 @@ public:
 
 	/*! \brief Check if the port map is in a valid state.
 	 *
-	 * \param physicalPorts List of the physical ports of the component and their bounds.
+	 * \param physicalPorts The bounds of the physical ports of the component by the port names.
 	 * \param errorList The list to add the possible error messages to.
 	 * \param parentIdentifier String from parent to help to identify the location of the error.
 	 *
 	 * \return bool True if the state is valid and writing is possible.
 	*/
-	bool isValid(const QList<General::PortBounds>& physicalPorts, 
+	bool isValid(QHash<QString, General::PortBounds> const& physicalPorts, 
 		QStringList& errorList, 
 		const QString& parentIdentifier) const;
 
 	/*! \brief Check if the port map is in a valid state.
 	 * 
-	 * \param physicalPorts List of the physical ports of the component and their bounds.
+	 * \param physicalPorts The bounds of the physical ports of the component by the port names.
 	 * 
 	 * \return bool True if the state is valid and writing is possible.
 	*/
-	bool isValid(const QList<General::PortBounds>& physicalPorts) const;
+	bool isValid(QHash<QString, General::PortBounds> const& physicalPorts) const;
 
 
     /*!
@@ -171,7 +171,7 @@ void SWView::write( QXmlStreamWriter& writer, bool withinHWComp ) {
 //-----------------------------------------------------------------------------
 // Function: SWView::isValid()
 //-----------------------------------------------------------------------------
-bool SWView::isValid(const QStringList& fileSetNames, const QStringList& cpuNames, QStringList& errorList,
+bool SWView::isValid(const QSet<QString>& fileSetNames, const QSet<QString>& cpuNames, QStringList& errorList,
     const QString& parentIdentifier) const
 {
     bool valid = true;
@@ -218,7 +218,7 @@ bool SWView::isValid(const QStringList& fileSetNames, const QStringList& cpuName
 //-----------------------------------------------------------------------------
 // Function: SWView::isValid()
 //-----------------------------------------------------------------------------
-bool SWView::isValid(const QStringList& fileSetNames, const QStringList& cpuNames) const
+bool SWView::isValid(const QSet<QString>& fileSetNames, const QSet<QString>& cpuNames) const
 {
     if (nameGroup_.name().isEmpty())
     {
@@ -26,6 +26,7 @@
 #include <QDomNode>
 #include <QXmlStreamWriter>
 #include <QStringList>
+#include <QSet>
 #include <QList>
 
 //-----------------------------------------------------------------------------
@@ -86,8 +87,8 @@ public:
 	 *
 	 *      @return True if contents are valid.
 	 */
-	bool isValid(const QStringList& fileSetNames,
-		const QStringList& cpuNames,
+	bool isValid(const QSet<QString>& fileSetNames,
+		const QSet<QString>& cpuNames,
 		QStringList& errorList, 
 		QString const& parentIdentifier) const;
 
@@ -99,8 +100,8 @@ public:
 	 * 
 	 *      @return True if contents are valid.
 	*/
-	bool isValid(const QStringList& fileSetNames,
-		const QStringList& cpuNames) const;
+	bool isValid(const QSet<QString>& fileSetNames,
+		const QSet<QString>& cpuNames) const;
 
 	/*! \brief Get pointer to the hierarchical design for this view
 	 *
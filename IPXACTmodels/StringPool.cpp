@@ -0,0 +1,78 @@
+//-----------------------------------------------------------------------------
+// File: StringPool.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Global pool of the identifier strings shared by the IP-XACT models.
+//-----------------------------------------------------------------------------
+
+#include "StringPool.h"
+
+#include <QReadLocker>
+#include <QReadWriteLock>
+#include <QSet>
+#include <QWriteLocker>
+
+namespace
+{
+    //! The pooled strings.
+    Q_GLOBAL_STATIC(QSet<QString>, pooledStrings)
+
+    //! The lock guarding the pooled strings.
+    Q_GLOBAL_STATIC(QReadWriteLock, poolLock)
+}
+
+//-----------------------------------------------------------------------------
+// Function: StringPool::intern()
+//-----------------------------------------------------------------------------
+QString StringPool::intern(QString const& value)
+{
+    // Null and empty strings are already shared by QString.
+    if (value.isEmpty())
+    {
+        return value;
+    }
+
+    {
+        QReadLocker readLocker(poolLock());
+
+        QSet<QString>::const_iterator pooled = pooledStrings()->constFind(value);
+        if (pooled != pooledStrings()->constEnd())
+        {
+            return *pooled;
+        }
+    }
+
+    QWriteLocker writeLocker(poolLock());
+
+    // Another thread may have added the string after the read lock was released.
+    QSet<QString>::const_iterator pooled = pooledStrings()->constFind(value);
+    if (pooled != pooledStrings()->constEnd())
+    {
+        return *pooled;
+    }
+
+    pooledStrings()->insert(value);
+    return value;
+}
+
+//-----------------------------------------------------------------------------
+// Function: StringPool::size()
+//-----------------------------------------------------------------------------
+int StringPool::size()
+{
+    QReadLocker readLocker(poolLock());
+    return pooledStrings()->size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: StringPool::clear()
+//-----------------------------------------------------------------------------
+void StringPool::clear()
+{
+    QWriteLocker writeLocker(poolLock());
+    pooledStrings()->clear();
+}
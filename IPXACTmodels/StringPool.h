@@ -0,0 +1,62 @@
+//-----------------------------------------------------------------------------
+// File: StringPool.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Global pool of the identifier strings shared by the IP-XACT models.
+//-----------------------------------------------------------------------------
+
+#ifndef STRINGPOOL_H
+#define STRINGPOOL_H
+
+#include "ipxactmodels_global.h"
+
+#include <QString>
+
+//-----------------------------------------------------------------------------
+//! Global pool of the identifier strings shared by the IP-XACT models.
+//
+// Names, ids, file types and other enumeration-like values repeat in almost every document of the
+// library. The models read from the documents store the instance of the string found in the pool, so
+// that equal identifiers share the same data. Comparing two pooled strings is then a pointer compare,
+// since QString checks for shared data before comparing the characters.
+//
+// The pool may be used from several threads at the same time. The pool only grows while the library is
+// in use, so the library clears it whenever the library is scanned again.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT StringPool
+{
+public:
+
+    /*!
+     *  Finds the pooled instance of the given string and adds the string to the pool, if not found.
+     *
+     *      @param [in] value   The string to find.
+     *
+     *      @return The pooled string equal to the given value.
+     */
+    static QString intern(QString const& value);
+
+    /*!
+     *  Returns the number of strings in the pool.
+     */
+    static int size();
+
+    /*!
+     *  Removes all the strings from the pool. The strings already stored in the models are not affected.
+     */
+    static void clear();
+
+private:
+
+    // The pool is used only through the static functions.
+    StringPool();
+    ~StringPool();
+    StringPool(StringPool const& rhs);
+    StringPool& operator=(StringPool const& rhs);
+};
+
+#endif // STRINGPOOL_H
@@ -126,7 +126,7 @@ void SystemView::write(QXmlStreamWriter& writer)
 //-----------------------------------------------------------------------------
 // Function: SystemView::isValid()
 //-----------------------------------------------------------------------------
-bool SystemView::isValid(const QStringList& fileSetNames, const QStringList& HWViewNames,
+bool SystemView::isValid(const QSet<QString>& fileSetNames, const QSet<QString>& HWViewNames,
     QStringList& errorList, const QString& parentIdentifier) const
 {
     bool valid = true;
@@ -168,7 +168,7 @@ bool SystemView::isValid(const QStringList& fileSetNames, const QStringList& HWV
 //-----------------------------------------------------------------------------
 // Function: SystemView::isValid()
 //-----------------------------------------------------------------------------
-bool SystemView::isValid(const QStringList& fileSetNames, const QStringList& HWViewNames) const
+bool SystemView::isValid(const QSet<QString>& fileSetNames, const QSet<QString>& HWViewNames) const
 {
     if (nameGroup_.name().isEmpty())
     {
@@ -22,6 +22,7 @@
 #include <QDomNode>
 #include <QXmlStreamWriter>
 #include <QStringList>
+#include <QSet>
 
 //-----------------------------------------------------------------------------
 //! System view class for making VLNV references to system designs.
@@ -80,7 +81,7 @@ public:
 	 *
 	 *      @return True if contents are valid.
 	 */
-	bool isValid(const QStringList& fileSetNames, const QStringList& HWViewNames, QStringList& errorList,
+	bool isValid(const QSet<QString>& fileSetNames, const QSet<QString>& HWViewNames, QStringList& errorList,
         QString const& parentIdentifier) const;
 
 	/*!
@@ -91,7 +92,7 @@ public:
 	 * 
 	 *      @return True if contents are valid.
 	*/
-	bool isValid(const QStringList& fileSetNames, const QStringList& HWViewNames) const;
+	bool isValid(const QSet<QString>& fileSetNames, const QSet<QString>& HWViewNames) const;
 
     /*! \brief Set the hierarchyRef for this view
 	 *
@@ -10,6 +10,7 @@
 //-----------------------------------------------------------------------------
 
 #include "XmlUtils.h"
+#include "StringPool.h"
 #include "VendorExtension.h"
 
 #include <QTextStream>
@@ -64,7 +65,7 @@ namespace XmlUtils
                 QString name = attributeMap.item(j).nodeName();
                 QString value = attributeMap.item(j).nodeValue();
 
-                map.insert(name, value);
+                map.insert(StringPool::intern(name), value);
             }            
         return map;
     }
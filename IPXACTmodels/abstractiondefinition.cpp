@@ -135,7 +135,7 @@ QSharedPointer<LibraryComponent> AbstractionDefinition::clone() const {
 	return QSharedPointer<LibraryComponent>(new AbstractionDefinition(*this));
 }
 
-void AbstractionDefinition::write(QFile& file) {
+void AbstractionDefinition::write(QIODevice& file) {
 	// create a writer instance and set it to operate on the given file
 	QXmlStreamWriter writer(&file);
 
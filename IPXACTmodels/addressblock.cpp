@@ -11,6 +11,7 @@
 #include "parameter.h"
 #include "registerfile.h"
 #include "register.h"
+#include "PackedRegisterTable.h"
 #include "XmlUtils.h"
 
 #include <common/utils.h>
@@ -18,6 +19,8 @@
 #include <QString>
 #include <QStringList>
 #include <QMap>
+#include <QSet>
+#include <QMutexLocker>
 #include <QDomNode>
 #include <QDomNamedNodeMap>
 #include <QSharedPointer>
@@ -33,7 +36,9 @@ width_(-1),
 widthAttributes_(),
 memoryBlockData_(),
 registerData_(),
-vendorExtensions_()
+vendorExtensions_(),
+packedRegisters_(),
+registerMutex_()
 {
 
 	for (int i = 0; i < memoryMapNode.childNodes().count(); ++i) {
@@ -89,8 +94,7 @@ vendorExtensions_()
 			}
 		}
 		else if (tempNode.nodeName() == QString("spirit:register")) {
-			registerData_.append(QSharedPointer<Register>(
-					new Register(tempNode)));
+			addRegister(tempNode);
 		}
 
         else if (tempNode.nodeName() == QString("spirit:vendorExtensions")) 
@@ -112,7 +116,9 @@ width_(-1),
 widthAttributes_(),
 memoryBlockData_(),
 registerData_(),
-vendorExtensions_()
+vendorExtensions_(),
+packedRegisters_(),
+registerMutex_()
 {
 
 }
@@ -125,10 +131,15 @@ width_(other.width_),
 widthAttributes_(other.widthAttributes_),
 memoryBlockData_(other.memoryBlockData_),
 registerData_(),
-vendorExtensions_(other.vendorExtensions_)
+vendorExtensions_(other.vendorExtensions_),
+packedRegisters_(),
+registerMutex_()
 {
+    // The other block may be read from another thread at the same time.
+    QList<QSharedPointer<RegisterModel> > otherRegisters;
+    other.getRegisterSnapshot(packedRegisters_, otherRegisters);
 
-	foreach (QSharedPointer<RegisterModel> regModel, other.registerData_) {
+	foreach (QSharedPointer<RegisterModel> regModel, otherRegisters) {
 		if (regModel) {
 			QSharedPointer<RegisterModel> copy = regModel->clone();
 			registerData_.append(copy);
@@ -146,8 +157,11 @@ AddressBlock & AddressBlock::operator=( const AddressBlock &other ) {
 		memoryBlockData_ = other.memoryBlockData_;
         vendorExtensions_ = other.vendorExtensions_;
 
+        QList<QSharedPointer<RegisterModel> > otherRegisters;
+        other.getRegisterSnapshot(packedRegisters_, otherRegisters);
+
 		registerData_.clear();
-		foreach (QSharedPointer<RegisterModel> regModel, other.registerData_) {
+		foreach (QSharedPointer<RegisterModel> regModel, otherRegisters) {
 			if (regModel) {
 				QSharedPointer<RegisterModel> copy = regModel->clone();
 				registerData_.append(copy);
@@ -192,8 +206,20 @@ void AddressBlock::write(QXmlStreamWriter& writer) {
 
 	memoryBlockData_.write(writer);
 
-	for (int i = 0; i < registerData_.size(); ++i) {
-		registerData_.at(i)->write(writer);
+    QSharedPointer<PackedRegisterTable> packedRegisters;
+    QList<QSharedPointer<RegisterModel> > registers;
+    getRegisterSnapshot(packedRegisters, registers);
+
+    if (packedRegisters)
+    {
+        for (int i = 0; i < packedRegisters->size(); ++i)
+        {
+            packedRegisters->write(writer, i);
+        }
+    }
+
+	for (int i = 0; i < registers.size(); ++i) {
+		registers.at(i)->write(writer);
 	}
 
     if (!vendorExtensions_.isEmpty())
@@ -245,7 +271,11 @@ bool AddressBlock::isValid(QSharedPointer<QList<QSharedPointer<Choice> > > compo
 		valid = false;
 	}
 
-    if (!registerData_.empty() &&
+    QSharedPointer<PackedRegisterTable> packedRegisters;
+    QList<QSharedPointer<RegisterModel> > registers;
+    getRegisterSnapshot(packedRegisters, registers);
+
+    if ((registers.size() != 0 || packedRegisters) &&
         (memoryBlockData_.getUsage() == General::RESERVED || memoryBlockData_.getUsage() == General::MEMORY))
     {
         errorList.append(QObject::tr("%1 with usage %2 must not contain registers").arg(
@@ -253,8 +283,30 @@ bool AddressBlock::isValid(QSharedPointer<QList<QSharedPointer<Choice> > > compo
         valid = false;
     }
 
-    QStringList registerNames;
-	foreach (QSharedPointer<RegisterModel> regModel, registerData_)
+    // The packed registers are validated from the register table without creating the register objects.
+    QSet<QString> registerNames;
+    int packedCount = packedRegisters ? packedRegisters->size() : 0;
+    for (int i = 0; i < packedCount; ++i)
+    {
+        QString registerName = packedRegisters->name(i);
+        if (registerNames.contains(registerName))
+        {
+            errorList.append(QObject::tr("%1 contains multiple registers with name %2").arg(
+                thisIdentifier, registerName));
+            valid = false;
+        }
+        else
+        {
+            registerNames.insert(registerName);
+        }
+
+        if (!packedRegisters->isValid(i, errorList, thisIdentifier))
+        {
+            valid = false;
+        }
+    }
+
+    foreach (QSharedPointer<RegisterModel> regModel, registers)
     {
         if (registerNames.contains(regModel->getName()))
         {
@@ -264,7 +316,7 @@ bool AddressBlock::isValid(QSharedPointer<QList<QSharedPointer<Choice> > > compo
         }
         else
         {
-            registerNames.append(regModel->getName());
+            registerNames.insert(regModel->getName());
         }
 
 		if (!regModel->isValid(componentChoices, errorList, thisIdentifier))
@@ -303,14 +355,30 @@ bool AddressBlock::isValid(QSharedPointer<QList<QSharedPointer<Choice> > > compo
 		return false;
 	}
 
-    if (!registerData_.empty() &&
+    QSharedPointer<PackedRegisterTable> packedRegisters;
+    QList<QSharedPointer<RegisterModel> > registers;
+    getRegisterSnapshot(packedRegisters, registers);
+
+    if ((registers.size() != 0 || packedRegisters) &&
         (memoryBlockData_.getUsage() == General::RESERVED || memoryBlockData_.getUsage() == General::MEMORY))
     {
         return false;
     }
 
-    QStringList registerNames;
-	foreach (QSharedPointer<RegisterModel> regModel, registerData_)
+    QSet<QString> registerNames;
+    int packedCount = packedRegisters ? packedRegisters->size() : 0;
+    for (int i = 0; i < packedCount; ++i)
+    {
+        QString registerName = packedRegisters->name(i);
+        if (registerNames.contains(registerName) || !packedRegisters->isValid(i))
+        {
+            return false;
+        }
+
+        registerNames.insert(registerName);
+    }
+
+    foreach (QSharedPointer<RegisterModel> regModel, registers)
     {
         if (registerNames.contains(regModel->getName()))
         {
@@ -318,7 +386,7 @@ bool AddressBlock::isValid(QSharedPointer<QList<QSharedPointer<Choice> > > compo
         }
         else
         {
-            registerNames.append(regModel->getName());
+            registerNames.insert(regModel->getName());
         }
 
 		if (!regModel->isValid(componentChoices))
@@ -378,10 +446,22 @@ QString AddressBlock::getLastAddressStr() const {
 }
 
 quint64 AddressBlock::getLastRegisterAddress() const {
+	QSharedPointer<PackedRegisterTable> packedRegisters;
+	QList<QSharedPointer<RegisterModel> > registers;
+	getRegisterSnapshot(packedRegisters, registers);
+
 	quint64 lastOffset = 0;
+
+    if (packedRegisters)
+    {
+        for (int i = 0; i < packedRegisters->size(); ++i)
+        {
+            lastOffset = qMax(lastOffset, General::str2Uint(packedRegisters->addressOffset(i)));
+        }
+    }
 	
 	// check all register models
-	foreach (QSharedPointer<RegisterModel> regModel, registerData_) {
+	foreach (QSharedPointer<RegisterModel> regModel, registers) {
 		
 		// and find registers 
 		QSharedPointer<Register> reg = regModel.dynamicCast<Register>();
@@ -403,7 +483,19 @@ QStringList AddressBlock::getAllRegisterOffsets()
 {
     QStringList registerOffsets;
 
-    foreach (QSharedPointer<RegisterModel> regModel, registerData_)
+    QSharedPointer<PackedRegisterTable> packedRegisters;
+    QList<QSharedPointer<RegisterModel> > registers;
+    getRegisterSnapshot(packedRegisters, registers);
+
+    if (packedRegisters)
+    {
+        for (int i = 0; i < packedRegisters->size(); ++i)
+        {
+            registerOffsets.append(packedRegisters->addressOffset(i));
+        }
+    }
+
+    foreach (QSharedPointer<RegisterModel> regModel, registers)
     {
         QSharedPointer<Register> reg = regModel.dynamicCast<Register>();
         if (reg)
@@ -420,8 +512,17 @@ QStringList AddressBlock::getAllRegisterOffsets()
 //-----------------------------------------------------------------------------
 int AddressBlock::getLastRegisterDimension(int lastRegisterIndex)
 {
-    QSharedPointer<RegisterModel> regModel = registerData_.at(lastRegisterIndex);
-    QSharedPointer<Register> reg = regModel.dynamicCast<Register>();
+    QSharedPointer<PackedRegisterTable> packedRegisters;
+    QList<QSharedPointer<RegisterModel> > registers;
+    getRegisterSnapshot(packedRegisters, registers);
+
+    int packedCount = packedRegisters ? packedRegisters->size() : 0;
+    if (lastRegisterIndex < packedCount)
+    {
+        return packedRegisters->dim(lastRegisterIndex);
+    }
+
+    QSharedPointer<Register> reg = registers.at(lastRegisterIndex - packedCount).dynamicCast<Register>();
     return reg->getDim();
 }
 
@@ -430,8 +531,17 @@ int AddressBlock::getLastRegisterDimension(int lastRegisterIndex)
 //-----------------------------------------------------------------------------
 int AddressBlock::getLastRegisterSize(int lastRegisterIndex)
 {
-    QSharedPointer<RegisterModel> regModel = registerData_.at(lastRegisterIndex);
-    QSharedPointer<Register> reg = regModel.dynamicCast<Register>();
+    QSharedPointer<PackedRegisterTable> packedRegisters;
+    QList<QSharedPointer<RegisterModel> > registers;
+    getRegisterSnapshot(packedRegisters, registers);
+
+    int packedCount = packedRegisters ? packedRegisters->size() : 0;
+    if (lastRegisterIndex < packedCount)
+    {
+        return packedRegisters->registerSize(lastRegisterIndex);
+    }
+
+    QSharedPointer<Register> reg = registers.at(lastRegisterIndex - packedCount).dynamicCast<Register>();
     return reg->getSize();
 }
 
@@ -528,19 +638,131 @@ void AddressBlock::setParameters(
 }
 
 QList<QSharedPointer<RegisterModel> >* AddressBlock::getRegisterPointer() {
+    unpackRegisters();
 	return &registerData_;
 }
 
 QList<QSharedPointer<RegisterModel> >& AddressBlock::getRegisterData() {
+    unpackRegisters();
 	return registerData_;
 }
 
 const QList<QSharedPointer<RegisterModel> >& AddressBlock::getRegisterData() const {
+    unpackRegisters();
 	return registerData_;
 }
 
+//-----------------------------------------------------------------------------
+// Function: addressblock::addRegister()
+//-----------------------------------------------------------------------------
+void AddressBlock::addRegister(QDomNode& registerNode)
+{
+    // Only the registers before the first register that cannot be packed are packed to keep the order.
+    if (registerData_.isEmpty())
+    {
+        if (!packedRegisters_)
+        {
+            packedRegisters_ = QSharedPointer<PackedRegisterTable>(new PackedRegisterTable());
+        }
+
+        if (packedRegisters_->append(registerNode))
+        {
+            return;
+        }
+
+        if (packedRegisters_->size() == 0)
+        {
+            packedRegisters_.clear();
+        }
+    }
+
+    registerData_.append(QSharedPointer<Register>(new Register(registerNode)));
+}
+
+//-----------------------------------------------------------------------------
+// Function: addressblock::takeRegisters()
+//-----------------------------------------------------------------------------
+void AddressBlock::takeRegisters(AddressBlock& other)
+{
+    if (registerCount() == 0)
+    {
+        packedRegisters_ = other.packedRegisters_;
+        registerData_ = other.registerData_;
+    }
+    else
+    {
+        getRegisterData().append(other.getRegisterData());
+    }
+
+    other.packedRegisters_.clear();
+    other.registerData_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: addressblock::unpackRegisters()
+//-----------------------------------------------------------------------------
+void AddressBlock::unpackRegisters() const
+{
+    QMutexLocker locker(&registerMutex_);
+
+    if (packedRegisters_)
+    {
+        QList<QSharedPointer<RegisterModel> > registers = packedRegisters_->createRegisters();
+        registers.append(registerData_);
+
+        registerData_ = registers;
+        packedRegisters_.clear();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: addressblock::getRegisterSnapshot()
+//-----------------------------------------------------------------------------
+void AddressBlock::getRegisterSnapshot(QSharedPointer<PackedRegisterTable>& packedRegisters,
+    QList<QSharedPointer<RegisterModel> >& registers) const
+{
+    // The copies share the data with the members, so taking them is cheap.
+    QMutexLocker locker(&registerMutex_);
+    packedRegisters = packedRegisters_;
+    registers = registerData_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: addressblock::registerCount()
+//-----------------------------------------------------------------------------
+int AddressBlock::registerCount() const
+{
+    QSharedPointer<PackedRegisterTable> packedRegisters;
+    QList<QSharedPointer<RegisterModel> > registers;
+    getRegisterSnapshot(packedRegisters, registers);
+
+    if (packedRegisters)
+    {
+        return packedRegisters->size() + registers.size();
+    }
+
+    return registers.size();
+}
+
 bool AddressBlock::uniqueRegisterNames( QStringList& regNames ) const {
-	foreach (QSharedPointer<RegisterModel> reg, registerData_) {
+    QSharedPointer<PackedRegisterTable> packedRegisters;
+    QList<QSharedPointer<RegisterModel> > registers;
+    getRegisterSnapshot(packedRegisters, registers);
+
+    if (packedRegisters)
+    {
+        for (int i = 0; i < packedRegisters->size(); ++i)
+        {
+            const QString regName = packedRegisters->name(i);
+            if (regNames.contains(regName)) {
+                return false;
+            }
+
+            regNames.append(regName);
+        }
+    }
+
+	foreach (QSharedPointer<RegisterModel> reg, registers) {
 		const QString regName = reg->getName();
 
 		// the register name was not unique
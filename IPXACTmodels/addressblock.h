@@ -17,12 +17,14 @@
 #include <QDomNode>
 #include <QString>
 #include <QMap>
+#include <QMutex>
 #include <QSharedPointer>
 #include <QXmlStreamWriter>
 
 class Choice;
 class RegisterModel;
 class MemoryBlockData;
+class PackedRegisterTable;
 class VendorExtension;
 
 /*! \brief Equals to spirit:addressBlock element in IP-Xact specification.
@@ -316,8 +318,49 @@ public:
 	*/
 	const QList<QSharedPointer<RegisterModel> >& getRegisterData() const;
 
+    /*!
+     *  Adds a register read from the given element to the end of the address block.
+     *
+     *  The plain registers at the beginning of the address block are stored in a packed table and the
+     *  register objects for them are created only when the register data is accessed. This function is
+     *  meant for reading the address block, since the table may be shared with the copies of the block.
+     *
+     *      @param [in] registerNode    The spirit:register element.
+     */
+    void addRegister(QDomNode& registerNode);
+
+    /*!
+     *  Moves the registers of the given address block to the end of this address block.
+     *
+     *      @param [in] other   The address block to take the registers from.
+     */
+    void takeRegisters(AddressBlock& other);
+
+    /*!
+     *  Returns the number of registers including the packed registers without creating the register
+     *  objects for them.
+     */
+    int registerCount() const;
+
 private:
 
+    /*!
+     *  Creates the register objects for the packed registers.
+     *
+     *  Also the const accessors unpack the registers, so the unpacking is guarded by registerMutex_.
+     *  The functions reading the packed registers use getRegisterSnapshot() to see them consistently.
+     */
+    void unpackRegisters() const;
+
+    /*!
+     *  Gets the packed registers and the register objects following them under registerMutex_.
+     *
+     *      @param [out] packedRegisters    The packed registers or null, if there are none.
+     *      @param [out] registers          The register objects following the packed registers.
+     */
+    void getRegisterSnapshot(QSharedPointer<PackedRegisterTable>& packedRegisters,
+        QList<QSharedPointer<RegisterModel> >& registers) const;
+
 	/*!
 	 * MANDATORY (spirit:range)
 	 * Range of an address block. Expressed as the number of addressable units.
@@ -356,7 +399,7 @@ private:
 	 * Group contains information about the grouping of bits into registers and
 	 * fields.
 	 */
-	QList<QSharedPointer<RegisterModel> > registerData_;
+	mutable QList<QSharedPointer<RegisterModel> > registerData_;
 
     /*!
 	 * OPTIONAL (spirit: vendorExtensions)
@@ -364,6 +407,12 @@ private:
 	 */
     QList<QSharedPointer<VendorExtension> > vendorExtensions_;
 
+    //! The packed registers preceding the registers in registerData_ or null, if there are none.
+    mutable QSharedPointer<PackedRegisterTable> packedRegisters_;
+
+    //! Guards unpacking the packed registers against the concurrent readers of the address block.
+    mutable QMutex registerMutex_;
+
 };
 
 #endif /* ADDRESSBLOCK_H_ */
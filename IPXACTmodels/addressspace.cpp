@@ -263,7 +263,7 @@ void AddressSpace::write(QXmlStreamWriter& writer) {
 // Function: addressspace::isValid()
 //-----------------------------------------------------------------------------
 bool AddressSpace::isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices,
-    QStringList remapStateNames, QStringList& errorList, const QString& parentIdentifier ) const
+    const QSet<QString>& remapStateNames, QStringList& errorList, const QString& parentIdentifier ) const
 {
 	bool valid = true;
 	const QString thisIdentifier(QObject::tr("address space %1").arg(nameGroup_.name()));
@@ -319,7 +319,7 @@ bool AddressSpace::isValid(QSharedPointer<QList<QSharedPointer<Choice> > > compo
 // Function: addressspace::isValid()
 //-----------------------------------------------------------------------------
 bool AddressSpace::isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices,
-    QStringList remapStateNames) const
+    const QSet<QString>& remapStateNames) const
 {
 	if (nameGroup_.name().isEmpty()) {
 		return false;
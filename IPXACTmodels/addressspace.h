@@ -17,6 +17,7 @@
 #include <QString>
 #include <QList>
 #include <QMap>
+#include <QSet>
 #include <QXmlStreamWriter>
 
 class Choice;
@@ -77,7 +78,7 @@ public:
      *
      *      @return True if the state isvalid and writing is possible.
 	 */
-	bool isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices, QStringList remapStateNames,
+	bool isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices, const QSet<QString>& remapStateNames,
         QStringList& errorList, const QString& parentIdentifier) const;
 
 	/*!
@@ -88,7 +89,7 @@ public:
      *
      *      @return True, if the state is valid and writing is possible, false otherwise.
 	 */
-	bool isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices, QStringList remapStateNames)
+	bool isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices, const QSet<QString>& remapStateNames)
         const;
 
 	/*! \brief Get the address unit bits
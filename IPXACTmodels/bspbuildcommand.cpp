@@ -80,7 +80,7 @@ void BSPBuildCommand::write( QXmlStreamWriter& writer ) {
 	writer.writeEndElement(); // kactus2:BSPBuildCommand
 }
 
-bool BSPBuildCommand::isValid( const QStringList& cpuNames, QStringList& errorList, const QString& parentIdentifier ) const {
+bool BSPBuildCommand::isValid( const QSet<QString>& cpuNames, QStringList& errorList, const QString& parentIdentifier ) const {
 	
 	// if the cpu name refers to non-existing CPU
 	if (!cpuName_.isEmpty() && !cpuNames.contains(cpuName_)) {
@@ -92,7 +92,7 @@ bool BSPBuildCommand::isValid( const QStringList& cpuNames, QStringList& errorLi
 	return true;
 }
 
-bool BSPBuildCommand::isValid( const QStringList& cpuNames ) const {
+bool BSPBuildCommand::isValid( const QSet<QString>& cpuNames ) const {
 	
 	// if the cpu name refers to non-existing CPU
 	if (!cpuName_.isEmpty() && !cpuNames.contains(cpuName_)) {
@@ -13,6 +13,7 @@
 #include <QDomNode>
 #include <QXmlStreamWriter>
 #include <QStringList>
+#include <QSet>
 #include <QString>
 
 /*! \brief Equals the kactus2:BSPBuildCommand in Kactus2 extensions.
@@ -70,13 +71,13 @@ public:
 	*
 	* \return bool True if the state is valid and writing is possible.
 	*/
-	bool isValid(const QStringList& cpuNames, QStringList& errorList, const QString& parentIdentifier) const;
+	bool isValid(const QSet<QString>& cpuNames, QStringList& errorList, const QString& parentIdentifier) const;
 
 	/*! \brief Check if the build command is in a valid state.
 	 *
 	 * \return bool True if the state is valid and writing is possible.
 	*/
-	bool isValid(const QStringList& cpuNames) const;
+	bool isValid(const QSet<QString>& cpuNames) const;
 
 	/*! \brief Check if there is anything specified for the BSP build command.
 	 *
@@ -143,7 +143,7 @@ QSharedPointer<LibraryComponent> BusDefinition::clone() const {
 	return QSharedPointer<LibraryComponent>(new BusDefinition(*this));
 }
 
-void BusDefinition::write(QFile& file) {
+void BusDefinition::write(QIODevice& file) {
 	// create a writer instance and set it to operate on the given file
 	QXmlStreamWriter writer(&file);
 
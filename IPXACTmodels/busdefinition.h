@@ -70,10 +70,10 @@ public:
 	* Prints all information stored in this document into specified file
 	* generating a valid IP-Xact document.
 	*
-	* \param file A reference to QFile instance representing the file to write
+	* \param file A reference to the device representing the file to write
 	* the data into.
 	*/
-	virtual void write(QFile& file);
+	virtual void write(QIODevice& file);
 
 	/*! \brief Check the validity of the bus definition.
 	 * 
@@ -13,6 +13,7 @@
 #include "XmlUtils.h"
 #include"vlnv.h"
 
+#include <IPXACTmodels/validators/ComponentValidationContext.h>
 #include <IPXACTmodels/validators/ParameterValidator.h>
 
 #include <QString>
@@ -579,8 +580,7 @@ void BusInterface::write(QXmlStreamWriter& writer) {
 	writer.writeEndElement(); // spirit:busInterface
 }
 
-bool BusInterface::isValid( const QList<General::PortBounds>& physicalPorts, QStringList const& memoryMaps,
-    QStringList const& addressSpaces,
+bool BusInterface::isValid(ComponentValidationContext const& context,
     QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices,
     QStringList& errorList,
     const QString& parentIdentifier ) const 
@@ -614,7 +614,7 @@ bool BusInterface::isValid( const QList<General::PortBounds>& physicalPorts, QSt
             valid = false;
         }
         else if (!master_->getAddressSpaceRef().isEmpty() && 
-            !addressSpaces.contains(master_->getAddressSpaceRef()))
+            !context.hasAddressSpace(master_->getAddressSpaceRef()))
         {
             errorList.append(QObject::tr("Bus interface %1 references address space %2 which is not "
                 "found within %3.").arg(nameGroup_.name(), master_->getAddressSpaceRef(), parentIdentifier));
@@ -631,7 +631,7 @@ bool BusInterface::isValid( const QList<General::PortBounds>& physicalPorts, QSt
                 thisIdentifier));
             valid = false;
         }
-        else if (!slave_->getMemoryMapRef().isEmpty() && !memoryMaps.contains(slave_->getMemoryMapRef()))
+        else if (!slave_->getMemoryMapRef().isEmpty() && !context.hasMemoryMap(slave_->getMemoryMapRef()))
         {
             errorList.append(QObject::tr("Bus interface %1 references memory map %2 which is not "
                 "found within %3.").arg(nameGroup_.name(), slave_->getMemoryMapRef(), parentIdentifier));
@@ -675,7 +675,7 @@ bool BusInterface::isValid( const QList<General::PortBounds>& physicalPorts, QSt
     }
 
 	foreach (QSharedPointer<PortMap> portMap, portMaps_) {
-		if (!portMap->isValid(physicalPorts, errorList, thisIdentifier)) {
+		if (!portMap->isValid(context.getPhysicalPorts(), errorList, thisIdentifier)) {
 			valid = false;
 		}
 	}
@@ -693,8 +693,8 @@ bool BusInterface::isValid( const QList<General::PortBounds>& physicalPorts, QSt
 	return valid;
 }
 
-bool BusInterface::isValid( const QList<General::PortBounds>& physicalPorts, QStringList const& memoryMaps,
-    QStringList const& addressSpaces, QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices) const 
+bool BusInterface::isValid(ComponentValidationContext const& context,
+    QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices) const 
 {
 	if (nameGroup_.name().isEmpty())
     {
@@ -710,7 +710,7 @@ bool BusInterface::isValid( const QList<General::PortBounds>& physicalPorts, QSt
     if (interfaceMode_ == General::MASTER || interfaceMode_ == General::MIRROREDMASTER)
     {
         if (!master_ ||
-            (!master_->getAddressSpaceRef().isEmpty() && !addressSpaces.contains(master_->getAddressSpaceRef())))
+            (!master_->getAddressSpaceRef().isEmpty() && !context.hasAddressSpace(master_->getAddressSpaceRef())))
         {
             return false;
         }
@@ -718,7 +718,7 @@ bool BusInterface::isValid( const QList<General::PortBounds>& physicalPorts, QSt
     }
     else if (interfaceMode_ == General::SLAVE)
     {
-        if (!slave_ || (!slave_->getMemoryMapRef().isEmpty() && !memoryMaps.contains(slave_->getMemoryMapRef()))) 
+        if (!slave_ || (!slave_->getMemoryMapRef().isEmpty() && !context.hasMemoryMap(slave_->getMemoryMapRef()))) 
         {
             return false;
         }
@@ -749,7 +749,7 @@ bool BusInterface::isValid( const QList<General::PortBounds>& physicalPorts, QSt
     }
 
 	foreach (QSharedPointer<PortMap> portMap, portMaps_) {
-		if (!portMap->isValid(physicalPorts)) {
+		if (!portMap->isValid(context.getPhysicalPorts())) {
 			return false;
 		}
 	}
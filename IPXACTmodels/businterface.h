@@ -25,6 +25,7 @@
 #include <QPointF>
 
 class Choice;
+class ComponentValidationContext;
 class MasterInterface;
 class SlaveInterface;
 class MonitorInterface;
@@ -114,32 +115,27 @@ public:
 
 	/*! \brief Check if the bus interface is in a valid state.
 	 *
-	 * \param physicalPorts     List of the physical ports of the component and their bounds.
-	 * \param memoryMaps        List of the memory map names in the component.
-     * \param addressSpaces     List of the address space names in the component.
+	 * \param context           The ports, memory maps and address spaces of the component.
      * \param componentChoices  Choices in the containing component.
 	 * \param errorList         The list to add the possible error messages to.
 	 * \param parentIdentifier  String from parent to help to identify the location of the error.
 	 *
 	 * \return bool True if the state is valid and writing is possible.
 	*/
-	bool isValid(const QList<General::PortBounds>& physicalPorts, QStringList const& memoryMaps,
-        QStringList const& addressSpaces,
+	bool isValid(ComponentValidationContext const& context,
         QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices,
 		QStringList& errorList, 
 		const QString& parentIdentifier) const;
 
 	/*! \brief Check if the bus interface is in a valid state.
 	 * 
-	 * \param physicalPorts List of the physical ports of the component and their bounds.
-     * \param memoryMaps List of the memory map names in the component.
-     * \param addressSpaces     List of the address space names in the component.
+	 * \param context           The ports, memory maps and address spaces of the component.
      * \param componentChoices  Choices in the containing component.
 	 * 
 	 * \return bool True if the state is valid and writing is possible.
 	*/
-	bool isValid(const QList<General::PortBounds>& physicalPorts, QStringList const& memoryMaps,
-        QStringList const& addressSpaces, QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices) const;
+	bool isValid(ComponentValidationContext const& context,
+        QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices) const;
 
 	/*! \brief get the vlnv to the abstraction definition
 	 *
@@ -29,6 +29,8 @@
 #include "SystemView.h"
 #include "FileDependency.h"
 
+#include <IPXACTmodels/validators/ComponentValidationContext.h>
+#include <IPXACTmodels/validators/ParallelValidator.h>
 #include <IPXACTmodels/validators/ParameterValidator.h>
 
 #include <QDomDocument>
@@ -37,6 +39,7 @@
 #include <QString>
 #include <QDomNamedNodeMap>
 #include <QList>
+#include <QSet>
 #include <QStringList>
 #include <QXmlStreamWriter>
 #include <QFile>
@@ -46,6 +49,99 @@
 
 #include "GenericVendorExtension.h"
 
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! Validates a file set of a component.
+    //-----------------------------------------------------------------------------
+    class FileSetValidation : public ParallelValidator::Task
+    {
+    public:
+
+        FileSetValidation(QSharedPointer<FileSet> fileSet, QString const& parentIdentifier):
+          fileSet_(fileSet), parentIdentifier_(parentIdentifier) {}
+
+        virtual bool validate(QStringList& errorList) const
+        {
+            return fileSet_->isValid(errorList, parentIdentifier_, true);
+        }
+
+        virtual bool validate() const
+        {
+            return fileSet_->isValid(true);
+        }
+
+    private:
+
+        QSharedPointer<FileSet> fileSet_;
+        QString parentIdentifier_;
+    };
+
+    //-----------------------------------------------------------------------------
+    //! Validates a bus interface of a component.
+    //-----------------------------------------------------------------------------
+    class BusInterfaceValidation : public ParallelValidator::Task
+    {
+    public:
+
+        BusInterfaceValidation(QSharedPointer<BusInterface> busInterface,
+            ComponentValidationContext const& context,
+            QSharedPointer<QList<QSharedPointer<Choice> > > choices,
+            QString const& parentIdentifier):
+          busInterface_(busInterface), context_(context), choices_(choices),
+              parentIdentifier_(parentIdentifier) {}
+
+        virtual bool validate(QStringList& errorList) const
+        {
+            return busInterface_->isValid(context_, choices_, errorList, parentIdentifier_);
+        }
+
+        virtual bool validate() const
+        {
+            return busInterface_->isValid(context_, choices_);
+        }
+
+    private:
+
+        QSharedPointer<BusInterface> busInterface_;
+        ComponentValidationContext const& context_;
+        QSharedPointer<QList<QSharedPointer<Choice> > > choices_;
+        QString parentIdentifier_;
+    };
+
+    //-----------------------------------------------------------------------------
+    //! Validates an address space or a memory map of a component.
+    //-----------------------------------------------------------------------------
+    template <typename T>
+    class MemoryValidation : public ParallelValidator::Task
+    {
+    public:
+
+        MemoryValidation(QSharedPointer<T> element, QSet<QString> const& remapStateNames,
+            QSharedPointer<QList<QSharedPointer<Choice> > > choices,
+            QString const& parentIdentifier):
+          element_(element), remapStateNames_(remapStateNames), choices_(choices),
+              parentIdentifier_(parentIdentifier) {}
+
+        virtual bool validate(QStringList& errorList) const
+        {
+            return element_->isValid(choices_, remapStateNames_, errorList, parentIdentifier_);
+        }
+
+        virtual bool validate() const
+        {
+            return element_->isValid(choices_, remapStateNames_);
+        }
+
+    private:
+
+        QSharedPointer<T> element_;
+        QSet<QString> remapStateNames_;
+        QSharedPointer<QList<QSharedPointer<Choice> > > choices_;
+        QString parentIdentifier_;
+    };
+}
+
 //-----------------------------------------------------------------------------
 // Function: Component::Component()
 //-----------------------------------------------------------------------------
@@ -72,7 +168,11 @@ parameters_(new QList<QSharedPointer<Parameter> >()),
 attributes_(),
 swViews_(),
 systemViews_(),
-author_()
+author_(),
+busInterfaceIndex_(),
+addressSpaceIndex_(),
+memoryMapIndex_(),
+fileSetIndex_()
 {
 	LibraryComponent::vlnv_->setType(VLNV::COMPONENT);
 
@@ -368,7 +468,11 @@ cpus_(),
 otherClockDrivers_(),
 parameters_(new QList<QSharedPointer<Parameter> >()), 
 attributes_(),
-author_()
+author_(),
+busInterfaceIndex_(),
+addressSpaceIndex_(),
+memoryMapIndex_(),
+fileSetIndex_()
 {
 	LibraryComponent::vlnv_->setType(VLNV::COMPONENT);
 }
@@ -397,7 +501,11 @@ cpus_(),
 otherClockDrivers_(), 
 parameters_(new QList<QSharedPointer<Parameter> >()),
 attributes_(),
-author_()
+author_(),
+busInterfaceIndex_(),
+addressSpaceIndex_(),
+memoryMapIndex_(),
+fileSetIndex_()
 {
 
 }
@@ -426,7 +534,11 @@ cpus_(),
 otherClockDrivers_(),
 parameters_(new QList<QSharedPointer<Parameter> >()),
 attributes_(other.attributes_),
-author_(other.author_)
+author_(other.author_),
+busInterfaceIndex_(),
+addressSpaceIndex_(),
+memoryMapIndex_(),
+fileSetIndex_()
 {
 
 	foreach (QSharedPointer<BusInterface> busif, other.busInterfaces_) {
@@ -725,6 +837,11 @@ Component & Component::operator=( const Component &other ) {
         author_ = other.getAuthor();
 
         vendorExtensions_ = other.vendorExtensions_;
+
+        busInterfaceIndex_.invalidate();
+        addressSpaceIndex_.invalidate();
+        memoryMapIndex_.invalidate();
+        fileSetIndex_.invalidate();
 	}
 	return *this;
 }
@@ -753,7 +870,7 @@ QSharedPointer<LibraryComponent> Component::clone() const
 	return QSharedPointer<LibraryComponent>(new Component(*this));
 }
 
-void Component::write(QFile& file) {
+void Component::write(QIODevice& file) {
 	// create a writer instance and set it to operate on the given file
 	QXmlStreamWriter writer(&file);
 
@@ -1074,43 +1191,41 @@ bool Component::isValid( QStringList& errorList ) const
 		thisIdentifier = QObject::tr("component %1").arg(vlnv_->toString());
 	}
 
-	// get the names of all file sets
-	QStringList fileSetNames;
+    // Collect the names referred by the elements once for all the elements.
+    ComponentValidationContext context(*this);
+
+    // The file sets, bus interfaces, address spaces and memory maps are validated in parallel.
+    ParallelValidator fileSetValidator;
+	QSet<QString> fileSetNames;
 	foreach (QSharedPointer<FileSet> fileset, fileSets_)
     {
 		if (fileSetNames.contains(fileset->getName()))
         {
-			errorList.append(QObject::tr("%1 contains several file sets with name %2").arg(
+			fileSetValidator.addError(QObject::tr("%1 contains several file sets with name %2").arg(
                 thisIdentifier).arg(fileset->getName()));
-			valid = false;
 		}
 		else
         {
-			fileSetNames.append(fileset->getName());
+			fileSetNames.insert(fileset->getName());
 		}
 
-		if (!fileset->isValid(errorList, thisIdentifier, true))
-        {
-			valid = false;
-		}
+		fileSetValidator.addTask(new FileSetValidation(fileset, thisIdentifier));
 	}
 
-	// the list to contains the bounds and names of the physical ports
-	QList<General::PortBounds> physPorts;
-	QStringList portNames;
-	
-	if (model_)
+    if (!fileSetValidator.run(errorList))
     {
-		physPorts = model_->getPortBounds();
-		portNames = model_->getPortNames();
+        valid = false;
+    }
 
-		if (!model_->isValid(fileSetNames, choices_, errorList, thisIdentifier))
+	if (model_)
+    {
+		if (!model_->isValid(context.getFileSetNames(), choices_, errorList, thisIdentifier))
         {
 			valid = false;
 		}
 	}
 
-    QStringList softwareViewNames;
+    QSet<QString> softwareViewNames;
     foreach (QSharedPointer<SWView> softwareView, swViews_)
     {
         if (softwareViewNames.contains(softwareView->getName()))
@@ -1121,16 +1236,16 @@ bool Component::isValid( QStringList& errorList ) const
         }
         else
         {
-            softwareViewNames.append(softwareView->getName());
+            softwareViewNames.insert(softwareView->getName());
         }
 
-        if (!softwareView->isValid(fileSetNames, getCpuNames(), errorList, thisIdentifier))
+        if (!softwareView->isValid(context.getFileSetNames(), context.getCpuNames(), errorList, thisIdentifier))
         {
             valid = false;
         }
     }
 
-    QStringList systemViewNames;
+    QSet<QString> systemViewNames;
     foreach (QSharedPointer<SystemView> currentSystemView, systemViews_)
     {
         if (systemViewNames.contains(currentSystemView->getName()))
@@ -1141,38 +1256,38 @@ bool Component::isValid( QStringList& errorList ) const
         }
         else
         {
-            systemViewNames.append(currentSystemView->getName());
+            systemViewNames.insert(currentSystemView->getName());
         }
 
-        if (!currentSystemView->isValid(fileSetNames, getViewNames(), errorList, thisIdentifier))
+        if (!currentSystemView->isValid(context.getFileSetNames(), context.getViewNames(), errorList, thisIdentifier))
         {
             valid = false;
         }
     }
 
-    QStringList memoryMaps = getMemoryMapNames();
-    QStringList addressSpaces = getAddressSpaceNames();
-	QStringList busifNames;
+    ParallelValidator busifValidator;
+	QSet<QString> busifNames;
 	foreach (QSharedPointer<BusInterface> busif, busInterfaces_)
     {
 		if (busifNames.contains(busif->getName()))
         {
-			errorList.append(QObject::tr("%1 contains several bus interfaces with name %2").arg(thisIdentifier).
-                arg(busif->getName()));
-			valid = false;
+			busifValidator.addError(QObject::tr("%1 contains several bus interfaces with name %2").arg(
+                thisIdentifier).arg(busif->getName()));
 		}
 		else
         {
-			busifNames.append(busif->getName());
+			busifNames.insert(busif->getName());
 		}
 
-		if (!busif->isValid(physPorts, memoryMaps, addressSpaces, choices_, errorList, thisIdentifier))
-        {
-			valid = false;
-		}
+		busifValidator.addTask(new BusInterfaceValidation(busif, context, choices_, thisIdentifier));
 	}
 
-    QStringList comIfNames;
+    if (!busifValidator.run(errorList))
+    {
+        valid = false;
+    }
+
+    QSet<QString> comIfNames;
     foreach (QSharedPointer<ComInterface> comIf, comInterfaces_)
     {
         if (comIfNames.contains(comIf->getName()))
@@ -1183,7 +1298,7 @@ bool Component::isValid( QStringList& errorList ) const
         }
         else
         {
-            comIfNames.append(comIf->getName());
+            comIfNames.insert(comIf->getName());
         }
 
         if (!comIf->isValid(errorList, thisIdentifier))
@@ -1192,7 +1307,7 @@ bool Component::isValid( QStringList& errorList ) const
         }
     }
 
-    QStringList apiIfNames;
+    QSet<QString> apiIfNames;
     foreach (QSharedPointer<ApiInterface> apiIf, apiInterfaces_)
     {
         if (apiIfNames.contains(apiIf->getName()))
@@ -1203,7 +1318,7 @@ bool Component::isValid( QStringList& errorList ) const
         }
         else
         {
-            apiIfNames.append(apiIf->getName());
+            apiIfNames.insert(apiIf->getName());
         }
 
         if (!apiIf->isValid(errorList, thisIdentifier))
@@ -1212,7 +1327,7 @@ bool Component::isValid( QStringList& errorList ) const
         }
     }
 
-	QStringList channelNames;
+	QSet<QString> channelNames;
 	foreach (QSharedPointer<Channel> channel, channels_)
     {
 		if (channelNames.contains(channel->getName()))
@@ -1222,13 +1337,13 @@ bool Component::isValid( QStringList& errorList ) const
 			valid = false;
 		}
 
-		if (!channel->isValid(busifNames, errorList, thisIdentifier))
+		if (!channel->isValid(context.getBusInterfaceNames(), errorList, thisIdentifier))
         {
 			valid = false;
 		}
 	}
 
-	QStringList remapNames;
+	QSet<QString> remapNames;
 	foreach (QSharedPointer<RemapState> remState, *remapStates_)
     {
 		if (remapNames.contains(remState->getName()))
@@ -1239,56 +1354,56 @@ bool Component::isValid( QStringList& errorList ) const
 		}
 		else
         {
-			remapNames.append(remState->getName());
+			remapNames.insert(remState->getName());
 		}
 
-		if (!remState->isValid(portNames, errorList, thisIdentifier))
+		if (!remState->isValid(context.getPortNames(), errorList, thisIdentifier))
         {
 			valid = false;
 		}
 	}
 
-	QStringList addSpaceNames;
+    ParallelValidator memoryValidator;
+	QSet<QString> addSpaceNames;
 	foreach (QSharedPointer<AddressSpace> addrSpace, addressSpaces_)
     {
 		if (addSpaceNames.contains(addrSpace->getName()))
         {
-			errorList.append(QObject::tr("%1 contains several address spaces with name %2").arg(thisIdentifier).
-                arg(addrSpace->getName()));
-			valid = false;
+			memoryValidator.addError(QObject::tr("%1 contains several address spaces with name %2").arg(
+                thisIdentifier).arg(addrSpace->getName()));
 		}
 		else
         {
-			addSpaceNames.append(addrSpace->getName());
+			addSpaceNames.insert(addrSpace->getName());
 		}
 
-		if (!addrSpace->isValid(choices_, getRemapStateNames(), errorList, thisIdentifier))
-        {
-			valid = false;
-		}
+		memoryValidator.addTask(new MemoryValidation<AddressSpace>(addrSpace, context.getRemapStateNames(),
+            choices_, thisIdentifier));
 	}
 
-	QStringList memoryMapNames;
+	QSet<QString> memoryMapNames;
 	foreach (QSharedPointer<MemoryMap> memMap, memoryMaps_)
     {
 		if (memoryMapNames.contains(memMap->getName()))
         {
-			errorList.append(QObject::tr("%1 contains several memory maps with name %2").arg(thisIdentifier).
-                arg(memMap->getName()));
-			valid = false;
+			memoryValidator.addError(QObject::tr("%1 contains several memory maps with name %2").arg(
+                thisIdentifier).arg(memMap->getName()));
 		}
 		else
         {
-			memoryMapNames.append(memMap->getName());
+			memoryMapNames.insert(memMap->getName());
 		}
 
-		if (!memMap->isValid(choices_, getRemapStateNames(), errorList, thisIdentifier))
-        {
-			valid = false;
-		}
+		memoryValidator.addTask(new MemoryValidation<MemoryMap>(memMap, context.getRemapStateNames(),
+            choices_, thisIdentifier));
 	}
 
-	QStringList compGenNames;
+    if (!memoryValidator.run(errorList))
+    {
+        valid = false;
+    }
+
+	QSet<QString> compGenNames;
 	foreach (QSharedPointer<ComponentGenerator> compGen, compGenerators_)
     {
 		if (compGenNames.contains(compGen->getName()))
@@ -1299,7 +1414,7 @@ bool Component::isValid( QStringList& errorList ) const
 		}
 		else
         {
-			compGenNames.append(compGen->getName());
+			compGenNames.insert(compGen->getName());
 		}
 
 		if (!compGen->isValid(choices_, errorList, thisIdentifier))
@@ -1308,7 +1423,7 @@ bool Component::isValid( QStringList& errorList ) const
 		}
 	}
 
-	QStringList choiceNames;
+	QSet<QString> choiceNames;
 	foreach (QSharedPointer<Choice> choice, *choices_)
     {
 		if (choiceNames.contains(choice->getName()))
@@ -1319,7 +1434,7 @@ bool Component::isValid( QStringList& errorList ) const
 		}
 		else
         {
-			choiceNames.append(choice->getName());
+			choiceNames.insert(choice->getName());
 		}
 
 		if (!choice->isValid(errorList, thisIdentifier))
@@ -1328,7 +1443,7 @@ bool Component::isValid( QStringList& errorList ) const
 		}
 	}
 
-	QStringList cpuNames;
+	QSet<QString> cpuNames;
 	foreach (QSharedPointer<Cpu> cpu, cpus_)
     {
 		if (cpuNames.contains(cpu->getName()))
@@ -1339,16 +1454,16 @@ bool Component::isValid( QStringList& errorList ) const
 		}
 		else
         {
-			cpuNames.append(cpu->getName());
+			cpuNames.insert(cpu->getName());
 		}
 
-		if (!cpu->isValid(addSpaceNames, choices_, errorList, thisIdentifier))
+		if (!cpu->isValid(context.getAddressSpaceNames(), choices_, errorList, thisIdentifier))
         {
 			valid = false;
 		}
 	}
 
-	QStringList clockNames;
+	QSet<QString> clockNames;
 	foreach (QSharedPointer<OtherClockDriver> otherClock, otherClockDrivers_)
     {
 		if (clockNames.contains(otherClock->getClockName()))
@@ -1359,7 +1474,7 @@ bool Component::isValid( QStringList& errorList ) const
 		}
 		else
         {
-			clockNames.append(otherClock->getClockName());
+			clockNames.insert(otherClock->getClockName());
 		}
 
 		if (!otherClock->isValid(errorList, thisIdentifier))
@@ -1369,7 +1484,7 @@ bool Component::isValid( QStringList& errorList ) const
 	}
 
     ParameterValidator validator;
-    QStringList paramNames;
+    QSet<QString> paramNames;
 	foreach (QSharedPointer<Parameter> param, *parameters_)
     {
 		if (paramNames.contains(param->getName())) 
@@ -1380,7 +1495,7 @@ bool Component::isValid( QStringList& errorList ) const
 		}
 		else 
         {
-			paramNames.append(param->getName());
+			paramNames.insert(param->getName());
 		}
 
         errorList.append(validator.findErrorsIn(param.data(), thisIdentifier, choices_));
@@ -1407,8 +1522,11 @@ bool Component::isValid() const
 		return false;
 	}
 
-	// get the names of all file sets
-	QStringList fileSetNames;
+    // Collect the names referred by the elements once for all the elements.
+    ComponentValidationContext context(*this);
+
+    ParallelValidator fileSetValidator;
+	QSet<QString> fileSetNames;
 	foreach (QSharedPointer<FileSet> fileset, fileSets_)
     {
 		if (fileSetNames.contains(fileset->getName()))
@@ -1417,25 +1535,20 @@ bool Component::isValid() const
 		}
 		else
         {
-			fileSetNames.append(fileset->getName());
+			fileSetNames.insert(fileset->getName());
 		}
 
-		if (!fileset->isValid(true))
-        {
-			return false;
-		}
+		fileSetValidator.addTask(new FileSetValidation(fileset, QString()));
 	}
 
-	// the list to contains the bounds and names of the physical ports
-	QList<General::PortBounds> physPorts;
-	QStringList portNames;
+    if (!fileSetValidator.run())
+    {
+        return false;
+    }
 
 	if (model_)
     {
-		physPorts = model_->getPortBounds();
-		portNames = model_->getPortNames();
-
-		if (!model_->isValid(fileSetNames, choices_))
+		if (!model_->isValid(context.getFileSetNames(), choices_))
         {
 			return false;
 		}
@@ -1449,37 +1562,36 @@ bool Component::isValid() const
         }
     }
 
-    QStringList softwareViewNames;
+    QSet<QString> softwareViewNames;
     foreach (QSharedPointer<SWView> softwareView, swViews_)
     {
         if (softwareViewNames.contains(softwareView->getName()) ||
-            !softwareView->isValid(fileSetNames, getCpuNames()))
+            !softwareView->isValid(context.getFileSetNames(), context.getCpuNames()))
         {
             return false;
         }
         else
         {
-            softwareViewNames.append(softwareView->getName());
+            softwareViewNames.insert(softwareView->getName());
         }
     }
 
-    QStringList systemViewNames;
+    QSet<QString> systemViewNames;
     foreach (QSharedPointer<SystemView> currentSystemView, systemViews_)
     {
         if (systemViewNames.contains(currentSystemView->getName()) ||
-            !currentSystemView->isValid(fileSetNames, getViewNames()))
+            !currentSystemView->isValid(context.getFileSetNames(), context.getViewNames()))
         {
             return false;
         }
         else
         {
-            systemViewNames.append(currentSystemView->getName());
+            systemViewNames.insert(currentSystemView->getName());
         }
     }
 
-    QStringList memoryMaps = getMemoryMapNames();
-    QStringList addressSpaces = getAddressSpaceNames();
-	QStringList busifNames;
+    ParallelValidator busifValidator;
+	QSet<QString> busifNames;
 	foreach (QSharedPointer<BusInterface> busif, busInterfaces_)
     {
 		if (busifNames.contains(busif->getName()))
@@ -1488,16 +1600,18 @@ bool Component::isValid() const
 		}
 		else
         {
-			busifNames.append(busif->getName());
+			busifNames.insert(busif->getName());
 		}
 
-		if (!busif->isValid(physPorts, memoryMaps, addressSpaces, choices_))
-        {
-			return false;
-		}
+		busifValidator.addTask(new BusInterfaceValidation(busif, context, choices_, QString()));
 	}
 
-    QStringList comIfNames;
+    if (!busifValidator.run())
+    {
+        return false;
+    }
+
+    QSet<QString> comIfNames;
     foreach (QSharedPointer<ComInterface> comIf, comInterfaces_)
     {
         if (comIfNames.contains(comIf->getName()))
@@ -1506,7 +1620,7 @@ bool Component::isValid() const
         }
         else
         {
-            comIfNames.append(comIf->getName());
+            comIfNames.insert(comIf->getName());
         }
 
         if (!comIf->isValid())
@@ -1515,7 +1629,7 @@ bool Component::isValid() const
         }
     }
 
-    QStringList apiIfNames;
+    QSet<QString> apiIfNames;
     foreach (QSharedPointer<ApiInterface> apiIf, apiInterfaces_)
     {
         if (apiIfNames.contains(apiIf->getName()))
@@ -1524,7 +1638,7 @@ bool Component::isValid() const
         }
         else
         {
-            apiIfNames.append(apiIf->getName());
+            apiIfNames.insert(apiIf->getName());
         }
 
         if (!apiIf->isValid())
@@ -1534,7 +1648,7 @@ bool Component::isValid() const
     }
 
 
-	QStringList channelNames;
+	QSet<QString> channelNames;
 	foreach (QSharedPointer<Channel> channel, channels_)
     {
 		if (channelNames.contains(channel->getName()))
@@ -1542,13 +1656,13 @@ bool Component::isValid() const
 			return false;
 		}
 
-		if (!channel->isValid(busifNames))
+		if (!channel->isValid(context.getBusInterfaceNames()))
         {
 			return false;
 		}
 	}
 
-	QStringList remapNames;
+	QSet<QString> remapNames;
 	foreach (QSharedPointer<RemapState> remState, *remapStates_)
     {
 		if (remapNames.contains(remState->getName()))
@@ -1557,16 +1671,17 @@ bool Component::isValid() const
 		}
 		else
         {
-			remapNames.append(remState->getName());
+			remapNames.insert(remState->getName());
 		}
 
-		if (!remState->isValid(portNames))
+		if (!remState->isValid(context.getPortNames()))
         {
 			return false;
 		}
 	}
 
-	QStringList addSpaceNames;
+    ParallelValidator memoryValidator;
+	QSet<QString> addSpaceNames;
 	foreach (QSharedPointer<AddressSpace> addrSpace, addressSpaces_)
     {
 		if (addSpaceNames.contains(addrSpace->getName()))
@@ -1575,16 +1690,14 @@ bool Component::isValid() const
 		}
 		else
         {
-			addSpaceNames.append(addrSpace->getName());
+			addSpaceNames.insert(addrSpace->getName());
 		}
 
-		if (!addrSpace->isValid(choices_, getRemapStateNames()))
-        {
-			return false;
-		}
+		memoryValidator.addTask(new MemoryValidation<AddressSpace>(addrSpace, context.getRemapStateNames(),
+            choices_, QString()));
 	}
 
-	QStringList memoryMapNames;
+	QSet<QString> memoryMapNames;
 	foreach (QSharedPointer<MemoryMap> memMap, memoryMaps_)
     {
 		if (memoryMapNames.contains(memMap->getName()))
@@ -1593,16 +1706,19 @@ bool Component::isValid() const
 		}
 		else
         {
-			memoryMapNames.append(memMap->getName());
+			memoryMapNames.insert(memMap->getName());
 		}
 
-		if (!memMap->isValid(choices_, getRemapStateNames()))
-        {
-			return false;
-		}
+		memoryValidator.addTask(new MemoryValidation<MemoryMap>(memMap, context.getRemapStateNames(),
+            choices_, QString()));
 	}
 
-	QStringList compGenNames;
+    if (!memoryValidator.run())
+    {
+        return false;
+    }
+
+	QSet<QString> compGenNames;
 	foreach (QSharedPointer<ComponentGenerator> compGen, compGenerators_)
     {
 		if (compGenNames.contains(compGen->getName()))
@@ -1611,7 +1727,7 @@ bool Component::isValid() const
 		}
 		else
         {
-			compGenNames.append(compGen->getName());
+			compGenNames.insert(compGen->getName());
 		}
 
 		if (!compGen->isValid(choices_))
@@ -1620,7 +1736,7 @@ bool Component::isValid() const
 		}
 	}
 
-	QStringList choiceNames;
+	QSet<QString> choiceNames;
 	foreach (QSharedPointer<Choice> choice, *choices_)
     {
 		if (choiceNames.contains(choice->getName()))
@@ -1629,7 +1745,7 @@ bool Component::isValid() const
 		}
 		else
         {
-			choiceNames.append(choice->getName());
+			choiceNames.insert(choice->getName());
 		}
 
 		if (!choice->isValid())
@@ -1638,7 +1754,7 @@ bool Component::isValid() const
 		}
 	}
 
-	QStringList cpuNames;
+	QSet<QString> cpuNames;
 	foreach (QSharedPointer<Cpu> cpu, cpus_)
     {
 		if (cpuNames.contains(cpu->getName()))
@@ -1647,16 +1763,16 @@ bool Component::isValid() const
 		}
 		else
         {
-			cpuNames.append(cpu->getName());
+			cpuNames.insert(cpu->getName());
 		}
 
-		if (!cpu->isValid(addSpaceNames, choices_))
+		if (!cpu->isValid(context.getAddressSpaceNames(), choices_))
         {
 			return false;
 		}
 	}
 
-	QStringList clockNames;
+	QSet<QString> clockNames;
 	foreach (QSharedPointer<OtherClockDriver> otherClock, otherClockDrivers_)
     {
 		if (clockNames.contains(otherClock->getClockName()))
@@ -1665,7 +1781,7 @@ bool Component::isValid() const
 		}
 		else
         {
-			clockNames.append(otherClock->getClockName());
+			clockNames.insert(otherClock->getClockName());
 		}
 
 		if (!otherClock->isValid())
@@ -1790,6 +1906,7 @@ void Component::setMemoryMaps(QList<QSharedPointer<MemoryMap> > const& memoryMap
 
 	// save new memory maps
 	memoryMaps_ = memoryMaps;
+	memoryMapIndex_.invalidate();
 }
 
 void Component::setChannels(const QList<QSharedPointer<Channel> > &channels) {
@@ -1806,6 +1923,7 @@ void Component::setFileSets(const QList<QSharedPointer<FileSet> > &fileSets) {
 
 	// save new file sets
 	fileSets_ = fileSets;
+	fileSetIndex_.invalidate();
 }
 
 const QList<QSharedPointer<Channel> >& Component::getChannels() const {
@@ -1830,6 +1948,7 @@ void Component::setAddressSpaces(QList<QSharedPointer<AddressSpace> > const& add
 
 	// save new address spaces
 	addressSpaces_ = addressSpaces;
+	addressSpaceIndex_.invalidate();
 }
 
 QList<QSharedPointer<AddressSpace> >& Component::getAddressSpaces() {
@@ -2108,28 +2227,15 @@ bool Component::hasPort( const QString& name ) const {
 }
 
 QSharedPointer<FileSet> Component::getFileSet( const QString& name ) const {
-	// search all file sets
-	for (int i = 0; i < fileSets_.size(); ++i) {
-
-		// if the file set was found
-		if (fileSets_.at(i)->getName() == name) {
-			return fileSets_.at(i);
-		}
-	}
-
-	// file set was not found
-	return QSharedPointer<FileSet>();
+	return fileSetIndex_.find(fileSets_, name);
 }
 
 QSharedPointer<FileSet> Component::getFileSet( const QString& name ) {
 
 	// search the file sets.
-	foreach (QSharedPointer<FileSet> fileSet, fileSets_) {
-		
-		// if the file set is found
-		if (fileSet->getName() == name) {
-			return fileSet;
-		}
+	QSharedPointer<FileSet> existingFileSet = fileSetIndex_.find(fileSets_, name);
+	if (existingFileSet) {
+		return existingFileSet;
 	}
 
 	// no file set with given name existed so create one
@@ -2209,16 +2315,7 @@ QStringList Component::getFileSetNames() const {
 }
 
 bool Component::hasFileSet( const QString& fileSetName ) const {
-
-	foreach (QSharedPointer<FileSet> fileSet, fileSets_) {
-
-		// if the file set is found.
-		if (fileSet->getName() == fileSetName)
-			return true;
-	}
-
-	// all file sets were searched but none found
-	return false;
+	return fileSetIndex_.find(fileSets_, fileSetName);
 }
 
 QSharedPointer<const FileSet> Component::findFileSetById( const QString& id ) const {
@@ -2259,6 +2356,7 @@ void Component::removeFileSet( const QString& fileSetName ) {
 		if (fileSets_.at(i)->getName() == fileSetName) {
 			fileSets_.value(i).clear();
 			fileSets_.removeAt(i);
+			fileSetIndex_.invalidate();
 			return;
 		}
 	}
@@ -2515,20 +2613,15 @@ const QList<QSharedPointer<Port> > Component::getPorts( const QString& interface
 	QStringList portNames;
 
 	// search the named interface
-	bool found = false;
-	foreach (QSharedPointer<BusInterface> busif, busInterfaces_) {
-		if (busif->getName() == interfaceName) {
-			found = true;
-			portNames = busif->getPhysicalPortNames();
-			break;
-		}
-	}
+	QSharedPointer<BusInterface> busif = busInterfaceIndex_.find(busInterfaces_, interfaceName);
 
 	// if interface was not found
-	if (!found) {
+	if (!busif) {
 		return ports;
 	}
 
+	portNames = busif->getPhysicalPortNames();
+
 	// get all the ports on the component
 	ports = getPorts();
 
@@ -3211,6 +3304,7 @@ void Component::removeAddressSpace( const QString& addrSpaceName ) {
 		// if the specified address space is found
 		if (addressSpaces_.at(i)->getName() == addrSpaceName) {
 			addressSpaces_.removeAt(i);
+			addressSpaceIndex_.invalidate();
 			return;
 		}
 	}
@@ -3223,12 +3317,7 @@ AddressSpace* Component::createAddressSpace() {
 }
 
 bool Component::hasAddressSpace( const QString& addrSpaceName ) const {
-	foreach (QSharedPointer<AddressSpace> addrSpace, addressSpaces_) {
-		if (addrSpace->getName() == addrSpaceName) {
-			return true;
-		}
-	}
-	return false;
+	return addressSpaceIndex_.find(addressSpaces_, addrSpaceName);
 }
 
 void Component::removeCpu( const QString& cpuName ) {
@@ -3544,10 +3633,9 @@ void Component::parseSystemViews(QDomNode& node)
 
 General::InterfaceMode Component::getInterfaceMode( const QString& interfaceName ) const {
 	
-	foreach (QSharedPointer<BusInterface> busif, busInterfaces_) {
-		if (busif->getName() == interfaceName) {
-			return busif->getInterfaceMode();
-		}
+	QSharedPointer<BusInterface> busif = busInterfaceIndex_.find(busInterfaces_, interfaceName);
+	if (busif) {
+		return busif->getInterfaceMode();
 	}
 	return General::INTERFACE_MODE_COUNT;
 }
@@ -3586,25 +3674,11 @@ QList<QSharedPointer<const BusInterface> > Component::getChannelConnectedInterfa
 }
 
 QSharedPointer<BusInterface> Component::getBusInterface( const QString& name ) {
-
-	foreach (QSharedPointer<BusInterface> busif, busInterfaces_) {
-		if (busif->getName() == name) {
-			return busif;
-		}
-	}
-
-	return QSharedPointer<BusInterface>();
+	return busInterfaceIndex_.find(busInterfaces_, name);
 }
 
 QSharedPointer<BusInterface const> Component::getBusInterface( const QString& name ) const {
-
-    foreach (QSharedPointer<BusInterface> busif, busInterfaces_) {
-        if (busif->getName() == name) {
-            return busif;
-        }
-    }
-
-    return QSharedPointer<BusInterface>();
+    return busInterfaceIndex_.find(busInterfaces_, name);
 }
 
 QStringList Component::getSlaveInterfaces( const QString& memoryMap ) const {
@@ -3663,12 +3737,7 @@ bool Component::hasInterfaces() const {
 }
 
 bool Component::hasInterface( const QString& interfaceName ) const {
-	foreach (QSharedPointer<BusInterface> busif, busInterfaces_) {
-		if (busif->getName() == interfaceName) {
-			return true;
-		}
-	}
-	return false;
+	return busInterfaceIndex_.find(busInterfaces_, interfaceName);
 }
 
 bool Component::addBusInterface(QSharedPointer<BusInterface> busInterface ) {
@@ -3690,6 +3759,8 @@ void Component::removeBusInterface( const QString& busifName ) {
 			--i;
 		}
 	}
+
+	busInterfaceIndex_.invalidate();
 }
 
 void Component::removeBusInterface( const BusInterface* busInterface ) {
@@ -3700,6 +3771,8 @@ void Component::removeBusInterface( const BusInterface* busInterface ) {
 			--i;
 		}
 	}
+
+	busInterfaceIndex_.invalidate();
 }
 
 QStringList Component::getBusInterfaceNames() const {
@@ -3759,16 +3832,16 @@ QString Component::getInterfaceNameForPort( const QString& portName ) const {
 
 QString Component::getInterfaceDescription( const QString& interfaceName ) const {
 
-	foreach (QSharedPointer<BusInterface> busif, busInterfaces_) {
-		if (busif->getName() == interfaceName) {
-			return busif->getDescription();
-		}
+	QSharedPointer<BusInterface> busif = busInterfaceIndex_.find(busInterfaces_, interfaceName);
+	if (busif) {
+		return busif->getDescription();
 	}
 	return QString();
 }
 
 void Component::setBusInterfaces(QList<QSharedPointer<BusInterface> >& busInterfaces ) {
 	busInterfaces_ = busInterfaces;
+	busInterfaceIndex_.invalidate();
 }
 
 QStringList Component::getModelParameterNames() const {
@@ -3781,15 +3854,7 @@ QStringList Component::getModelParameterNames() const {
 //-----------------------------------------------------------------------------
 QSharedPointer<MemoryMap> Component::getMemoryMap(QString const& name) const
 {
-    for (int i = 0; i < memoryMaps_.size(); ++i)
-    {
-        if (memoryMaps_.at(i)->getName() == name)
-        {
-            return memoryMaps_.at(i);
-        }
-    }
-
-    return QSharedPointer<MemoryMap>();
+    return memoryMapIndex_.find(memoryMaps_, name);
 }
 
 //-----------------------------------------------------------------------------
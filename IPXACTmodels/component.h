@@ -14,6 +14,7 @@
 #include "view.h"
 #include "port.h"
 #include "modelparameter.h"
+#include "NameIndex.h"
 
 #include "ipxactmodels_global.h"
 
@@ -104,10 +105,10 @@ public:
 	* Prints all information stored in this document into specified file
 	* generating a valid IP-Xact document.
 	*
-	* \param file A reference to QFile instance representing the file to write
+	* \param file A reference to the device representing the file to write
 	* the data into.
 	*/
-	virtual void write(QFile& file);
+	virtual void write(QIODevice& file);
 
 	/*! \brief Check the validity of the component.
 	 * 
@@ -1862,6 +1863,12 @@ private:
 
     //! The author of the component.
     QString author_;
+
+    //! The indices for finding the elements by name.
+    NameIndex<BusInterface> busInterfaceIndex_;
+    NameIndex<AddressSpace> addressSpaceIndex_;
+    NameIndex<MemoryMap> memoryMapIndex_;
+    NameIndex<FileSet> fileSetIndex_;
 };
 
 
@@ -18,12 +18,46 @@
 #include "XmlUtils.h"
 
 #include <IPXACTmodels/kactusExtensions/KactusAttribute.h>
+#include <IPXACTmodels/validators/ParallelValidator.h>
 #include"vlnv.h"
 #include "XmlUtils.h"
 
 #include <QDomNamedNodeMap>
 #include <QXmlStreamWriter>
 
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! Validates a connection between the component instances of a design.
+    //
+    // The connection is referred to, not copied, so it must be an element of the design itself.
+    //-----------------------------------------------------------------------------
+    template <typename T>
+    class ConnectionValidation : public ParallelValidator::Task
+    {
+    public:
+
+        ConnectionValidation(T const& connection, QStringList const& instanceNames,
+            QString const& parentIdentifier):
+          connection_(connection), instanceNames_(instanceNames), parentIdentifier_(parentIdentifier) {}
+
+        virtual bool validate(QStringList& errorList) const
+        {
+            return connection_.isValid(instanceNames_, errorList, parentIdentifier_);
+        }
+
+        virtual bool validate() const
+        {
+            return connection_.isValid(instanceNames_);
+        }
+
+    private:
+
+        T const& connection_;
+        QStringList const& instanceNames_;
+        QString parentIdentifier_;
+    };
+}
 
 //-----------------------------------------------------------------------------
 // Function: Design::Design()
@@ -199,7 +233,7 @@ QSharedPointer<LibraryComponent> Design::clone() const {
 //-----------------------------------------------------------------------------
 // Function: Design::write()
 //-----------------------------------------------------------------------------
-void Design::write(QFile& file)
+void Design::write(QIODevice& file)
 {
 	QXmlStreamWriter writer(&file);
 
@@ -468,22 +502,27 @@ bool Design::isValid( QStringList& errorList ) const {
         }
     }
 
+	// The connections are validated in parallel.
+	ParallelValidator interconnectionValidator;
 	QStringList interconnectionNames;
-	foreach (Interconnection interconnection, interconnections_) {
+	for (int i = 0; i < interconnections_.size(); ++i) {
+		Interconnection const& interconnection = interconnections_.at(i);
 		
 		// if there are several interconnections with same name
 		if (interconnectionNames.contains(interconnection.name())) {
-			errorList.append(QObject::tr("Design contains several interconnections"
+			interconnectionValidator.addError(QObject::tr("Design contains several interconnections"
 				" with name '%1'").arg(interconnection.name()));
-			valid = false;
 		}
 		else {
 			interconnectionNames.append(interconnection.name());
 		}
 
-		if (!interconnection.isValid(instanceNames, errorList, thisIdentifier)) {
-			valid = false;
-		}
+		interconnectionValidator.addTask(new ConnectionValidation<Interconnection>(interconnection,
+			instanceNames, thisIdentifier));
+	}
+
+	if (!interconnectionValidator.run(errorList)) {
+		valid = false;
 	}
 
     QStringList comConnectionNames;
@@ -556,26 +595,30 @@ bool Design::isValid( QStringList& errorList ) const {
 		}
 	}
 
+	ParallelValidator adHocValidator;
 	QStringList adHocNames;
-	foreach (AdHocConnection adHoc, adHocConnections_) {
+	for (int i = 0; i < adHocConnections_.size(); ++i) {
+		AdHocConnection const& adHoc = adHocConnections_.at(i);
 		if (adHocNames.contains(adHoc.name())) {
-			errorList.append(QObject::tr("Design contains several ad hoc connections"
+			adHocValidator.addError(QObject::tr("Design contains several ad hoc connections"
 				" with name %1").arg(adHoc.name()));
-			valid = false;
 		}
 		else {
 			adHocNames.append(adHoc.name());
 		}
 
-		if (!adHoc.isValid(instanceNames, errorList, thisIdentifier)) {
-			valid = false;
-		}
+		adHocValidator.addTask(new ConnectionValidation<AdHocConnection>(adHoc, instanceNames,
+			thisIdentifier));
 	}
 
-	foreach (HierConnection hierConn, hierConnections_) {
-		if (!hierConn.isValid(instanceNames, errorList, thisIdentifier)) {
-			valid = false;
-		}
+	for (int i = 0; i < hierConnections_.size(); ++i) {
+		HierConnection const& hierConn = hierConnections_.at(i);
+		adHocValidator.addTask(new ConnectionValidation<HierConnection>(hierConn, instanceNames,
+			thisIdentifier));
+	}
+
+	if (!adHocValidator.run(errorList)) {
+		valid = false;
 	}
 
 	return valid;
@@ -625,8 +668,11 @@ bool Design::isValid() const {
 		}
 	}
 
+	// The connections are validated in parallel.
+	ParallelValidator connectionValidator;
 	QStringList interconnectionNames;
-	foreach (Interconnection interconnection, interconnections_) {
+	for (int i = 0; i < interconnections_.size(); ++i) {
+		Interconnection const& interconnection = interconnections_.at(i);
 
 		// if there are several interconnections with same name
 		if (interconnectionNames.contains(interconnection.name())) {
@@ -636,13 +682,13 @@ bool Design::isValid() const {
 			interconnectionNames.append(interconnection.name());
 		}
 
-		if (!interconnection.isValid(instanceNames)) {
-			return false;
-		}
+		connectionValidator.addTask(new ConnectionValidation<Interconnection>(interconnection,
+			instanceNames, QString()));
 	}
 
 	QStringList adHocNames;
-	foreach (AdHocConnection adHoc, adHocConnections_) {
+	for (int i = 0; i < adHocConnections_.size(); ++i) {
+		AdHocConnection const& adHoc = adHocConnections_.at(i);
 		if (adHocNames.contains(adHoc.name())) {
 			return false;
 		}
@@ -650,15 +696,18 @@ bool Design::isValid() const {
 			adHocNames.append(adHoc.name());
 		}
 
-		if (!adHoc.isValid(instanceNames)) {
-			return false;
-		}
+		connectionValidator.addTask(new ConnectionValidation<AdHocConnection>(adHoc, instanceNames,
+			QString()));
 	}
 
-	foreach (HierConnection hierConn, hierConnections_) {
-		if (!hierConn.isValid(instanceNames)) {
-			return false;
-		}
+	for (int i = 0; i < hierConnections_.size(); ++i) {
+		HierConnection const& hierConn = hierConnections_.at(i);
+		connectionValidator.addTask(new ConnectionValidation<HierConnection>(hierConn, instanceNames,
+			QString()));
+	}
+
+	if (!connectionValidator.run()) {
+		return false;
 	}
 
 	QStringList comConnectionNames;
@@ -79,7 +79,7 @@ public:
 
 	/*! \brief Write XML IP-XACT document of this design
 	*/
-	virtual void write(QFile& file);
+	virtual void write(QIODevice& file);
 
     /*! \brief Check the validity of the design.
 	 * 
@@ -376,6 +376,13 @@ public:
      */
 	KactusAttribute::Implementation getDesignImplementation() const;
 
+    /*!
+     *  Parses the routes from kactus2:routes and applies them to the connections with the same names.
+     *
+     *      @param [in] routesNode   The DOM node containing the routes.
+     */
+    void parseRoutes(QDomNode& routesNode);
+
 private:
 
     /*!
@@ -392,13 +399,6 @@ private:
      */
     void parseColumnLayout(QDomNode& layoutNode);
 
-    /*!
-     *  Parses the routes from kactus2:routes.
-     *
-     *      @param [in] routesNode   The DOM node containing the routes.
-     */
-    void parseRoutes(QDomNode& routesNode);
-
     /*!
      *  Parses a route from kactus2:route.
      *
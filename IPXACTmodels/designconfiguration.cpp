@@ -416,7 +416,7 @@ QSharedPointer<LibraryComponent> DesignConfiguration::clone() const
 //-----------------------------------------------------------------------------
 // Function: DesignConfiguration::write()
 //-----------------------------------------------------------------------------
-void DesignConfiguration::write(QFile& file)
+void DesignConfiguration::write(QIODevice& file)
 {
     // create a writer instance and set it to operate on the given file
     QXmlStreamWriter writer(&file);
@@ -351,31 +351,8 @@ void Field::write(QXmlStreamWriter& writer) {
 
 bool Field::isValid(unsigned int registerSize, QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices,
     QStringList& errorList, const QString& parentIdentifier ) const {
-	bool valid = true;
-
-	if (nameGroup_.name().isEmpty()) {
-		errorList.append(QObject::tr("No name specified for a field within %1").arg(
-			parentIdentifier));
-		valid = false;
-	}
-
-	if (bitOffset_ < 0) {
-		errorList.append(QObject::tr("No bit offset set for field %1 within %2").arg(
-			nameGroup_.name()).arg(parentIdentifier));
-		valid = false;
-	}
-
-	if (bitWidth_ <= 0) {
-		errorList.append(QObject::tr("No bit width set for field %1 within %2").arg(
-			nameGroup_.name()).arg(parentIdentifier));
-		valid = false;
-	}
-
-	if ((bitOffset_ + bitWidth_) > registerSize) {
-		errorList.append(QObject::tr("The register contains %1 bits but field's MSB bit is %2").arg(
-			registerSize).arg(bitOffset_ + bitWidth_ - 1));
-		valid = false;
-	}
+	bool valid = isValidValues(nameGroup_.name(), bitOffset_, bitWidth_, registerSize, &errorList,
+		parentIdentifier);
 
 	foreach (QSharedPointer<EnumeratedValue> enumValue, enumeratedValues_)
     {
@@ -402,22 +379,7 @@ bool Field::isValid(unsigned int registerSize, QSharedPointer<QList<QSharedPoint
 bool Field::isValid(unsigned int registerSize, 
     QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices) const 
 {
-    if (nameGroup_.name().isEmpty()) 
-    {
-        return false;
-    }
-
-    if (bitOffset_ < 0)
-    {
-        return false;
-    }
-
-    if (bitWidth_ <= 0)
-    {
-        return false;
-    }
-
-    if ((bitOffset_ + bitWidth_) > registerSize)
+    if (!isValidValues(nameGroup_.name(), bitOffset_, bitWidth_, registerSize, 0, QString()))
     {
         return false;
     }
@@ -440,6 +402,49 @@ bool Field::isValid(unsigned int registerSize,
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: field::isValidValues()
+//-----------------------------------------------------------------------------
+bool Field::isValidValues(QString const& name, int bitOffset, unsigned int bitWidth, unsigned int registerSize,
+    QStringList* errorList, QString const& parentIdentifier)
+{
+    if (!errorList)
+    {
+        return !name.isEmpty() && bitOffset >= 0 && bitWidth != 0 && (bitOffset + bitWidth) <= registerSize;
+    }
+
+    bool valid = true;
+
+    if (name.isEmpty())
+    {
+        errorList->append(QObject::tr("No name specified for a field within %1").arg(parentIdentifier));
+        valid = false;
+    }
+
+    if (bitOffset < 0)
+    {
+        errorList->append(QObject::tr("No bit offset set for field %1 within %2").arg(
+            name).arg(parentIdentifier));
+        valid = false;
+    }
+
+    if (bitWidth == 0)
+    {
+        errorList->append(QObject::tr("No bit width set for field %1 within %2").arg(
+            name).arg(parentIdentifier));
+        valid = false;
+    }
+
+    if ((bitOffset + bitWidth) > registerSize)
+    {
+        errorList->append(QObject::tr("The register contains %1 bits but field's MSB bit is %2").arg(
+            registerSize).arg(bitOffset + bitWidth - 1));
+        valid = false;
+    }
+
+    return valid;
+}
+
 //-----------------------------------------------------------------------------
 // Function: field::getBitOffset()
 //-----------------------------------------------------------------------------
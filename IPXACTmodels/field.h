@@ -97,6 +97,20 @@ public:
 	bool isValid(unsigned int registerSize,
         QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices) const;
 
+	/*! \brief Check if the given name, offset and width of a field are valid.
+	 *
+	 * \param name The name of the field.
+	 * \param bitOffset The bit offset of the field.
+	 * \param bitWidth The bit width of the field.
+	 * \param registerSize The size of the containing register, field must not extend beyond this.
+	 * \param errorList The list to add the possible error messages to or null, if not needed.
+	 * \param parentIdentifier String from parent to help to identify the location of the error.
+	 *
+	 * \return bool True if the values are valid.
+	*/
+	static bool isValidValues(QString const& name, int bitOffset, unsigned int bitWidth,
+		unsigned int registerSize, QStringList* errorList, QString const& parentIdentifier);
+
 	/*! \brief Get the bit offset.
 	 *
 	 * \return bit offset.
@@ -10,6 +10,7 @@
 #include "buildcommand.h"
 #include "fileset.h"
 #include "GenericVendorExtension.h"
+#include "StringPool.h"
 
 #include <QSharedPointer>
 #include <QString>
@@ -120,7 +121,7 @@ vendorExtensions_()
 
 		if (name == QString("spirit:fileId")) {
 			fileId_ = value;
-			fileId_ = XmlUtils::removeWhiteSpace(fileId_);
+			fileId_ = StringPool::intern(XmlUtils::removeWhiteSpace(fileId_));
 		}
 		else {
 			attributes_[name] = value;
@@ -137,11 +138,11 @@ vendorExtensions_()
 		}
 
 		else if (tempNode.nodeName() == QString("spirit:fileType")) {
-			fileTypes_.append(tempNode.childNodes().at(0).nodeValue());
+			fileTypes_.append(StringPool::intern(tempNode.childNodes().at(0).nodeValue()));
 		}
 
 		else if (tempNode.nodeName() == QString("spirit:userFileType")) {
-			userFileTypes_.append(tempNode.childNodes().at(0).nodeValue());
+			userFileTypes_.append(StringPool::intern(tempNode.childNodes().at(0).nodeValue()));
 		}
 
 		else if (tempNode.nodeName() == QString("spirit:isIncludeFile")) {
@@ -158,7 +159,7 @@ vendorExtensions_()
 
 		else if (tempNode.nodeName() == QString("spirit:logicalName")) {
 			logicalName_ = tempNode.childNodes().at(0).nodeValue();
-			logicalName_ = XmlUtils::removeWhiteSpace(logicalName_);
+			logicalName_ = StringPool::intern(XmlUtils::removeWhiteSpace(logicalName_));
 
 			// get the default-attribute
 			QDomNamedNodeMap attributeMap = tempNode.attributes();
@@ -193,7 +194,7 @@ vendorExtensions_()
 		}
 
 		else if (tempNode.nodeName() == QString("spirit:imageType")) {
-			imageTypes_.append(tempNode.childNodes().at(0).nodeValue());
+			imageTypes_.append(StringPool::intern(tempNode.childNodes().at(0).nodeValue()));
 		}
 
 		else if (tempNode.nodeName() == QString("spirit:description")) {
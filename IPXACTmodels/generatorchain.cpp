@@ -231,7 +231,7 @@ QSharedPointer<LibraryComponent> GeneratorChain::clone() const {
 	return QSharedPointer<LibraryComponent>(new GeneratorChain(*this));
 }
 
-void GeneratorChain::write(QFile& file) {
+void GeneratorChain::write(QIODevice& file) {
 	// create a writer instance and set it to operate on the given file
 	QXmlStreamWriter writer(&file);
 
@@ -182,7 +182,7 @@ public:
 	 * 
 	 * \param file The file to write to document into.
 	 */
-	virtual void write(QFile& file) = 0;
+	virtual void write(QIODevice& file) = 0;
 
 	/*! \brief Write the VLNV information using the specified writer
 	 *
@@ -151,7 +151,7 @@ void MemoryMap::write(QXmlStreamWriter& writer)
 // Function: memorymap::isValid()
 //-----------------------------------------------------------------------------
 bool MemoryMap::isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices,
-    QStringList remapStateNames, QStringList& errorList,
+    const QSet<QString>& remapStateNames, QStringList& errorList,
     const QString& parentIdentifier) const
 {
     bool valid = AbstractMemoryMap::isValid(componentChoices, errorList, parentIdentifier);
@@ -184,7 +184,7 @@ bool MemoryMap::isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componen
 // Function: memorymap::isValid()
 //-----------------------------------------------------------------------------
 bool MemoryMap::isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices,
-    QStringList remapStateNames) const
+    const QSet<QString>& remapStateNames) const
 {
     bool valid = AbstractMemoryMap::isValid(componentChoices);
 
@@ -15,6 +15,7 @@
 
 #include <QDomNode>
 #include <QXmlStreamWriter>
+#include <QSet>
 #include <QTextStream>
 
 class VendorExtension;
@@ -76,7 +77,7 @@ public:
      *
      *      @return True, if the state is valid and writing is possible.
 	 */
-	bool isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices, QStringList remapStateNames,
+	bool isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices, const QSet<QString>& remapStateNames,
         QStringList& errorList, const QString& parentIdentifier) const;
 
 	/*!
@@ -87,7 +88,7 @@ public:
      *
      *      @return True, if the state is valid and writing is possible.
 	 */
-	bool isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices, QStringList remapStateNames)
+	bool isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices, const QSet<QString>& remapStateNames)
         const;
 
     /*!
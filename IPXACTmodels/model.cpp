@@ -15,6 +15,7 @@
 #include <QDomNode>
 #include <QString>
 #include <QList>
+#include <QSet>
 #include <QXmlStreamWriter>
 
 #include <QDebug>
@@ -22,7 +23,9 @@
 Model::Model(QDomNode &modelNode):
 views_(),
 ports_(),
-modelParameters_(new QList<QSharedPointer<ModelParameter> >()) {
+modelParameters_(new QList<QSharedPointer<ModelParameter> >()),
+viewIndex_(),
+portIndex_() {
 
 	for (int i = 0; i < modelNode.childNodes().count(); ++i) {
 		QDomNode tempNode = modelNode.childNodes().at(i);
@@ -66,7 +69,9 @@ modelParameters_(new QList<QSharedPointer<ModelParameter> >()) {
 }
 
 Model::Model(): views_(), ports_(), 
-    modelParameters_(new QList<QSharedPointer<ModelParameter> >()) 
+    modelParameters_(new QList<QSharedPointer<ModelParameter> >()),
+    viewIndex_(),
+    portIndex_()
 {
 
 }
@@ -74,7 +79,9 @@ Model::Model(): views_(), ports_(),
 Model::Model( const Model &other ):
 views_(),
 ports_(),
-modelParameters_(new QList<QSharedPointer<ModelParameter> >()) {
+modelParameters_(new QList<QSharedPointer<ModelParameter> >()),
+viewIndex_(),
+portIndex_() {
 
 	foreach (QSharedPointer<View> view, other.views_) {
 		if (view) {
@@ -127,6 +134,9 @@ Model& Model::operator=( const Model &other ) {
                 new ModelParameter(*modelParam.data()));
             modelParameters_->append(copy);
         }
+
+        viewIndex_.invalidate();
+        portIndex_.invalidate();
     }
 	return *this;
 }
@@ -186,14 +196,14 @@ void Model::write(QXmlStreamWriter& writer) {
 //-----------------------------------------------------------------------------
 // Function: model::isValid()
 //-----------------------------------------------------------------------------
-bool Model::isValid( const QStringList& fileSetNames,
+bool Model::isValid( const QSet<QString>& fileSetNames,
                     QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices,
 					QStringList& errorList, 
 					const QString& parentIdentifier ) const {
 	bool valid = true;
 	bool hasViews = !views_.isEmpty();
 
-	QStringList portNames;
+	QSet<QString> portNames;
 	foreach (QSharedPointer<Port> port, ports_) {
 
 		if (portNames.contains(port->getName())) {
@@ -202,7 +212,7 @@ bool Model::isValid( const QStringList& fileSetNames,
 			valid = false;
 		}
 		else {
-			portNames.append(port->getName());
+			portNames.insert(port->getName());
 		}
 
 		if (!port->isValid(hasViews, errorList, parentIdentifier)) {
@@ -210,7 +220,7 @@ bool Model::isValid( const QStringList& fileSetNames,
 		}
 	}
 
-	QStringList viewNames;
+	QSet<QString> viewNames;
 	foreach (QSharedPointer<View> view, views_) {
 
 		if (viewNames.contains(view->getName())) {
@@ -219,7 +229,7 @@ bool Model::isValid( const QStringList& fileSetNames,
 			valid = false;
 		}
 		else {
-			viewNames.append(view->getName());
+			viewNames.insert(view->getName());
 		}
 
 		if (!view->isValid(fileSetNames, componentChoices, errorList, parentIdentifier)) {
@@ -228,7 +238,7 @@ bool Model::isValid( const QStringList& fileSetNames,
 	}
 
     ModelParameterValidator validator;
-	QStringList modelParamNames;
+	QSet<QString> modelParamNames;
 	foreach (QSharedPointer<ModelParameter> modelParam, *modelParameters_) 
     {
 		if (modelParamNames.contains(modelParam->getName())) {
@@ -238,7 +248,7 @@ bool Model::isValid( const QStringList& fileSetNames,
 		}
 		else 
         {
-			modelParamNames.append(modelParam->getName());
+			modelParamNames.insert(modelParam->getName());
 		}
 
         errorList.append(validator.findErrorsIn(modelParam.data(), parentIdentifier, componentChoices));
@@ -254,18 +264,18 @@ bool Model::isValid( const QStringList& fileSetNames,
 //-----------------------------------------------------------------------------
 // Function: model::isValid()
 //-----------------------------------------------------------------------------
-bool Model::isValid(const QStringList& fileSetNames,
+bool Model::isValid(const QSet<QString>& fileSetNames,
      QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices) const {
 	bool hasViews = !views_.isEmpty();
 
-	QStringList portNames;
+	QSet<QString> portNames;
 	foreach (QSharedPointer<Port> port, ports_) {
 
 		if (portNames.contains(port->getName())) {
 			return false;
 		}
 		else {
-			portNames.append(port->getName());
+			portNames.insert(port->getName());
 		}
 
 		if (!port->isValid(hasViews)) {
@@ -273,14 +283,14 @@ bool Model::isValid(const QStringList& fileSetNames,
 		}
 	}
 
-	QStringList viewNames;
+	QSet<QString> viewNames;
 	foreach (QSharedPointer<View> view, views_) {
 
 		if (viewNames.contains(view->getName())) {
 			return false;
 		}
 		else {
-			viewNames.append(view->getName());
+			viewNames.insert(view->getName());
 		}
 
 		if (!view->isValid(fileSetNames, componentChoices)) {
@@ -289,7 +299,7 @@ bool Model::isValid(const QStringList& fileSetNames,
 	}
 
     ModelParameterValidator validator;
-	QStringList modelParamNames;
+	QSet<QString> modelParamNames;
 	foreach (QSharedPointer<ModelParameter> modelParam, *modelParameters_)
     {
 		if (modelParamNames.contains(modelParam->getName()))
@@ -298,7 +308,7 @@ bool Model::isValid(const QStringList& fileSetNames,
 		}
 		else
         {
-			modelParamNames.append(modelParam->getName());
+			modelParamNames.insert(modelParam->getName());
 		}
 
 		if (!validator.validate(modelParam.data(), componentChoices))
@@ -316,6 +326,7 @@ void Model::setViews(const QList<QSharedPointer<View> > &views) {
 
 	// save the new views
 	views_ = views;
+	viewIndex_.invalidate();
 }
 
 const QList<QSharedPointer<View> >& Model::getViews() const {
@@ -411,17 +422,7 @@ QMap<QString, VLNV> Model::getHierRefNames() const {
 }
 
 View* Model::findView(const QString name) const {
-	// search all views
-	for (int i = 0; i < views_.size(); ++i) {
-
-		// if the view has the specified name
-		if (views_.at(i)->getName() == name) {
-			return views_.at(i).data();
-		}
-	}
-
-	// view was not found
-	return 0;
+	return viewIndex_.find(views_, name).data();
 }
 
 void Model::addView(View* newView) {
@@ -446,6 +447,8 @@ void Model::removeView(const QString& name) {
             i--;
 		}
 	}
+
+	viewIndex_.invalidate();
 }
 
 View* Model::createView() {
@@ -652,13 +655,7 @@ QList<QSharedPointer<Port> >& Model::getPorts() {
 }
 
 QSharedPointer<Port> Model::getPort( const QString& name ) const {
-
-	foreach (QSharedPointer<Port> port, ports_) {
-		if (port->getName() == name) {
-			return port;
-		}
-	}
-	return QSharedPointer<Port>();
+	return portIndex_.find(ports_, name);
 }
 
 int Model::getPortWidth( const QString& portName ) const {
@@ -690,6 +687,8 @@ void Model::removePort( const QString& portName ) {
 			--i;
 		}
 	}
+
+	portIndex_.invalidate();
 }
 
 bool Model::renamePort( const QString& oldName, const QString& newName ) {
@@ -701,6 +700,8 @@ bool Model::renamePort( const QString& oldName, const QString& newName ) {
 			found = true;
 		}
 	}
+
+	portIndex_.invalidate();
 	return found;
 }
 
@@ -714,10 +715,9 @@ QStringList Model::getPortNames() const {
 
 General::Direction Model::getPortDirection( const QString& portName ) const {
 
-	foreach (QSharedPointer<Port> port, ports_) {
-		if (port->getName() == portName) {
-			return port->getDirection();
-		}
+	QSharedPointer<Port> port = getPort(portName);
+	if (port) {
+		return port->getDirection();
 	}
 	return General::DIRECTION_INVALID;
 }
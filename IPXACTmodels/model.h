@@ -10,6 +10,7 @@
 #include "port.h"
 #include "view.h"
 #include "modelparameter.h"
+#include "NameIndex.h"
 
 #include "ipxactmodels_global.h"
 
@@ -18,6 +19,7 @@
 #include <QSharedPointer>
 #include <QXmlStreamWriter>
 #include <QStringList>
+#include <QSet>
 
 class Choice;
 class VLNV;
@@ -77,7 +79,7 @@ public:
 	 *
 	 * \return bool True if the state is valid and writing is possible.
 	*/
-	bool isValid(const QStringList& fileSetNames, 
+	bool isValid(const QSet<QString>& fileSetNames, 
         QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices,
 		QStringList& errorList, 
 		const QString& parentIdentifier) const;
@@ -89,7 +91,7 @@ public:
 	 * 
 	 * \return bool True if the state is valid and writing is possible.
 	*/
-	bool isValid(const QStringList& fileSetNames,
+	bool isValid(const QSet<QString>& fileSetNames,
          QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices) const;
 
 	/*! \brief Get the views of this model
@@ -466,6 +468,12 @@ private:
 	 */
 	QSharedPointer<QList<QSharedPointer<ModelParameter> > > modelParameters_;
 
+	//! The index for finding the views by name.
+	NameIndex<View> viewIndex_;
+
+	//! The index for finding the ports by name.
+	NameIndex<Port> portIndex_;
+
 };
 
 #endif /* MODEL_H_ */
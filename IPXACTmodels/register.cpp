@@ -215,22 +215,8 @@ void Register::write(QXmlStreamWriter& writer)
 bool Register::isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices,
     QStringList& errorList,QString const& parentIdentifier ) const
 {
-	bool valid = true;
-	const QString thisIdentifier(QObject::tr("register %1").arg(nameGroup_.name()));
-
-	if (nameGroup_.name().isEmpty())
-    {
-		errorList.append(QObject::tr("No name specified for register within %1").arg(
-			parentIdentifier));
-		valid = false;
-	}
-
-	if (addressOffset_.isEmpty())
-    {
-		errorList.append(QObject::tr("No address offset set for register %1"
-			" within %2").arg(nameGroup_.name()).arg(parentIdentifier));
-		valid = false;
-	}
+	bool valid = isValidValues(nameGroup_.name(), addressOffset_, &errorList, parentIdentifier);
+	const QString thisIdentifier(getIdentifier(nameGroup_.name()));
 
 	if (!registerDefinition_.isValid(componentChoices, errorList, thisIdentifier))
     {
@@ -264,12 +250,7 @@ bool Register::isValid(QSharedPointer<QList<QSharedPointer<Choice> > > component
 //-----------------------------------------------------------------------------
 bool Register::isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices) const
 {
-	if (nameGroup_.name().isEmpty()) 
-    {
-		return false;
-	}
-
-	if (addressOffset_.isEmpty())
+	if (!isValidValues(nameGroup_.name(), addressOffset_, 0, QString()))
     {
 		return false;
 	}
@@ -299,6 +280,44 @@ bool Register::isValid(QSharedPointer<QList<QSharedPointer<Choice> > > component
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: Register::isValidValues()
+//-----------------------------------------------------------------------------
+bool Register::isValidValues(QString const& name, QString const& addressOffset, QStringList* errorList,
+    QString const& parentIdentifier)
+{
+    bool valid = true;
+
+    if (name.isEmpty())
+    {
+        if (errorList)
+        {
+            errorList->append(QObject::tr("No name specified for register within %1").arg(parentIdentifier));
+        }
+        valid = false;
+    }
+
+    if (addressOffset.isEmpty())
+    {
+        if (errorList)
+        {
+            errorList->append(QObject::tr("No address offset set for register %1"
+                " within %2").arg(name).arg(parentIdentifier));
+        }
+        valid = false;
+    }
+
+    return valid;
+}
+
+//-----------------------------------------------------------------------------
+// Function: Register::getIdentifier()
+//-----------------------------------------------------------------------------
+QString Register::getIdentifier(QString const& name)
+{
+    return QObject::tr("register %1").arg(name);
+}
+
 //-----------------------------------------------------------------------------
 // Function: Register::getAddressOffset()
 //-----------------------------------------------------------------------------
@@ -101,6 +101,26 @@ public:
 	*/
     virtual bool isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices) const;
 
+	/*! \brief Check if the given name and address offset of a register are valid.
+	 *
+	 * \param name The name of the register.
+	 * \param addressOffset The address offset of the register.
+	 * \param errorList The list to add the possible error messages to or null, if not needed.
+	 * \param parentIdentifier String from parent to help to identify the location of the error.
+	 *
+	 * \return bool True if the values are valid.
+	*/
+    static bool isValidValues(QString const& name, QString const& addressOffset, QStringList* errorList,
+        QString const& parentIdentifier);
+
+	/*! \brief Get the string identifying a register in the error messages of its elements.
+	 *
+	 * \param name The name of the register.
+	 *
+	 * \return The identifier of the register.
+	*/
+    static QString getIdentifier(QString const& name);
+
 	/*! \brief Get the addressOffset of the register
 	 *
 	 * \return QString containing the address offset.
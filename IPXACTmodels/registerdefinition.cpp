@@ -164,12 +164,7 @@ bool RegisterDefinition::isValid(QSharedPointer<QList<QSharedPointer<Choice> > >
     QStringList& errorList, 
 								 const QString& parentIdentifier ) const {
 
-	bool valid = true;
-
-	if (size_ == 0) {
-		errorList.append(QObject::tr("No size specified for %1").arg(parentIdentifier));
-		valid = false;
-	}
+	bool valid = isValidSize(size_, &errorList, parentIdentifier);
 
 	if (reset_ && !reset_->isValid(errorList, parentIdentifier)) {
 		valid = false;
@@ -187,7 +182,7 @@ bool RegisterDefinition::isValid(QSharedPointer<QList<QSharedPointer<Choice> > >
 
 bool RegisterDefinition::isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices) const
 {
-	if (size_ == 0)
+	if (!isValidSize(size_, 0, QString()))
     {
 		return false;
 	}
@@ -208,6 +203,16 @@ bool RegisterDefinition::isValid(QSharedPointer<QList<QSharedPointer<Choice> > >
 	return true;
 }
 
+bool RegisterDefinition::isValidSize(unsigned int size, QStringList* errorList, QString const& parentIdentifier) {
+	if (size == 0) {
+		if (errorList) {
+			errorList->append(QObject::tr("No size specified for %1").arg(parentIdentifier));
+		}
+		return false;
+	}
+	return true;
+}
+
 General::Access RegisterDefinition::getAccess() const {
 	return access_;
 }
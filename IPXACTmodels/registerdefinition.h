@@ -83,6 +83,16 @@ public:
 	*/
 	bool isValid(QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices) const;
 
+	/*! \brief Check if the given register size is valid.
+	 *
+	 * \param size The size of the register.
+	 * \param errorList The list to add the possible error message to or null, if not needed.
+	 * \param parentIdentifier String from parent to help to identify the location of the error.
+	 *
+	 * \return bool True if the size is valid.
+	*/
+	static bool isValidSize(unsigned int size, QStringList* errorList, QString const& parentIdentifier);
+
 	/*! \brief Get the access.
 	 *
 	 * \return enum Access.
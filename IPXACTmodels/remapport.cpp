@@ -82,7 +82,7 @@ void RemapPort::write(QXmlStreamWriter& writer) {
 	return;
 }
 
-bool RemapPort::isValid( const QStringList& portNames, 
+bool RemapPort::isValid( QSet<QString> const& portNames, 
 						QStringList& errorList, 
 						const QString& parentIdentifier ) const {
 	bool valid = true;
@@ -108,7 +108,7 @@ bool RemapPort::isValid( const QStringList& portNames,
 	return valid;
 }
 
-bool RemapPort::isValid( const QStringList& portNames ) const {
+bool RemapPort::isValid( QSet<QString> const& portNames ) const {
 	if (value_.isEmpty()) {
 		return false;
 	}
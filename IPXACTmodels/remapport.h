@@ -13,6 +13,7 @@
 
 #include <QString>
 #include <QList>
+#include <QSet>
 #include <QDomNode>
 #include <QXmlStreamWriter>
 
@@ -64,23 +65,23 @@ public:
 
 	/*! \brief Check if the remap port is in a valid state.
 	 *
-	 * \param portNames List containing the names of the ports of the component.
+	 * \param portNames The names of the ports of the component.
 	 * \param errorList The list to add the possible error messages to.
 	 * \param parentIdentifier String from parent to help to identify the location of the error.
 	 *
 	 * \return bool True if the state is valid and writing is possible.
 	*/
-	bool isValid(const QStringList& portNames,
+	bool isValid(QSet<QString> const& portNames,
 		QStringList& errorList, 
 		const QString& parentIdentifier) const;
 
 	/*! \brief Check if the remap port is in a valid state.
 	 * 
-	 * \param portNames List containing the names of the ports of the component.
+	 * \param portNames The names of the ports of the component.
 	 * 
 	 * \return bool True if the state is valid and writing is possible.
 	*/
-	bool isValid(const QStringList& portNames) const;
+	bool isValid(QSet<QString> const& portNames) const;
 
 	/*! \brief Get the value of the port name ref element
 	 *
@@ -120,7 +120,7 @@ void RemapState::write(QXmlStreamWriter& writer)
 //-----------------------------------------------------------------------------
 // Function: remapstate::isValid()
 //-----------------------------------------------------------------------------
-bool RemapState::isValid( const QStringList& portNames,
+bool RemapState::isValid( QSet<QString> const& portNames,
 						 QStringList& errorList,
 						 const QString& parentIdentifier ) const
 {
@@ -146,7 +146,7 @@ bool RemapState::isValid( const QStringList& portNames,
 //-----------------------------------------------------------------------------
 // Function: remapstate::isValid()
 //-----------------------------------------------------------------------------
-bool RemapState::isValid( const QStringList& portNames ) const
+bool RemapState::isValid( QSet<QString> const& portNames ) const
 {
     if (nameGroup_.name().isEmpty())
     {
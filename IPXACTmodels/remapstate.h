@@ -15,6 +15,7 @@
 
 #include <QString>
 #include <QList>
+#include <QSet>
 #include <QXmlStreamWriter>
 
 /*! \brief Equals to the spirit:remapState element in the IP-Xact specification
@@ -80,22 +81,22 @@ public:
     /*!
 	 *  Check if the remap state is in a valid state.
 	 *
-	 *      @param [in] portNames           List containing the names of the ports of the component.
+	 *      @param [in] portNames           The names of the ports of the component.
 	 *      @param [in] errorList           The list to add the possible error messages to.
 	 *      @param [in] parentIdentifier    String from parent to help identify the location of the erro.
      *
      *      @return True, if the state is valid, false otherwise.
 	 */
-	bool isValid(const QStringList& portNames, QStringList& errorList, const QString& parentIdentifier) const;
+	bool isValid(QSet<QString> const& portNames, QStringList& errorList, const QString& parentIdentifier) const;
 
 	/*!
 	 *  Check if the remap state is in a valid state.
 	 *
-	 *      @param [in] portNames   List containing the names of the ports of the component.
+	 *      @param [in] portNames   The names of the ports of the component.
      *
      *      @return True, if the state is valid and writing is possible.
 	 */
-	bool isValid(const QStringList& portNames) const;
+	bool isValid(QSet<QString> const& portNames) const;
 
     /*!
 	 *  Get the name of the remap state.
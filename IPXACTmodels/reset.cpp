@@ -69,16 +69,19 @@ void Reset::write(QXmlStreamWriter& writer) {
 }
 
 bool Reset::isValid( QStringList& errorList, const QString& parentIdentifier ) const {
-	if (value_.isEmpty()) {
-		errorList.append(QObject::tr("No value set for reset within %1").arg(
-			parentIdentifier));
-		return false;
-	}
-	return true;
+	return isValidValue(value_, &errorList, parentIdentifier);
 }
 
 bool Reset::isValid() const {
-	if (value_.isEmpty()) {
+	return isValidValue(value_, 0, QString());
+}
+
+bool Reset::isValidValue(QString const& value, QStringList* errorList, QString const& parentIdentifier) {
+	if (value.isEmpty()) {
+		if (errorList) {
+			errorList->append(QObject::tr("No value set for reset within %1").arg(
+				parentIdentifier));
+		}
 		return false;
 	}
 	return true;
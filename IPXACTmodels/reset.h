@@ -73,6 +73,16 @@ public:
 	*/
 	bool isValid() const;
 
+	/*! \brief Check if the given reset value is valid.
+	 *
+	 * \param value The reset value.
+	 * \param errorList The list to add the possible error message to or null, if not needed.
+	 * \param parentIdentifier String from parent to help to identify the location of the error.
+	 *
+	 * \return bool True if the value is valid.
+	*/
+	static bool isValidValue(QString const& value, QStringList* errorList, QString const& parentIdentifier);
+
 	/*! \brief Get the mask.
 	 *
 	 * \return The mask bits.
@@ -0,0 +1,74 @@
+//-----------------------------------------------------------------------------
+// File: AbstractionDefinitionStreamReader.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Reader for IP-XACT abstraction definitions in a single streaming pass.
+//-----------------------------------------------------------------------------
+
+#include "AbstractionDefinitionStreamReader.h"
+
+#include <IPXACTmodels/abstractiondefinition.h>
+#include <IPXACTmodels/portabstraction.h>
+
+namespace
+{
+    //! The path of the elements read as fragments.
+    const QString PORT_PATH = "spirit:abstractionDefinition/spirit:ports/spirit:port";
+}
+
+//-----------------------------------------------------------------------------
+// Function: AbstractionDefinitionStreamReader::AbstractionDefinitionStreamReader()
+//-----------------------------------------------------------------------------
+AbstractionDefinitionStreamReader::AbstractionDefinitionStreamReader(): DocumentStreamReader(), ports_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: AbstractionDefinitionStreamReader::~AbstractionDefinitionStreamReader()
+//-----------------------------------------------------------------------------
+AbstractionDefinitionStreamReader::~AbstractionDefinitionStreamReader()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: AbstractionDefinitionStreamReader::read()
+//-----------------------------------------------------------------------------
+QSharedPointer<AbstractionDefinition> AbstractionDefinitionStreamReader::read(QIODevice* device)
+{
+    ports_.clear();
+
+    QDomDocument skeleton;
+    if (!readDocument(device, skeleton))
+    {
+        return QSharedPointer<AbstractionDefinition>();
+    }
+
+    QSharedPointer<AbstractionDefinition> abstractionDefinition(new AbstractionDefinition(skeleton));
+    abstractionDefinition->getPorts().append(ports_);
+
+    ports_.clear();
+
+    return abstractionDefinition;
+}
+
+//-----------------------------------------------------------------------------
+// Function: AbstractionDefinitionStreamReader::isFragment()
+//-----------------------------------------------------------------------------
+bool AbstractionDefinitionStreamReader::isFragment(QString const& path) const
+{
+    return path == PORT_PATH;
+}
+
+//-----------------------------------------------------------------------------
+// Function: AbstractionDefinitionStreamReader::readFragment()
+//-----------------------------------------------------------------------------
+void AbstractionDefinitionStreamReader::readFragment(QString const& /*path*/, QDomNode& fragmentNode)
+{
+    ports_.append(QSharedPointer<PortAbstraction>(new PortAbstraction(fragmentNode)));
+}
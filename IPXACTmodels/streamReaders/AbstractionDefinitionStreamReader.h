@@ -0,0 +1,67 @@
+//-----------------------------------------------------------------------------
+// File: AbstractionDefinitionStreamReader.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Reader for IP-XACT abstraction definitions in a single streaming pass.
+//-----------------------------------------------------------------------------
+
+#ifndef ABSTRACTIONDEFINITIONSTREAMREADER_H
+#define ABSTRACTIONDEFINITIONSTREAMREADER_H
+
+#include "DocumentStreamReader.h"
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+
+#include <QList>
+#include <QSharedPointer>
+
+class AbstractionDefinition;
+class PortAbstraction;
+
+//-----------------------------------------------------------------------------
+//! Reader for IP-XACT abstraction definitions in a single streaming pass.
+//
+// The logical ports are read one element at a time.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT AbstractionDefinitionStreamReader : public DocumentStreamReader
+{
+public:
+
+    //! The constructor.
+    AbstractionDefinitionStreamReader();
+
+    //! The destructor.
+    virtual ~AbstractionDefinitionStreamReader();
+
+    /*!
+     *  Reads an abstraction definition from the given device.
+     *
+     *      @param [in] device  The device to read the abstraction definition from.
+     *
+     *      @return The read abstraction definition or null, if the document could not be read.
+     */
+    QSharedPointer<AbstractionDefinition> read(QIODevice* device);
+
+protected:
+
+    //! Checks if the element in the given path is read as a separate fragment.
+    virtual bool isFragment(QString const& path) const;
+
+    //! Reads a fragment of the document.
+    virtual void readFragment(QString const& path, QDomNode& fragmentNode);
+
+private:
+
+    // Disable copying.
+    AbstractionDefinitionStreamReader(AbstractionDefinitionStreamReader const& rhs);
+    AbstractionDefinitionStreamReader& operator=(AbstractionDefinitionStreamReader const& rhs);
+
+    //! The logical ports read from the fragments.
+    QList<QSharedPointer<PortAbstraction> > ports_;
+};
+
+#endif // ABSTRACTIONDEFINITIONSTREAMREADER_H
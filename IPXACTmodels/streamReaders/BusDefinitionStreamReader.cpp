@@ -0,0 +1,60 @@
+//-----------------------------------------------------------------------------
+// File: BusDefinitionStreamReader.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Reader for IP-XACT bus definitions in a single streaming pass.
+//-----------------------------------------------------------------------------
+
+#include "BusDefinitionStreamReader.h"
+
+#include <IPXACTmodels/busdefinition.h>
+
+//-----------------------------------------------------------------------------
+// Function: BusDefinitionStreamReader::BusDefinitionStreamReader()
+//-----------------------------------------------------------------------------
+BusDefinitionStreamReader::BusDefinitionStreamReader(): DocumentStreamReader()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: BusDefinitionStreamReader::~BusDefinitionStreamReader()
+//-----------------------------------------------------------------------------
+BusDefinitionStreamReader::~BusDefinitionStreamReader()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: BusDefinitionStreamReader::read()
+//-----------------------------------------------------------------------------
+QSharedPointer<BusDefinition> BusDefinitionStreamReader::read(QIODevice* device)
+{
+    QDomDocument skeleton;
+    if (!readDocument(device, skeleton))
+    {
+        return QSharedPointer<BusDefinition>();
+    }
+
+    return QSharedPointer<BusDefinition>(new BusDefinition(skeleton));
+}
+
+//-----------------------------------------------------------------------------
+// Function: BusDefinitionStreamReader::isFragment()
+//-----------------------------------------------------------------------------
+bool BusDefinitionStreamReader::isFragment(QString const& /*path*/) const
+{
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BusDefinitionStreamReader::readFragment()
+//-----------------------------------------------------------------------------
+void BusDefinitionStreamReader::readFragment(QString const& /*path*/, QDomNode& /*fragmentNode*/)
+{
+
+}
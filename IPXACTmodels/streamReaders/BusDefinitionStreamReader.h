@@ -0,0 +1,62 @@
+//-----------------------------------------------------------------------------
+// File: BusDefinitionStreamReader.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Reader for IP-XACT bus definitions in a single streaming pass.
+//-----------------------------------------------------------------------------
+
+#ifndef BUSDEFINITIONSTREAMREADER_H
+#define BUSDEFINITIONSTREAMREADER_H
+
+#include "DocumentStreamReader.h"
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+
+#include <QSharedPointer>
+
+class BusDefinition;
+
+//-----------------------------------------------------------------------------
+//! Reader for IP-XACT bus definitions in a single streaming pass.
+//
+// Bus definitions have no repeated elements of notable size, so the whole document is read into the skeleton.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT BusDefinitionStreamReader : public DocumentStreamReader
+{
+public:
+
+    //! The constructor.
+    BusDefinitionStreamReader();
+
+    //! The destructor.
+    virtual ~BusDefinitionStreamReader();
+
+    /*!
+     *  Reads a bus definition from the given device.
+     *
+     *      @param [in] device  The device to read the bus definition from.
+     *
+     *      @return The read bus definition or null, if the document could not be read.
+     */
+    QSharedPointer<BusDefinition> read(QIODevice* device);
+
+protected:
+
+    //! Checks if the element in the given path is read as a separate fragment.
+    virtual bool isFragment(QString const& path) const;
+
+    //! Reads a fragment of the document.
+    virtual void readFragment(QString const& path, QDomNode& fragmentNode);
+
+private:
+
+    // Disable copying.
+    BusDefinitionStreamReader(BusDefinitionStreamReader const& rhs);
+    BusDefinitionStreamReader& operator=(BusDefinitionStreamReader const& rhs);
+};
+
+#endif // BUSDEFINITIONSTREAMREADER_H
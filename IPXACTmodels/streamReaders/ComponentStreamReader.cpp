@@ -0,0 +1,137 @@
+//-----------------------------------------------------------------------------
+// File: ComponentStreamReader.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Reader for IP-XACT components in a single streaming pass.
+//-----------------------------------------------------------------------------
+
+#include "ComponentStreamReader.h"
+
+#include <IPXACTmodels/addressblock.h>
+#include <IPXACTmodels/businterface.h>
+#include <IPXACTmodels/component.h>
+#include <IPXACTmodels/fileset.h>
+#include <IPXACTmodels/memorymap.h>
+#include <IPXACTmodels/model.h>
+#include <IPXACTmodels/port.h>
+
+namespace
+{
+    //! The paths of the elements read as fragments.
+    const QString BUS_INTERFACE_PATH = "spirit:component/spirit:busInterfaces/spirit:busInterface";
+    const QString FILE_SET_PATH = "spirit:component/spirit:fileSets/spirit:fileSet";
+    const QString PORT_PATH = "spirit:component/spirit:model/spirit:ports/spirit:port";
+    const QString REGISTER_PATH =
+        "spirit:component/spirit:memoryMaps/spirit:memoryMap/spirit:addressBlock/spirit:register";
+
+    //! The path of the address blocks containing the fragment registers.
+    const QString ADDRESS_BLOCK_PATH = "spirit:component/spirit:memoryMaps/spirit:memoryMap/spirit:addressBlock";
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentStreamReader::ComponentStreamReader()
+//-----------------------------------------------------------------------------
+ComponentStreamReader::ComponentStreamReader(): DocumentStreamReader(), busInterfaces_(), fileSets_(),
+    ports_(), blockRegisters_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentStreamReader::~ComponentStreamReader()
+//-----------------------------------------------------------------------------
+ComponentStreamReader::~ComponentStreamReader()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentStreamReader::read()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> ComponentStreamReader::read(QIODevice* device)
+{
+    busInterfaces_.clear();
+    fileSets_.clear();
+    ports_.clear();
+    blockRegisters_.clear();
+
+    QDomDocument skeleton;
+    if (!readDocument(device, skeleton))
+    {
+        return QSharedPointer<Component>();
+    }
+
+    QSharedPointer<Component> component(new Component(skeleton));
+
+    // The fragments were left out of the skeleton, so they follow the elements built from it.
+    component->getBusInterfaces().append(busInterfaces_);
+    component->getFileSets().append(fileSets_);
+    component->getModel()->getPorts().append(ports_);
+
+    int blockIndex = 0;
+    foreach (QSharedPointer<MemoryMap> memoryMap, component->getMemoryMaps())
+    {
+        foreach (QSharedPointer<MemoryMapItem> item, memoryMap->getItems())
+        {
+            QSharedPointer<AddressBlock> addressBlock = item.dynamicCast<AddressBlock>();
+            if (addressBlock && blockIndex < blockRegisters_.size())
+            {
+                addressBlock->takeRegisters(*blockRegisters_.at(blockIndex));
+                ++blockIndex;
+            }
+        }
+    }
+
+    busInterfaces_.clear();
+    fileSets_.clear();
+    ports_.clear();
+    blockRegisters_.clear();
+
+    return component;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentStreamReader::elementStarted()
+//-----------------------------------------------------------------------------
+void ComponentStreamReader::elementStarted(QString const& path)
+{
+    if (path == ADDRESS_BLOCK_PATH)
+    {
+        blockRegisters_.append(QSharedPointer<AddressBlock>(new AddressBlock()));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentStreamReader::isFragment()
+//-----------------------------------------------------------------------------
+bool ComponentStreamReader::isFragment(QString const& path) const
+{
+    return path == REGISTER_PATH || path == PORT_PATH || path == BUS_INTERFACE_PATH || path == FILE_SET_PATH;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentStreamReader::readFragment()
+//-----------------------------------------------------------------------------
+void ComponentStreamReader::readFragment(QString const& path, QDomNode& fragmentNode)
+{
+    if (path == REGISTER_PATH)
+    {
+        blockRegisters_.last()->addRegister(fragmentNode);
+    }
+    else if (path == PORT_PATH)
+    {
+        ports_.append(QSharedPointer<Port>(new Port(fragmentNode)));
+    }
+    else if (path == BUS_INTERFACE_PATH)
+    {
+        busInterfaces_.append(QSharedPointer<BusInterface>(new BusInterface(fragmentNode)));
+    }
+    else if (path == FILE_SET_PATH)
+    {
+        fileSets_.append(QSharedPointer<FileSet>(new FileSet(fragmentNode)));
+    }
+}
@@ -0,0 +1,87 @@
+//-----------------------------------------------------------------------------
+// File: ComponentStreamReader.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Reader for IP-XACT components in a single streaming pass.
+//-----------------------------------------------------------------------------
+
+#ifndef COMPONENTSTREAMREADER_H
+#define COMPONENTSTREAMREADER_H
+
+#include "DocumentStreamReader.h"
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+
+#include <QList>
+#include <QSharedPointer>
+
+class AddressBlock;
+class BusInterface;
+class Component;
+class FileSet;
+class Port;
+
+//-----------------------------------------------------------------------------
+//! Reader for IP-XACT components in a single streaming pass.
+//
+// The bus interfaces, file sets, ports and the registers of the memory map address blocks are read
+// one element at a time, so the DOM of a register-heavy component is never built as a whole.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT ComponentStreamReader : public DocumentStreamReader
+{
+public:
+
+    //! The constructor.
+    ComponentStreamReader();
+
+    //! The destructor.
+    virtual ~ComponentStreamReader();
+
+    /*!
+     *  Reads a component from the given device.
+     *
+     *      @param [in] device  The device to read the component from.
+     *
+     *      @return The read component or null, if the document could not be read.
+     */
+    QSharedPointer<Component> read(QIODevice* device);
+
+protected:
+
+    //! Called when an element of the skeleton starts.
+    virtual void elementStarted(QString const& path);
+
+    //! Checks if the element in the given path is read as a separate fragment.
+    virtual bool isFragment(QString const& path) const;
+
+    //! Reads a fragment of the document.
+    virtual void readFragment(QString const& path, QDomNode& fragmentNode);
+
+private:
+
+    // Disable copying.
+    ComponentStreamReader(ComponentStreamReader const& rhs);
+    ComponentStreamReader& operator=(ComponentStreamReader const& rhs);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The bus interfaces read from the fragments.
+    QList<QSharedPointer<BusInterface> > busInterfaces_;
+
+    //! The file sets read from the fragments.
+    QList<QSharedPointer<FileSet> > fileSets_;
+
+    //! The ports read from the fragments.
+    QList<QSharedPointer<Port> > ports_;
+
+    //! Holders for the registers of each memory map address block in document order.
+    QList<QSharedPointer<AddressBlock> > blockRegisters_;
+};
+
+#endif // COMPONENTSTREAMREADER_H
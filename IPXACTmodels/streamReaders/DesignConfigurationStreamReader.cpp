@@ -0,0 +1,99 @@
+//-----------------------------------------------------------------------------
+// File: DesignConfigurationStreamReader.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Reader for IP-XACT design configurations in a single streaming pass.
+//-----------------------------------------------------------------------------
+
+#include "DesignConfigurationStreamReader.h"
+
+#include <IPXACTmodels/designconfiguration.h>
+
+#include <QMap>
+
+namespace
+{
+    //! The path of the elements read as fragments.
+    const QString VIEW_CONFIGURATION_PATH = "spirit:designConfiguration/spirit:viewConfiguration";
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignConfigurationStreamReader::DesignConfigurationStreamReader()
+//-----------------------------------------------------------------------------
+DesignConfigurationStreamReader::DesignConfigurationStreamReader(): DocumentStreamReader(),
+    viewConfigurations_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignConfigurationStreamReader::~DesignConfigurationStreamReader()
+//-----------------------------------------------------------------------------
+DesignConfigurationStreamReader::~DesignConfigurationStreamReader()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignConfigurationStreamReader::read()
+//-----------------------------------------------------------------------------
+QSharedPointer<DesignConfiguration> DesignConfigurationStreamReader::read(QIODevice* device)
+{
+    viewConfigurations_.clear();
+
+    QDomDocument skeleton;
+    if (!readDocument(device, skeleton))
+    {
+        return QSharedPointer<DesignConfiguration>();
+    }
+
+    QSharedPointer<DesignConfiguration> designConfiguration(new DesignConfiguration(skeleton));
+
+    QMap<QString, QString> views = designConfiguration->getViewConfigurations();
+    for (int i = 0; i < viewConfigurations_.size(); ++i)
+    {
+        views.insert(viewConfigurations_.at(i).first, viewConfigurations_.at(i).second);
+    }
+    designConfiguration->setViewConfigurations(views);
+
+    viewConfigurations_.clear();
+
+    return designConfiguration;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignConfigurationStreamReader::isFragment()
+//-----------------------------------------------------------------------------
+bool DesignConfigurationStreamReader::isFragment(QString const& path) const
+{
+    return path == VIEW_CONFIGURATION_PATH;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignConfigurationStreamReader::readFragment()
+//-----------------------------------------------------------------------------
+void DesignConfigurationStreamReader::readFragment(QString const& /*path*/, QDomNode& fragmentNode)
+{
+    QString instanceName;
+    QString viewName;
+
+    for (int i = 0; i < fragmentNode.childNodes().count(); ++i)
+    {
+        QDomNode viewNode = fragmentNode.childNodes().at(i);
+
+        if (viewNode.nodeName() == QString("spirit:instanceName"))
+        {
+            instanceName = viewNode.childNodes().at(0).nodeValue();
+        }
+        else if (viewNode.nodeName() == QString("spirit:viewName"))
+        {
+            viewName = viewNode.childNodes().at(0).nodeValue();
+        }
+    }
+
+    viewConfigurations_.append(qMakePair(instanceName, viewName));
+}
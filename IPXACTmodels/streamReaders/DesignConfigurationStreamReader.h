@@ -0,0 +1,67 @@
+//-----------------------------------------------------------------------------
+// File: DesignConfigurationStreamReader.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Reader for IP-XACT design configurations in a single streaming pass.
+//-----------------------------------------------------------------------------
+
+#ifndef DESIGNCONFIGURATIONSTREAMREADER_H
+#define DESIGNCONFIGURATIONSTREAMREADER_H
+
+#include "DocumentStreamReader.h"
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+
+#include <QList>
+#include <QPair>
+#include <QSharedPointer>
+
+class DesignConfiguration;
+
+//-----------------------------------------------------------------------------
+//! Reader for IP-XACT design configurations in a single streaming pass.
+//
+// The view configurations of the instances are read one element at a time.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT DesignConfigurationStreamReader : public DocumentStreamReader
+{
+public:
+
+    //! The constructor.
+    DesignConfigurationStreamReader();
+
+    //! The destructor.
+    virtual ~DesignConfigurationStreamReader();
+
+    /*!
+     *  Reads a design configuration from the given device.
+     *
+     *      @param [in] device  The device to read the design configuration from.
+     *
+     *      @return The read design configuration or null, if the document could not be read.
+     */
+    QSharedPointer<DesignConfiguration> read(QIODevice* device);
+
+protected:
+
+    //! Checks if the element in the given path is read as a separate fragment.
+    virtual bool isFragment(QString const& path) const;
+
+    //! Reads a fragment of the document.
+    virtual void readFragment(QString const& path, QDomNode& fragmentNode);
+
+private:
+
+    // Disable copying.
+    DesignConfigurationStreamReader(DesignConfigurationStreamReader const& rhs);
+    DesignConfigurationStreamReader& operator=(DesignConfigurationStreamReader const& rhs);
+
+    //! The instance and view names of the view configurations in document order.
+    QList<QPair<QString, QString> > viewConfigurations_;
+};
+
+#endif // DESIGNCONFIGURATIONSTREAMREADER_H
@@ -0,0 +1,127 @@
+//-----------------------------------------------------------------------------
+// File: DesignStreamReader.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Reader for IP-XACT designs in a single streaming pass.
+//-----------------------------------------------------------------------------
+
+#include "DesignStreamReader.h"
+
+#include <IPXACTmodels/design.h>
+
+namespace
+{
+    //! The paths of the elements read as fragments.
+    const QString COMPONENT_INSTANCE_PATH = "spirit:design/spirit:componentInstances/spirit:componentInstance";
+    const QString INTERCONNECTION_PATH = "spirit:design/spirit:interconnections/spirit:interconnection";
+    const QString ADHOC_CONNECTION_PATH = "spirit:design/spirit:adHocConnections/spirit:adHocConnection";
+    const QString HIER_CONNECTION_PATH = "spirit:design/spirit:hierConnections/spirit:hierConnection";
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignStreamReader::DesignStreamReader()
+//-----------------------------------------------------------------------------
+DesignStreamReader::DesignStreamReader(): DocumentStreamReader(), componentInstances_(), interconnections_(),
+    adHocConnections_(), hierConnections_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignStreamReader::~DesignStreamReader()
+//-----------------------------------------------------------------------------
+DesignStreamReader::~DesignStreamReader()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignStreamReader::read()
+//-----------------------------------------------------------------------------
+QSharedPointer<Design> DesignStreamReader::read(QIODevice* device)
+{
+    componentInstances_.clear();
+    interconnections_.clear();
+    adHocConnections_.clear();
+    hierConnections_.clear();
+
+    QDomDocument skeleton;
+    if (!readDocument(device, skeleton))
+    {
+        return QSharedPointer<Design>();
+    }
+
+    QSharedPointer<Design> design(new Design(skeleton));
+
+    design->setComponentInstances(design->getComponentInstances() + componentInstances_);
+    design->setInterconnections(design->getInterconnections() + interconnections_);
+    design->setAdHocConnections(design->getAdHocConnections() + adHocConnections_);
+    design->setHierarchicalConnections(design->getHierarchicalConnections() + hierConnections_);
+
+    // The routes were parsed before the connections were added, so they are applied again.
+    QDomNode routesNode = findRoutes(skeleton);
+    if (!routesNode.isNull())
+    {
+        design->parseRoutes(routesNode);
+    }
+
+    componentInstances_.clear();
+    interconnections_.clear();
+    adHocConnections_.clear();
+    hierConnections_.clear();
+
+    return design;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignStreamReader::findRoutes()
+//-----------------------------------------------------------------------------
+QDomNode DesignStreamReader::findRoutes(QDomDocument const& skeleton) const
+{
+    QDomElement extensions = skeleton.documentElement().firstChildElement("spirit:vendorExtensions");
+
+    // The routes are found under kactus2:extensions or directly under spirit:vendorExtensions.
+    QDomElement routes = extensions.firstChildElement("kactus2:extensions").firstChildElement("kactus2:routes");
+    if (routes.isNull())
+    {
+        routes = extensions.firstChildElement("kactus2:routes");
+    }
+
+    return routes;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignStreamReader::isFragment()
+//-----------------------------------------------------------------------------
+bool DesignStreamReader::isFragment(QString const& path) const
+{
+    return path == COMPONENT_INSTANCE_PATH || path == INTERCONNECTION_PATH || path == ADHOC_CONNECTION_PATH ||
+        path == HIER_CONNECTION_PATH;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignStreamReader::readFragment()
+//-----------------------------------------------------------------------------
+void DesignStreamReader::readFragment(QString const& path, QDomNode& fragmentNode)
+{
+    if (path == COMPONENT_INSTANCE_PATH)
+    {
+        componentInstances_.append(ComponentInstance(fragmentNode));
+    }
+    else if (path == INTERCONNECTION_PATH)
+    {
+        interconnections_.append(Interconnection(fragmentNode));
+    }
+    else if (path == ADHOC_CONNECTION_PATH)
+    {
+        adHocConnections_.append(AdHocConnection(fragmentNode));
+    }
+    else if (path == HIER_CONNECTION_PATH)
+    {
+        hierConnections_.append(HierConnection(fragmentNode));
+    }
+}
@@ -0,0 +1,92 @@
+//-----------------------------------------------------------------------------
+// File: DesignStreamReader.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Reader for IP-XACT designs in a single streaming pass.
+//-----------------------------------------------------------------------------
+
+#ifndef DESIGNSTREAMREADER_H
+#define DESIGNSTREAMREADER_H
+
+#include "DocumentStreamReader.h"
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+#include <IPXACTmodels/AdHocConnection.h>
+#include <IPXACTmodels/ComponentInstance.h>
+#include <IPXACTmodels/HierConnection.h>
+#include <IPXACTmodels/Interconnection.h>
+
+#include <QList>
+#include <QSharedPointer>
+
+class Design;
+
+//-----------------------------------------------------------------------------
+//! Reader for IP-XACT designs in a single streaming pass.
+//
+// The component instances and the connections are read one element at a time.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT DesignStreamReader : public DocumentStreamReader
+{
+public:
+
+    //! The constructor.
+    DesignStreamReader();
+
+    //! The destructor.
+    virtual ~DesignStreamReader();
+
+    /*!
+     *  Reads a design from the given device.
+     *
+     *      @param [in] device  The device to read the design from.
+     *
+     *      @return The read design or null, if the document could not be read.
+     */
+    QSharedPointer<Design> read(QIODevice* device);
+
+protected:
+
+    //! Checks if the element in the given path is read as a separate fragment.
+    virtual bool isFragment(QString const& path) const;
+
+    //! Reads a fragment of the document.
+    virtual void readFragment(QString const& path, QDomNode& fragmentNode);
+
+private:
+
+    // Disable copying.
+    DesignStreamReader(DesignStreamReader const& rhs);
+    DesignStreamReader& operator=(DesignStreamReader const& rhs);
+
+    /*!
+     *  Finds the routes of the connections from the read document.
+     *
+     *      @param [in] skeleton    The document read without the fragments.
+     *
+     *      @return The kactus2:routes element or a null node, if the design has no routes.
+     */
+    QDomNode findRoutes(QDomDocument const& skeleton) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The component instances read from the fragments.
+    QList<ComponentInstance> componentInstances_;
+
+    //! The interconnections read from the fragments.
+    QList<Interconnection> interconnections_;
+
+    //! The ad-hoc connections read from the fragments.
+    QList<AdHocConnection> adHocConnections_;
+
+    //! The hierarchical connections read from the fragments.
+    QList<HierConnection> hierConnections_;
+};
+
+#endif // DESIGNSTREAMREADER_H
@@ -0,0 +1,488 @@
+//-----------------------------------------------------------------------------
+// File: DocumentStreamReader.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Base class for reading IP-XACT documents in a single streaming pass.
+//-----------------------------------------------------------------------------
+
+#include "DocumentStreamReader.h"
+
+#include <QObject>
+#include <QXmlStreamReader>
+
+namespace
+{
+    //! The bytes identifying a snapshot.
+    const quint32 SNAPSHOT_MAGIC = 0x4B32534E;
+
+    //! The node types in a snapshot.
+    enum SnapshotToken
+    {
+        NAME = 0,                   //!< A name used by the following elements and attributes.
+        START_ELEMENT,
+        END_ELEMENT,
+        TEXT,
+        CDATA_SECTION,
+        COMMENT,
+        PROCESSING_INSTRUCTION,
+        END_OF_DOCUMENT
+    };
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::DocumentStreamReader()
+//-----------------------------------------------------------------------------
+DocumentStreamReader::DocumentStreamReader(): errorString_(), skeleton_(), fragmentDocument_(), current_(),
+    fragmentParent_(), fragmentDepth_(0), path_(), snapshot_(0), snapshotDevice_(0), snapshotNames_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::~DocumentStreamReader()
+//-----------------------------------------------------------------------------
+DocumentStreamReader::~DocumentStreamReader()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::errorString()
+//-----------------------------------------------------------------------------
+QString DocumentStreamReader::errorString() const
+{
+    return errorString_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::setSnapshotDevice()
+//-----------------------------------------------------------------------------
+void DocumentStreamReader::setSnapshotDevice(QIODevice* device)
+{
+    snapshotDevice_ = device;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::isSnapshot()
+//-----------------------------------------------------------------------------
+bool DocumentStreamReader::isSnapshot(QIODevice* device)
+{
+    QByteArray magic = device->peek(int(sizeof(SNAPSHOT_MAGIC)));
+    if (magic.size() != int(sizeof(SNAPSHOT_MAGIC)))
+    {
+        return false;
+    }
+
+    QDataStream stream(magic);
+    quint32 value = 0;
+    stream >> value;
+
+    return value == SNAPSHOT_MAGIC;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::readDocument()
+//-----------------------------------------------------------------------------
+bool DocumentStreamReader::readDocument(QIODevice* device, QDomDocument& skeleton)
+{
+    errorString_.clear();
+
+    skeleton_ = skeleton;
+    fragmentDocument_ = QDomDocument();
+    current_ = skeleton_;
+    fragmentParent_ = QDomNode();
+    fragmentDepth_ = 0;
+    path_.clear();
+
+    bool success = false;
+    if (isSnapshot(device))
+    {
+        success = readSnapshot(device);
+    }
+    else
+    {
+        success = readXml(device);
+    }
+
+    current_.clear();
+    fragmentParent_.clear();
+    skeleton_ = QDomDocument();
+    fragmentDocument_ = QDomDocument();
+
+    return success;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::elementStarted()
+//-----------------------------------------------------------------------------
+void DocumentStreamReader::elementStarted(QString const& /*path*/)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::readXml()
+//-----------------------------------------------------------------------------
+bool DocumentStreamReader::readXml(QIODevice* device)
+{
+    QDataStream snapshotStream;
+    if (snapshotDevice_ != 0)
+    {
+        snapshotStream.setDevice(snapshotDevice_);
+        snapshotStream.setVersion(QDataStream::Qt_5_0);
+        snapshotStream << SNAPSHOT_MAGIC << SNAPSHOT_VERSION;
+
+        snapshot_ = &snapshotStream;
+        snapshotNames_.clear();
+    }
+
+    // The names are kept qualified as in a document read with QDomDocument::setContent().
+    QXmlStreamReader reader(device);
+    reader.setNamespaceProcessing(false);
+
+    while (!reader.atEnd())
+    {
+        reader.readNext();
+
+        if (reader.isStartDocument() && !reader.documentVersion().isEmpty())
+        {
+            QString declaration = QString("version=\"%1\"").arg(reader.documentVersion().toString());
+            if (!reader.documentEncoding().isEmpty())
+            {
+                declaration.append(QString(" encoding=\"%1\"").arg(reader.documentEncoding().toString()));
+            }
+
+            addProcessingInstruction("xml", declaration);
+        }
+        else if (reader.isStartElement())
+        {
+            startElement(reader.qualifiedName().toString(), reader.attributes());
+        }
+        else if (reader.isEndElement())
+        {
+            endElement();
+        }
+        else if (reader.isCDATA())
+        {
+            addCDataSection(reader.text().toString());
+        }
+        // Whitespace between the elements is dropped as in QDomDocument::setContent().
+        else if (reader.isCharacters() && !reader.isWhitespace())
+        {
+            addText(reader.text().toString());
+        }
+        else if (reader.isComment())
+        {
+            addComment(reader.text().toString());
+        }
+        else if (reader.isProcessingInstruction())
+        {
+            addProcessingInstruction(reader.processingInstructionTarget().toString(),
+                reader.processingInstructionData().toString());
+        }
+    }
+
+    if (snapshot_ != 0)
+    {
+        *snapshot_ << quint8(END_OF_DOCUMENT);
+
+        snapshot_ = 0;
+        snapshotNames_.clear();
+    }
+
+    if (reader.hasError())
+    {
+        errorString_ = QObject::tr("%1 on line %2, column %3.").arg(reader.errorString()).arg(
+            reader.lineNumber()).arg(reader.columnNumber());
+        return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::readSnapshot()
+//-----------------------------------------------------------------------------
+bool DocumentStreamReader::readSnapshot(QIODevice* device)
+{
+    QDataStream stream(device);
+    stream.setVersion(QDataStream::Qt_5_0);
+
+    quint32 magic = 0;
+    quint16 version = 0;
+    stream >> magic >> version;
+
+    if (version != SNAPSHOT_VERSION)
+    {
+        errorString_ = QObject::tr("Snapshot version %1 is not supported.").arg(version);
+        return false;
+    }
+
+    QVector<QString> names;
+
+    quint8 token = END_OF_DOCUMENT;
+    stream >> token;
+
+    while (stream.status() == QDataStream::Ok && token != END_OF_DOCUMENT)
+    {
+        if (token == NAME)
+        {
+            QString name;
+            stream >> name;
+            names.append(name);
+        }
+        else if (token == START_ELEMENT)
+        {
+            quint32 nameIndex = 0;
+            quint32 attributeCount = 0;
+            stream >> nameIndex >> attributeCount;
+
+            QXmlStreamAttributes attributes;
+            for (quint32 i = 0; i < attributeCount && stream.status() == QDataStream::Ok; ++i)
+            {
+                quint32 attributeIndex = 0;
+                QString value;
+                stream >> attributeIndex >> value;
+
+                if (attributeIndex >= quint32(names.size()))
+                {
+                    break;
+                }
+
+                attributes.append(names.at(attributeIndex), value);
+            }
+
+            if (nameIndex >= quint32(names.size()) || attributes.size() != int(attributeCount))
+            {
+                break;
+            }
+
+            startElement(names.at(nameIndex), attributes);
+        }
+        else if (token == END_ELEMENT)
+        {
+            if (path_.isEmpty())
+            {
+                break;
+            }
+
+            endElement();
+        }
+        else if (token == TEXT || token == CDATA_SECTION || token == COMMENT)
+        {
+            QString text;
+            stream >> text;
+
+            if (token == TEXT)
+            {
+                addText(text);
+            }
+            else if (token == CDATA_SECTION)
+            {
+                addCDataSection(text);
+            }
+            else
+            {
+                addComment(text);
+            }
+        }
+        else if (token == PROCESSING_INSTRUCTION)
+        {
+            QString target;
+            QString data;
+            stream >> target >> data;
+
+            addProcessingInstruction(target, data);
+        }
+        else
+        {
+            break;
+        }
+
+        stream >> token;
+    }
+
+    if (stream.status() != QDataStream::Ok || token != END_OF_DOCUMENT || !path_.isEmpty())
+    {
+        errorString_ = QObject::tr("The snapshot is corrupted.");
+        return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::startElement()
+//-----------------------------------------------------------------------------
+void DocumentStreamReader::startElement(QString const& name, QXmlStreamAttributes const& attributes)
+{
+    if (snapshot_ != 0)
+    {
+        quint32 nameIndex = recordName(name);
+
+        QVector<quint32> attributeIndices;
+        foreach (QXmlStreamAttribute const& attribute, attributes)
+        {
+            attributeIndices.append(recordName(attribute.qualifiedName().toString()));
+        }
+
+        *snapshot_ << quint8(START_ELEMENT) << nameIndex << quint32(attributes.size());
+        for (int i = 0; i < attributes.size(); ++i)
+        {
+            *snapshot_ << attributeIndices.at(i) << attributes.at(i).value().toString();
+        }
+    }
+
+    path_.append(name);
+    QString elementPath = path_.join("/");
+
+    if (fragmentDepth_ > 0)
+    {
+        ++fragmentDepth_;
+    }
+    else if (isFragment(elementPath))
+    {
+        fragmentDepth_ = 1;
+        fragmentParent_ = current_;
+        current_ = fragmentDocument_;
+    }
+    else
+    {
+        elementStarted(elementPath);
+    }
+
+    QDomElement element = currentOwner().createElement(name);
+    foreach (QXmlStreamAttribute const& attribute, attributes)
+    {
+        element.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+    }
+
+    current_.appendChild(element);
+    current_ = element;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::endElement()
+//-----------------------------------------------------------------------------
+void DocumentStreamReader::endElement()
+{
+    if (snapshot_ != 0)
+    {
+        *snapshot_ << quint8(END_ELEMENT);
+    }
+
+    if (fragmentDepth_ == 1)
+    {
+        readFragment(path_.join("/"), current_);
+
+        fragmentDocument_.removeChild(current_);
+        current_ = fragmentParent_;
+        fragmentDepth_ = 0;
+    }
+    else
+    {
+        if (fragmentDepth_ > 1)
+        {
+            --fragmentDepth_;
+        }
+
+        current_ = current_.parentNode();
+    }
+
+    path_.removeLast();
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::addText()
+//-----------------------------------------------------------------------------
+void DocumentStreamReader::addText(QString const& text)
+{
+    if (snapshot_ != 0)
+    {
+        *snapshot_ << quint8(TEXT) << text;
+    }
+
+    QDomNode previous = current_.lastChild();
+    if (previous.isText() && !previous.isCDATASection())
+    {
+        previous.toText().appendData(text);
+    }
+    else
+    {
+        current_.appendChild(currentOwner().createTextNode(text));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::addCDataSection()
+//-----------------------------------------------------------------------------
+void DocumentStreamReader::addCDataSection(QString const& text)
+{
+    if (snapshot_ != 0)
+    {
+        *snapshot_ << quint8(CDATA_SECTION) << text;
+    }
+
+    current_.appendChild(currentOwner().createCDATASection(text));
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::addComment()
+//-----------------------------------------------------------------------------
+void DocumentStreamReader::addComment(QString const& text)
+{
+    if (snapshot_ != 0)
+    {
+        *snapshot_ << quint8(COMMENT) << text;
+    }
+
+    current_.appendChild(currentOwner().createComment(text));
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::addProcessingInstruction()
+//-----------------------------------------------------------------------------
+void DocumentStreamReader::addProcessingInstruction(QString const& target, QString const& data)
+{
+    if (snapshot_ != 0)
+    {
+        *snapshot_ << quint8(PROCESSING_INSTRUCTION) << target << data;
+    }
+
+    current_.appendChild(currentOwner().createProcessingInstruction(target, data));
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::recordName()
+//-----------------------------------------------------------------------------
+quint32 DocumentStreamReader::recordName(QString const& name)
+{
+    QHash<QString, quint32>::const_iterator known = snapshotNames_.constFind(name);
+    if (known != snapshotNames_.constEnd())
+    {
+        return known.value();
+    }
+
+    quint32 index = snapshotNames_.size();
+    snapshotNames_.insert(name, index);
+    *snapshot_ << quint8(NAME) << name;
+
+    return index;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::currentOwner()
+//-----------------------------------------------------------------------------
+QDomDocument DocumentStreamReader::currentOwner() const
+{
+    if (fragmentDepth_ > 0)
+    {
+        return fragmentDocument_;
+    }
+
+    return skeleton_;
+}
@@ -0,0 +1,223 @@
+//-----------------------------------------------------------------------------
+// File: DocumentStreamReader.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Base class for reading IP-XACT documents in a single streaming pass.
+//-----------------------------------------------------------------------------
+
+#ifndef DOCUMENTSTREAMREADER_H
+#define DOCUMENTSTREAMREADER_H
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+
+#include <QDataStream>
+#include <QDomDocument>
+#include <QDomNode>
+#include <QHash>
+#include <QIODevice>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QXmlStreamAttributes>
+
+//-----------------------------------------------------------------------------
+//! Base class for reading IP-XACT documents in a single streaming pass.
+//
+// The document is read with QXmlStreamReader. The repeated elements selected by the derived reader are
+// built one at a time into a small fragment, handed to the reader and discarded, so that only the rest of
+// the document is kept in memory as a DOM skeleton. The derived reader builds the model from the skeleton
+// with the DOM constructors and adds the objects it built from the fragments.
+//
+// A document read from XML can be recorded as a binary snapshot of its nodes. Reading the snapshot gives
+// the same nodes without tokenizing the XML text, so a reader accepts either format from its device.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT DocumentStreamReader
+{
+public:
+
+    //! The constructor.
+    DocumentStreamReader();
+
+    //! The destructor.
+    virtual ~DocumentStreamReader();
+
+    /*!
+     *  Gets the error of the previous read.
+     *
+     *      @return The description of the error or an empty string, if the read succeeded.
+     */
+    QString errorString() const;
+
+    /*!
+     *  Sets the device to record the snapshot of the next document read from XML to.
+     *
+     *      @param [in] device  The device to write the snapshot to or null, if no snapshot is recorded.
+     */
+    void setSnapshotDevice(QIODevice* device);
+
+    /*!
+     *  Checks if the given device contains a snapshot instead of an XML document.
+     *
+     *      @param [in] device  The device to check. Nothing is read from the device.
+     */
+    static bool isSnapshot(QIODevice* device);
+
+    //! The version of the snapshot format. Snapshots of other versions are not read.
+    static const quint16 SNAPSHOT_VERSION = 1;
+
+protected:
+
+    /*!
+     *  Reads the document from the given device.
+     *
+     *      @param [in]  device     The device to read the XML document or the snapshot from.
+     *      @param [out] skeleton   The document without the elements read as fragments.
+     *
+     *      @return True, if the document was read, otherwise false.
+     */
+    bool readDocument(QIODevice* device, QDomDocument& skeleton);
+
+    /*!
+     *  Called when an element of the skeleton starts.
+     *
+     *      @param [in] path    The qualified names of the element and its ancestors separated by '/'.
+     */
+    virtual void elementStarted(QString const& path);
+
+    /*!
+     *  Checks if the element in the given path is read as a separate fragment.
+     *
+     *      @param [in] path    The qualified names of the element and its ancestors separated by '/'.
+     *
+     *      @return True, if the element is read as a fragment, otherwise false.
+     */
+    virtual bool isFragment(QString const& path) const = 0;
+
+    /*!
+     *  Reads a fragment of the document. The fragment is discarded after the call.
+     *
+     *      @param [in] path            The path of the fragment element.
+     *      @param [in] fragmentNode    The fragment element.
+     */
+    virtual void readFragment(QString const& path, QDomNode& fragmentNode) = 0;
+
+private:
+
+    // Disable copying.
+    DocumentStreamReader(DocumentStreamReader const& rhs);
+    DocumentStreamReader& operator=(DocumentStreamReader const& rhs);
+
+    /*!
+     *  Reads the nodes of an XML document.
+     *
+     *      @param [in] device  The device to read the document from.
+     *
+     *      @return True, if the document was read, otherwise false.
+     */
+    bool readXml(QIODevice* device);
+
+    /*!
+     *  Reads the nodes of a snapshot.
+     *
+     *      @param [in] device  The device to read the snapshot from.
+     *
+     *      @return True, if the snapshot was read, otherwise false.
+     */
+    bool readSnapshot(QIODevice* device);
+
+    /*!
+     *  Adds an element to the document and makes it the current node.
+     *
+     *      @param [in] name        The qualified name of the element.
+     *      @param [in] attributes  The attributes of the element.
+     */
+    void startElement(QString const& name, QXmlStreamAttributes const& attributes);
+
+    /*!
+     *  Ends the current element and hands it to the derived reader, if it is a fragment.
+     */
+    void endElement();
+
+    /*!
+     *  Adds text to the current node. Adjacent text is merged into a single node.
+     *
+     *      @param [in] text    The text to add.
+     */
+    void addText(QString const& text);
+
+    /*!
+     *  Adds a CDATA section to the current node.
+     *
+     *      @param [in] text    The text of the section.
+     */
+    void addCDataSection(QString const& text);
+
+    /*!
+     *  Adds a comment to the current node.
+     *
+     *      @param [in] text    The text of the comment.
+     */
+    void addComment(QString const& text);
+
+    /*!
+     *  Adds a processing instruction to the current node.
+     *
+     *      @param [in] target  The target of the instruction.
+     *      @param [in] data    The data of the instruction.
+     */
+    void addProcessingInstruction(QString const& target, QString const& data);
+
+    /*!
+     *  Writes a name to the snapshot unless it has already been written.
+     *
+     *      @param [in] name    The name to write.
+     *
+     *      @return The index of the name in the snapshot.
+     */
+    quint32 recordName(QString const& name);
+
+    /*!
+     *  Gets the document the nodes are currently created in.
+     */
+    QDomDocument currentOwner() const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The error of the previous read.
+    QString errorString_;
+
+    //! The document being read without the fragments.
+    QDomDocument skeleton_;
+
+    //! The document owning the fragment being read.
+    QDomDocument fragmentDocument_;
+
+    //! The node the read nodes are added to.
+    QDomNode current_;
+
+    //! The skeleton node containing the fragment being read.
+    QDomNode fragmentParent_;
+
+    //! The depth of the current node in the fragment being read or 0, if no fragment is being read.
+    int fragmentDepth_;
+
+    //! The qualified names of the current element and its ancestors.
+    QStringList path_;
+
+    //! The stream to record the snapshot to or null, if no snapshot is recorded.
+    QDataStream* snapshot_;
+
+    //! The device to record the snapshot of the next document to.
+    QIODevice* snapshotDevice_;
+
+    //! The indices of the names already written to the snapshot.
+    QHash<QString, quint32> snapshotNames_;
+};
+
+#endif // DOCUMENTSTREAMREADER_H
@@ -0,0 +1,133 @@
+//-----------------------------------------------------------------------------
+// File: ComponentValidationContext.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// The names and ports of a component collected once for validating its elements.
+//-----------------------------------------------------------------------------
+
+#include "ComponentValidationContext.h"
+
+#include <IPXACTmodels/component.h>
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidationContext::ComponentValidationContext()
+//-----------------------------------------------------------------------------
+ComponentValidationContext::ComponentValidationContext(Component const& component):
+physicalPorts_(),
+portNames_(),
+memoryMaps_(),
+addressSpaces_(),
+addressSpaceNames_(component.getAddressSpaceNames()),
+fileSetNames_(component.getFileSetNames().toSet()),
+viewNames_(component.getViewNames().toSet()),
+cpuNames_(component.getCpuNames().toSet()),
+remapStateNames_(component.getRemapStateNames().toSet()),
+busInterfaceNames_(component.getBusInterfaceNames())
+{
+    QList<General::PortBounds> portBounds = component.getPortBounds();
+    physicalPorts_.reserve(portBounds.size());
+    portNames_.reserve(portBounds.size());
+
+    // The first port with each name is referred, as when searching the port list.
+    for (int i = portBounds.size() - 1; i >= 0; --i)
+    {
+        General::PortBounds const& bounds = portBounds.at(i);
+        physicalPorts_.insert(bounds.portName_, bounds);
+        portNames_.insert(bounds.portName_);
+    }
+
+    memoryMaps_ = component.getMemoryMapNames().toSet();
+    addressSpaces_ = addressSpaceNames_.toSet();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidationContext::~ComponentValidationContext()
+//-----------------------------------------------------------------------------
+ComponentValidationContext::~ComponentValidationContext()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidationContext::getPhysicalPorts()
+//-----------------------------------------------------------------------------
+QHash<QString, General::PortBounds> const& ComponentValidationContext::getPhysicalPorts() const
+{
+    return physicalPorts_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidationContext::getPortNames()
+//-----------------------------------------------------------------------------
+QSet<QString> const& ComponentValidationContext::getPortNames() const
+{
+    return portNames_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidationContext::hasMemoryMap()
+//-----------------------------------------------------------------------------
+bool ComponentValidationContext::hasMemoryMap(QString const& name) const
+{
+    return memoryMaps_.contains(name);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidationContext::hasAddressSpace()
+//-----------------------------------------------------------------------------
+bool ComponentValidationContext::hasAddressSpace(QString const& name) const
+{
+    return addressSpaces_.contains(name);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidationContext::getAddressSpaceNames()
+//-----------------------------------------------------------------------------
+QStringList const& ComponentValidationContext::getAddressSpaceNames() const
+{
+    return addressSpaceNames_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidationContext::getFileSetNames()
+//-----------------------------------------------------------------------------
+QSet<QString> const& ComponentValidationContext::getFileSetNames() const
+{
+    return fileSetNames_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidationContext::getViewNames()
+//-----------------------------------------------------------------------------
+QSet<QString> const& ComponentValidationContext::getViewNames() const
+{
+    return viewNames_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidationContext::getCpuNames()
+//-----------------------------------------------------------------------------
+QSet<QString> const& ComponentValidationContext::getCpuNames() const
+{
+    return cpuNames_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidationContext::getRemapStateNames()
+//-----------------------------------------------------------------------------
+QSet<QString> const& ComponentValidationContext::getRemapStateNames() const
+{
+    return remapStateNames_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentValidationContext::getBusInterfaceNames()
+//-----------------------------------------------------------------------------
+QStringList const& ComponentValidationContext::getBusInterfaceNames() const
+{
+    return busInterfaceNames_;
+}
@@ -0,0 +1,137 @@
+//-----------------------------------------------------------------------------
+// File: ComponentValidationContext.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// The names and ports of a component collected once for validating its elements.
+//-----------------------------------------------------------------------------
+
+#ifndef COMPONENTVALIDATIONCONTEXT_H
+#define COMPONENTVALIDATIONCONTEXT_H
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+#include <IPXACTmodels/generaldeclarations.h>
+
+#include <QHash>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+class Component;
+
+//-----------------------------------------------------------------------------
+//! The names and ports of a component collected once for validating its elements.
+//
+// The elements of a component refer to its ports, memory maps, address spaces and other elements by
+// name. The context collects the referable names once, so that validating each element does not
+// need to collect or search them again.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT ComponentValidationContext
+{
+public:
+
+	/*!
+	 *  The constructor.
+	 *
+	 *      @param [in] component   The component whose elements are validated.
+	 */
+	ComponentValidationContext(Component const& component);
+
+	//! The destructor.
+	~ComponentValidationContext();
+
+    /*!
+     *  Gets the bounds of the physical ports of the component by the port names.
+     */
+    QHash<QString, General::PortBounds> const& getPhysicalPorts() const;
+
+    /*!
+     *  Gets the names of the ports of the component.
+     */
+    QSet<QString> const& getPortNames() const;
+
+    /*!
+     *  Checks if the component has a memory map with the given name.
+     */
+    bool hasMemoryMap(QString const& name) const;
+
+    /*!
+     *  Checks if the component has an address space with the given name.
+     */
+    bool hasAddressSpace(QString const& name) const;
+
+    /*!
+     *  Gets the names of the address spaces of the component.
+     */
+    QStringList const& getAddressSpaceNames() const;
+
+    /*!
+     *  Gets the names of the file sets of the component.
+     */
+    QSet<QString> const& getFileSetNames() const;
+
+    /*!
+     *  Gets the names of the hardware views of the component.
+     */
+    QSet<QString> const& getViewNames() const;
+
+    /*!
+     *  Gets the names of the cpus of the component.
+     */
+    QSet<QString> const& getCpuNames() const;
+
+    /*!
+     *  Gets the names of the remap states of the component.
+     */
+    QSet<QString> const& getRemapStateNames() const;
+
+    /*!
+     *  Gets the names of the bus interfaces of the component.
+     */
+    QStringList const& getBusInterfaceNames() const;
+
+private:
+
+	// Disable copying.
+	ComponentValidationContext(ComponentValidationContext const& rhs);
+	ComponentValidationContext& operator=(ComponentValidationContext const& rhs);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The physical port bounds by the port names.
+    QHash<QString, General::PortBounds> physicalPorts_;
+
+    //! The names of the ports.
+    QSet<QString> portNames_;
+
+    //! The names of the memory maps for searching.
+    QSet<QString> memoryMaps_;
+
+    //! The names of the address spaces for searching.
+    QSet<QString> addressSpaces_;
+
+    //! The names of the address spaces.
+    QStringList addressSpaceNames_;
+
+    //! The names of the file sets.
+    QSet<QString> fileSetNames_;
+
+    //! The names of the hardware views.
+    QSet<QString> viewNames_;
+
+    //! The names of the cpus.
+    QSet<QString> cpuNames_;
+
+    //! The names of the remap states.
+    QSet<QString> remapStateNames_;
+
+    //! The names of the bus interfaces.
+    QStringList busInterfaceNames_;
+};
+
+#endif // COMPONENTVALIDATIONCONTEXT_H
@@ -0,0 +1,266 @@
+//-----------------------------------------------------------------------------
+// File: ParallelValidator.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Runs independent validation tasks in a thread pool and merges their results in order.
+//-----------------------------------------------------------------------------
+
+#include "ParallelValidator.h"
+
+#include <QAtomicInt>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QRunnable>
+#include <QSharedPointer>
+#include <QThreadPool>
+#include <QVector>
+#include <QWaitCondition>
+
+namespace
+{
+    //! The smallest number of tasks run in the thread pool. Fewer tasks are run in the calling thread.
+    const int MINIMUM_PARALLEL_TASKS = 4;
+
+    //-----------------------------------------------------------------------------
+    //! Task reporting an error found before running the tasks.
+    //-----------------------------------------------------------------------------
+    class ErrorTask : public ParallelValidator::Task
+    {
+    public:
+
+        ErrorTask(QString const& error): error_(error) {}
+
+        virtual bool validate(QStringList& errorList) const
+        {
+            errorList.append(error_);
+            return false;
+        }
+
+        virtual bool validate() const
+        {
+            return false;
+        }
+
+    private:
+
+        //! The error to report.
+        QString error_;
+    };
+
+    //-----------------------------------------------------------------------------
+    //! The state of a single run shared by the calling thread and the pooled threads.
+    //-----------------------------------------------------------------------------
+    struct RunState
+    {
+        //! The tasks to run.
+        QList<ParallelValidator::Task*> tasks;
+
+        //! The errors of each task, if the errors are collected.
+        QVector<QStringList> errors;
+
+        //! Flag for collecting the errors.
+        bool collectErrors;
+
+        //! The index of the next task to take.
+        QAtomicInt nextTask;
+
+        //! Set when a task was found not valid.
+        QAtomicInt failed;
+
+        //! The number of tasks completed, guarded by the mutex.
+        int completedTasks;
+
+        //! The lock guarding the completed tasks.
+        QMutex mutex;
+
+        //! Signaled when all the tasks have been completed.
+        QWaitCondition finished;
+    };
+
+    /*!
+     *  Takes and runs tasks until all the tasks have been taken.
+     *
+     *      @param [in] state   The state of the run.
+     */
+    void runPendingTasks(RunState& state)
+    {
+        int const count = state.tasks.size();
+
+        for (int index = state.nextTask.fetchAndAddOrdered(1); index < count;
+            index = state.nextTask.fetchAndAddOrdered(1))
+        {
+            bool valid = true;
+            if (state.collectErrors)
+            {
+                // Each task has its own error list, so the lists are not guarded.
+                valid = state.tasks.at(index)->validate(state.errors[index]);
+            }
+            else if (state.failed.load() == 0)
+            {
+                valid = state.tasks.at(index)->validate();
+            }
+
+            if (!valid)
+            {
+                state.failed.storeRelease(1);
+            }
+
+            QMutexLocker locker(&state.mutex);
+            ++state.completedTasks;
+            if (state.completedTasks == count)
+            {
+                state.finished.wakeAll();
+            }
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    //! Runs the tasks of a run in a pooled thread.
+    //-----------------------------------------------------------------------------
+    class ValidationRunner : public QRunnable
+    {
+    public:
+
+        ValidationRunner(QSharedPointer<RunState> state): state_(state) {}
+
+        virtual void run()
+        {
+            runPendingTasks(*state_);
+        }
+
+    private:
+
+        //! The shared state of the run. It is kept alive until the runner has been run.
+        QSharedPointer<RunState> state_;
+    };
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParallelValidator::ParallelValidator()
+//-----------------------------------------------------------------------------
+ParallelValidator::ParallelValidator(): tasks_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParallelValidator::~ParallelValidator()
+//-----------------------------------------------------------------------------
+ParallelValidator::~ParallelValidator()
+{
+    qDeleteAll(tasks_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParallelValidator::addTask()
+//-----------------------------------------------------------------------------
+void ParallelValidator::addTask(Task* task)
+{
+    tasks_.append(task);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParallelValidator::addError()
+//-----------------------------------------------------------------------------
+void ParallelValidator::addError(QString const& error)
+{
+    tasks_.append(new ErrorTask(error));
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParallelValidator::taskCount()
+//-----------------------------------------------------------------------------
+int ParallelValidator::taskCount() const
+{
+    return tasks_.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParallelValidator::run()
+//-----------------------------------------------------------------------------
+bool ParallelValidator::run(QStringList& errorList)
+{
+    return runTasks(&errorList);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParallelValidator::run()
+//-----------------------------------------------------------------------------
+bool ParallelValidator::run()
+{
+    return runTasks(0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParallelValidator::runTasks()
+//-----------------------------------------------------------------------------
+bool ParallelValidator::runTasks(QStringList* errorList)
+{
+    QList<Task*> tasks = tasks_;
+    tasks_.clear();
+
+    QThreadPool* pool = QThreadPool::globalInstance();
+    int runnerCount = qMin(pool->maxThreadCount(), tasks.size()) - 1;
+
+    bool valid = true;
+
+    if (tasks.size() < MINIMUM_PARALLEL_TASKS || runnerCount < 1)
+    {
+        foreach (Task* task, tasks)
+        {
+            if (errorList)
+            {
+                valid = task->validate(*errorList) && valid;
+            }
+            else if (!task->validate())
+            {
+                valid = false;
+                break;
+            }
+        }
+    }
+    else
+    {
+        QSharedPointer<RunState> state(new RunState());
+        state->tasks = tasks;
+        state->collectErrors = errorList != 0;
+        state->completedTasks = 0;
+        if (state->collectErrors)
+        {
+            state->errors.resize(tasks.size());
+        }
+
+        for (int i = 0; i < runnerCount; ++i)
+        {
+            pool->start(new ValidationRunner(state));
+        }
+
+        // The calling thread takes tasks too, so the run completes even if no pooled thread is free.
+        runPendingTasks(*state);
+
+        {
+            QMutexLocker locker(&state->mutex);
+            while (state->completedTasks < tasks.size())
+            {
+                state->finished.wait(&state->mutex);
+            }
+        }
+
+        if (errorList)
+        {
+            foreach (QStringList const& taskErrors, state->errors)
+            {
+                errorList->append(taskErrors);
+            }
+        }
+
+        valid = state->failed.load() == 0;
+    }
+
+    qDeleteAll(tasks);
+    return valid;
+}
@@ -0,0 +1,128 @@
+//-----------------------------------------------------------------------------
+// File: ParallelValidator.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Runs independent validation tasks in a thread pool and merges their results in order.
+//-----------------------------------------------------------------------------
+
+#ifndef PARALLELVALIDATOR_H
+#define PARALLELVALIDATOR_H
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+//-----------------------------------------------------------------------------
+//! Runs independent validation tasks in a thread pool and merges their results in order.
+//
+// The elements of a model, such as the bus interfaces or memory maps of a component, are validated
+// independently of each other. Each element is added as a task and the tasks are run in the global
+// thread pool. The calling thread runs tasks too, so the validator may be used from a pooled thread.
+// The errors of the tasks are appended in the order the tasks were added, so the errors are the same
+// as if the tasks were run one after the other.
+//
+// The tasks must only read the model while they are run.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT ParallelValidator
+{
+public:
+
+    //-----------------------------------------------------------------------------
+    //! A single validation task.
+    //-----------------------------------------------------------------------------
+    class IPXACTMODELS_EXPORT Task
+    {
+    public:
+
+        //! The destructor.
+        virtual ~Task() {}
+
+        /*!
+         *  Validates the element of the task.
+         *
+         *      @param [in/out] errorList   The list to add the found errors to.
+         *
+         *      @return True, if the element is valid, otherwise false.
+         */
+        virtual bool validate(QStringList& errorList) const = 0;
+
+        /*!
+         *  Validates the element of the task without collecting the errors.
+         *
+         *      @return True, if the element is valid, otherwise false.
+         */
+        virtual bool validate() const = 0;
+    };
+
+    //! The constructor.
+    ParallelValidator();
+
+    //! The destructor.
+    ~ParallelValidator();
+
+    /*!
+     *  Adds a task to run. The validator takes the ownership of the task.
+     *
+     *      @param [in] task    The task to add.
+     */
+    void addTask(Task* task);
+
+    /*!
+     *  Adds an error found before running the tasks. The error is reported in order with the tasks.
+     *
+     *      @param [in] error   The error to report.
+     */
+    void addError(QString const& error);
+
+    /*!
+     *  Gets the number of tasks and errors added.
+     */
+    int taskCount() const;
+
+    /*!
+     *  Runs the tasks and removes them from the validator.
+     *
+     *      @param [in/out] errorList   The list to add the errors of the tasks to.
+     *
+     *      @return True, if all the tasks were valid and no errors were added, otherwise false.
+     */
+    bool run(QStringList& errorList);
+
+    /*!
+     *  Runs the tasks without collecting the errors and removes them from the validator. The remaining
+     *  tasks are skipped after the first task that is not valid.
+     *
+     *      @return True, if all the tasks were valid and no errors were added, otherwise false.
+     */
+    bool run();
+
+private:
+
+    // Disable copying.
+    ParallelValidator(ParallelValidator const& rhs);
+    ParallelValidator& operator=(ParallelValidator const& rhs);
+
+    /*!
+     *  Runs the tasks in the thread pool.
+     *
+     *      @param [out] errorList  The list to add the errors to or null, if the errors are not collected.
+     *
+     *      @return True, if all the tasks were valid, otherwise false.
+     */
+    bool runTasks(QStringList* errorList);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The tasks to run in order.
+    QList<Task*> tasks_;
+};
+
+#endif // PARALLELVALIDATOR_H
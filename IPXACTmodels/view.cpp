@@ -7,6 +7,7 @@
 #include "GenericVendorExtension.h"
 #include "modelparameter.h"
 #include "parameter.h"
+#include "StringPool.h"
 #include "view.h"
 #include "vlnv.h"
 #include "XmlUtils.h"
@@ -41,11 +42,11 @@ vendorExtensions_()
 
 		if (tempNode.nodeName() == QString("spirit:envIdentifier"))
         {
-			envIdentifiers_.append(tempNode.childNodes().at(0).nodeValue());
+			envIdentifiers_.append(StringPool::intern(tempNode.childNodes().at(0).nodeValue()));
 		}
 		else if (tempNode.nodeName() == QString("spirit:language"))
         {
-			language_ = tempNode.childNodes().at(0).nodeValue();
+			language_ = StringPool::intern(tempNode.childNodes().at(0).nodeValue());
 
 			// get the spirit:strict attribute
 			QDomNamedNodeMap attributeMap = tempNode.attributes();
@@ -65,7 +66,7 @@ vendorExtensions_()
 					// strip the name of embedded whitespace characters
 					QString localName = tempNode.childNodes().at(j).childNodes().at(0).nodeValue();
 					localName = XmlUtils::removeWhiteSpace(localName);
-					fileSetRefs_.append(localName);
+					fileSetRefs_.append(StringPool::intern(localName));
 				}
 			}
 		}
@@ -276,7 +277,7 @@ void View::write(QXmlStreamWriter& writer)
 	writer.writeEndElement(); // spirit:view
 }
 
-bool View::isValid( const QStringList& fileSetNames, 
+bool View::isValid( const QSet<QString>& fileSetNames, 
                     QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices,
 				   QStringList& errorList, 
 				   const QString& parentIdentifier ) const {
@@ -328,7 +329,7 @@ bool View::isValid( const QStringList& fileSetNames,
 	return valid;
 }
 
-bool View::isValid( const QStringList& fileSetNames, 
+bool View::isValid( const QSet<QString>& fileSetNames, 
     QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices ) const 
 {
 	if (nameGroup_.name().isEmpty()) 
@@ -21,6 +21,7 @@
 #include <QSharedPointer>
 #include <QXmlStreamWriter>
 #include <QStringList>
+#include <QSet>
 
 class ComponentInstantiation;
 class Choice;
@@ -93,7 +94,7 @@ public:
 	 *
 	 * \return bool True if the state is valid and writing is possible.
 	*/
-	bool isValid(const QStringList& fileSetNames, 
+	bool isValid(const QSet<QString>& fileSetNames, 
         QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices,
 		QStringList& errorList, 
 		const QString& parentIdentifier) const;
@@ -105,7 +106,7 @@ public:
 	 * 
 	 * \return bool True if the state is valid and writing is possible.
 	*/
-	bool isValid(const QStringList& fileSetNames,
+	bool isValid(const QSet<QString>& fileSetNames,
         QSharedPointer<QList<QSharedPointer<Choice> > > componentChoices) const;
 
 	/*! \brief Get list of the envIdentifiers for this view
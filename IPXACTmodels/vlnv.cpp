@@ -4,6 +4,7 @@
  */
 
 #include "vlnv.h"
+#include "StringPool.h"
 
 #include <QString>
 #include <QStringList>
@@ -42,12 +43,12 @@ type_(type) {
 VLNV::~VLNV() {
 }
 
-// the copy constructor
+// the copy constructor shares the already simplified identifiers
 VLNV::VLNV(const VLNV &other): 
-vendor_(other.vendor_.simplified()), 
-library_(other.library_.simplified()),
-name_(other.name_.simplified()), 
-version_(other.version_.simplified()),
+vendor_(other.vendor_), 
+library_(other.library_),
+name_(other.name_), 
+version_(other.version_),
 type_(other.type_) {
 }
 
@@ -69,16 +70,16 @@ vendor_(),
 	QStringList fields = parseStr.split(separator, QString::SkipEmptyParts);
 	
 	if (fields.size() > 0) {
-		vendor_ = fields.at(0);
+		vendor_ = fields.at(0).simplified();
 	}
 	if (fields.size() > 1) {
-		library_ = fields.at(1);
+		library_ = fields.at(1).simplified();
 	}
 	if (fields.size() > 2) {
-		name_ = fields.at(2);
+		name_ = fields.at(2).simplified();
 	}
 	if (fields.size() > 3) {
-		version_ = fields.at(3);
+		version_ = fields.at(3).simplified();
 	}
 }
 
@@ -110,10 +111,10 @@ QString VLNV::getVersion() const {
 VLNV &VLNV::operator=(const VLNV &other) {
 	// if we are not assigning to self
 	if (this != &other) {
-		vendor_ = other.vendor_.simplified();
-		library_ = other.library_.simplified();
-		name_ = other.name_.simplified();
-		version_ = other.version_.simplified();
+		vendor_ = other.vendor_;
+		library_ = other.library_;
+		name_ = other.name_;
+		version_ = other.version_;
 		type_ = other.type_;
 	}
 	return *this;
@@ -379,7 +380,14 @@ VLNV VLNV::createVLNV(const QDomNode& node, IPXactType type)
         return VLNV();
     }
 
-    return VLNV(type, vendor, library, name, version);
+    // The same VLNVs are referenced from many documents, so the identifiers are shared through the pool.
+    VLNV vlnv(type, vendor, library, name, version);
+    vlnv.vendor_ = StringPool::intern(vlnv.vendor_);
+    vlnv.library_ = StringPool::intern(vlnv.library_);
+    vlnv.name_ = StringPool::intern(vlnv.name_);
+    vlnv.version_ = StringPool::intern(vlnv.version_);
+
+    return vlnv;
 }
 
 QString VLNV::createDirPath() const {
@@ -647,7 +647,19 @@ HEADERS += ./common/Global.h \
     ./kactusGenerators/vhdlGenerator/vhdlport.h \
     ./kactusGenerators/vhdlGenerator/vhdlsignal.h \
     ./kactusGenerators/DocumentGenerator/documentgenerator.h \
-    ./kactusGenerators/modelsimGenerator/modelsimgenerator.h
+    ./kactusGenerators/modelsimGenerator/modelsimgenerator.h \
+    ./editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyColumnAllocator.h \
+    ./mainwindow/BatchRunner.h \
+    ./common/PerformanceTrace/PerformanceTrace.h \
+    ./common/PerformanceTrace/ScopedTrace.h \
+    ./common/graphicsItems/ConnectionSegmentIndex.h \
+    ./common/graphicsItems/LevelOfDetail.h \
+    ./common/graphicsItems/DetailTextItem.h \
+    ./common/graphicsItems/DetailShadowEffect.h \
+    ./common/graphicsItems/OrthogonalRouter.h \
+    ./designEditors/MemoryDesigner/AddressSectionList.h \
+    ./library/LibraryManager/HeadlessLibraryHandler.h \
+    ./library/LibraryManager/LibraryHandlerBase.h
 SOURCES += ./common/GenericEditProvider.cpp \
     ./common/TextEditProvider.cpp \
     ./common/utils.cpp \
@@ -1227,5 +1239,17 @@ SOURCES += ./common/GenericEditProvider.cpp \
     ./kactusGenerators/vhdlGenerator/vhdlsignal.cpp \
     ./kactusGenerators/vhdlGenerator/VhdlTypedObject.cpp \
     ./kactusGenerators/DocumentGenerator/documentgenerator.cpp \
-    ./kactusGenerators/modelsimGenerator/modelsimgenerator.cpp
+    ./kactusGenerators/modelsimGenerator/modelsimgenerator.cpp \
+    ./editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyColumnAllocator.cpp \
+    ./mainwindow/BatchRunner.cpp \
+    ./common/PerformanceTrace/PerformanceTrace.cpp \
+    ./common/PerformanceTrace/ScopedTrace.cpp \
+    ./common/graphicsItems/ConnectionSegmentIndex.cpp \
+    ./common/graphicsItems/LevelOfDetail.cpp \
+    ./common/graphicsItems/DetailTextItem.cpp \
+    ./common/graphicsItems/DetailShadowEffect.cpp \
+    ./common/graphicsItems/OrthogonalRouter.cpp \
+    ./designEditors/MemoryDesigner/AddressSectionList.cpp \
+    ./library/LibraryManager/HeadlessLibraryHandler.cpp \
+    ./library/LibraryManager/LibraryHandlerBase.cpp
 RESOURCES += kactus.qrc
@@ -0,0 +1,237 @@
+//-----------------------------------------------------------------------------
+// File: CppIncludeResolver.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Resolves C/C++ #include directives to files using the include paths of a component.
+//-----------------------------------------------------------------------------
+
+#include "CppIncludeResolver.h"
+
+#include <IPXACTmodels/component.h>
+#include <IPXACTmodels/file.h>
+#include <IPXACTmodels/filebuilder.h>
+#include <IPXACTmodels/fileset.h>
+#include <IPXACTmodels/generaldeclarations.h>
+
+#include <QDir>
+#include <QFileInfo>
+#include <QRegularExpression>
+
+//-----------------------------------------------------------------------------
+// Function: CppIncludeResolver::CppIncludeResolver()
+//-----------------------------------------------------------------------------
+CppIncludeResolver::CppIncludeResolver() : includeDirectories_(), directoryListings_(), resolvedIncludes_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: CppIncludeResolver::~CppIncludeResolver()
+//-----------------------------------------------------------------------------
+CppIncludeResolver::~CppIncludeResolver()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: CppIncludeResolver::setup()
+//-----------------------------------------------------------------------------
+void CppIncludeResolver::setup(Component const* component, QString const& componentPath)
+{
+    clear();
+
+    if (component == 0)
+    {
+        return;
+    }
+
+    // Explicit include paths are searched first in the order they are given.
+    foreach (QSharedPointer<FileSet> fileSet, component->getFileSets())
+    {
+        foreach (QString const& dependency, fileSet->getDependencies())
+        {
+            addIncludeDirectory(dependency, componentPath);
+        }
+
+        foreach (QSharedPointer<FileBuilder> builder, fileSet->getDefaultFileBuilders())
+        {
+            if (isCppFileType(QStringList(builder->getFileType())))
+            {
+                addIncludeDirectoriesFromFlags(builder->getFlags(), componentPath);
+            }
+        }
+
+        foreach (QSharedPointer<File> file, fileSet->getFiles())
+        {
+            if (isCppFileType(file->getAllFileTypes()))
+            {
+                foreach (QString const& dependency, file->getDependencies())
+                {
+                    addIncludeDirectory(dependency, componentPath);
+                }
+
+                addIncludeDirectoriesFromFlags(file->getFlags(), componentPath);
+            }
+        }
+    }
+
+    // The locations of the include files of the component are searched last.
+    foreach (QSharedPointer<FileSet> fileSet, component->getFileSets())
+    {
+        foreach (QSharedPointer<File> file, fileSet->getFiles())
+        {
+            if (file->getIncludeFile())
+            {
+                addIncludeDirectory(QFileInfo(file->getName()).path(), componentPath);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: CppIncludeResolver::clear()
+//-----------------------------------------------------------------------------
+void CppIncludeResolver::clear()
+{
+    includeDirectories_.clear();
+    directoryListings_.clear();
+    resolvedIncludes_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: CppIncludeResolver::resolve()
+//-----------------------------------------------------------------------------
+QString CppIncludeResolver::resolve(QString const& includeName, bool isSystemInclude,
+    QString const& sourceDirectory)
+{
+    if (QFileInfo(includeName).isAbsolute())
+    {
+        return QFileInfo(includeName).isFile() ? QDir::cleanPath(includeName) : QString();
+    }
+
+    // Quoted includes are first searched relative to the including file.
+    if (!isSystemInclude)
+    {
+        QString localPath = findInDirectory(sourceDirectory, includeName);
+        if (!localPath.isEmpty())
+        {
+            return localPath;
+        }
+    }
+
+    if (resolvedIncludes_.contains(includeName))
+    {
+        return resolvedIncludes_.value(includeName);
+    }
+
+    QString resolvedPath;
+    foreach (QString const& directory, includeDirectories_)
+    {
+        resolvedPath = findInDirectory(directory, includeName);
+        if (!resolvedPath.isEmpty())
+        {
+            break;
+        }
+    }
+
+    resolvedIncludes_.insert(includeName, resolvedPath);
+    return resolvedPath;
+}
+
+//-----------------------------------------------------------------------------
+// Function: CppIncludeResolver::getIncludeDirectories()
+//-----------------------------------------------------------------------------
+QStringList CppIncludeResolver::getIncludeDirectories() const
+{
+    return includeDirectories_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: CppIncludeResolver::addIncludeDirectory()
+//-----------------------------------------------------------------------------
+void CppIncludeResolver::addIncludeDirectory(QString const& directory, QString const& componentPath)
+{
+    if (directory.isEmpty())
+    {
+        return;
+    }
+
+    QString absolutePath = QDir::cleanPath(General::getAbsolutePath(componentPath, directory));
+    if (!absolutePath.isEmpty() && !includeDirectories_.contains(absolutePath))
+    {
+        includeDirectories_.append(absolutePath);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: CppIncludeResolver::addIncludeDirectoriesFromFlags()
+//-----------------------------------------------------------------------------
+void CppIncludeResolver::addIncludeDirectoriesFromFlags(QString const& flags, QString const& componentPath)
+{
+    static QRegularExpression includeFlag("(?:^|\\s)(?:-I|/I|-isystem|-iquote)\\s*(\"[^\"]+\"|\\S+)");
+
+    QRegularExpressionMatchIterator matches = includeFlag.globalMatch(flags);
+    while (matches.hasNext())
+    {
+        QString directory = matches.next().captured(1);
+        directory.remove('"');
+
+        addIncludeDirectory(directory, componentPath);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: CppIncludeResolver::isCppFileType()
+//-----------------------------------------------------------------------------
+bool CppIncludeResolver::isCppFileType(QStringList const& fileTypes) const
+{
+    return fileTypes.contains("cSource") || fileTypes.contains("cppSource");
+}
+
+//-----------------------------------------------------------------------------
+// Function: CppIncludeResolver::findInDirectory()
+//-----------------------------------------------------------------------------
+QString CppIncludeResolver::findInDirectory(QString const& directory, QString const& includeName)
+{
+    QString filePath = QDir::cleanPath(directory + "/" + includeName);
+    QString fileDirectory = QFileInfo(filePath).path();
+    QString directoryKey = comparableName(fileDirectory);
+
+    // List each directory only once instead of querying the file system for every include.
+    if (!directoryListings_.contains(directoryKey))
+    {
+        QHash<QString, QString> listing;
+        foreach (QString const& entry, QDir(fileDirectory).entryList(QDir::Files | QDir::Hidden))
+        {
+            listing.insert(comparableName(entry), entry);
+        }
+
+        directoryListings_.insert(directoryKey, listing);
+    }
+
+    // The file name is returned as listed so that the path matches the file regardless of the include.
+    QString fileKey = comparableName(QFileInfo(filePath).fileName());
+    QString listedName = directoryListings_.value(directoryKey).value(fileKey);
+    if (!listedName.isEmpty())
+    {
+        return fileDirectory + "/" + listedName;
+    }
+
+    return QString();
+}
+
+//-----------------------------------------------------------------------------
+// Function: CppIncludeResolver::comparableName()
+//-----------------------------------------------------------------------------
+QString CppIncludeResolver::comparableName(QString const& name)
+{
+#ifdef Q_OS_WIN
+    return name.toLower();
+#else
+    return name;
+#endif
+}
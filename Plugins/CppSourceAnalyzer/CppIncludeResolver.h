@@ -0,0 +1,132 @@
+//-----------------------------------------------------------------------------
+// File: CppIncludeResolver.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Resolves C/C++ #include directives to files using the include paths of a component.
+//-----------------------------------------------------------------------------
+
+#ifndef CPPINCLUDERESOLVER_H
+#define CPPINCLUDERESOLVER_H
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+class Component;
+
+//-----------------------------------------------------------------------------
+//! Resolves C/C++ #include directives to files using the include paths of a component.
+//-----------------------------------------------------------------------------
+class CppIncludeResolver
+{
+public:
+
+    //! The constructor.
+    CppIncludeResolver();
+
+    //! The destructor.
+    ~CppIncludeResolver();
+
+    /*!
+     *  Collects the include directories of the given component.
+     *
+     *      @param [in] component      The component whose include directories to use.
+     *      @param [in] componentPath  The path to the directory where the component is located.
+     *
+     *      @remarks Include directories are read from the file set dependencies, file dependencies,
+     *               -I flags of the C/C++ file builders and files and the locations of include files.
+     */
+    void setup(Component const* component, QString const& componentPath);
+
+    /*!
+     *  Clears all include directories and cached directory listings and resolved includes.
+     */
+    void clear();
+
+    /*!
+     *  Resolves the given include to an absolute file path.
+     *
+     *      @param [in] includeName         The name of the included file as written in the source.
+     *      @param [in] isSystemInclude     True for <> includes, false for "" includes.
+     *      @param [in] sourceDirectory     The directory of the file containing the include.
+     *
+     *      @return The absolute path to the included file or an empty string, if the file was not found.
+     */
+    QString resolve(QString const& includeName, bool isSystemInclude, QString const& sourceDirectory);
+
+    /*!
+     *  Gets the include directories in search order.
+     *
+     *      @return The absolute paths to the include directories.
+     */
+    QStringList getIncludeDirectories() const;
+
+private:
+    // Disable copying.
+    CppIncludeResolver(CppIncludeResolver const& rhs);
+    CppIncludeResolver& operator=(CppIncludeResolver const& rhs);
+
+    /*!
+     *  Adds an include directory to the search path, if not already added.
+     *
+     *      @param [in] directory       The directory to add, absolute or relative to the base path.
+     *      @param [in] componentPath   The path to the directory where the component is located.
+     */
+    void addIncludeDirectory(QString const& directory, QString const& componentPath);
+
+    /*!
+     *  Adds the include directories given with -I, -isystem, -iquote or /I in the given flags.
+     *
+     *      @param [in] flags           The build flags.
+     *      @param [in] componentPath   The path to the directory where the component is located.
+     */
+    void addIncludeDirectoriesFromFlags(QString const& flags, QString const& componentPath);
+
+    /*!
+     *  Checks if the given file type is a C/C++ file type.
+     *
+     *      @param [in] fileTypes   The file types to check.
+     *
+     *      @return True, if any of the file types is a C/C++ type, otherwise false.
+     */
+    bool isCppFileType(QStringList const& fileTypes) const;
+
+    /*!
+     *  Finds the given include in the given directory using the cached directory listing.
+     *
+     *      @param [in] directory       The directory to search in.
+     *      @param [in] includeName     The name of the include, possibly containing subdirectories.
+     *
+     *      @return The absolute path to the file with the file name as listed in the directory or an empty
+     *              string, if not found.
+     */
+    QString findInDirectory(QString const& directory, QString const& includeName);
+
+    /*!
+     *  Gets the form of the given file or directory name used for comparing names in the file system.
+     *
+     *      @param [in] name    The name to compare.
+     *
+     *      @return The name in lower case on case-insensitive file systems, otherwise the name as is.
+     */
+    static QString comparableName(QString const& name);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The include directories in search order.
+    QStringList includeDirectories_;
+
+    //! The file names in each directory that has been searched, by their comparable names.
+    QHash<QString, QHash<QString, QString> > directoryListings_;
+
+    //! Includes already resolved against the include directories, empty for not found.
+    QHash<QString, QString> resolvedIncludes_;
+};
+
+#endif // CPPINCLUDERESOLVER_H
@@ -18,6 +18,8 @@
 #include <QCoreApplication>
 #include <QCryptographicHash>
 #include <QTextStream>
+#include <QDir>
+#include <QRegularExpression>
 
 #include <Plugins/PluginSystem/IPluginUtility.h>
 
@@ -25,7 +27,8 @@
 // Function: CppSourceAnalyzer::CppSourceAnalyzer()
 //-----------------------------------------------------------------------------
 CppSourceAnalyzer::CppSourceAnalyzer()
-    : fileTypes_()
+    : fileTypes_(),
+      includeResolver_()
 {
     fileTypes_.append("cSource");
     fileTypes_.append("cppSource");
@@ -139,34 +142,66 @@ QList<FileDependencyDesc> CppSourceAnalyzer::getFileDependencies(Component const
     {
         QString source = getSourceData(file);
 
-        // Find #includes
+        QDir sourceDirectory = QFileInfo(filename).absoluteDir();
+
+        static QRegularExpression includeExp("^#\\s*include\\s*([<\"])([^>\"]+)[>\"]");
+        static QRegularExpression conditionalStartExp("^#\\s*if(?:n?def)?\\b");
+        static QRegularExpression disabledStartExp("^#\\s*if\\s+0\\b");
+        static QRegularExpression conditionalElseExp("^#\\s*(?:else|elif)\\b");
+        static QRegularExpression conditionalEndExp("^#\\s*endif\\b");
+
+        // Nesting depth inside an #if 0 block, zero when the lines are active.
+        int disabledDepth = 0;
+
         QTextStream sourceStream(&source);
         while(!sourceStream.atEnd())
         {
             const QString currentLine = sourceStream.readLine();
-            int includePosition = currentLine.indexOf("#include");
-            // include found (can they be somewhere else than start of line?)
-            if (includePosition == 0)
+            if (!currentLine.startsWith('#'))
+            {
+                continue;
+            }
+
+            if (disabledDepth > 0)
+            {
+                if (conditionalStartExp.match(currentLine).hasMatch())
+                {
+                    disabledDepth++;
+                }
+                else if (conditionalEndExp.match(currentLine).hasMatch() ||
+                    (disabledDepth == 1 && conditionalElseExp.match(currentLine).hasMatch()))
+                {
+                    disabledDepth--;
+                }
+                continue;
+            }
+
+            if (disabledStartExp.match(currentLine).hasMatch())
             {
+                disabledDepth = 1;
+                continue;
+            }
+
+            QRegularExpressionMatch includeMatch = includeExp.match(currentLine);
+            if (includeMatch.hasMatch())
+            {
+                QString includeName = includeMatch.captured(2).trimmed();
+                bool isSystemInclude = includeMatch.captured(1) == "<";
+
                 FileDependencyDesc dependency;
+                dependency.description = tr("Include reference to %1").arg(includeName);
 
-                int includeStart = 0;
-                int includeEnd = 0;
-                // includes with < >
-                if (currentLine.indexOf("<") != -1)
+                QString includePath = includeResolver_.resolve(includeName, isSystemInclude, 
+                    sourceDirectory.absolutePath());
+                if (includePath.isEmpty())
                 {
-                    includeStart = currentLine.indexOf("<") + 1;
-                    includeEnd = currentLine.indexOf(">");
+                    dependency.filename = includeName;
                 }
-                // includes with " "
                 else
                 {
-                    includeStart = currentLine.indexOf("\"") + 1;
-                    includeEnd = currentLine.indexOf("\"", includeStart+1);
+                    dependency.filename = sourceDirectory.relativeFilePath(includePath);
                 }
-                // Include found, TODO: store it
-                QString includeName = currentLine.mid(includeStart, includeEnd-includeStart);
-                dependency.filename = includeName;
+
                 dependencies.append(dependency);
             }
         }
@@ -287,8 +322,9 @@ QString CppSourceAnalyzer::removeComments(QString& source)
 //-----------------------------------------------------------------------------
 // Function: CppSourceAnalyzer::beginAnalysis()
 //-----------------------------------------------------------------------------
-void CppSourceAnalyzer::beginAnalysis(Component const* /*component*/, QString const& /*componentPath*/)
+void CppSourceAnalyzer::beginAnalysis(Component const* component, QString const& componentPath)
 {
+    includeResolver_.setup(component, componentPath);
 }
 
 //-----------------------------------------------------------------------------
@@ -296,6 +332,7 @@ void CppSourceAnalyzer::beginAnalysis(Component const* /*component*/, QString co
 //-----------------------------------------------------------------------------
 void CppSourceAnalyzer::endAnalysis(Component const* /*component*/, QString const& /*componentPath*/)
 {
+    includeResolver_.clear();
 }
 
 QList<IPlugin::ExternalProgramRequirement> CppSourceAnalyzer::getProgramRequirements() {
@@ -12,6 +12,8 @@
 #ifndef CPPSOURCEANALYZER_H
 #define CPPSOURCEANALYZER_H
 
+#include "CppIncludeResolver.h"
+
 #include <Plugins/PluginSystem/IPlugin.h>
 #include <Plugins/PluginSystem/ISourceAnalyzerPlugin.h>
 #include <QFileInfo>
@@ -153,6 +155,9 @@ private:
 
     //! The supported file types.
     QStringList fileTypes_;
+
+    //! Resolves the includes using the include paths of the analyzed component.
+    CppIncludeResolver includeResolver_;
 };
 
 #endif // CPPSOURCEANALYZER_H
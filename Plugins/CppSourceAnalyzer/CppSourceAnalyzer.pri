@@ -7,5 +7,7 @@
 message("You are running qmake on a generated .pro file. This may not work!")
 
 
-HEADERS += ./CppSourceAnalyzer.h
-SOURCES += ./CppSourceAnalyzer.cpp
+HEADERS += ./CppSourceAnalyzer.h \
+    ./CppIncludeResolver.h
+SOURCES += ./CppSourceAnalyzer.cpp \
+    ./CppIncludeResolver.cpp
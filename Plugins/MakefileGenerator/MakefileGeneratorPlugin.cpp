@@ -144,7 +144,7 @@ void MakefileGeneratorPlugin::runGenerator( IPluginUtility* utility,
     QStringList replacedFiles = parser.getReplacedFiles();
 
     // Ask verification from the user, if any file is being replaced,
-    if ( replacedFiles.size() > 0 )
+    if ( replacedFiles.size() > 0 && utility->isInteractive() )
     {
         // Details will be the list of files being replaced.
         QString detailMsg;
@@ -68,7 +68,15 @@ void BaseMemoryMapHeaderWriter::checkDirectoryStructure(QDir dir)
 void BaseMemoryMapHeaderWriter::openFileErrorMessage(QString const& absoluteFilePath)
 {
     QString message(QObject::tr("File: %1 could not be opened for writing.").arg(absoluteFilePath));
-    QMessageBox::critical(utility_->getParentWidget(), QCoreApplication::applicationName(), message);
+
+    if (utility_->isInteractive())
+    {
+        QMessageBox::critical(utility_->getParentWidget(), QCoreApplication::applicationName(), message);
+    }
+    else
+    {
+        utility_->printError(message);
+    }
 }
 
 //-----------------------------------------------------------------------------
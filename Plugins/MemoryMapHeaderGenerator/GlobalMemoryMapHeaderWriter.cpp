@@ -71,17 +71,21 @@ void GlobalMemoryMapHeaderWriter::writeMemoryMapHeader(QSharedPointer<Component>
 
     if (options.isEmpty())
     {
-        // create the dialog to display the headers to be generated
-        FileSaveDialog dialog(utility_->getParentWidget());
-        dialog.setModel(&model);
+        // Without user interaction, the headers are written to their default locations.
+        if (utility_->isInteractive())
+        {
+            // create the dialog to display the headers to be generated
+            FileSaveDialog dialog(utility_->getParentWidget());
+            dialog.setModel(&model);
 
-        int result = dialog.exec();
+            int result = dialog.exec();
 
-        // if user clicked cancel
-        if (result == QDialog::Rejected)
-        {
-            informGenerationAbort();
-            return;
+            // if user clicked cancel
+            if (result == QDialog::Rejected)
+            {
+                informGenerationAbort();
+                return;
+            }
         }
 
         options = model.getHeaderOptions();
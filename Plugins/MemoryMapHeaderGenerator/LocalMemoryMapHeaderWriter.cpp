@@ -61,17 +61,21 @@ void LocalMemoryMapHeaderWriter::writeMemoryMapHeader(QList<LocalHeaderSaveModel
 
     if (options.isEmpty())
     {
-        FileSaveDialog dialog(utility_->getParentWidget());
-        dialog.setModel(&model);
-        dialog.setItemDelegate(new LocalHeaderSaveDelegate(component_, parentObject_));
-
-        int result = dialog.exec();
-
-        // if user clicked cancel
-        if (result == QDialog::Rejected)
+        // Without user interaction, the headers are written to their default locations.
+        if (utility_->isInteractive())
         {
-            informGenerationAbort();
-            return;
+            FileSaveDialog dialog(utility_->getParentWidget());
+            dialog.setModel(&model);
+            dialog.setItemDelegate(new LocalHeaderSaveDelegate(component_, parentObject_));
+
+            int result = dialog.exec();
+
+            // if user clicked cancel
+            if (result == QDialog::Rejected)
+            {
+                informGenerationAbort();
+                return;
+            }
         }
 
         options = model.getHeaderOptions();
@@ -124,16 +124,20 @@ void SystemMemoryMapHeaderWriter::writeMemoryMapHeader(QSharedPointer<Component>
 	SystemHeaderSaveModel model(utility_->getLibraryInterface(), parentObject_);
     model.setObjects(component, systemGeneratorSettings_);
 
-	FileSaveDialog dialog(utility_->getParentWidget());
-	dialog.setModel(&model);
+    // Without user interaction, the headers are written to their default locations.
+    if (utility_->isInteractive())
+    {
+        FileSaveDialog dialog(utility_->getParentWidget());
+        dialog.setModel(&model);
 
-	int result = dialog.exec();
+        int result = dialog.exec();
 
-	if (result == QDialog::Rejected)
-    {
-        informGenerationAbort();
-		return;
-	}
+        if (result == QDialog::Rejected)
+        {
+            informGenerationAbort();
+            return;
+        }
+    }
 
     systemGeneratorSettings_ = model.getObjects();
 
@@ -197,8 +197,17 @@ void MemoryMapHeaderGenerator::runGenerator( IPluginUtility* utility, QSharedPoi
 		// the generator is run on a system component without the configuration
 		else
         {
-			QMessageBox::warning(utility->getParentWidget(), QCoreApplication::applicationName(),
-				tr("A system design opened without configuration.\nSystem design must always have a configuration."));
+            QString message(tr("A system design opened without configuration.\n"
+                "System design must always have a configuration."));
+
+            if (utility->isInteractive())
+            {
+                QMessageBox::warning(utility->getParentWidget(), QCoreApplication::applicationName(), message);
+            }
+            else
+            {
+                utility->printError(message);
+            }
 			return;
 		}
 	}
@@ -51,6 +51,13 @@ public:
      *  Returns the parent widget to be used for e.g. dialogs.
      */
     virtual QWidget* getParentWidget() = 0;
+
+    /*!
+     *  Checks if the user can be asked for input e.g. with dialogs.
+     *
+     *      @return True, if dialogs may be shown, false when running without user interaction.
+     */
+    virtual bool isInteractive() const = 0;
 };
 
 //-----------------------------------------------------------------------------
@@ -63,3 +63,11 @@ QWidget* PluginUtilityAdapter::getParentWidget()
 {
     return parentWidget_;
 }
+
+//-----------------------------------------------------------------------------
+// Function: PluginUtilityAdapter::isInteractive()
+//-----------------------------------------------------------------------------
+bool PluginUtilityAdapter::isInteractive() const
+{
+    return true;
+}
@@ -63,6 +63,9 @@ public:
     //! Returns the parent widget to be used for e.g. dialogs.
     virtual QWidget* getParentWidget();
 
+    //! Checks if the user can be asked for input e.g. with dialogs.
+    virtual bool isInteractive() const;
+
 signals:
 
     //! Emitted when an error message should be printed.
@@ -215,6 +215,12 @@ bool VerilogGeneratorPlugin::couldConfigure(QStringList const& possibleViewNames
     configuration_->setOutputPath(defaultOutputPath());
     configuration_->setSaveToFileset(outputFileAndViewShouldBeAddedToTopComponent());
 
+    // Without user interaction, generate using the default configuration.
+    if (!utility_->isInteractive())
+    {
+        return true;
+    }
+
     GeneratorConfigurationDialog dialog(configuration_, utility_->getParentWidget());
     dialog.setViewNames(possibleViewNames);
     return dialog.exec() == QDialog::Accepted;
@@ -0,0 +1,224 @@
+//-----------------------------------------------------------------------------
+// File: PerformanceTrace.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Records timed events and writes them in the Chrome trace event format.
+//-----------------------------------------------------------------------------
+
+#include "PerformanceTrace.h"
+
+#include <QAtomicInt>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSettings>
+#include <QThread>
+#include <QVector>
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! A recorded trace event.
+    //-----------------------------------------------------------------------------
+    struct TraceEvent
+    {
+        //! The name of the event.
+        QString name;
+
+        //! The category of the event.
+        QString category;
+
+        //! Additional information of the event.
+        QString detail;
+
+        //! The start time of the event in microseconds.
+        qint64 startTime;
+
+        //! The duration of the event in microseconds.
+        qint64 duration;
+
+        //! The thread where the event occurred.
+        quintptr threadId;
+    };
+
+    //! Guards the recorded events and the output path.
+    QMutex traceMutex;
+
+    //! Non-zero when the trace is enabled.
+    QAtomicInt traceEnabled(0);
+
+    //! The clock for the event times.
+    QElapsedTimer traceClock;
+
+    //! The file where the trace is written.
+    QString traceOutputPath;
+
+    //! The recorded events.
+    QVector<TraceEvent> traceEvents;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PerformanceTrace::enableFromSettings()
+//-----------------------------------------------------------------------------
+void PerformanceTrace::enableFromSettings()
+{
+    // The environment overrides the settings so that a single run can be traced.
+    QString outputPath = QString::fromLocal8Bit(qgetenv("KACTUS2_TRACE_FILE"));
+
+    if (outputPath.isEmpty())
+    {
+        QSettings settings;
+        outputPath = settings.value("Platform/TraceFile", QString()).toString();
+    }
+
+    if (!outputPath.isEmpty())
+    {
+        enable(outputPath);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: PerformanceTrace::enable()
+//-----------------------------------------------------------------------------
+void PerformanceTrace::enable(QString const& outputPath)
+{
+    QMutexLocker locker(&traceMutex);
+
+    traceOutputPath = outputPath;
+    traceEvents.clear();
+    traceClock.start();
+
+    traceEnabled.store(1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: PerformanceTrace::disable()
+//-----------------------------------------------------------------------------
+void PerformanceTrace::disable()
+{
+    QMutexLocker locker(&traceMutex);
+
+    traceEnabled.store(0);
+
+    traceOutputPath.clear();
+    traceEvents.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: PerformanceTrace::isEnabled()
+//-----------------------------------------------------------------------------
+bool PerformanceTrace::isEnabled()
+{
+    return traceEnabled.load() != 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PerformanceTrace::currentTime()
+//-----------------------------------------------------------------------------
+qint64 PerformanceTrace::currentTime()
+{
+    return traceClock.nsecsElapsed() / 1000;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PerformanceTrace::addEvent()
+//-----------------------------------------------------------------------------
+void PerformanceTrace::addEvent(QString const& name, QString const& category, QString const& detail,
+    qint64 startTime, qint64 duration)
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    TraceEvent event;
+    event.name = name;
+    event.category = category;
+    event.detail = detail;
+    event.startTime = startTime;
+    event.duration = duration;
+    event.threadId = reinterpret_cast<quintptr>(QThread::currentThreadId());
+
+    QMutexLocker locker(&traceMutex);
+
+    if (traceEvents.size() < MAX_EVENTS)
+    {
+        traceEvents.append(event);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: PerformanceTrace::getEventCount()
+//-----------------------------------------------------------------------------
+int PerformanceTrace::getEventCount()
+{
+    QMutexLocker locker(&traceMutex);
+    return traceEvents.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: PerformanceTrace::writeTrace()
+//-----------------------------------------------------------------------------
+bool PerformanceTrace::writeTrace()
+{
+    if (!isEnabled())
+    {
+        return true;
+    }
+
+    QMutexLocker locker(&traceMutex);
+
+    qint64 processId = QCoreApplication::applicationPid();
+
+    QJsonArray events;
+    foreach (TraceEvent const& traceEvent, traceEvents)
+    {
+        // Complete events carry both the start time and the duration.
+        QJsonObject event;
+        event.insert("name", traceEvent.name);
+        event.insert("cat", traceEvent.category);
+        event.insert("ph", QString("X"));
+        event.insert("ts", double(traceEvent.startTime));
+        event.insert("dur", double(traceEvent.duration));
+        event.insert("pid", double(processId));
+        event.insert("tid", double(traceEvent.threadId));
+
+        if (!traceEvent.detail.isEmpty())
+        {
+            QJsonObject arguments;
+            arguments.insert("detail", traceEvent.detail);
+            event.insert("args", arguments);
+        }
+
+        events.append(event);
+    }
+
+    QJsonObject trace;
+    trace.insert("traceEvents", events);
+    trace.insert("displayTimeUnit", QString("ms"));
+
+    if (traceEvents.size() == MAX_EVENTS)
+    {
+        QJsonObject metadata;
+        metadata.insert("truncated", true);
+        trace.insert("otherData", metadata);
+    }
+
+    QFile outputFile(traceOutputPath);
+    if (!outputFile.open(QFile::WriteOnly | QFile::Truncate))
+    {
+        return false;
+    }
+
+    QByteArray output = QJsonDocument(trace).toJson(QJsonDocument::Compact);
+    return outputFile.write(output) == output.size();
+}
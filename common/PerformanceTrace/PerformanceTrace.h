@@ -0,0 +1,89 @@
+//-----------------------------------------------------------------------------
+// File: PerformanceTrace.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Records timed events and writes them in the Chrome trace event format.
+//-----------------------------------------------------------------------------
+
+#ifndef PERFORMANCETRACE_H
+#define PERFORMANCETRACE_H
+
+#include <QString>
+
+//-----------------------------------------------------------------------------
+//! Records timed events and writes them in the Chrome trace event format.
+//
+// The trace is disabled by default. It is enabled with the environment variable KACTUS2_TRACE_FILE or
+// the setting Platform/TraceFile, both giving the file where the trace is written. The written file
+// can be opened in chrome://tracing or any other viewer supporting the trace event format.
+//-----------------------------------------------------------------------------
+namespace PerformanceTrace
+{
+    //! The maximum number of events recorded. Later events are dropped.
+    const int MAX_EVENTS = 1000000;
+
+    /*!
+     *  Enables the trace, if requested in the environment or in the settings.
+     *
+     *      @remarks The application and organization names must be set before calling this function.
+     */
+    void enableFromSettings();
+
+    /*!
+     *  Starts recording the trace.
+     *
+     *      @param [in] outputPath  The file where the trace is written.
+     */
+    void enable(QString const& outputPath);
+
+    /*!
+     *  Stops recording the trace and discards all recorded events.
+     */
+    void disable();
+
+    /*!
+     *  Checks if the trace is being recorded.
+     *
+     *      @return True, if the trace is enabled, otherwise false.
+     */
+    bool isEnabled();
+
+    /*!
+     *  Gets the current time of the trace clock.
+     *
+     *      @return The elapsed time since the trace was enabled in microseconds.
+     */
+    qint64 currentTime();
+
+    /*!
+     *  Records a completed event.
+     *
+     *      @param [in] name        The name of the event.
+     *      @param [in] category    The category of the event.
+     *      @param [in] detail      Additional information of the event, e.g. the document name.
+     *      @param [in] startTime   The start time of the event in microseconds.
+     *      @param [in] duration    The duration of the event in microseconds.
+     */
+    void addEvent(QString const& name, QString const& category, QString const& detail, qint64 startTime,
+        qint64 duration);
+
+    /*!
+     *  Gets the number of recorded events.
+     *
+     *      @return The number of events.
+     */
+    int getEventCount();
+
+    /*!
+     *  Writes the recorded events to the output file.
+     *
+     *      @return True, if the trace was written or it was not enabled, otherwise false.
+     */
+    bool writeTrace();
+}
+
+#endif // PERFORMANCETRACE_H
@@ -0,0 +1,70 @@
+//-----------------------------------------------------------------------------
+// File: ScopedTrace.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Records the lifetime of a scope as a performance trace event.
+//-----------------------------------------------------------------------------
+
+#include "ScopedTrace.h"
+
+#include "PerformanceTrace.h"
+
+//-----------------------------------------------------------------------------
+// Function: ScopedTrace::ScopedTrace()
+//-----------------------------------------------------------------------------
+ScopedTrace::ScopedTrace(const char* name, const char* category):
+active_(PerformanceTrace::isEnabled()),
+literalName_(name),
+name_(),
+category_(category),
+detail_(),
+startTime_(0)
+{
+    if (active_)
+    {
+        startTime_ = PerformanceTrace::currentTime();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ScopedTrace::ScopedTrace()
+//-----------------------------------------------------------------------------
+ScopedTrace::ScopedTrace(QString const& name, const char* category, QString const& detail):
+active_(PerformanceTrace::isEnabled()),
+literalName_(0),
+name_(),
+category_(category),
+detail_(),
+startTime_(0)
+{
+    if (active_)
+    {
+        name_ = name;
+        detail_ = detail;
+        startTime_ = PerformanceTrace::currentTime();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ScopedTrace::~ScopedTrace()
+//-----------------------------------------------------------------------------
+ScopedTrace::~ScopedTrace()
+{
+    if (active_)
+    {
+        qint64 endTime = PerformanceTrace::currentTime();
+
+        QString name = name_;
+        if (literalName_ != 0)
+        {
+            name = QString::fromLatin1(literalName_);
+        }
+
+        PerformanceTrace::addEvent(name, QString::fromLatin1(category_), detail_, startTime_,
+            endTime - startTime_);
+    }
+}
@@ -0,0 +1,87 @@
+//-----------------------------------------------------------------------------
+// File: ScopedTrace.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Records the lifetime of a scope as a performance trace event.
+//-----------------------------------------------------------------------------
+
+#ifndef SCOPEDTRACE_H
+#define SCOPEDTRACE_H
+
+#include "PerformanceTrace.h"
+
+#include <QString>
+
+//-----------------------------------------------------------------------------
+//! Records the lifetime of the current scope as a performance trace event with a detail.
+//
+// The name and the detail are evaluated only when the performance trace is enabled, so they may be
+// built from the arguments of the traced function without slowing it down when tracing is off.
+//-----------------------------------------------------------------------------
+#define SCOPED_TRACE_DETAIL(variable, name, category, detail) \
+    ScopedTrace variable(PerformanceTrace::isEnabled() ? QString(name) : QString(), category, \
+        PerformanceTrace::isEnabled() ? QString(detail) : QString())
+
+//-----------------------------------------------------------------------------
+//! Records the lifetime of a scope as a performance trace event.
+//
+// Does nothing but check a flag when the performance trace is disabled. The events with a detail are
+// recorded with the macro SCOPED_TRACE_DETAIL, which builds the detail only when tracing is enabled.
+//-----------------------------------------------------------------------------
+class ScopedTrace
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] name        The name of the event.
+     *      @param [in] category    The category of the event.
+     */
+    ScopedTrace(const char* name, const char* category);
+
+    /*!
+     *  The constructor. Use the macro SCOPED_TRACE_DETAIL instead of calling this directly.
+     *
+     *      @param [in] name        The name of the event.
+     *      @param [in] category    The category of the event.
+     *      @param [in] detail      Additional information of the event, e.g. the document name.
+     */
+    ScopedTrace(QString const& name, const char* category, QString const& detail);
+
+    //! The destructor. Records the event.
+    ~ScopedTrace();
+
+private:
+    // Disable copying.
+    ScopedTrace(ScopedTrace const& rhs);
+    ScopedTrace& operator=(ScopedTrace const& rhs);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! If true, the event is recorded.
+    bool active_;
+
+    //! The name of the event given as a literal.
+    const char* literalName_;
+
+    //! The name of the event.
+    QString name_;
+
+    //! The category of the event.
+    const char* category_;
+
+    //! Additional information of the event.
+    QString detail_;
+
+    //! The start time of the event in microseconds.
+    qint64 startTime_;
+};
+
+#endif // SCOPEDTRACE_H
@@ -14,6 +14,7 @@
 #include "ConnectionEndpoint.h"
 #include "IGraphicsItemStack.h"
 #include "GraphicsConnection.h"
+#include "LevelOfDetail.h"
 
 #include <IPXACTmodels/vlnv.h>
 
@@ -22,6 +23,7 @@
 #include <IPXACTmodels/component.h>
 
 #include <QFont>
+#include <QPainter>
 #include <QTextDocument>
 
 //-----------------------------------------------------------------------------
@@ -56,7 +58,7 @@ ComponentItem::ComponentItem(QRectF const& size,
         "Null component-pointer given as parameter");
 
     // Create the name label.
-    nameLabel_ = new QGraphicsTextItem(instanceName, this);
+    nameLabel_ = new DetailTextItem(instanceName, this);
     QFont font = nameLabel_->font();
     font.setWeight(QFont::Bold);
     nameLabel_->setFont(font);
@@ -167,6 +169,7 @@ void ComponentItem::setName(QString const& name)
     }
 
     name_ = name;
+    diagram->markItemModified(this);
 
     if (displayName_.isEmpty())
     {
@@ -199,6 +202,12 @@ void ComponentItem::setDisplayName(QString const& displayName)
         updateNameLabel(name_);
     }
 
+    DesignDiagram* diagram = dynamic_cast<DesignDiagram*>(scene());
+    if (diagram != 0)
+    {
+        diagram->markItemModified(this);
+    }
+
     emit displayNameChanged(displayName_);
 }
 
@@ -209,6 +218,13 @@ void ComponentItem::setDescription(const QString& description)
 {
     description_ = description;
     updateComponent();
+
+    DesignDiagram* diagram = dynamic_cast<DesignDiagram*>(scene());
+    if (diagram != 0)
+    {
+        diagram->markItemModified(this);
+    }
+
     emit descriptionChanged(description_);
 }
 
@@ -299,6 +315,22 @@ QVariant ComponentItem::itemChange(GraphicsItemChange change, const QVariant &va
     return QGraphicsItem::itemChange(change, value);
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentItem::paint()
+//-----------------------------------------------------------------------------
+void ComponentItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
+{
+    if (LevelOfDetail::getLevel(painter) == LevelOfDetail::LEVEL_OUTLINE)
+    {
+        painter->setPen(QPen(pen().color(), 0));
+        painter->setBrush(brush().color());
+        painter->drawRect(rect());
+        return;
+    }
+
+    QGraphicsRectItem::paint(painter, option, widget);
+}
+
 //-----------------------------------------------------------------------------
 // Function: updateNameLabel()
 //-----------------------------------------------------------------------------
@@ -11,6 +11,8 @@
 
 #ifndef COMPONENTITEM_H
 #define COMPONENTITEM_H
+
+#include <common/graphicsItems/DetailTextItem.h>
 
 #include <designEditors/common/diagramgrid.h>
 #include <designEditors/common/Association/Associable.h>
@@ -227,6 +229,9 @@ signals:
 protected:
     QVariant itemChange(GraphicsItemChange change, const QVariant &value);
 
+    //! Draws the component as a plain rectangle when the diagram is zoomed far out.
+    virtual void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget);
+
     /*!
      *  Updates the name label with the given text.
      *
@@ -253,7 +258,7 @@ private:
     QString name_;
 
     //! The name label.
-    QGraphicsTextItem* nameLabel_;
+    DetailTextItem* nameLabel_;
 
     //! \brief The display name for the component instance.
 	QString displayName_;
@@ -19,6 +19,8 @@
 
 #include <common/KactusColors.h>
 
+#include <designEditors/common/DesignDiagram.h>
+
 #include <QPen>
 
 //-----------------------------------------------------------------------------
@@ -184,6 +186,12 @@ void ConnectionEndpoint::updateInterface()
     {
         setPen(QPen(Qt::black, 0));
     }
+
+    DesignDiagram* diagram = dynamic_cast<DesignDiagram*>(scene());
+    if (diagram != 0)
+    {
+        diagram->markItemModified(this);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -0,0 +1,194 @@
+//-----------------------------------------------------------------------------
+// File: ConnectionSegmentIndex.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Spatial index of the route segments of the connections in a diagram.
+//-----------------------------------------------------------------------------
+
+#include "ConnectionSegmentIndex.h"
+
+#include "GraphicsConnection.h"
+
+#include <QtMath>
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex::ConnectionSegmentIndex()
+//-----------------------------------------------------------------------------
+ConnectionSegmentIndex::ConnectionSegmentIndex(qreal cellSize) : cellSize_(cellSize), cells_(),
+    connectionCells_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex::~ConnectionSegmentIndex()
+//-----------------------------------------------------------------------------
+ConnectionSegmentIndex::~ConnectionSegmentIndex()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex::clear()
+//-----------------------------------------------------------------------------
+void ConnectionSegmentIndex::clear()
+{
+    cells_.clear();
+    connectionCells_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex::updateConnection()
+//-----------------------------------------------------------------------------
+void ConnectionSegmentIndex::updateConnection(GraphicsConnection* connection, QList<QPointF> const& route)
+{
+    QSet<Cell> oldCells = connectionCells_.value(connection);
+    QSet<Cell> newCells = getCells(route);
+
+    foreach (Cell const& cell, oldCells - newCells)
+    {
+        QHash<Cell, QSet<GraphicsConnection*> >::iterator connections = cells_.find(cell);
+        if (connections != cells_.end())
+        {
+            connections.value().remove(connection);
+            if (connections.value().isEmpty())
+            {
+                cells_.erase(connections);
+            }
+        }
+    }
+
+    foreach (Cell const& cell, newCells - oldCells)
+    {
+        cells_[cell].insert(connection);
+    }
+
+    connectionCells_.insert(connection, newCells);
+
+    // Both the connections crossing the old route and the ones crossing the new route are affected.
+    invalidateCrossings(oldCells.unite(newCells));
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex::removeConnection()
+//-----------------------------------------------------------------------------
+void ConnectionSegmentIndex::removeConnection(GraphicsConnection* connection)
+{
+    if (!connectionCells_.contains(connection))
+    {
+        return;
+    }
+
+    QSet<Cell> oldCells = connectionCells_.take(connection);
+    foreach (Cell const& cell, oldCells)
+    {
+        QHash<Cell, QSet<GraphicsConnection*> >::iterator connections = cells_.find(cell);
+        if (connections != cells_.end())
+        {
+            connections.value().remove(connection);
+            if (connections.value().isEmpty())
+            {
+                cells_.erase(connections);
+            }
+        }
+    }
+
+    invalidateCrossings(oldCells);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex::findConnections()
+//-----------------------------------------------------------------------------
+QList<GraphicsConnection*> ConnectionSegmentIndex::findConnections(QRectF const& area) const
+{
+    QSet<GraphicsConnection*> connections;
+
+    int left = qFloor(area.left() / cellSize_);
+    int right = qFloor(area.right() / cellSize_);
+    int top = qFloor(area.top() / cellSize_);
+    int bottom = qFloor(area.bottom() / cellSize_);
+
+    // For large areas it is cheaper to go through the occupied cells only.
+    if (qreal(right - left + 1) * qreal(bottom - top + 1) > cells_.size())
+    {
+        for (QHash<Cell, QSet<GraphicsConnection*> >::const_iterator i = cells_.constBegin();
+            i != cells_.constEnd(); ++i)
+        {
+            if (i.key().first >= left && i.key().first <= right &&
+                i.key().second >= top && i.key().second <= bottom)
+            {
+                connections.unite(i.value());
+            }
+        }
+    }
+    else
+    {
+        for (int x = left; x <= right; ++x)
+        {
+            for (int y = top; y <= bottom; ++y)
+            {
+                QHash<Cell, QSet<GraphicsConnection*> >::const_iterator i = cells_.constFind(Cell(x, y));
+                if (i != cells_.constEnd())
+                {
+                    connections.unite(i.value());
+                }
+            }
+        }
+    }
+
+    return connections.toList();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex::getCells()
+//-----------------------------------------------------------------------------
+QSet<ConnectionSegmentIndex::Cell> ConnectionSegmentIndex::getCells(QList<QPointF> const& route) const
+{
+    QSet<Cell> cells;
+    for (int i = 0; i < route.size() - 1; ++i)
+    {
+        addCells(QRectF(route.at(i), route.at(i + 1)).normalized(), cells);
+    }
+
+    return cells;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex::addCells()
+//-----------------------------------------------------------------------------
+void ConnectionSegmentIndex::addCells(QRectF const& area, QSet<Cell>& cells) const
+{
+    int left = qFloor(area.left() / cellSize_);
+    int right = qFloor(area.right() / cellSize_);
+    int top = qFloor(area.top() / cellSize_);
+    int bottom = qFloor(area.bottom() / cellSize_);
+
+    for (int x = left; x <= right; ++x)
+    {
+        for (int y = top; y <= bottom; ++y)
+        {
+            cells.insert(Cell(x, y));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex::invalidateCrossings()
+//-----------------------------------------------------------------------------
+void ConnectionSegmentIndex::invalidateCrossings(QSet<Cell> const& cells) const
+{
+    QSet<GraphicsConnection*> affected;
+    foreach (Cell const& cell, cells)
+    {
+        affected.unite(cells_.value(cell));
+    }
+
+    foreach (GraphicsConnection* connection, affected)
+    {
+        connection->invalidateCrossings();
+    }
+}
@@ -0,0 +1,120 @@
+//-----------------------------------------------------------------------------
+// File: ConnectionSegmentIndex.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Spatial index of the route segments of the connections in a diagram.
+//-----------------------------------------------------------------------------
+
+#ifndef CONNECTIONSEGMENTINDEX_H
+#define CONNECTIONSEGMENTINDEX_H
+
+#include <QHash>
+#include <QList>
+#include <QPair>
+#include <QPointF>
+#include <QRectF>
+#include <QSet>
+
+class GraphicsConnection;
+
+//-----------------------------------------------------------------------------
+//! Spatial index of the route segments of the connections in a diagram.
+//
+// The scene is divided into a uniform grid of square cells and each connection is stored in the cells
+// covered by its route segments. When a route changes, the connections sharing a cell with the old or
+// the new route are notified so that they can drop their cached crossings.
+//-----------------------------------------------------------------------------
+class ConnectionSegmentIndex
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] cellSize    The width and height of a single grid cell in scene coordinates.
+     */
+    explicit ConnectionSegmentIndex(qreal cellSize = 200.0);
+
+    //! The destructor.
+    ~ConnectionSegmentIndex();
+
+    /*!
+     *  Removes all connections from the index without notifying them.
+     */
+    void clear();
+
+    /*!
+     *  Adds the given connection to the index or updates its route in the index.
+     *
+     *      @param [in] connection  The connection whose route changed.
+     *      @param [in] route       The new route of the connection in scene coordinates.
+     */
+    void updateConnection(GraphicsConnection* connection, QList<QPointF> const& route);
+
+    /*!
+     *  Removes the given connection from the index.
+     *
+     *      @param [in] connection  The connection to remove.
+     */
+    void removeConnection(GraphicsConnection* connection);
+
+    /*!
+     *  Finds the connections with a route segment in a grid cell overlapping the given area.
+     *
+     *      @param [in] area    The area to search in scene coordinates.
+     *
+     *      @return The candidate connections. The caller must check the actual segments.
+     */
+    QList<GraphicsConnection*> findConnections(QRectF const& area) const;
+
+private:
+    // Disable copying.
+    ConnectionSegmentIndex(ConnectionSegmentIndex const& rhs);
+    ConnectionSegmentIndex& operator=(ConnectionSegmentIndex const& rhs);
+
+    //! Grid cell identified by its column and row.
+    typedef QPair<int, int> Cell;
+
+    /*!
+     *  Finds the cells covered by the given route.
+     *
+     *      @param [in] route   The route in scene coordinates.
+     *
+     *      @return The covered cells.
+     */
+    QSet<Cell> getCells(QList<QPointF> const& route) const;
+
+    /*!
+     *  Adds the cells overlapping the given area to the given set.
+     *
+     *      @param [in]  area   The area in scene coordinates.
+     *      @param [out] cells  The set to add the cells to.
+     */
+    void addCells(QRectF const& area, QSet<Cell>& cells) const;
+
+    /*!
+     *  Notifies the connections in the given cells that their crossings may have changed.
+     *
+     *      @param [in] cells   The cells whose connections to notify.
+     */
+    void invalidateCrossings(QSet<Cell> const& cells) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The width and height of a grid cell.
+    qreal cellSize_;
+
+    //! The connections in each non-empty cell.
+    QHash<Cell, QSet<GraphicsConnection*> > cells_;
+
+    //! The cells covered by each indexed connection.
+    QHash<GraphicsConnection*, QSet<Cell> > connectionCells_;
+};
+
+#endif // CONNECTIONSEGMENTINDEX_H
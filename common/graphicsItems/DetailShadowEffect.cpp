@@ -0,0 +1,44 @@
+//-----------------------------------------------------------------------------
+// File: DetailShadowEffect.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Drop shadow for labels that are hidden when the diagram is zoomed out.
+//-----------------------------------------------------------------------------
+
+#include "DetailShadowEffect.h"
+
+#include "LevelOfDetail.h"
+
+#include <QPainter>
+
+//-----------------------------------------------------------------------------
+// Function: DetailShadowEffect::DetailShadowEffect()
+//-----------------------------------------------------------------------------
+DetailShadowEffect::DetailShadowEffect(QObject* parent):
+QGraphicsDropShadowEffect(parent)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DetailShadowEffect::~DetailShadowEffect()
+//-----------------------------------------------------------------------------
+DetailShadowEffect::~DetailShadowEffect()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DetailShadowEffect::draw()
+//-----------------------------------------------------------------------------
+void DetailShadowEffect::draw(QPainter* painter)
+{
+    if (LevelOfDetail::getLevel(painter) == LevelOfDetail::LEVEL_FULL)
+    {
+        QGraphicsDropShadowEffect::draw(painter);
+    }
+}
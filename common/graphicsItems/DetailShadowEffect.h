@@ -0,0 +1,51 @@
+//-----------------------------------------------------------------------------
+// File: DetailShadowEffect.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Drop shadow for labels that are hidden when the diagram is zoomed out.
+//-----------------------------------------------------------------------------
+
+#ifndef DETAILSHADOWEFFECT_H
+#define DETAILSHADOWEFFECT_H
+
+#include <QGraphicsDropShadowEffect>
+
+//-----------------------------------------------------------------------------
+//! Drop shadow for labels that are hidden when the diagram is zoomed out.
+//
+// Skips both the shadow and the item itself when the level of detail is too low for labels, so that
+// the blur is not rendered for labels that are not drawn.
+//-----------------------------------------------------------------------------
+class DetailShadowEffect : public QGraphicsDropShadowEffect
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] parent   The parent object.
+     */
+    explicit DetailShadowEffect(QObject* parent = 0);
+
+    //! The destructor.
+    virtual ~DetailShadowEffect();
+
+protected:
+
+    //! Draws the shadow and the item, unless the level of detail is too low for labels.
+    virtual void draw(QPainter* painter);
+
+private:
+
+    //! Disable copying.
+    DetailShadowEffect(DetailShadowEffect const& rhs);
+
+    //! Disable assignment.
+    DetailShadowEffect& operator=(DetailShadowEffect const& rhs);
+};
+
+#endif // DETAILSHADOWEFFECT_H
@@ -0,0 +1,53 @@
+//-----------------------------------------------------------------------------
+// File: DetailTextItem.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Text item for labels that are hidden when the diagram is zoomed out.
+//-----------------------------------------------------------------------------
+
+#include "DetailTextItem.h"
+
+#include "LevelOfDetail.h"
+
+#include <QPainter>
+
+//-----------------------------------------------------------------------------
+// Function: DetailTextItem::DetailTextItem()
+//-----------------------------------------------------------------------------
+DetailTextItem::DetailTextItem(QGraphicsItem* parent):
+QGraphicsTextItem(parent)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DetailTextItem::DetailTextItem()
+//-----------------------------------------------------------------------------
+DetailTextItem::DetailTextItem(QString const& text, QGraphicsItem* parent):
+QGraphicsTextItem(text, parent)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DetailTextItem::~DetailTextItem()
+//-----------------------------------------------------------------------------
+DetailTextItem::~DetailTextItem()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DetailTextItem::paint()
+//-----------------------------------------------------------------------------
+void DetailTextItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
+{
+    if (LevelOfDetail::getLevel(painter) == LevelOfDetail::LEVEL_FULL)
+    {
+        QGraphicsTextItem::paint(painter, option, widget);
+    }
+}
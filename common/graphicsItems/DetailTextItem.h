@@ -0,0 +1,54 @@
+//-----------------------------------------------------------------------------
+// File: DetailTextItem.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Text item for labels that are hidden when the diagram is zoomed out.
+//-----------------------------------------------------------------------------
+
+#ifndef DETAILTEXTITEM_H
+#define DETAILTEXTITEM_H
+
+#include <QGraphicsTextItem>
+
+//-----------------------------------------------------------------------------
+//! Text item for labels that are hidden when the diagram is zoomed out.
+//-----------------------------------------------------------------------------
+class DetailTextItem : public QGraphicsTextItem
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] parent   The parent item.
+     */
+    explicit DetailTextItem(QGraphicsItem* parent = 0);
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] text     The text of the label.
+     *      @param [in] parent   The parent item.
+     */
+    DetailTextItem(QString const& text, QGraphicsItem* parent = 0);
+
+    //! The destructor.
+    virtual ~DetailTextItem();
+
+    //! Draws the item, unless the level of detail is too low for labels.
+    virtual void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget);
+
+private:
+
+    //! Disable copying.
+    DetailTextItem(DetailTextItem const& rhs);
+
+    //! Disable assignment.
+    DetailTextItem& operator=(DetailTextItem const& rhs);
+};
+
+#endif // DETAILTEXTITEM_H
@@ -31,6 +31,18 @@
 #include <QDebug>
 #include <QCursor>
 #include <QApplication>
+#include <QtAlgorithms>
+
+namespace
+{
+    /*!
+     *  Compares the y coordinates of two items.
+     */
+    bool isItemAbove(QGraphicsItem const* item1, QGraphicsItem const* item2)
+    {
+        return item1->y() < item2->y();
+    }
+}
 
 //-----------------------------------------------------------------------------
 // Function: GraphicsColumn()
@@ -44,7 +56,8 @@ GraphicsColumn::GraphicsColumn(ColumnDesc const& desc, GraphicsColumnLayout* lay
       items_(),
       oldPos_(),
       mouseNearResizeArea_(false),
-      oldWidth_(0)
+      oldWidth_(0),
+      batchDepth_(0)
 {
     setFlag(ItemIsMovable);
     setFlag(ItemIsSelectable);
@@ -101,7 +114,12 @@ void GraphicsColumn::addItem(QGraphicsItem* item, bool load)
     item->setPos(pos);
     item->setFlag(ItemStacksBehindParent);
 
-    if (load)
+    // During a batch, the items are ordered and stacked when the batch ends.
+    if (batchDepth_ > 0)
+    {
+        items_.append(item);
+    }
+    else if (load)
     {
         // Place the item at the correct index in the items list.
         for (int i = 0; i < items_.size(); ++i)
@@ -136,7 +154,7 @@ void GraphicsColumn::removeItem(QGraphicsItem* item)
     items_.removeAll(item);
     item->setParentItem(0);
 
-    if (itemLayout_ != 0)
+    if (itemLayout_ != 0 && batchDepth_ == 0)
     {
         itemLayout_->updateItemPositions(items_, desc_.getWidth() / 2, MIN_Y_PLACEMENT);
     }
@@ -355,6 +373,28 @@ void GraphicsColumn::updateItemPositions()
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: GraphicsColumn::beginBatchUpdate()
+//-----------------------------------------------------------------------------
+void GraphicsColumn::beginBatchUpdate()
+{
+    ++batchDepth_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: GraphicsColumn::endBatchUpdate()
+//-----------------------------------------------------------------------------
+void GraphicsColumn::endBatchUpdate()
+{
+    Q_ASSERT(batchDepth_ > 0);
+
+    if (--batchDepth_ == 0)
+    {
+        qStableSort(items_.begin(), items_.end(), isItemAbove);
+        updateItemPositions();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: getName()
 //-----------------------------------------------------------------------------
@@ -150,6 +150,19 @@ public:
      */
     void updateItemPositions();
 
+    /*!
+     *  Suspends the item layout until the matching call to endBatchUpdate().
+     *
+     *      @remarks The items added during the batch keep their positions and are stacked once at the end.
+     */
+    void beginBatchUpdate();
+
+    /*!
+     *  Ends a batch started with beginBatchUpdate(). The items are ordered and stacked when the outermost
+     *  batch ends.
+     */
+    void endBatchUpdate();
+
     /*!
      *  Maps the given local position to scene coordinates.
      */
@@ -275,6 +288,9 @@ private:
 
     //! The old column width before resize.
     unsigned int oldWidth_;
+
+    //! The number of nested batch updates in progress.
+    int batchDepth_;
 };
 
 //-----------------------------------------------------------------------------
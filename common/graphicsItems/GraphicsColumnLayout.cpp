@@ -26,7 +26,8 @@ GraphicsColumnLayout::GraphicsColumnLayout(QGraphicsScene* scene)
       layoutWidth_(0.0),
       offsetY_(0),
       autoReorganized_(false),
-      autoCreateColumnFunc_(0)
+      autoCreateColumnFunc_(0),
+      batchDepth_(0)
 {
 }
 
@@ -76,6 +77,12 @@ void GraphicsColumnLayout::addColumn(GraphicsColumn* column, bool append)
 
     column->setOffsetY(offsetY_);
 
+    // A column added during a batch joins the batch.
+    for (int i = 0; i < batchDepth_; ++i)
+    {
+        column->beginBatchUpdate();
+    }
+
     // Add the column to the list of columns and update the layout width.
     columns_.append(column);
     layoutWidth_ += column->boundingRect().width();
@@ -92,6 +99,11 @@ void GraphicsColumnLayout::removeColumn(GraphicsColumn* column)
 {
     if (columns_.removeAll(column) > 0)
     {
+        for (int i = 0; i < batchDepth_; ++i)
+        {
+            column->endBatchUpdate();
+        }
+
         layoutWidth_ -= column->boundingRect().width();
         layout_->updateItemPositions(columns_, 0.0, 0.0);
         scene_->removeItem(column);
@@ -186,6 +198,33 @@ void GraphicsColumnLayout::updatePositions()
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: GraphicsColumnLayout::beginBatchUpdate()
+//-----------------------------------------------------------------------------
+void GraphicsColumnLayout::beginBatchUpdate()
+{
+    ++batchDepth_;
+
+    foreach (GraphicsColumn* column, columns_)
+    {
+        column->beginBatchUpdate();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: GraphicsColumnLayout::endBatchUpdate()
+//-----------------------------------------------------------------------------
+void GraphicsColumnLayout::endBatchUpdate()
+{
+    Q_ASSERT(batchDepth_ > 0);
+    --batchDepth_;
+
+    foreach (GraphicsColumn* column, columns_)
+    {
+        column->endBatchUpdate();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: GraphicsColumnLayout::setAutoReorganize()
 //-----------------------------------------------------------------------------
@@ -121,6 +121,16 @@ public:
      */
     void updatePositions();
 
+    /*!
+     *  Suspends the item layout of all columns during a bulk operation, such as loading or pasting.
+     */
+    void beginBatchUpdate();
+
+    /*!
+     *  Ends a batch started with beginBatchUpdate(). The columns are stacked when the outermost batch ends.
+     */
+    void endBatchUpdate();
+
     /*!
      *  Returns the columns in the column layout.
      */
@@ -160,6 +170,9 @@ private:
 
     //! The function pointer to the column auto-creation function.
     AutoCreateColumnFunc autoCreateColumnFunc_;
+
+    //! The number of nested batch updates in progress.
+    int batchDepth_;
 };
 
 //-----------------------------------------------------------------------------
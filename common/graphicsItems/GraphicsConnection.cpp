@@ -13,6 +13,7 @@
 
 #include "ComponentItem.h"
 #include "ConnectionUndoCommands.h"
+#include "LevelOfDetail.h"
 
 #include <common/GenericEditProvider.h>
 #include <common/KactusColors.h>
@@ -22,6 +23,7 @@
 #include <designEditors/common/DiagramUtil.h>
 
 #include <QPen>
+#include <QPolygonF>
 #include <QStyleOptionGraphicsItem>
 #include <QGraphicsScene>
 #include <QPainter>
@@ -29,6 +31,7 @@
 
 float const GraphicsConnection::MIN_LENGTH = 10.0f;
 float const GraphicsConnection::MIN_START_LENGTH = 20.0f;
+float const GraphicsConnection::OVERLAP_SEARCH_MARGIN = 500.0f;
 
 //-----------------------------------------------------------------------------
 // Function: GraphicsConnection()
@@ -47,7 +50,9 @@ GraphicsConnection::GraphicsConnection(ConnectionEndpoint* endpoint1, Connection
       selectionType_(NONE),
       routingMode_(ROUTING_MODE_NORMAL),
       imported_(false),
-      invalid_(false)
+      invalid_(false),
+      crossings_(),
+      crossingsValid_(false)
 {
     setItemSettings();
     createRoute(endpoint1, endpoint2);
@@ -98,7 +103,9 @@ GraphicsConnection::GraphicsConnection(QPointF const& p1, QVector2D const& dir1,
       selectionType_(NONE),
       routingMode_(ROUTING_MODE_NORMAL),
       imported_(false),
-      invalid_(false)
+      invalid_(false),
+      crossings_(),
+      crossingsValid_(false)
 {
     setItemSettings();
     createRoute(p1, p2, dir1, dir2);
@@ -109,6 +116,12 @@ GraphicsConnection::GraphicsConnection(QPointF const& p1, QVector2D const& dir1,
 //-----------------------------------------------------------------------------
 GraphicsConnection::~GraphicsConnection()
 {
+    DesignDiagram* diagram = dynamic_cast<DesignDiagram*>(scene());
+    if (diagram != 0)
+    {
+        diagram->getConnectionSegmentIndex().removeConnection(this);
+    }
+
     disconnectEnds();
     emit destroyed(this);
 }
@@ -206,6 +219,7 @@ QString const& GraphicsConnection::name() const
 void GraphicsConnection::setName(QString const& name)
 {
     name_ = name;
+    notifyModified();
     emit contentChanged();
 }
 
@@ -223,6 +237,7 @@ QString const& GraphicsConnection::description() const
 void GraphicsConnection::setDescription(QString const& description)
 {
     description_ = description;
+    notifyModified();
     emit contentChanged();
 }
 
@@ -582,6 +597,16 @@ void GraphicsConnection::mouseReleaseEvent(QGraphicsSceneMouseEvent *mouseEvent)
 void GraphicsConnection::paint(QPainter* painter, QStyleOptionGraphicsItem const* option,
                          QWidget* widget)
 {
+    LevelOfDetail::Level detail = LevelOfDetail::getLevel(painter);
+
+    // Far out the stroked outline is not distinguishable from a plain line, which is much cheaper to draw.
+    if (detail == LevelOfDetail::LEVEL_OUTLINE)
+    {
+        painter->setPen(QPen(pen().color(), 0));
+        painter->drawPolyline(QPolygonF(pathPoints_.toVector()));
+        return;
+    }
+
     bool selected = option->state & QStyle::State_Selected;
 
     QStyleOptionGraphicsItem myoption = (*option);
@@ -589,7 +614,7 @@ void GraphicsConnection::paint(QPainter* painter, QStyleOptionGraphicsItem const
 
     QGraphicsPathItem::paint(painter, &myoption, widget);
 
-    if (!selected && routingMode_ == ROUTING_MODE_NORMAL)
+    if (!selected && routingMode_ == ROUTING_MODE_NORMAL && detail == LevelOfDetail::LEVEL_FULL)
     {
         drawOverlapGraphics(painter);
     }
@@ -793,6 +818,9 @@ void GraphicsConnection::paintConnectionPath()
 
     QPainterPathStroker stroker;
     setPath(stroker.createStroke(path));
+
+    updateSegmentIndex();
+    notifyModified();
 }
 
 //-----------------------------------------------------------------------------
@@ -869,6 +897,18 @@ QVariant GraphicsConnection::itemChange(GraphicsItemChange change, const QVarian
             endpoint2_->setSelectionHighlight(selected);
         }
     }
+    else if (change == ItemSceneChange)
+    {
+        DesignDiagram* oldDiagram = dynamic_cast<DesignDiagram*>(scene());
+        if (oldDiagram != 0)
+        {
+            oldDiagram->getConnectionSegmentIndex().removeConnection(this);
+        }
+    }
+    else if (change == ItemSceneHasChanged)
+    {
+        updateSegmentIndex();
+    }
 
     return QGraphicsPathItem::itemChange(change, value);
 }
@@ -973,94 +1013,73 @@ void GraphicsConnection::drawLineGap(QPainter* painter, QLineF const& line1, QPo
 //-----------------------------------------------------------------------------
 void GraphicsConnection::drawOverlapGraphics(QPainter* painter)
 {
-    // Determine all items that collide with this item.
-    foreach (QGraphicsItem* item, collidingItems())
+    QList<QPointF> const& route1 = pathPoints_;
+
+    if (!crossingsValid_)
     {
-        QList<QPointF> const& route1 = pathPoints_;
+        updateCrossings();
+    }
 
-        // Paint junction marks to those parts that go vertically and cross another connection.
-        if (dynamic_cast<GraphicsConnection*>(item) != 0)
+    // Paint junction marks to those parts that go vertically and cross another connection.
+    foreach (Crossing const& crossing, crossings_)
+    {
+        GraphicsConnection* conn = crossing.other;
+        QLineF line1(route1[crossing.segment], route1[crossing.segment + 1]);
+        QPointF const& pt = crossing.point;
+
+        // If the connections share an endpoint, draw a black junction circle.
+        if (endpoint1() == conn->endpoint1() || endpoint2() == conn->endpoint2() ||
+            endpoint1() == conn->endpoint2() || endpoint2() == conn->endpoint1())
         {
-            GraphicsConnection* conn = static_cast<GraphicsConnection*>(item);
-            QList<QPointF> const& route2 = conn->route();
+            painter->setPen(QPen(Qt::black, 0));
 
-            for (int i = 0; i < route1.size() - 1; ++i)
-            {
-                // Discard horizontal segments.
-                if (qFuzzyCompare(route1[i].y(), route1[i + 1].y()))
-                {
-                    continue;
-                }
+            QPainterPath circlePath;
+            circlePath.addEllipse(pt, 5.0, 5.0);
 
-                QLineF line1(route1[i], route1[i + 1]);
+            painter->fillPath(circlePath, QBrush(Qt::black));
+        }
+        else
+        {
+            // Otherwise draw a gray undercrossing line close to the intersection point.
+            // Drawing is performed using two lines, excluding the area close to
+            // the intersection point. This way the drawing is done correctly even though
+            // the connection is above the other connection.
+            QVector2D dir(line1.dx(), line1.dy());
+            dir.normalize();
 
-                for (int j = 0; j < route2.size() - 1; ++j)
-                {
-                    // Discard vertical segments of the intersecting connections.
-                    if (qFuzzyCompare(route2[j].x(), route2[j + 1].x()))
-                    {
-                        continue;
-                    }
+            qreal length1 = QVector2D(pt - line1.p1()).length();
+            qreal length2 = QVector2D(pt - line1.p2()).length();
 
-                    QLineF line2(route2[j], route2[j + 1]);
+            qreal width = 3;
 
-                    QPointF pt;
-                    QLineF::IntersectType type = line1.intersect(line2, &pt);
+            // If both lines are thick, we have to use a thicker width.
+            if (pen().width() >= 3 && conn->pen().width() >= 3)
+            {
+                ++width;
+            }
 
-                    if (type == QLineF::BoundedIntersection)
-                    {
-                        // If the connections share an endpoint, draw a black junction circle.
-                        if (endpoint1() == conn->endpoint1() || endpoint2() == conn->endpoint2() ||
-                            endpoint1() == conn->endpoint2() || endpoint2() == conn->endpoint1())
-                        {
-                            painter->setPen(QPen(Qt::black, 0));
-
-                            QPainterPath circlePath;
-                            circlePath.addEllipse(pt, 5.0, 5.0);
-
-                            painter->fillPath(circlePath, QBrush(Qt::black));
-                        }
-                        else
-                        {
-                            // Otherwise draw a gray undercrossing line close to the intersection point.
-                            // Drawing is performed using two lines, excluding the area close to
-                            // the intersection point. This way the drawing is done correctly even though
-                            // the connection is above the other connection.
-                            QVector2D dir(line1.dx(), line1.dy());
-                            dir.normalize();
-
-                            qreal length1 = QVector2D(pt - line1.p1()).length();
-                            qreal length2 = QVector2D(pt - line1.p2()).length();
-
-                            qreal width = 3;
-
-                            // If both lines are thick, we have to use a thicker width.
-                            if (pen().width() >= 3 && conn->pen().width() >= 3)
-                            {
-                                ++width;
-                            }
-
-                            painter->setPen(QPen(QColor(160, 160, 160), pen().width() + 1));
-
-                            if (length2 > 0.5f)
-                            {
-                                QPointF seg1Pt1 = (QVector2D(pt) + dir * qMin(length2, width)).toPointF();
-                                QPointF seg1Pt2 = (QVector2D(pt) + dir * qMin(length2, (qreal)GridSize)).toPointF();
-                                painter->drawLine(seg1Pt1, seg1Pt2);
-                            }
-
-                            if (length1 > 0.5f)
-                            {
-                                QPointF seg2Pt1 = (QVector2D(pt) - dir * qMin(length1, width)).toPointF();
-                                QPointF seg2Pt2 = (QVector2D(pt) - dir * qMin(length1, (qreal)GridSize)).toPointF();
-                                painter->drawLine(seg2Pt1, seg2Pt2);
-                            }
-                        }
-                    }
-                }
+            painter->setPen(QPen(QColor(160, 160, 160), pen().width() + 1));
+
+            if (length2 > 0.5f)
+            {
+                QPointF seg1Pt1 = (QVector2D(pt) + dir * qMin(length2, width)).toPointF();
+                QPointF seg1Pt2 = (QVector2D(pt) + dir * qMin(length2, (qreal)GridSize)).toPointF();
+                painter->drawLine(seg1Pt1, seg1Pt2);
+            }
+
+            if (length1 > 0.5f)
+            {
+                QPointF seg2Pt1 = (QVector2D(pt) - dir * qMin(length1, width)).toPointF();
+                QPointF seg2Pt2 = (QVector2D(pt) - dir * qMin(length1, (qreal)GridSize)).toPointF();
+                painter->drawLine(seg2Pt1, seg2Pt2);
             }
         }
-        else if (dynamic_cast<ComponentItem*>(item) != 0)
+    }
+
+    // Determine the components that may overlap with this item.
+    foreach (QGraphicsItem* item, scene()->items(sceneBoundingRect(), Qt::IntersectsItemBoundingRect))
+    {
+        if (dynamic_cast<ComponentItem*>(item) != 0)
         {
             ComponentItem* comp = static_cast<ComponentItem*>(item);
 
@@ -1123,6 +1142,99 @@ void GraphicsConnection::drawOverlapGraphics(QPainter* painter)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: GraphicsConnection::updateCrossings()
+//-----------------------------------------------------------------------------
+void GraphicsConnection::updateCrossings()
+{
+    crossings_.clear();
+    crossingsValid_ = true;
+
+    DesignDiagram* diagram = dynamic_cast<DesignDiagram*>(scene());
+    if (diagram == 0)
+    {
+        return;
+    }
+
+    QList<QPointF> const& route1 = pathPoints_;
+
+    for (int i = 0; i < route1.size() - 1; ++i)
+    {
+        // Discard horizontal segments.
+        if (qFuzzyCompare(route1[i].y(), route1[i + 1].y()))
+        {
+            continue;
+        }
+
+        QLineF line1(route1[i], route1[i + 1]);
+
+        QRectF segmentArea = QRectF(route1[i], route1[i + 1]).normalized();
+        foreach (GraphicsConnection* conn, diagram->getConnectionSegmentIndex().findConnections(segmentArea))
+        {
+            if (conn == this)
+            {
+                continue;
+            }
+
+            QList<QPointF> const& route2 = conn->route();
+
+            for (int j = 0; j < route2.size() - 1; ++j)
+            {
+                // Discard vertical segments of the intersecting connections.
+                if (qFuzzyCompare(route2[j].x(), route2[j + 1].x()))
+                {
+                    continue;
+                }
+
+                QLineF line2(route2[j], route2[j + 1]);
+
+                QPointF pt;
+                if (line1.intersect(line2, &pt) == QLineF::BoundedIntersection)
+                {
+                    crossings_.append(Crossing(i, pt, conn));
+                }
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: GraphicsConnection::invalidateCrossings()
+//-----------------------------------------------------------------------------
+void GraphicsConnection::invalidateCrossings()
+{
+    crossingsValid_ = false;
+    update();
+}
+
+//-----------------------------------------------------------------------------
+// Function: GraphicsConnection::updateSegmentIndex()
+//-----------------------------------------------------------------------------
+void GraphicsConnection::updateSegmentIndex()
+{
+    DesignDiagram* diagram = dynamic_cast<DesignDiagram*>(scene());
+    if (diagram != 0)
+    {
+        diagram->getConnectionSegmentIndex().updateConnection(this, pathPoints_);
+    }
+    else
+    {
+        invalidateCrossings();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: GraphicsConnection::notifyModified()
+//-----------------------------------------------------------------------------
+void GraphicsConnection::notifyModified()
+{
+    DesignDiagram* diagram = dynamic_cast<DesignDiagram*>(scene());
+    if (diagram != 0)
+    {
+        diagram->markItemModified(this);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: GraphicsConnection::setLineWidth()
 //-----------------------------------------------------------------------------
@@ -1357,12 +1469,23 @@ bool GraphicsConnection::sortBoundsByY(SegmentBound const& lhs, SegmentBound con
 void GraphicsConnection::createSegmentBounds(QList<SegmentBound>& verticalBounds,
                                              QList<SegmentBound>& horizontalBounds)
 {
-    foreach (QGraphicsItem* item, scene()->items())
+    DesignDiagram* diagram = dynamic_cast<DesignDiagram*>(scene());
+
+    QList<GraphicsConnection*> nearbyConnections;
+    if (diagram != 0 && !pathPoints_.isEmpty())
     {
-        GraphicsConnection const* conn = dynamic_cast<GraphicsConnection const*>(item);
+        // The segments are moved only a limited distance from the current route, so connections
+        // farther away cannot cause overlaps.
+        QRectF searchArea = QPolygonF(pathPoints_.toVector()).boundingRect().adjusted(
+            -OVERLAP_SEARCH_MARGIN, -OVERLAP_SEARCH_MARGIN, OVERLAP_SEARCH_MARGIN, OVERLAP_SEARCH_MARGIN);
 
+        nearbyConnections = diagram->getConnectionSegmentIndex().findConnections(searchArea);
+    }
+
+    foreach (GraphicsConnection const* conn, nearbyConnections)
+    {
         // If the connections share an endpoint, discard it from the segment bounds.
-        if (conn != 0 && conn != this &&
+        if (conn != this &&
             endpoint1() != conn->endpoint1() && endpoint2() != conn->endpoint2() &&
             endpoint1() != conn->endpoint2() && endpoint2() != conn->endpoint1())
         {
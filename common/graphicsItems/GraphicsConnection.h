@@ -232,6 +232,13 @@ public:
      */
     virtual QPointF connectionPoint(QPointF const& otherEnd) const;
 
+    /*!
+     *  Marks the cached crossings with other connections outdated and schedules a repaint.
+     *
+     *      @remarks Called by the segment index when a route near this connection changes.
+     */
+    void invalidateCrossings();
+
 signals:
     //! Signals that the connection has changed.
     void contentChanged();
@@ -250,6 +257,11 @@ protected:
 
     QVariant itemChange(GraphicsItemChange change, const QVariant &value);
 
+    /*!
+     *  Notifies the diagram that the design data of this connection has changed.
+     */
+    void notifyModified();
+
 private:
     //-----------------------------------------------------------------------------
     //! Selection type enumeration.
@@ -265,6 +277,9 @@ private:
     static float const MIN_LENGTH;
     static float const MIN_START_LENGTH;
 
+    //! The distance around the route searched for other connections when fixing overlaps.
+    static float const OVERLAP_SEARCH_MARGIN;
+
     /*!
      *  Sets the default graphics item settings.
      */
@@ -311,6 +326,42 @@ private:
      */
     void drawLineGap(QPainter* painter, QLineF const& line, QPointF const& pt);
 
+    /*!
+     *  Finds the points where the vertical segments of this connection cross the horizontal segments
+     *  of the other connections.
+     */
+    void updateCrossings();
+
+    /*!
+     *  Updates the route of this connection in the segment index of the diagram.
+     */
+    void updateSegmentIndex();
+
+    //-----------------------------------------------------------------------------
+    //! Crossing of this connection and another connection.
+    //-----------------------------------------------------------------------------
+    struct Crossing
+    {
+        //! The index of the vertical segment of this connection.
+        int segment;
+
+        //! The crossing point.
+        QPointF point;
+
+        //! The connection crossed.
+        GraphicsConnection* other;
+
+        /*!
+         *  Constructor.
+         */
+        Crossing(int segment, QPointF const& point, GraphicsConnection* other)
+            : segment(segment),
+              point(point),
+              other(other)
+        {
+        }
+    };
+
     //-----------------------------------------------------------------------------
     //! Segment bound structure.
     //-----------------------------------------------------------------------------
@@ -334,7 +385,7 @@ private:
     };
 
     /*!
-     *  Creates segment bounds from the existing connections.
+     *  Creates segment bounds from the existing connections near this connection.
      *
      *      @param [out] verBounds    The list of vertical segment bounds.
      *      @param [out] horizontalBounds  The list of horizontal bounds.
@@ -490,6 +541,12 @@ private:
 
     //! The default color.
     bool invalid_;
+
+    //! The cached crossings with other connections.
+    QList<Crossing> crossings_;
+
+    //! If true, the cached crossings are up to date with the routes.
+    bool crossingsValid_;
 };
 
 //-----------------------------------------------------------------------------
@@ -0,0 +1,59 @@
+//-----------------------------------------------------------------------------
+// File: LevelOfDetail.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Level of detail for drawing the diagram items at different zoom levels.
+//-----------------------------------------------------------------------------
+
+#include "LevelOfDetail.h"
+
+#include <QPainter>
+#include <QSettings>
+#include <QStyleOptionGraphicsItem>
+
+namespace
+{
+    //! The default zoom percentage below which labels are hidden.
+    const int DEFAULT_LABEL_THRESHOLD = 50;
+
+    //! The default zoom percentage below which the items are drawn as plain shapes.
+    const int DEFAULT_OUTLINE_THRESHOLD = 25;
+
+    //! The scale below which labels are hidden.
+    qreal labelThreshold = DEFAULT_LABEL_THRESHOLD / 100.0;
+
+    //! The scale below which the items are drawn as plain shapes.
+    qreal outlineThreshold = DEFAULT_OUTLINE_THRESHOLD / 100.0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LevelOfDetail::applySettings()
+//-----------------------------------------------------------------------------
+void LevelOfDetail::applySettings(QSettings& settings)
+{
+    labelThreshold = settings.value("Design/LabelZoomThreshold", DEFAULT_LABEL_THRESHOLD).toInt() / 100.0;
+    outlineThreshold = settings.value("Design/OutlineZoomThreshold", DEFAULT_OUTLINE_THRESHOLD).toInt() / 100.0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LevelOfDetail::getLevel()
+//-----------------------------------------------------------------------------
+LevelOfDetail::Level LevelOfDetail::getLevel(QPainter const* painter)
+{
+    qreal scale = QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform());
+
+    if (scale < outlineThreshold)
+    {
+        return LEVEL_OUTLINE;
+    }
+    else if (scale < labelThreshold)
+    {
+        return LEVEL_NO_LABELS;
+    }
+
+    return LEVEL_FULL;
+}
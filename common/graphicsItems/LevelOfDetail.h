@@ -0,0 +1,51 @@
+//-----------------------------------------------------------------------------
+// File: LevelOfDetail.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Level of detail for drawing the diagram items at different zoom levels.
+//-----------------------------------------------------------------------------
+
+#ifndef LEVELOFDETAIL_H
+#define LEVELOFDETAIL_H
+
+class QPainter;
+class QSettings;
+
+//-----------------------------------------------------------------------------
+//! Level of detail for drawing the diagram items at different zoom levels.
+//
+// The level is selected from the scale of the painter transform so that zoomed out diagrams skip the
+// details that would not be legible anyway.
+//-----------------------------------------------------------------------------
+namespace LevelOfDetail
+{
+    //! The levels of detail from the most detailed to the least detailed.
+    enum Level
+    {
+        LEVEL_FULL = 0,     //!< All details are drawn.
+        LEVEL_NO_LABELS,    //!< Labels and connection junction marks are hidden.
+        LEVEL_OUTLINE       //!< Components, ports and connections are drawn as plain shapes.
+    };
+
+    /*!
+     *  Reads the zoom thresholds of the levels from the given settings.
+     *
+     *      @param [in] settings    The settings to read.
+     */
+    void applySettings(QSettings& settings);
+
+    /*!
+     *  Gets the level of detail for drawing with the given painter.
+     *
+     *      @param [in] painter     The painter used to draw the item.
+     *
+     *      @return The level of detail to draw with.
+     */
+    Level getLevel(QPainter const* painter);
+}
+
+#endif // LEVELOFDETAIL_H
@@ -0,0 +1,386 @@
+//-----------------------------------------------------------------------------
+// File: OrthogonalRouter.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Obstacle-aware orthogonal router for the connections in a diagram.
+//-----------------------------------------------------------------------------
+
+#include "OrthogonalRouter.h"
+
+#include <QHash>
+#include <QMultiMap>
+#include <QtAlgorithms>
+
+#include <limits>
+
+namespace
+{
+    //! The distance the search area extends beyond the endpoints of a route.
+    const qreal SEARCH_MARGIN = 200.0;
+
+    //! The cost of a single bend compared to the route length.
+    const qreal BEND_COST = 40.0;
+
+    //! The maximum number of search states to expand for a single route.
+    const int MAX_EXPANDED_STATES = 200000;
+
+    //! The grid steps for each direction.
+    const int STEP_X[] = { 1, 0, -1, 0 };
+    const int STEP_Y[] = { 0, 1, 0, -1 };
+
+    //! The distance within which two coordinates are considered equal.
+    const qreal COORDINATE_EPSILON = 0.001;
+
+    /*!
+     *  Sorts the given coordinates and removes the duplicates.
+     */
+    void sortUnique(QVector<qreal>& coordinates)
+    {
+        qSort(coordinates);
+
+        QVector<qreal> unique;
+        unique.reserve(coordinates.size());
+        foreach (qreal coordinate, coordinates)
+        {
+            if (unique.isEmpty() || coordinate - unique.last() > COORDINATE_EPSILON)
+            {
+                unique.append(coordinate);
+            }
+        }
+
+        coordinates = unique;
+    }
+
+    /*!
+     *  Finds the index of the given coordinate in a sorted list of unique coordinates.
+     */
+    int indexOf(QVector<qreal> const& coordinates, qreal coordinate)
+    {
+        return qLowerBound(coordinates.constBegin(), coordinates.constEnd(), coordinate - COORDINATE_EPSILON) -
+            coordinates.constBegin();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::OrthogonalRouter()
+//-----------------------------------------------------------------------------
+OrthogonalRouter::OrthogonalRouter(QList<QRectF> const& obstacles, qreal clearance, qreal stubLength):
+obstacles_(obstacles), bounds_(), clearance_(clearance), stubLength_(stubLength)
+{
+    foreach (QRectF const& obstacle, obstacles_)
+    {
+        bounds_ = bounds_.united(obstacle);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::~OrthogonalRouter()
+//-----------------------------------------------------------------------------
+OrthogonalRouter::~OrthogonalRouter()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::route()
+//-----------------------------------------------------------------------------
+QList<QPointF> OrthogonalRouter::route(Request const& request) const
+{
+    Direction startDirection = toDirection(request.startDirection);
+    Direction endDirection = toDirection(request.endDirection);
+
+    QPointF startStub = request.start +
+        QPointF(STEP_X[startDirection] * stubLength_, STEP_Y[startDirection] * stubLength_);
+    QPointF endStub = request.end +
+        QPointF(STEP_X[endDirection] * stubLength_, STEP_Y[endDirection] * stubLength_);
+
+    // Most routes stay close to their endpoints, so the search starts from the area around them.
+    QRectF area = QRectF(startStub, endStub).normalized().adjusted(-SEARCH_MARGIN, -SEARCH_MARGIN,
+        SEARCH_MARGIN, SEARCH_MARGIN);
+
+    QList<QPointF> path = search(startStub, startDirection, endStub, endDirection, area);
+
+    if (path.isEmpty() && !area.contains(bounds_))
+    {
+        area = area.united(bounds_.adjusted(-SEARCH_MARGIN, -SEARCH_MARGIN, SEARCH_MARGIN, SEARCH_MARGIN));
+        path = search(startStub, startDirection, endStub, endDirection, area);
+    }
+
+    if (path.isEmpty())
+    {
+        return path;
+    }
+
+    path.prepend(request.start);
+    path.append(request.end);
+
+    return simplify(path);
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::routeAll()
+//-----------------------------------------------------------------------------
+QList<QList<QPointF> > OrthogonalRouter::routeAll(QList<Request> const& requests) const
+{
+    QList<QList<QPointF> > routes;
+    foreach (Request const& request, requests)
+    {
+        routes.append(route(request));
+    }
+
+    return routes;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::search()
+//-----------------------------------------------------------------------------
+QList<QPointF> OrthogonalRouter::search(QPointF const& from, Direction fromDirection, QPointF const& to,
+    Direction toDirection, QRectF const& area) const
+{
+    // The grid lines follow the obstacle edges with the clearance. Obstacles containing the endpoints
+    // are ignored so that the route can always leave them.
+    QVector<QRectF> obstacles;
+    QVector<qreal> xs;
+    QVector<qreal> ys;
+
+    xs << from.x() << to.x() << area.left() << area.right();
+    ys << from.y() << to.y() << area.top() << area.bottom();
+
+    foreach (QRectF const& obstacle, obstacles_)
+    {
+        if (obstacle.intersects(area) && !obstacle.contains(from) && !obstacle.contains(to))
+        {
+            obstacles.append(obstacle);
+
+            QRectF margin = obstacle.adjusted(-clearance_, -clearance_, clearance_, clearance_);
+            if (margin.left() > area.left())
+            {
+                xs << margin.left();
+            }
+            if (margin.right() < area.right())
+            {
+                xs << margin.right();
+            }
+            if (margin.top() > area.top())
+            {
+                ys << margin.top();
+            }
+            if (margin.bottom() < area.bottom())
+            {
+                ys << margin.bottom();
+            }
+        }
+    }
+
+    sortUnique(xs);
+    sortUnique(ys);
+
+    const qint64 rows = ys.size();
+    const int toX = indexOf(xs, to.x());
+    const int toY = indexOf(ys, to.y());
+
+    // A search state is a grid point and the direction the route arrived to it.
+    QHash<qint64, qreal> costs;
+    QHash<qint64, qint64> previous;
+    QMultiMap<qreal, qint64> open;
+
+    qint64 start = (indexOf(xs, from.x()) * rows + indexOf(ys, from.y())) * DIRECTION_COUNT + fromDirection;
+    costs.insert(start, 0.0);
+    open.insert(qAbs(to.x() - from.x()) + qAbs(to.y() - from.y()), start);
+
+    // The route should arrive to the end point opposite to the direction it leaves the end point.
+    const int arrivalDirection = (toDirection + 2) % DIRECTION_COUNT;
+
+    qreal bestCost = std::numeric_limits<qreal>::max();
+    qint64 best = -1;
+    int expanded = 0;
+
+    while (!open.isEmpty() && expanded < MAX_EXPANDED_STATES)
+    {
+        QMultiMap<qreal, qint64>::iterator first = open.begin();
+        qreal estimate = first.key();
+        qint64 state = first.value();
+        open.erase(first);
+
+        if (estimate >= bestCost)
+        {
+            break;
+        }
+
+        int direction = state % DIRECTION_COUNT;
+        int x = (state / DIRECTION_COUNT) / rows;
+        int y = (state / DIRECTION_COUNT) % rows;
+
+        qreal cost = costs.value(state);
+
+        // Skip the states already reached with a lower cost.
+        if (estimate > cost + qAbs(xs.at(toX) - xs.at(x)) + qAbs(ys.at(toY) - ys.at(y)) + 0.001)
+        {
+            continue;
+        }
+
+        ++expanded;
+
+        if (x == toX && y == toY)
+        {
+            int bends = 0;
+            if (direction == toDirection)
+            {
+                bends = 2;
+            }
+            else if (direction != arrivalDirection)
+            {
+                bends = 1;
+            }
+
+            if (cost + bends * BEND_COST < bestCost)
+            {
+                bestCost = cost + bends * BEND_COST;
+                best = state;
+            }
+
+            continue;
+        }
+
+        // Continue straight or turn left or right, but never back.
+        for (int turn = -1; turn <= 1; ++turn)
+        {
+            int nextDirection = (direction + turn + DIRECTION_COUNT) % DIRECTION_COUNT;
+            int nextX = x + STEP_X[nextDirection];
+            int nextY = y + STEP_Y[nextDirection];
+
+            if (nextX < 0 || nextX >= xs.size() || nextY < 0 || nextY >= ys.size())
+            {
+                continue;
+            }
+
+            QPointF current(xs.at(x), ys.at(y));
+            QPointF next(xs.at(nextX), ys.at(nextY));
+
+            if (isBlocked(current, next, obstacles))
+            {
+                continue;
+            }
+
+            qreal nextCost = cost + qAbs(next.x() - current.x()) + qAbs(next.y() - current.y());
+            if (turn != 0)
+            {
+                nextCost += BEND_COST;
+            }
+
+            qint64 nextState = (nextX * rows + nextY) * DIRECTION_COUNT + nextDirection;
+
+            QHash<qint64, qreal>::const_iterator known = costs.constFind(nextState);
+            if (known == costs.constEnd() || nextCost < known.value())
+            {
+                costs.insert(nextState, nextCost);
+                previous.insert(nextState, state);
+                open.insert(nextCost + qAbs(to.x() - next.x()) + qAbs(to.y() - next.y()), nextState);
+            }
+        }
+    }
+
+    QList<QPointF> path;
+    if (best == -1)
+    {
+        return path;
+    }
+
+    for (qint64 state = best; state != start; state = previous.value(state))
+    {
+        path.prepend(QPointF(xs.at((state / DIRECTION_COUNT) / rows), ys.at((state / DIRECTION_COUNT) % rows)));
+    }
+
+    path.prepend(from);
+
+    return path;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::isBlocked()
+//-----------------------------------------------------------------------------
+bool OrthogonalRouter::isBlocked(QPointF const& from, QPointF const& to, QVector<QRectF> const& obstacles) const
+{
+    qreal left = qMin(from.x(), to.x());
+    qreal right = qMax(from.x(), to.x());
+    qreal top = qMin(from.y(), to.y());
+    qreal bottom = qMax(from.y(), to.y());
+
+    // Segments running along the obstacle edges are allowed.
+    foreach (QRectF const& obstacle, obstacles)
+    {
+        if (from.y() == to.y())
+        {
+            if (top > obstacle.top() && top < obstacle.bottom() &&
+                left < obstacle.right() && right > obstacle.left())
+            {
+                return true;
+            }
+        }
+        else if (left > obstacle.left() && left < obstacle.right() &&
+            top < obstacle.bottom() && bottom > obstacle.top())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::toDirection()
+//-----------------------------------------------------------------------------
+OrthogonalRouter::Direction OrthogonalRouter::toDirection(QVector2D const& vector)
+{
+    if (qAbs(vector.x()) >= qAbs(vector.y()))
+    {
+        if (vector.x() < 0)
+        {
+            return LEFT;
+        }
+
+        return RIGHT;
+    }
+    else if (vector.y() < 0)
+    {
+        return UP;
+    }
+
+    return DOWN;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OrthogonalRouter::simplify()
+//-----------------------------------------------------------------------------
+QList<QPointF> OrthogonalRouter::simplify(QList<QPointF> const& route)
+{
+    QList<QPointF> simplified;
+    foreach (QPointF const& point, route)
+    {
+        if (!simplified.isEmpty() && simplified.last() == point)
+        {
+            continue;
+        }
+
+        // Drop the previous point, if it is on a straight line between its neighbors.
+        if (simplified.size() >= 2)
+        {
+            QPointF const& first = simplified.at(simplified.size() - 2);
+            QPointF const& middle = simplified.last();
+
+            if ((first.x() == middle.x() && middle.x() == point.x()) ||
+                (first.y() == middle.y() && middle.y() == point.y()))
+            {
+                simplified.removeLast();
+            }
+        }
+
+        simplified.append(point);
+    }
+
+    return simplified;
+}
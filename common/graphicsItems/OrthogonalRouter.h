@@ -0,0 +1,141 @@
+//-----------------------------------------------------------------------------
+// File: OrthogonalRouter.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Obstacle-aware orthogonal router for the connections in a diagram.
+//-----------------------------------------------------------------------------
+
+#ifndef ORTHOGONALROUTER_H
+#define ORTHOGONALROUTER_H
+
+#include <QList>
+#include <QPointF>
+#include <QRectF>
+#include <QVector>
+#include <QVector2D>
+
+//-----------------------------------------------------------------------------
+//! Obstacle-aware orthogonal router for the connections in a diagram.
+//
+// The routes are searched with A* on a sparse grid formed by the edges of the obstacles near the
+// endpoints. The cost of a route is its length with a penalty for each bend. The router does not
+// access any graphics items so it can be run outside the GUI thread.
+//-----------------------------------------------------------------------------
+class OrthogonalRouter
+{
+public:
+
+    //-----------------------------------------------------------------------------
+    //! Endpoints of a single route to find.
+    //-----------------------------------------------------------------------------
+    struct Request
+    {
+        QPointF start;              //!< The start point of the route.
+        QVector2D startDirection;   //!< The direction the route leaves the start point to.
+        QPointF end;                //!< The end point of the route.
+        QVector2D endDirection;     //!< The direction the route leaves the end point to.
+
+        Request() : start(), startDirection(), end(), endDirection()
+        {
+        }
+    };
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] obstacles   The areas the routes must not cross in scene coordinates.
+     *      @param [in] clearance   The preferred distance between the routes and the obstacles.
+     *      @param [in] stubLength  The length of the straight segment at both ends of a route.
+     */
+    OrthogonalRouter(QList<QRectF> const& obstacles, qreal clearance, qreal stubLength);
+
+    //! The destructor.
+    ~OrthogonalRouter();
+
+    /*!
+     *  Finds a route between two endpoints.
+     *
+     *      @param [in] request     The endpoints of the route.
+     *
+     *      @return The route points from the start to the end or an empty list, if no route was found.
+     */
+    QList<QPointF> route(Request const& request) const;
+
+    /*!
+     *  Finds the routes for the given requests.
+     *
+     *      @param [in] requests    The endpoints of the routes.
+     *
+     *      @return The routes in the same order as the requests. A route is empty, if it was not found.
+     */
+    QList<QList<QPointF> > routeAll(QList<Request> const& requests) const;
+
+private:
+
+    //! The directions of the route segments.
+    enum Direction
+    {
+        RIGHT = 0,
+        DOWN,
+        LEFT,
+        UP,
+        DIRECTION_COUNT
+    };
+
+    /*!
+     *  Searches a route between two points on the grid of the obstacles in the given area.
+     *
+     *      @param [in] from            The start point of the search.
+     *      @param [in] fromDirection   The direction of the route arriving to the start point.
+     *      @param [in] to              The end point of the search.
+     *      @param [in] toDirection     The direction the route should leave the end point to.
+     *      @param [in] area            The area to search the route in.
+     *
+     *      @return The points of the route or an empty list, if no route was found.
+     */
+    QList<QPointF> search(QPointF const& from, Direction fromDirection, QPointF const& to,
+        Direction toDirection, QRectF const& area) const;
+
+    /*!
+     *  Checks if a straight segment between two adjacent grid points crosses an obstacle.
+     *
+     *      @param [in] from        The start of the segment.
+     *      @param [in] to          The end of the segment.
+     *      @param [in] obstacles   The obstacles to check.
+     *
+     *      @return True, if the segment is inside an obstacle, otherwise false.
+     */
+    bool isBlocked(QPointF const& from, QPointF const& to, QVector<QRectF> const& obstacles) const;
+
+    /*!
+     *  Finds the closest segment direction for the given vector.
+     */
+    static Direction toDirection(QVector2D const& vector);
+
+    /*!
+     *  Removes the duplicate and collinear points from a route.
+     */
+    static QList<QPointF> simplify(QList<QPointF> const& route);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The areas the routes must not cross.
+    QList<QRectF> obstacles_;
+
+    //! The bounding rectangle of all the obstacles.
+    QRectF bounds_;
+
+    //! The preferred distance between the routes and the obstacles.
+    qreal clearance_;
+
+    //! The length of the straight segment at both ends of a route.
+    qreal stubLength_;
+};
+
+#endif // ORTHOGONALROUTER_H
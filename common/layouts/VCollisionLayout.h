@@ -56,9 +56,9 @@ public:
     void setItemPos(QList<T*> const& items, T* item, qreal x, qreal minY = 0.0);
 
     /*!
-     *  Updates the positions of all items using vertical stacking.
+     *  Updates the positions of all items so that they do not collide.
      *
-     *      @param [in] items    The list of items.
+     *      @param [in] items    The list of items ordered by their y coordinates.
      *      @param [in] x        The x coordinate for the items.
      *      @param [in] minY     The minimum y coordinate.
      */
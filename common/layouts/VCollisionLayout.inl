@@ -83,11 +83,13 @@ void VCollisionLayout<T>::updateItemMove(QList<T*>& items, T* item, qreal minY)
         QRectF itemRect1 = item1->mapRectToParent(item1->boundingRect());
         QRectF itemRect2 = item2->mapRectToParent(item2->boundingRect());
 
-        if (itemRect1.bottom() + spacing_ > itemRect2.top())
+        // The items below the first gap did not collide before the move, so they can be left as they are.
+        if (itemRect1.bottom() + spacing_ <= itemRect2.top())
         {
-            item2->setY(itemRect1.bottom() + spacing_ - (itemRect2.top() - item2->y()));
+            break;
         }
 
+        item2->setY(itemRect1.bottom() + spacing_ - (itemRect2.top() - item2->y()));
         ++index;
     }
 }
@@ -105,8 +107,17 @@ void VCollisionLayout<T>::setItemPos(QList<T*> const&, T* item, qreal x, qreal)
 // Function: VCollisionLayout<T>::updateItemPositions()
 //-----------------------------------------------------------------------------
 template <class T>
-void VCollisionLayout<T>::updateItemPositions(QList<T*>&, qreal, qreal)
+void VCollisionLayout<T>::updateItemPositions(QList<T*>& items, qreal x, qreal minY)
 {
-    // Nothing to do.
+    // Push each item below the previous one only if they collide.
+    qreal y = minY;
+
+    foreach (T* item, items)
+    {
+        QRectF itemRect = item->boundingRect();
+        item->setPos(x, qMax(y - itemRect.top(), item->y()));
+
+        y = item->y() + itemRect.bottom() + spacing_;
+    }
 }
 
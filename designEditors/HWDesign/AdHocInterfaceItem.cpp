@@ -140,6 +140,12 @@ AdHocInterfaceItem::AdHocInterfaceItem(QSharedPointer<Component> component,
 //-----------------------------------------------------------------------------
 AdHocInterfaceItem::~AdHocInterfaceItem()
 {
+    HWDesignDiagram* diagram = dynamic_cast<HWDesignDiagram*>(scene());
+    if (diagram != 0)
+    {
+        diagram->unregisterInterface(this);
+    }
+
     GraphicsColumn* column = dynamic_cast<GraphicsColumn*>(parentItem());
 
     if (column != 0)
@@ -286,6 +292,24 @@ QVariant AdHocInterfaceItem::itemChange(GraphicsItemChange change,
 
         break;
 
+    case ItemSceneChange:
+        {
+            // Keep the item registry of the diagram up to date.
+            HWDesignDiagram* oldDiagram = dynamic_cast<HWDesignDiagram*>(scene());
+            if (oldDiagram != 0)
+            {
+                oldDiagram->unregisterInterface(this);
+            }
+
+            HWDesignDiagram* newDiagram = dynamic_cast<HWDesignDiagram*>(value.value<QGraphicsScene*>());
+            if (newDiagram != 0)
+            {
+                newDiagram->registerInterface(this);
+            }
+
+            break;
+        }
+
     default:
         break;
     }
@@ -357,15 +381,7 @@ void AdHocInterfaceItem::mousePressEvent(QGraphicsSceneMouseEvent *event)
     }
 
     // Begin the position update for all connections.
-    foreach (QGraphicsItem *item, scene()->items())
-    {
-        GraphicsConnection* conn = dynamic_cast<GraphicsConnection*>(item);
-
-        if (conn != 0)
-        {
-            conn->beginUpdatePosition();
-        }
-    }
+    static_cast<HWDesignDiagram*>(scene())->beginUpdateConnectionPositions();
 }
 
 //-----------------------------------------------------------------------------
@@ -408,15 +424,7 @@ void AdHocInterfaceItem::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
         }
 
         // End the position update for all connections.
-        foreach (QGraphicsItem *item, scene()->items())
-        {
-            GraphicsConnection* conn = dynamic_cast<GraphicsConnection*>(item);
-
-            if (conn != 0)
-            {
-                conn->endUpdatePosition(cmd.data());
-            }
-        }
+        static_cast<HWDesignDiagram*>(scene())->endUpdateConnectionPositions(cmd.data());
 
         // Add the undo command to the edit stack only if it has changes.
         if (cmd->childCount() > 0 || oldPos_ != scenePos())
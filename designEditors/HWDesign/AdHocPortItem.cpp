@@ -18,6 +18,7 @@
 #include "HWDesignDiagram.h"
 #include "OffPageConnectorItem.h"
 
+#include <common/graphicsItems/DetailShadowEffect.h>
 #include <common/graphicsItems/GraphicsConnection.h>
 #include <common/GenericEditProvider.h>
 #include <designEditors/common/diagramgrid.h>
@@ -35,7 +36,6 @@
 #include <QStyleOptionGraphicsItem>
 #include <QColor>
 #include <QFont>
-#include <QGraphicsDropShadowEffect>
 #include <QDebug>
 #include <QVector2D>
 #include <QGraphicsScene>
@@ -107,7 +107,7 @@ AdHocPortItem::AdHocPortItem(Port* port, LibraryInterface* lh,
 	nameLabel_.setFont(font);
 	nameLabel_.setFlag(ItemStacksBehindParent);
 
-    QGraphicsDropShadowEffect *shadow = new QGraphicsDropShadowEffect;
+    DetailShadowEffect *shadow = new DetailShadowEffect;
     shadow->setXOffset(0);
     shadow->setYOffset(0);
     shadow->setBlurRadius(5);
@@ -293,6 +293,12 @@ QVariant AdHocPortItem::itemChange(GraphicsItemChange change,
 
 			checkDirection();
 			setLabelPosition();
+
+            HWDesignDiagram* diagram = dynamic_cast<HWDesignDiagram*>(scene());
+            if (diagram != 0)
+            {
+                diagram->markItemModified(this);
+            }
             
 			break;
         }
@@ -372,14 +378,10 @@ void AdHocPortItem::mousePressEvent(QGraphicsSceneMouseEvent *event)
     }
 
     // Begin the position update for all connections.
-    foreach (QGraphicsItem *item, scene()->items())
+    HWDesignDiagram* diagram = dynamic_cast<HWDesignDiagram*>(scene());
+    if (diagram != 0)
     {
-        GraphicsConnection* conn = dynamic_cast<GraphicsConnection*>(item);
-
-        if (conn != 0)
-        {
-            conn->beginUpdatePosition();
-        }
+        diagram->beginUpdateConnectionPositions();
     }
 }
 
@@ -433,15 +435,7 @@ void AdHocPortItem::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
     oldPortPositions_.clear();
     
     // End the position update for all connections.
-    foreach (QGraphicsItem *item, scene()->items())
-    {
-        GraphicsConnection* conn = dynamic_cast<GraphicsConnection*>(item);
-
-        if (conn != 0)
-        {
-            conn->endUpdatePosition(cmd.data());
-        }
-    }
+    static_cast<HWDesignDiagram*>(scene())->endUpdateConnectionPositions(cmd.data());
 
     // Add the undo command to the edit stack only if it has changes.
     if (cmd->childCount() > 0 || oldPos_ != pos())
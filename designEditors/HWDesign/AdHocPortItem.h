@@ -17,6 +17,7 @@
 
 #include "HWConnectionEndpoint.h"
 
+#include <common/graphicsItems/DetailTextItem.h>
 #include <common/graphicsItems/GraphicsItemTypes.h>
 
 class OffPageConnectorItem;
@@ -204,7 +205,7 @@ protected:
 private:
     
 	//! The name label.
-	QGraphicsTextItem nameLabel_;
+	DetailTextItem nameLabel_;
 
     Port* port_;
 
@@ -104,6 +104,12 @@ BusInterfaceItem::BusInterfaceItem(LibraryInterface* lh, QSharedPointer<Componen
 }
 
 BusInterfaceItem::~BusInterfaceItem() {
+    HWDesignDiagram* diagram = dynamic_cast<HWDesignDiagram*>(scene());
+    if (diagram != 0)
+    {
+        diagram->unregisterInterface(this);
+    }
+
     HWColumn* column = dynamic_cast<HWColumn*>(parentItem());
 
     if (column != 0)
@@ -467,6 +473,24 @@ QVariant BusInterfaceItem::itemChange(GraphicsItemChange change,
 
         break;
 
+    case ItemSceneChange:
+        {
+            // Keep the item registry of the diagram up to date.
+            HWDesignDiagram* oldDiagram = dynamic_cast<HWDesignDiagram*>(scene());
+            if (oldDiagram != 0)
+            {
+                oldDiagram->unregisterInterface(this);
+            }
+
+            HWDesignDiagram* newDiagram = dynamic_cast<HWDesignDiagram*>(value.value<QGraphicsScene*>());
+            if (newDiagram != 0)
+            {
+                newDiagram->registerInterface(this);
+            }
+
+            break;
+        }
+
     default:
         break;
     }
@@ -536,15 +560,7 @@ void BusInterfaceItem::mouseReleaseEvent(QGraphicsSceneMouseEvent* event)
         oldInterfacePositions_.clear();
 
         // End the position update for all connections.
-        foreach (QGraphicsItem *item, scene()->items())
-        {
-            GraphicsConnection* conn = dynamic_cast<GraphicsConnection*>(item);
-
-            if (conn != 0)
-            {
-                conn->endUpdatePosition(cmd.data());
-            }
-        }
+        static_cast<HWDesignDiagram*>(scene())->endUpdateConnectionPositions(cmd.data());
 
         // Add the undo command to the edit stack only if it has changes.
         if (cmd->childCount() > 0 || oldPos_ != scenePos())
@@ -585,15 +601,7 @@ void BusInterfaceItem::mousePressEvent(QGraphicsSceneMouseEvent *event)
     }
 
     // Begin the position update for all connections.
-    foreach (QGraphicsItem *item, scene()->items())
-    {
-        GraphicsConnection* conn = dynamic_cast<GraphicsConnection*>(item);
-
-        if (conn != 0)
-        {
-            conn->beginUpdatePosition();
-        }
-    }
+    static_cast<HWDesignDiagram*>(scene())->beginUpdateConnectionPositions();
 }
 
 //-----------------------------------------------------------------------------
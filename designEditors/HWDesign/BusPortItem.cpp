@@ -11,7 +11,9 @@
 #include "HWDesignDiagram.h"
 #include "OffPageConnectorItem.h"
 
+#include <common/graphicsItems/DetailShadowEffect.h>
 #include <common/graphicsItems/GraphicsConnection.h>
+#include <common/graphicsItems/LevelOfDetail.h>
 #include <common/GenericEditProvider.h>
 #include <designEditors/common/diagramgrid.h>
 #include <designEditors/common/NamelabelWidth.h>
@@ -28,7 +30,6 @@
 #include <QStyleOptionGraphicsItem>
 #include <QColor>
 #include <QFont>
-#include <QGraphicsDropShadowEffect>
 #include <QDebug>
 #include <QVector2D>
 #include <QGraphicsScene>
@@ -56,7 +57,7 @@ BusPortItem::BusPortItem(QSharedPointer<BusInterface> busIf, LibraryInterface* l
 	nameLabel_.setFont(font);
 	nameLabel_.setFlag(ItemStacksBehindParent);
 
-    QGraphicsDropShadowEffect *shadow = new QGraphicsDropShadowEffect;
+    DetailShadowEffect *shadow = new DetailShadowEffect;
     shadow->setXOffset(0);
     shadow->setYOffset(0);
     shadow->setBlurRadius(5);
@@ -443,6 +444,12 @@ QVariant BusPortItem::itemChange(GraphicsItemChange change,
 			checkDirection();
 			setLabelPosition();
 
+            HWDesignDiagram* diagram = dynamic_cast<HWDesignDiagram*>(scene());
+            if (diagram != 0)
+            {
+                diagram->markItemModified(this);
+            }
+
             break;
         }
     case ItemRotationHasChanged:
@@ -571,15 +578,27 @@ void BusPortItem::mousePressEvent(QGraphicsSceneMouseEvent *event)
     }
 
     // Begin the position update for all connections.
-    foreach (QGraphicsItem *item, scene()->items())
+    HWDesignDiagram* diagram = dynamic_cast<HWDesignDiagram*>(scene());
+    if (diagram != 0)
     {
-        GraphicsConnection* conn = dynamic_cast<GraphicsConnection*>(item);
+        diagram->beginUpdateConnectionPositions();
+    }
+}
 
-        if (conn != 0)
-        {
-            conn->beginUpdatePosition();
-        }
+//-----------------------------------------------------------------------------
+// Function: BusPortItem::paint()
+//-----------------------------------------------------------------------------
+void BusPortItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
+{
+    if (LevelOfDetail::getLevel(painter) == LevelOfDetail::LEVEL_OUTLINE)
+    {
+        painter->setPen(Qt::NoPen);
+        painter->setBrush(brush());
+        painter->drawPolygon(polygon());
+        return;
     }
+
+    HWConnectionEndpoint::paint(painter, option, widget);
 }
 
 //-----------------------------------------------------------------------------
@@ -632,15 +651,7 @@ void BusPortItem::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
     oldPortPositions_.clear();
     
     // End the position update for all connections.
-    foreach (QGraphicsItem *item, scene()->items())
-    {
-        GraphicsConnection* conn = dynamic_cast<GraphicsConnection*>(item);
-
-        if (conn != 0)
-        {
-            conn->endUpdatePosition(cmd.data());
-        }
-    }
+    static_cast<HWDesignDiagram*>(scene())->endUpdateConnectionPositions(cmd.data());
 
     // Add the undo command to the edit stack only if it has changes.
     if (cmd->childCount() > 0 || oldPos_ != pos())
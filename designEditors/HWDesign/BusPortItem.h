@@ -12,6 +12,7 @@
 
 #include "HWConnectionEndpoint.h"
 
+#include <common/graphicsItems/DetailTextItem.h>
 #include <common/graphicsItems/GraphicsItemTypes.h>
 
 class BusInterface;
@@ -208,6 +209,9 @@ protected:
     virtual QVariant itemChange(GraphicsItemChange change,
                                 const QVariant &value);
 
+    //! Draws the port as a plain shape when the diagram is zoomed far out.
+    virtual void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget);
+
     virtual void mousePressEvent(QGraphicsSceneMouseEvent *event);
     virtual void mouseMoveEvent(QGraphicsSceneMouseEvent *event);
     virtual void mouseReleaseEvent(QGraphicsSceneMouseEvent *event);
@@ -230,7 +234,7 @@ private:
     LibraryInterface* lh_;
 
     //! The name label.
-    QGraphicsTextItem nameLabel_;
+    DetailTextItem nameLabel_;
 
     //! The position of the port before mouse move.
     QPointF oldPos_;
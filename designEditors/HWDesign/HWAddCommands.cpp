@@ -15,6 +15,7 @@
 #include "BusPortItem.h"
 #include "HWComponentItem.h"
 #include "BusInterfaceItem.h"
+#include "HWDesignDiagram.h"
 
 #include <common/graphicsItems/GraphicsColumn.h>
 #include <designEditors/common/DesignDiagram.h>
@@ -155,6 +156,7 @@ void ConnectionAddCommand::undo()
 
     // Remove the interconnection from the scene.
     scene_->removeItem(conn_);
+    static_cast<HWDesignDiagram*>(scene_)->unregisterConnection(conn_);
     del_ = true;
 
    // Execute child commands.
@@ -173,11 +175,13 @@ void ConnectionAddCommand::redo()
     QUndoCommand::redo();
 
     // Add the back to the scene.
-    if (!scene_->items().contains(conn_))
+    if (conn_->scene() != scene_)
     {
         scene_->addItem(conn_);
     }
 
+    static_cast<HWDesignDiagram*>(scene_)->registerConnection(conn_);
+
     // Connect the ends and set the interface modes and port map for the hierarchical end point.
     if (conn_->connectEnds())
     {
@@ -63,6 +63,7 @@ HWComponentItem::HWComponentItem(LibraryInterface* lh_,
       vendorExtensions_()
 {
     setFlag(ItemIsMovable);
+    setFlag(ItemSendsScenePositionChanges);
     setAdHocData(component, portAdHocVisibilities);
     
 	QList<QSharedPointer<BusInterface> > busInterfaces = component->getBusInterfaces();
@@ -291,15 +292,7 @@ void HWComponentItem::mouseReleaseEvent(QGraphicsSceneMouseEvent* event)
         }
 
         // End the position update for all connections.
-        foreach (QGraphicsItem *item, scene()->items())
-        {
-            GraphicsConnection* conn = dynamic_cast<GraphicsConnection*>(item);
-
-            if (conn != 0)
-            {
-                conn->endUpdatePosition(cmd.data());
-            }
-        }
+        static_cast<HWDesignDiagram*>(scene())->endUpdateConnectionPositions(cmd.data());
 
         // Add the undo command to the edit stack only if it has at least some real changes.
         if (cmd->childCount() > 0 || scenePos() != oldPos_)
@@ -330,14 +323,31 @@ void HWComponentItem::mousePressEvent(QGraphicsSceneMouseEvent *event)
     oldColumn_ = dynamic_cast<HWColumn*>(parentItem());
 
     // Begin the position update for all connections.
-    foreach (QGraphicsItem *item, scene()->items())
+    static_cast<HWDesignDiagram*>(scene())->beginUpdateConnectionPositions();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWComponentItem::itemChange()
+//-----------------------------------------------------------------------------
+QVariant HWComponentItem::itemChange(GraphicsItemChange change, const QVariant& value)
+{
+    if (change == ItemScenePositionHasChanged)
     {
-        GraphicsConnection* conn = dynamic_cast<GraphicsConnection*>(item);
+        notifyModified();
+    }
 
-        if (conn != 0)
-        {
-            conn->beginUpdatePosition();
-        }
+    return ComponentItem::itemChange(change, value);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWComponentItem::notifyModified()
+//-----------------------------------------------------------------------------
+void HWComponentItem::notifyModified()
+{
+    HWDesignDiagram* diagram = dynamic_cast<HWDesignDiagram*>(scene());
+    if (diagram != 0)
+    {
+        diagram->markItemModified(this);
     }
 }
 
@@ -480,6 +490,7 @@ void HWComponentItem::addPort(HWConnectionEndpoint* port)
 
     // Update the component size.
     updateSize();
+    notifyModified();
 }
 
 //-----------------------------------------------------------------------------
@@ -556,6 +567,7 @@ void HWComponentItem::updateComponent()
     {
         delete hierIcon_;
     }
+    notifyModified();
 }
 
 //-----------------------------------------------------------------------------
@@ -573,6 +585,7 @@ void HWComponentItem::removePort(HWConnectionEndpoint* port)
     {
         componentModel()->removeBusInterface(port->getBusInterface().data());
     }
+    notifyModified();
 }
 
 //-----------------------------------------------------------------------------
@@ -639,6 +652,7 @@ void HWComponentItem::onAdHocVisibilityChanged(QString const& portName, bool vis
         found = 0;
     }
 
+    notifyModified();
     emit adHocVisibilitiesChanged();
 }
 
@@ -212,6 +212,9 @@ protected:
     //! Called when the user release the mouse.
     void mouseReleaseEvent(QGraphicsSceneMouseEvent* event);
 
+    //! Notifies the diagram when the position of the component in the scene changes.
+    virtual QVariant itemChange(GraphicsItemChange change, const QVariant& value);
+
 private:
 	
 	//! \brief No copying
@@ -229,6 +232,11 @@ private:
      */
     void onAddPort(HWConnectionEndpoint* port, bool right);
 
+    /*!
+     *  Notifies the diagram that the design data of this component instance has changed.
+     */
+    void notifyModified();
+
 	/*!
 	 *  Returns the height of the component.
 	 */
@@ -30,7 +30,7 @@ HWConnection::HWConnection(ConnectionEndpoint* endpoint1,
                                                QString const& description,
                                                DesignDiagram* parent)
     : GraphicsConnection(endpoint1, endpoint2, autoConnect, name, displayName, description, parent), 
-      widthLabel_(new QGraphicsTextItem(this)), vendorExtensions_()
+      widthLabel_(new DetailTextItem(this)), vendorExtensions_()
 {
     setWidthLabelDefaultFont();
 
@@ -49,7 +49,7 @@ HWConnection::HWConnection(QPointF const& p1, QVector2D const& dir1,
 											   QString const& description,
 											   DesignDiagram* parent)
     : GraphicsConnection(p1, dir1, p2, dir2, displayName, description, parent),
-      widthLabel_(new QGraphicsTextItem(this)), vendorExtensions_()
+      widthLabel_(new DetailTextItem(this)), vendorExtensions_()
 {
     setWidthLabelDefaultFont();
 }
@@ -59,6 +59,12 @@ HWConnection::HWConnection(QPointF const& p1, QVector2D const& dir1,
 //-----------------------------------------------------------------------------
 HWConnection::~HWConnection()
 {
+    // Connections deleted along with their endpoints are still in the diagram.
+    HWDesignDiagram* diagram = dynamic_cast<HWDesignDiagram*>(scene());
+    if (diagram != 0)
+    {
+        diagram->unregisterConnection(this);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -212,6 +218,7 @@ bool HWConnection::isBus() const
 void HWConnection::setVendorExtensions(QList<QSharedPointer<VendorExtension> > const& vendorExtensions)
 {
     vendorExtensions_ = vendorExtensions;
+    notifyModified();
 }
 
 //-----------------------------------------------------------------------------
@@ -244,6 +251,7 @@ int HWConnection::getAdHocRightBound(int endpointIndex) const
 void HWConnection::setAdHocLeftBound(int endpointIndex, int leftBound)
 {
     portBounds_[endpointIndex].left_ = leftBound;
+    notifyModified();
     emit contentChanged();
 }
 
@@ -253,6 +261,7 @@ void HWConnection::setAdHocLeftBound(int endpointIndex, int leftBound)
 void HWConnection::setAdHocRightBound(int endpointIndex, int rightBound)
 {
     portBounds_[endpointIndex].right_ = rightBound;
+    notifyModified();
     emit contentChanged();
 }
 
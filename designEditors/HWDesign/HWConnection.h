@@ -10,6 +10,7 @@
 #include <QGraphicsTextItem>
 #include <QUndoCommand>
 
+#include <common/graphicsItems/DetailTextItem.h>
 #include <common/graphicsItems/GraphicsConnection.h>
 #include <common/graphicsItems/GraphicsItemTypes.h>
 
@@ -187,7 +188,7 @@ private:
     //-----------------------------------------------------------------------------
 
     //! The connection width label.
-    QGraphicsTextItem* widthLabel_;
+    DetailTextItem* widthLabel_;
 
     //! The ad-hoc port bounds.
     AdHocPortBound portBounds_[2];
@@ -16,6 +16,7 @@
 #include "BusPortItem.h"
 #include "HWComponentItem.h"
 #include "BusInterfaceItem.h"
+#include "HWDesignDiagram.h"
 
 #include <common/GenericEditProvider.h>
 #include <common/graphicsItems/GraphicsColumn.h>
@@ -337,6 +338,7 @@ void ConnectionDeleteCommand::undo()
 
     // Add the item back to the scene.
     scene_->addItem(conn_);
+    static_cast<HWDesignDiagram*>(scene_)->registerConnection(conn_);
     
     // Connect the ends and set the interface modes.
     conn_->connectEnds();
@@ -378,6 +380,7 @@ void ConnectionDeleteCommand::redo()
 
     // Remove the item from the scene.
     scene_->removeItem(conn_);
+    static_cast<HWDesignDiagram*>(scene_)->unregisterConnection(conn_);
     del_ = true;
 
     // Execute child commands.
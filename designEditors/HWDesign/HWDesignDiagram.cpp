@@ -28,6 +28,7 @@
 #include <common/graphicsItems/CommonGraphicsUndoCommands.h>
 #include <common/graphicsItems/ConnectionUndoCommands.h>
 #include <common/dialogs/newObjectDialog/newobjectdialog.h>
+#include <common/PerformanceTrace/ScopedTrace.h>
 
 #include <designEditors/common/DiagramUtil.h>
 #include <designEditors/common/diagramgrid.h>
@@ -58,11 +59,21 @@
 #include <QApplication>
 #include <QMenu>
 #include <QClipboard>
+#include <qmath.h>
 
 Q_DECLARE_METATYPE(HWDesignDiagram::BusInterfaceCollectionCopyData)
 Q_DECLARE_METATYPE(HWDesignDiagram::ComponentCollectionCopyData)
 Q_DECLARE_METATYPE(HWDesignDiagram::ColumnCollectionCopyData)
 
+namespace
+{
+    //! The number of connections in a loaded design after which the connections are created on demand.
+    const int LAZY_CONNECTION_THRESHOLD = 500;
+
+    //! The size of the grid cells used to find the pending connections in the visible area.
+    const qreal PENDING_CELL_SIZE = 500.0;
+}
+
 //-----------------------------------------------------------------------------
 // Function: HWDesignDiagram()
 //-----------------------------------------------------------------------------
@@ -70,7 +81,24 @@ HWDesignDiagram::HWDesignDiagram(LibraryInterface *lh, GenericEditProvider& edit
     : ComponentDesignDiagram(lh, editProvider, parent),
       dragCompType_(CIT_NONE),
       dragBus_(false),
-      dragEndPoint_(0)
+      dragEndPoint_(0),
+      instances_(),
+      instanceOrder_(),
+      instancePositions_(),
+      interfaces_(),
+      adHocInterfaces_(),
+      connections_(),
+      connectionPositions_(),
+      nextItemPosition_(0),
+      instanceModels_(),
+      modifiedInstances_(),
+      connectionModels_(),
+      modifiedConnections_(),
+      pendingConnections_(),
+      pendingInstanceConnections_(),
+      pendingCells_(),
+      pendingArea_(),
+      nextPendingId_(0)
 {
 
 }
@@ -83,11 +111,39 @@ HWDesignDiagram::~HWDesignDiagram()
 
 }
 
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::clearScene()
+//-----------------------------------------------------------------------------
+void HWDesignDiagram::clearScene()
+{
+    // The items are destroyed with the scene so the registry must not be used during the clear.
+    instances_.clear();
+    instanceOrder_.clear();
+    instancePositions_.clear();
+    interfaces_.clear();
+    adHocInterfaces_.clear();
+    connections_.clear();
+    connectionPositions_.clear();
+
+    ComponentDesignDiagram::clearScene();
+
+    instanceModels_.clear();
+    modifiedInstances_.clear();
+    connectionModels_.clear();
+    modifiedConnections_.clear();
+    pendingConnections_.clear();
+    pendingInstanceConnections_.clear();
+    pendingCells_.clear();
+    pendingArea_ = QRectF();
+}
+
 //-----------------------------------------------------------------------------
 // Function: HWDesignDiagram::loadDesign()
 //-----------------------------------------------------------------------------
 void HWDesignDiagram::loadDesign(QSharedPointer<Design> design)
 {
+    SCOPED_TRACE_DETAIL(trace, "HWDesignDiagram::loadDesign", "editor", design->getVlnv()->toString());
+
     if (design->getColumns().isEmpty())
     {
         addColumn(ColumnDesc("IO", COLUMN_CONTENT_IO, 0, IO_COLUMN_WIDTH));
@@ -104,6 +160,9 @@ void HWDesignDiagram::loadDesign(QSharedPointer<Design> design)
         }
     }
 
+    // The columns are stacked once after all the items have been added.
+    getLayout()->beginBatchUpdate();
+
     // Create diagram interfaces for the top-level bus interfaces.
     foreach (QSharedPointer<BusInterface> busIf, getEditedComponent()->getBusInterfaces())
     {
@@ -119,10 +178,28 @@ void HWDesignDiagram::loadDesign(QSharedPointer<Design> design)
         createComponentItem(instance, design);
     }
 
+    // In large designs, the connections between instances are created when they are first needed.
+    bool deferConnections = design->getInterconnections().size() + design->getAdHocConnections().size() >
+        LAZY_CONNECTION_THRESHOLD;
+
+    QList<Interconnection> deferredInterconnections;
+    QList<AdHocConnection> deferredAdHocConnections;
+
     /* interconnections */
     foreach(Interconnection interconnection, design->getInterconnections())
     {
-        createInterconnection(interconnection, design);
+        QPair<Interface, Interface> connInterfaces = interconnection.getInterfaces();
+
+        if (deferConnections && canDeferConnection(
+            QStringList() << connInterfaces.first.getComponentRef() << connInterfaces.second.getComponentRef(),
+            QStringList() << connInterfaces.first.getBusRef() << connInterfaces.second.getBusRef(), false))
+        {
+            deferredInterconnections.append(interconnection);
+        }
+        else
+        {
+            createInterconnection(interconnection, design);
+        }
     }
 
 	// Create hierarchical connections.
@@ -140,13 +217,50 @@ void HWDesignDiagram::loadDesign(QSharedPointer<Design> design)
     // Create ad-hoc connections based on the design data.
     foreach (AdHocConnection const& adHocConn, design->getAdHocConnections())
     {
-        createAdHocConnection(adHocConn);
+        QStringList instanceNames;
+        QStringList portNames;
+        foreach (PortRef const& portRef, adHocConn.internalPortReferences())
+        {
+            instanceNames.append(portRef.getComponentRef());
+            portNames.append(portRef.getPortRef());
+        }
+
+        if (deferConnections && adHocConn.externalPortReferences().isEmpty() &&
+            canDeferConnection(instanceNames, portNames, true))
+        {
+            deferredAdHocConnections.append(adHocConn);
+        }
+        else
+        {
+            createAdHocConnection(adHocConn);
+        }
     }
 
     // Update the stacking of the columns.
-    foreach (GraphicsColumn* column, getLayout()->getColumns())
+    getLayout()->endBatchUpdate();
+
+    // The areas of the pending connections are known only after the instances have been positioned.
+    foreach (Interconnection const& interconnection, deferredInterconnections)
     {
-        column->updateItemPositions();
+        ConnectionModel model;
+        model.interconnections.append(interconnection);
+
+        addPendingConnection(QStringList() << interconnection.getInterfaces().first.getComponentRef() <<
+            interconnection.getInterfaces().second.getComponentRef(), interconnection.getRoute(), model);
+    }
+
+    foreach (AdHocConnection const& adHocConn, deferredAdHocConnections)
+    {
+        ConnectionModel model;
+        model.adHocConnections.append(adHocConn);
+
+        QStringList instanceNames;
+        foreach (PortRef const& portRef, adHocConn.internalPortReferences())
+        {
+            instanceNames.append(portRef.getComponentRef());
+        }
+
+        addPendingConnection(instanceNames, adHocConn.getRoute(), model);
     }
 }
 
@@ -155,23 +269,306 @@ void HWDesignDiagram::loadDesign(QSharedPointer<Design> design)
 //-----------------------------------------------------------------------------
 HWComponentItem *HWDesignDiagram::getComponent(const QString &instanceName)
 {
-	// search all graphicsitems in the scene
-	foreach (QGraphicsItem *item, items())
+    HWComponentItem* comp = instances_.value(instanceName, 0);
+
+	// if no component was found
+    if (comp == 0)
     {
-		// if the item is a component
-        if (item->type() == HWComponentItem::Type)
+        emit errorMessage(tr("Component %1 was not found within design").arg(instanceName));
+    }
+
+    return comp;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::updateInstanceName()
+//-----------------------------------------------------------------------------
+void HWDesignDiagram::updateInstanceName(QString const& oldName, QString const& newName)
+{
+    // The pending connections refer to the old name.
+    createPendingConnections(instances_.value(oldName, 0));
+
+    DesignDiagram::updateInstanceName(oldName, newName);
+
+    HWComponentItem* comp = instances_.take(oldName);
+    if (comp != 0)
+    {
+        instances_.insert(newName, comp);
+
+        // The connections refer to the instance by name.
+        foreach (ConnectionEndpoint* endpoint, comp->getEndpoints())
         {
-            HWComponentItem *comp = qgraphicsitem_cast<HWComponentItem *>(item);
+            markItemModified(endpoint);
+        }
+    }
+}
 
-			// if component's name matches
-            if (comp->name() == instanceName)
-                return comp;
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::markItemModified()
+//-----------------------------------------------------------------------------
+void HWDesignDiagram::markItemModified(QGraphicsItem* item)
+{
+    if (item->type() == HWComponentItem::Type)
+    {
+        HWComponentItem* comp = static_cast<HWComponentItem*>(item);
+        modifiedInstances_.insert(comp);
+
+        // The stored routes of the pending connections are no longer valid for a moved instance.
+        createPendingConnections(comp);
+    }
+    else if (item->type() == HWConnection::Type)
+    {
+        modifiedConnections_.insert(static_cast<HWConnection*>(item));
+    }
+    else
+    {
+        ConnectionEndpoint* endpoint = dynamic_cast<ConnectionEndpoint*>(item);
+        if (endpoint == 0)
+        {
+            return;
+        }
+
+        // The instance stores the port positions and the connections refer to the port by name.
+        HWComponentItem* comp = dynamic_cast<HWComponentItem*>(endpoint->encompassingComp());
+        if (comp != 0)
+        {
+            modifiedInstances_.insert(comp);
+
+            // The pending connections of the port must exist to be updated with it.
+            createPendingConnections(comp);
+        }
+
+        QList<GraphicsConnection*> connections = endpoint->getConnections();
+
+        ConnectionEndpoint* offPageConnector = endpoint->getOffPageConnector();
+        if (offPageConnector != 0 && offPageConnector != endpoint)
+        {
+            connections.append(offPageConnector->getConnections());
+        }
+
+        foreach (GraphicsConnection* conn, connections)
+        {
+            modifiedConnections_.insert(static_cast<HWConnection*>(conn));
         }
     }
+}
 
-	// if no component was found
-	emit errorMessage(tr("Component %1 was not found within design").arg(instanceName));
-    return 0;
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::onVisibleAreaChanged()
+//-----------------------------------------------------------------------------
+void HWDesignDiagram::onVisibleAreaChanged(QRectF const& visibleArea)
+{
+    QRectF area = visibleArea.intersected(pendingArea_);
+    if (pendingConnections_.isEmpty() || area.isEmpty())
+    {
+        return;
+    }
+
+    // Only the connections in the grid cells of the visible area are checked.
+    QSet<int> checkedIds;
+    QList<int> visibleIds;
+    foreach (QPair<int, int> const& cell, findPendingCells(area))
+    {
+        foreach (int id, pendingCells_.values(cell))
+        {
+            if (checkedIds.contains(id))
+            {
+                continue;
+            }
+
+            checkedIds.insert(id);
+            foreach (QRectF const& pendingArea, pendingConnections_.value(id).areas)
+            {
+                if (pendingArea.intersects(area))
+                {
+                    visibleIds.append(id);
+                    break;
+                }
+            }
+        }
+    }
+
+    // The connections are created in the order they were loaded.
+    qSort(visibleIds);
+    createPendingConnections(visibleIds);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::createPendingItems()
+//-----------------------------------------------------------------------------
+void HWDesignDiagram::createPendingItems()
+{
+    createPendingConnections(pendingConnections_.keys());
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::getDiagramInterface()
+//-----------------------------------------------------------------------------
+BusInterfaceItem* HWDesignDiagram::getDiagramInterface(QString const& interfaceName)
+{
+    HWConnectionEndpoint* endpoint = interfaces_.value(interfaceName, 0);
+
+    // The bus interface may have been renamed outside the diagram e.g. in the interface editor.
+    if (endpoint == 0 || endpoint->name() != interfaceName)
+    {
+        endpoint = 0;
+
+        foreach (HWConnectionEndpoint* registeredEndpoint, interfaces_)
+        {
+            if (registeredEndpoint->name() == interfaceName)
+            {
+                endpoint = registeredEndpoint;
+                interfaces_.insert(interfaceName, endpoint);
+                break;
+            }
+        }
+    }
+
+    return static_cast<BusInterfaceItem*>(endpoint);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::registerInterface()
+//-----------------------------------------------------------------------------
+void HWDesignDiagram::registerInterface(HWConnectionEndpoint* endpoint)
+{
+    if (endpoint->type() == AdHocInterfaceItem::Type)
+    {
+        adHocInterfaces_.insert(endpoint->name(), endpoint);
+    }
+    else
+    {
+        interfaces_.insert(endpoint->name(), endpoint);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::unregisterInterface()
+//-----------------------------------------------------------------------------
+void HWDesignDiagram::unregisterInterface(HWConnectionEndpoint* endpoint)
+{
+    QHash<QString, HWConnectionEndpoint*>* registry = &interfaces_;
+    if (endpoint->type() == AdHocInterfaceItem::Type)
+    {
+        registry = &adHocInterfaces_;
+    }
+
+    // The item may be registered with an outdated name, so all the keys for the item are removed.
+    QMutableHashIterator<QString, HWConnectionEndpoint*> i(*registry);
+    while (i.hasNext())
+    {
+        if (i.next().value() == endpoint)
+        {
+            i.remove();
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::registerConnection()
+//-----------------------------------------------------------------------------
+void HWDesignDiagram::registerConnection(HWConnection* connection)
+{
+    if (!connectionPositions_.contains(connection))
+    {
+        connectionPositions_.insert(connection, nextItemPosition_);
+        connections_.insert(nextItemPosition_, connection);
+        nextItemPosition_++;
+    }
+
+    connectionModels_.remove(connection);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::unregisterConnection()
+//-----------------------------------------------------------------------------
+void HWDesignDiagram::unregisterConnection(HWConnection* connection)
+{
+    if (connectionPositions_.contains(connection))
+    {
+        connections_.remove(connectionPositions_.take(connection));
+    }
+
+    connectionModels_.remove(connection);
+    modifiedConnections_.remove(connection);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::getConnections()
+//-----------------------------------------------------------------------------
+QList<HWConnection*> HWDesignDiagram::getConnections() const
+{
+    return connections_.values();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::beginUpdateConnectionPositions()
+//-----------------------------------------------------------------------------
+void HWDesignDiagram::beginUpdateConnectionPositions()
+{
+    foreach (HWConnection* connection, connections_)
+    {
+        connection->beginUpdatePosition();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::endUpdateConnectionPositions()
+//-----------------------------------------------------------------------------
+void HWDesignDiagram::endUpdateConnectionPositions(QUndoCommand* parentCommand)
+{
+    foreach (HWConnection* connection, connections_)
+    {
+        connection->endUpdatePosition(parentCommand);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::onComponentInstanceAdded()
+//-----------------------------------------------------------------------------
+void HWDesignDiagram::onComponentInstanceAdded(ComponentItem* item)
+{
+    DesignDiagram::onComponentInstanceAdded(item);
+
+    if (item->type() == HWComponentItem::Type)
+    {
+        HWComponentItem* comp = static_cast<HWComponentItem*>(item);
+        instances_.insert(comp->name(), comp);
+
+        if (!instancePositions_.contains(comp))
+        {
+            instancePositions_.insert(comp, nextItemPosition_);
+            instanceOrder_.insert(nextItemPosition_, comp);
+            nextItemPosition_++;
+        }
+
+        instanceModels_.remove(comp);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::onComponentInstanceRemoved()
+//-----------------------------------------------------------------------------
+void HWDesignDiagram::onComponentInstanceRemoved(ComponentItem* item)
+{
+    DesignDiagram::onComponentInstanceRemoved(item);
+
+    if (instances_.value(item->name(), 0) == item)
+    {
+        instances_.remove(item->name());
+    }
+
+    if (item->type() == HWComponentItem::Type)
+    {
+        HWComponentItem* comp = static_cast<HWComponentItem*>(item);
+        if (instancePositions_.contains(comp))
+        {
+            instanceOrder_.remove(instancePositions_.take(comp));
+        }
+
+        instanceModels_.remove(comp);
+        modifiedInstances_.remove(comp);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -181,14 +578,9 @@ void HWDesignDiagram::setVisibilityControlState(QString const& name, bool state)
 {
     if (name == "Bus Widths")
     {
-        foreach (QGraphicsItem* item, items())
+        foreach (HWConnection* conn, connections_)
         {
-            HWConnection* conn = dynamic_cast<HWConnection*>(item);
-
-            if (conn != 0)
-            {
-                conn->setBusWidthVisible(state);
-            }
+            conn->setBusWidthVisible(state);
         }
     }
 
@@ -203,150 +595,80 @@ QSharedPointer<Design> HWDesignDiagram::createDesign(const VLNV &vlnv) const
 	QSharedPointer<Design> design = DesignDiagram::createDesign(vlnv);
 
 	QList<ComponentInstance> instances;
-	QList<Interconnection> interconnections;
-	QList<HierConnection> hierConnections;
-    QList<AdHocConnection> adHocConnections;
+    ConnectionModel connections;
     QList<ColumnDesc> columns;
 
-    QList<QString> unpackagedNames;
     QMap<QString, QPointF> adHocPortPositions;
 
-	foreach (QGraphicsItem *item, items())
+    // Only the instances changed since the previous save are recreated. The instances and connections are
+    // saved in the order they were added so that the saved design does not change between saves.
+    foreach (HWComponentItem* comp, instanceOrder_)
     {
-		if (item->type() == HWComponentItem::Type)
+        QHash<HWComponentItem*, ComponentInstance>::iterator cached = instanceModels_.find(comp);
+        if (cached == instanceModels_.end() || modifiedInstances_.contains(comp))
         {
-            HWComponentItem *comp = qgraphicsitem_cast<HWComponentItem *>(item);
+            cached = instanceModels_.insert(comp, createComponentInstance(comp));
+        }
 
-            ComponentInstance instance(comp->name(), comp->displayName(),
-				                       comp->description(), *comp->componentModel()->getVlnv(),
-                                       comp->scenePos(), comp->getUuid());
+        ComponentInstance& instance = cached.value();
 
-			// save the configurable element values to the design
-            if (getDesignConfiguration().isNull())
-            {
-                 instance.setConfigurableElementValues(comp->getConfigurableElements());
-            }
-            else
-            {
-			   getDesignConfiguration()->setConfigurableElementValues(instance.getUuid(),
-                   comp->getConfigurableElements());
-            }
-            instance.setPortAdHocVisibilities(comp->getPortAdHocVisibilities());
-            instance.setVendorExtensions(comp->getVendorExtensions());
-
-            // Save the port positions.
-            QListIterator<QSharedPointer<BusInterface> > itrBusIf(comp->componentModel()->getBusInterfaces());
-            while (itrBusIf.hasNext())
-            {
-                QSharedPointer<BusInterface> busif = itrBusIf.next();
-                instance.updateBusInterfacePosition(busif->getName(), comp->getBusPort(busif->getName())->pos());
-            }
+        // The configurable elements and extensions are edited in place so they are always copied.
+        if (getDesignConfiguration().isNull())
+        {
+            instance.setConfigurableElementValues(comp->getConfigurableElements());
+        }
+        else
+        {
+            getDesignConfiguration()->setConfigurableElementValues(instance.getUuid(),
+                comp->getConfigurableElements());
+        }
+        instance.setPortAdHocVisibilities(comp->getPortAdHocVisibilities());
+        instance.setVendorExtensions(comp->getVendorExtensions());
 
-            QMapIterator<QString, bool> itrAdHoc(comp->getPortAdHocVisibilities());
-            while (itrAdHoc.hasNext())
-            {
-                itrAdHoc.next();
+        instances.append(instance);
+    }
 
-                if (itrAdHoc.value())
-                {
-                    instance.updateAdHocPortPosition(itrAdHoc.key(), comp->getAdHocPort(itrAdHoc.key())->pos());
-                }
-            }
+    modifiedInstances_.clear();
 
-			instances.append(instance);
-		}
-        else if (item->type() == HWConnection::Type)
+    foreach (HWConnection* conn, connections_)
+    {
+        // Connections to top-level interfaces depend on the interface definitions edited outside the
+        // diagram. They are few so they are always recreated.
+        if (!isCachedConnection(conn))
         {
-            HWConnection *conn = qgraphicsitem_cast<HWConnection *>(item);
+            createConnectionModel(conn, connections);
+            continue;
+        }
 
-            // Save data based on the connection type.
-            if (conn->isBus())
-            {
-			    if (conn->endpoint1()->encompassingComp() && conn->endpoint2()->encompassingComp())
-                {
-				    Interface iface1(conn->endpoint1()->encompassingComp()->name(),
-					    conn->endpoint1()->name());
-				    Interface iface2(conn->endpoint2()->encompassingComp()->name(),
-					    conn->endpoint2()->name());
-				    interconnections.append(Interconnection(conn->name(), iface1, iface2,
-                                                                    conn->route(),
-                                                                    conn->endpoint1()->type() == OffPageConnectorItem::Type,
-                                                                    QString(),
-																    conn->description()));
-			    }
-                else
-                {
-				    ConnectionEndpoint *compPort;
-				    ConnectionEndpoint *hierPort;
-
-                    if (conn->endpoint1()->encompassingComp()) {
-					    compPort = conn->endpoint1();
-					    hierPort = conn->endpoint2();
-				    } else {
-					    compPort = conn->endpoint2();
-					    hierPort = conn->endpoint1();
-				    }
-
-                    if (hierPort->getBusInterface() != 0)
-                    {
-                       HierConnection hierConnection = HierConnection(hierPort->name(),
-                            Interface(compPort->encompassingComp()->name(),
-                            compPort->name()),
-                            hierPort->scenePos(), hierPort->getDirection(),
-                            conn->route(),
-                            conn->endpoint1()->type() == OffPageConnectorItem::Type);
-                        hierConnection.setVendorExtensions(conn->getVendorExtensions());
-                        hierConnections.append(hierConnection);
-                    }
-			    }
-            }
-            else
-            {
-                // Otherwise the connection is ad-hoc.
-                QList<PortRef> internalPortRefs;
-                QList<PortRef> externalPortRefs;
+        QHash<HWConnection*, ConnectionModel>::iterator cached = connectionModels_.find(conn);
+        if (cached == connectionModels_.end() || modifiedConnections_.contains(conn))
+        {
+            cached = connectionModels_.insert(conn, ConnectionModel());
+            createConnectionModel(conn, cached.value());
+        }
 
-                if (conn->endpoint1()->isHierarchical())
-                {
-                    externalPortRefs.append(PortRef(conn->endpoint1()->name(), QString(),
-                                                            conn->getAdHocLeftBound(0),
-                                                            conn->getAdHocRightBound(0)));
-                }
-                else
-                {
-                    internalPortRefs.append(PortRef(conn->endpoint1()->name(),
-                                                            conn->endpoint1()->encompassingComp()->name(),
-                                                            conn->getAdHocLeftBound(0),
-                                                            conn->getAdHocRightBound(0)));
-                }
+        ConnectionModel const& model = cached.value();
+        connections.interconnections.append(model.interconnections);
+        connections.hierConnections.append(model.hierConnections);
+        connections.adHocConnections.append(model.adHocConnections);
+    }
 
-                if (conn->endpoint2()->isHierarchical())
-                {
-                    externalPortRefs.append(PortRef(conn->endpoint2()->name(), QString(),
-                                                            conn->getAdHocLeftBound(1),
-                                                            conn->getAdHocRightBound(1)));
-                }
-                else
-                {
-                    internalPortRefs.append(PortRef(conn->endpoint2()->name(),
-                                                            conn->endpoint2()->encompassingComp()->name(),
-                                                            conn->getAdHocLeftBound(1),
-                                                            conn->getAdHocRightBound(1)));
-                }
+    modifiedConnections_.clear();
 
-                adHocConnections.append(AdHocConnection(conn->name(), QString(),
-                                                                conn->description(), 0 /*TODO*/,
-                                                                internalPortRefs, externalPortRefs,
-                                                                conn->route(),
-                                                                conn->endpoint1()->type() == OffPageConnectorItem::Type));
-            }
-		}
-        else if (item->type() == AdHocInterfaceItem::Type)
+    // The pending connections are saved as they were loaded unless their instances have been removed.
+    foreach (PendingConnection const& pending, pendingConnections_)
+    {
+        if (hasPendingInstances(pending))
         {
-            AdHocInterfaceItem* adHocIf = static_cast<AdHocInterfaceItem*>(item);
-            adHocPortPositions[adHocIf->name()] = adHocIf->scenePos();
+            connections.interconnections.append(pending.model.interconnections);
+            connections.adHocConnections.append(pending.model.adHocConnections);
         }
-	}
+    }
+
+    foreach (HWConnectionEndpoint* adHocIf, adHocInterfaces_)
+    {
+        adHocPortPositions[adHocIf->name()] = adHocIf->scenePos();
+    }
 
     foreach(GraphicsColumn* column, getLayout()->getColumns())
     {
@@ -354,9 +676,9 @@ QSharedPointer<Design> HWDesignDiagram::createDesign(const VLNV &vlnv) const
     }
 
 	design->setComponentInstances(instances);
-	design->setInterconnections(interconnections);
-    design->setHierarchicalConnections(hierConnections);
-    design->setAdHocConnections(adHocConnections);
+	design->setInterconnections(connections.interconnections);
+    design->setHierarchicalConnections(connections.hierConnections);
+    design->setAdHocConnections(connections.adHocConnections);
     design->setColumns(columns);   
     design->setPortAdHocVisibilities(getPortAdHocVisibilities());
     design->setAdHocPortPositions(adHocPortPositions);
@@ -364,6 +686,320 @@ QSharedPointer<Design> HWDesignDiagram::createDesign(const VLNV &vlnv) const
 	return design;
 }
 
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::createComponentInstance()
+//-----------------------------------------------------------------------------
+ComponentInstance HWDesignDiagram::createComponentInstance(HWComponentItem* comp) const
+{
+    ComponentInstance instance(comp->name(), comp->displayName(),
+        comp->description(), *comp->componentModel()->getVlnv(),
+        comp->scenePos(), comp->getUuid());
+
+    // Save the port positions.
+    QListIterator<QSharedPointer<BusInterface> > itrBusIf(comp->componentModel()->getBusInterfaces());
+    while (itrBusIf.hasNext())
+    {
+        QSharedPointer<BusInterface> busif = itrBusIf.next();
+        instance.updateBusInterfacePosition(busif->getName(), comp->getBusPort(busif->getName())->pos());
+    }
+
+    QMapIterator<QString, bool> itrAdHoc(comp->getPortAdHocVisibilities());
+    while (itrAdHoc.hasNext())
+    {
+        itrAdHoc.next();
+
+        if (itrAdHoc.value())
+        {
+            instance.updateAdHocPortPosition(itrAdHoc.key(), comp->getAdHocPort(itrAdHoc.key())->pos());
+        }
+    }
+
+    return instance;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::createConnectionModel()
+//-----------------------------------------------------------------------------
+void HWDesignDiagram::createConnectionModel(HWConnection* conn, ConnectionModel& model) const
+{
+    // Save data based on the connection type.
+    if (conn->isBus())
+    {
+        if (conn->endpoint1()->encompassingComp() && conn->endpoint2()->encompassingComp())
+        {
+            Interface iface1(conn->endpoint1()->encompassingComp()->name(),
+                conn->endpoint1()->name());
+            Interface iface2(conn->endpoint2()->encompassingComp()->name(),
+                conn->endpoint2()->name());
+            model.interconnections.append(Interconnection(conn->name(), iface1, iface2,
+                conn->route(),
+                conn->endpoint1()->type() == OffPageConnectorItem::Type,
+                QString(),
+                conn->description()));
+        }
+        else
+        {
+            ConnectionEndpoint *compPort;
+            ConnectionEndpoint *hierPort;
+
+            if (conn->endpoint1()->encompassingComp()) {
+                compPort = conn->endpoint1();
+                hierPort = conn->endpoint2();
+            } else {
+                compPort = conn->endpoint2();
+                hierPort = conn->endpoint1();
+            }
+
+            if (hierPort->getBusInterface() != 0)
+            {
+                HierConnection hierConnection = HierConnection(hierPort->name(),
+                    Interface(compPort->encompassingComp()->name(),
+                    compPort->name()),
+                    hierPort->scenePos(), hierPort->getDirection(),
+                    conn->route(),
+                    conn->endpoint1()->type() == OffPageConnectorItem::Type);
+                hierConnection.setVendorExtensions(conn->getVendorExtensions());
+                model.hierConnections.append(hierConnection);
+            }
+        }
+    }
+    else
+    {
+        // Otherwise the connection is ad-hoc.
+        QList<PortRef> internalPortRefs;
+        QList<PortRef> externalPortRefs;
+
+        if (conn->endpoint1()->isHierarchical())
+        {
+            externalPortRefs.append(PortRef(conn->endpoint1()->name(), QString(),
+                conn->getAdHocLeftBound(0),
+                conn->getAdHocRightBound(0)));
+        }
+        else
+        {
+            internalPortRefs.append(PortRef(conn->endpoint1()->name(),
+                conn->endpoint1()->encompassingComp()->name(),
+                conn->getAdHocLeftBound(0),
+                conn->getAdHocRightBound(0)));
+        }
+
+        if (conn->endpoint2()->isHierarchical())
+        {
+            externalPortRefs.append(PortRef(conn->endpoint2()->name(), QString(),
+                conn->getAdHocLeftBound(1),
+                conn->getAdHocRightBound(1)));
+        }
+        else
+        {
+            internalPortRefs.append(PortRef(conn->endpoint2()->name(),
+                conn->endpoint2()->encompassingComp()->name(),
+                conn->getAdHocLeftBound(1),
+                conn->getAdHocRightBound(1)));
+        }
+
+        model.adHocConnections.append(AdHocConnection(conn->name(), QString(),
+            conn->description(), 0 /*TODO*/,
+            internalPortRefs, externalPortRefs,
+            conn->route(),
+            conn->endpoint1()->type() == OffPageConnectorItem::Type));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::isCachedConnection()
+//-----------------------------------------------------------------------------
+bool HWDesignDiagram::isCachedConnection(HWConnection* conn) const
+{
+    return !conn->endpoint1()->isHierarchical() && !conn->endpoint2()->isHierarchical() &&
+        conn->endpoint1()->encompassingComp() != 0 && conn->endpoint2()->encompassingComp() != 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::canDeferConnection()
+//-----------------------------------------------------------------------------
+bool HWDesignDiagram::canDeferConnection(QStringList const& instanceNames, QStringList const& portNames,
+    bool adHoc) const
+{
+    for (int i = 0; i < instanceNames.size(); ++i)
+    {
+        HWComponentItem* comp = instances_.value(instanceNames.at(i), 0);
+        if (comp == 0)
+        {
+            return false;
+        }
+
+        // Missing ports are created with the connections to show them to the user right away.
+        if ((adHoc && comp->getAdHocPort(portNames.at(i)) == 0) ||
+            (!adHoc && comp->getBusPort(portNames.at(i)) == 0))
+        {
+            return false;
+        }
+    }
+
+    return !instanceNames.isEmpty();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::addPendingConnection()
+//-----------------------------------------------------------------------------
+void HWDesignDiagram::addPendingConnection(QStringList const& instanceNames, QList<QPointF> const& route,
+    ConnectionModel const& model)
+{
+    PendingConnection pending;
+    pending.model = model;
+
+    foreach (QString const& instanceName, instanceNames)
+    {
+        HWComponentItem* comp = instances_.value(instanceName);
+        pending.instances.append(comp);
+        pending.areas.append(comp->sceneBoundingRect());
+    }
+
+    // The segments of the route are indexed separately so that a long connection covers only the cells
+    // it passes through. Without a stored route, the connection is routed somewhere between the instances.
+    if (route.size() < 2)
+    {
+        QRectF bounds;
+        foreach (QRectF const& instanceArea, pending.areas)
+        {
+            bounds = bounds.united(instanceArea);
+        }
+        pending.areas.append(bounds);
+    }
+
+    for (int i = 1; i < route.size(); ++i)
+    {
+        pending.areas.append(QRectF(route.at(i - 1), route.at(i)).normalized().adjusted(-1, -1, 1, 1));
+    }
+
+    foreach (QRectF const& area, pending.areas)
+    {
+        foreach (QPair<int, int> const& cell, findPendingCells(area))
+        {
+            if (!pending.cells.contains(cell))
+            {
+                pending.cells.append(cell);
+            }
+        }
+
+        pendingArea_ = pendingArea_.united(area);
+    }
+
+    int id = nextPendingId_++;
+    pendingConnections_.insert(id, pending);
+
+    foreach (HWComponentItem* comp, pending.instances)
+    {
+        pendingInstanceConnections_.insert(comp, id);
+    }
+
+    foreach (QPair<int, int> const& cell, pending.cells)
+    {
+        pendingCells_.insert(cell, id);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::createPendingConnections()
+//-----------------------------------------------------------------------------
+void HWDesignDiagram::createPendingConnections(QList<int> const& pendingIds)
+{
+    foreach (int id, pendingIds)
+    {
+        QMap<int, PendingConnection>::iterator i = pendingConnections_.find(id);
+        if (i == pendingConnections_.end())
+        {
+            continue;
+        }
+
+        // The connections of removed instances are kept pending in case the removal is undone.
+        PendingConnection pending = i.value();
+        bool instanceDestroyed = pending.instances.contains(QPointer<HWComponentItem>());
+        if (!instanceDestroyed && !hasPendingInstances(pending))
+        {
+            continue;
+        }
+
+        // Remove the connection before creating the items, since the creation may modify the instances.
+        pendingConnections_.erase(i);
+
+        foreach (HWComponentItem* comp, pending.instances)
+        {
+            pendingInstanceConnections_.remove(comp, id);
+        }
+
+        foreach (QPair<int, int> const& cell, pending.cells)
+        {
+            pendingCells_.remove(cell, id);
+        }
+
+        // The connections of the destroyed instances can no longer be created.
+        if (instanceDestroyed)
+        {
+            continue;
+        }
+
+        foreach (Interconnection const& interconnection, pending.model.interconnections)
+        {
+            createInterconnection(interconnection, QSharedPointer<Design>());
+        }
+
+        foreach (AdHocConnection const& adHocConn, pending.model.adHocConnections)
+        {
+            createAdHocConnection(adHocConn);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::createPendingConnections()
+//-----------------------------------------------------------------------------
+void HWDesignDiagram::createPendingConnections(HWComponentItem* comp)
+{
+    if (comp != 0 && pendingInstanceConnections_.contains(comp))
+    {
+        createPendingConnections(pendingInstanceConnections_.values(comp));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::hasPendingInstances()
+//-----------------------------------------------------------------------------
+bool HWDesignDiagram::hasPendingInstances(PendingConnection const& pending) const
+{
+    foreach (QPointer<HWComponentItem> const& comp, pending.instances)
+    {
+        if (comp.isNull() || instances_.value(comp->name(), 0) != comp)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HWDesignDiagram::findPendingCells()
+//-----------------------------------------------------------------------------
+QList<QPair<int, int> > HWDesignDiagram::findPendingCells(QRectF const& area) const
+{
+    int firstColumn = qFloor(area.left() / PENDING_CELL_SIZE);
+    int lastColumn = qFloor(area.right() / PENDING_CELL_SIZE);
+    int firstRow = qFloor(area.top() / PENDING_CELL_SIZE);
+    int lastRow = qFloor(area.bottom() / PENDING_CELL_SIZE);
+
+    QList<QPair<int, int> > cells;
+    for (int column = firstColumn; column <= lastColumn; ++column)
+    {
+        for (int row = firstRow; row <= lastRow; ++row)
+        {
+            cells.append(qMakePair(column, row));
+        }
+    }
+
+    return cells;
+}
+
 //-----------------------------------------------------------------------------
 // Function: HWDesignDiagram::updateHierComponent()
 //-----------------------------------------------------------------------------
@@ -430,16 +1066,7 @@ void HWDesignDiagram::onAdHocVisibilityChanged(QString const& portName, bool vis
 //-----------------------------------------------------------------------------
 HWConnectionEndpoint* HWDesignDiagram::getDiagramAdHocPort(QString const& portName)
 {
-    foreach (QGraphicsItem* item, items())
-    {
-        if (item->type() == AdHocInterfaceItem::Type &&
-            static_cast<AdHocInterfaceItem*>(item)->name() == portName)
-        {
-            return static_cast<HWConnectionEndpoint*>(item);
-        }
-    }
-
-    return 0;
+    return adHocInterfaces_.value(portName, 0);
 }
 
 //-----------------------------------------------------------------------------
@@ -1013,6 +1640,9 @@ void HWDesignDiagram::dropEvent(QGraphicsSceneDragDropEvent *event)
             
             if (msgBox.exec() == QMessageBox::Yes)
             {
+                // The replacement moves the connections of the old instance to the new one.
+                createPendingConnections(oldCompItem);
+
                 // Create the component item.
                 HWComponentItem *newCompItem = new HWComponentItem(getLibraryInterface(), comp, instanceName);
 
@@ -1310,6 +1940,20 @@ int HWDesignDiagram::connectionType() const
 //-----------------------------------------------------------------------------
 void HWDesignDiagram::onSelected(QGraphicsItem* newSelection)
 {
+    // The selected instances may be moved or deleted, so their connections must exist.
+    foreach (QGraphicsItem* item, selectedItems())
+    {
+        ConnectionEndpoint* endpoint = dynamic_cast<ConnectionEndpoint*>(item);
+        if (item->type() == HWComponentItem::Type)
+        {
+            createPendingConnections(static_cast<HWComponentItem*>(item));
+        }
+        else if (endpoint != 0)
+        {
+            createPendingConnections(dynamic_cast<HWComponentItem*>(endpoint->encompassingComp()));
+        }
+    }
+
     // Activate the correct views when something has been selected.
     if (newSelection != 0)
     {
@@ -1613,6 +2257,9 @@ void HWDesignDiagram::replace(ComponentItem* destComp, ComponentItem* sourceComp
 
     if (destHWComponent && sourceHWComponent)
     {
+        createPendingConnections(destHWComponent);
+        createPendingConnections(sourceHWComponent);
+
         // Perform the replacement.
         QSharedPointer<ReplaceComponentCommand> 
             cmd(new ReplaceComponentCommand(destHWComponent, sourceHWComponent, true, true));
@@ -1761,6 +2408,7 @@ void HWDesignDiagram::createInterconnection(Interconnection const& interconnecti
             this, SIGNAL(errorMessage(QString const&)));
 
         addItem(diagramInterconnection);
+        registerConnection(diagramInterconnection);
         diagramInterconnection->updatePosition();
     }
 }
@@ -1794,6 +2442,11 @@ BusPortItem* HWDesignDiagram::createMissingPort(QString const& portName, HWCompo
     BusPortItem* port = new BusPortItem(busIf, getLibraryInterface(), false, component);
     component->addPort(port);
 
+    if (design.isNull())
+    {
+        return port;
+    }
+
     foreach (ComponentInstance const& instance, design->getComponentInstances())
     {
         if (instance.getInstanceName() == component->name())
@@ -1831,14 +2484,10 @@ void HWDesignDiagram::createHierarchicalConnection(HierConnection const& hierCon
     else
     {			
         // Find the corresponding diagram interface.
-        foreach (QGraphicsItem* item, items())
+        BusInterfaceItem* diagramInterface = getDiagramInterface(busIf->getName());
+        if (diagramInterface != 0 && diagramInterface->getBusInterface() == busIf)
         {
-            if (item->type() == BusInterfaceItem::Type &&
-                static_cast<BusInterfaceItem*>(item)->getBusInterface() == busIf)
-            {
-                hierarchicalInterface = static_cast<BusInterfaceItem*>(item);
-                break;
-            }
+            hierarchicalInterface = diagramInterface;
         }
     }
 
@@ -1897,6 +2546,7 @@ void HWDesignDiagram::createHierarchicalConnection(HierConnection const& hierCon
         SIGNAL(errorMessage(QString const&)));
 
     addItem(hierarchicalConnection);
+    registerConnection(hierarchicalConnection);
     hierarchicalConnection->updatePosition();
 }
 
@@ -2049,6 +2699,7 @@ void HWDesignDiagram::creatConnectionForAdHocPorts(AdHocConnection const& adHocC
     connect(connection, SIGNAL(errorMessage(QString const&)), this, SIGNAL(errorMessage(QString const&)));
 
     addItem(connection);
+    registerConnection(connection);
     connection->updatePosition();
 }
 
@@ -2169,13 +2820,9 @@ void HWDesignDiagram::pasteInterfaces(BusInterfaceCollectionCopyData const& coll
     {
         QList<QString> existingNames;
 
-        foreach (QGraphicsItem* item, items())
+        foreach (HWConnectionEndpoint* interface, interfaces_)
         {
-            if (item->type() == BusInterfaceItem::Type)
-            {
-                BusInterfaceItem* interface = static_cast<BusInterfaceItem*>(item);
-                existingNames.append(interface->name());
-            }
+            existingNames.append(interface->name());
         }
 
         // Bus interface must have a unique name within the component.
@@ -2289,6 +2936,8 @@ void HWDesignDiagram::pasteInterfaces(BusInterfaceCollectionCopyData const& coll
 void HWDesignDiagram::pasteInstances(ComponentCollectionCopyData const& collection,
                                      GraphicsColumn* column, QUndoCommand* cmd, bool useCursorPos)
 {
+    getLayout()->beginBatchUpdate();
+
     foreach (ComponentInstanceCopyData const& instance, collection.instances)
     {
         // Create unique name for the component instance.
@@ -2358,4 +3007,6 @@ void HWDesignDiagram::pasteInstances(ComponentCollectionCopyData const& collecti
             childCmd->redo();
         }
     }
+
+    getLayout()->endBatchUpdate();
 }
@@ -10,22 +10,28 @@
 
 #include <designEditors/common/ComponentDesignDiagram.h>
 
+#include <IPXACTmodels/AdHocConnection.h>
 #include <IPXACTmodels/businterface.h>
 #include <IPXACTmodels/ColumnDesc.h>
+#include <IPXACTmodels/ComponentInstance.h>
+#include <IPXACTmodels/HierConnection.h>
+#include <IPXACTmodels/Interconnection.h>
 
+#include <QHash>
 #include <QMap>
+#include <QPair>
+#include <QPointer>
+#include <QSet>
 #include <QVector>
 #include <QSharedPointer>
 #include <QUndoCommand>
 
 class AbstractionDefinition;
-class AdHocConnection;
 class AdHocInterfaceItem;
 class AdHocPortItem;
 class BusPortItem;
 class BusInterfaceItem;
 class Component;
-class ComponentInstance;
 class ComponentItem;
 class ConnectionEndpoint;
 class Design;
@@ -34,11 +40,9 @@ class GenericEditProvider;
 class GraphicsColumn;
 class GraphicsColumnLayout;
 class GraphicsConnection;
-class HierConnection;
 class HWComponentItem;
 class HWConnection;
 class HWConnectionEndpoint;
-class Interconnection;
 class LibraryInterface;
 class PortRef;
 class VLNV;
@@ -192,6 +196,10 @@ public:
 	//! \brief The destructor
 	virtual ~HWDesignDiagram();
 
+    /*!
+     *  Clears the scene and the item registry.
+     */
+    virtual void clearScene();
 
     /*! 
      *  Creates a design based on the contents in the diagram.
@@ -213,6 +221,89 @@ public:
      */
     HWComponentItem* getComponent(const QString &instanceName);
 
+    /*!
+     *  Updates the registered name of a component instance.
+     *
+     *      @param [in] oldName     The old name of the component instance.
+     *      @param [in] newName     The new name of the component instance.
+     */
+    virtual void updateInstanceName(QString const& oldName, QString const& newName);
+
+    /*!
+     *  Marks the design data of the given item outdated so that it is recreated on the next save.
+     *
+     *      @param [in] item   The changed component instance, port or connection.
+     */
+    virtual void markItemModified(QGraphicsItem* item);
+
+    /*!
+     *  Creates the pending connections in the given visible area.
+     *
+     *      @param [in] visibleArea   The visible area in scene coordinates.
+     */
+    virtual void onVisibleAreaChanged(QRectF const& visibleArea);
+
+    /*!
+     *  Creates all the pending connections.
+     */
+    virtual void createPendingItems();
+
+    /*!
+     *  Returns the top-level bus interface item with the given name or null if not found.
+     *
+     *      @param [in] interfaceName   The name of the bus interface.
+     */
+    BusInterfaceItem* getDiagramInterface(QString const& interfaceName);
+
+    /*!
+     *  Adds a top-level bus interface or ad-hoc interface item to the item registry.
+     *
+     *      @param [in] endpoint    The top-level interface item.
+     *
+     *      @remarks Called by the interface items when they are added to the diagram.
+     */
+    void registerInterface(HWConnectionEndpoint* endpoint);
+
+    /*!
+     *  Removes a top-level bus interface or ad-hoc interface item from the item registry.
+     *
+     *      @param [in] endpoint    The top-level interface item.
+     *
+     *      @remarks Called by the interface items when they are removed from the diagram.
+     */
+    void unregisterInterface(HWConnectionEndpoint* endpoint);
+
+    /*!
+     *  Adds a connection to the item registry.
+     *
+     *      @param [in] connection  The connection added to the diagram.
+     */
+    void registerConnection(HWConnection* connection);
+
+    /*!
+     *  Removes a connection from the item registry.
+     *
+     *      @param [in] connection  The connection removed from the diagram.
+     */
+    void unregisterConnection(HWConnection* connection);
+
+    /*!
+     *  Returns all the connections in the diagram.
+     */
+    QList<HWConnection*> getConnections() const;
+
+    /*!
+     *  Begins the position update for all the connections in the diagram.
+     */
+    void beginUpdateConnectionPositions();
+
+    /*!
+     *  Ends the position update for all the connections in the diagram.
+     *
+     *      @param [in] parentCommand   The parent command for the connection move commands.
+     */
+    void endUpdateConnectionPositions(QUndoCommand* parentCommand);
+
     /*!
      *  Changes the state of a visibility control.
      *
@@ -263,6 +354,12 @@ public slots:
      */
 	virtual void onAddToLibraryAction();
 
+    //! Called when a component instance is added to the diagram.
+    virtual void onComponentInstanceAdded(ComponentItem* item);
+
+    //! Called when a component instance is removed from the diagram.
+    virtual void onComponentInstanceRemoved(ComponentItem* item);
+
 protected:
 
     /*!
@@ -575,6 +672,108 @@ private:
     void pasteInstances(ComponentCollectionCopyData const& collection,
                         GraphicsColumn* column, QUndoCommand* cmd, bool useCursorPos);
 
+    //-----------------------------------------------------------------------------
+    //! The design data created from a single connection.
+    //-----------------------------------------------------------------------------
+    struct ConnectionModel
+    {
+        QList<Interconnection> interconnections;    //!< Bus connections between instances.
+        QList<HierConnection> hierConnections;      //!< Bus connections to top-level interfaces.
+        QList<AdHocConnection> adHocConnections;    //!< Ad-hoc connections.
+    };
+
+    /*!
+     *  Creates the design data for a component instance.
+     *
+     *      @param [in] comp   The component instance item.
+     *
+     *      @return The component instance data without configurable elements.
+     */
+    ComponentInstance createComponentInstance(HWComponentItem* comp) const;
+
+    /*!
+     *  Creates the design data for a connection.
+     *
+     *      @param [in]  conn   The connection item.
+     *      @param [out] model  The model to add the created connection data to.
+     */
+    void createConnectionModel(HWConnection* conn, ConnectionModel& model) const;
+
+    /*!
+     *  Checks if the design data of a connection can be cached between saves.
+     *
+     *      @param [in] conn   The connection item.
+     *
+     *      @return True, if both endpoints are ports of component instances, otherwise false.
+     */
+    bool isCachedConnection(HWConnection* conn) const;
+
+    /*!
+     *  Checks if the creation of the graphics item for a loaded connection can be deferred.
+     *
+     *      @param [in] instanceNames   The names of the connected component instances.
+     *      @param [in] portNames       The names of the connected ports in the same order as the instances.
+     *      @param [in] adHoc           If true, the ports are ad-hoc ports, otherwise bus interfaces.
+     *
+     *      @return True, if all the instances and ports have items in the diagram, otherwise false.
+     */
+    bool canDeferConnection(QStringList const& instanceNames, QStringList const& portNames, bool adHoc) const;
+
+    /*!
+     *  Adds a loaded connection whose graphics item is created later.
+     *
+     *      @param [in] instanceNames   The names of the connected component instances.
+     *      @param [in] route           The stored route of the connection.
+     *      @param [in] model           The design data of the connection.
+     */
+    void addPendingConnection(QStringList const& instanceNames, QList<QPointF> const& route,
+        ConnectionModel const& model);
+
+    /*!
+     *  Creates the graphics items for the given pending connections.
+     *
+     *      @param [in] pendingIds   The identifiers of the pending connections to create.
+     */
+    void createPendingConnections(QList<int> const& pendingIds);
+
+    /*!
+     *  Creates the graphics items for the pending connections of a component instance.
+     *
+     *      @param [in] comp   The component instance.
+     */
+    void createPendingConnections(HWComponentItem* comp);
+
+    /*!
+     *  Finds the cells of the pending connection index that overlap the given area.
+     *
+     *      @param [in] area   The area in scene coordinates.
+     *
+     *      @return The overlapping cells as column and row pairs.
+     */
+    QList<QPair<int, int> > findPendingCells(QRectF const& area) const;
+
+    //-----------------------------------------------------------------------------
+    //! A loaded connection whose graphics item has not been created yet.
+    //-----------------------------------------------------------------------------
+    struct PendingConnection
+    {
+        QList<QRectF> areas;                            //!< The areas of the route segments and the instances.
+        QList<QPair<int, int> > cells;                  //!< The cells of the index covered by the areas.
+        QList<QPointer<HWComponentItem> > instances;    //!< The connected instances.
+        ConnectionModel model;                          //!< The design data of the connection.
+    };
+
+    /*!
+     *  Checks if all the instances of a pending connection are in the diagram. The connections of a removed
+     *  instance are kept pending in case the removal is undone, but an instance added with the same name
+     *  does not get them.
+     *
+     *      @param [in] pending   The pending connection to check.
+     *
+     *      @return True, if the connected instances are in the diagram, otherwise false.
+     */
+    bool hasPendingInstances(PendingConnection const& pending) const;
+
 
     //-----------------------------------------------------------------------------
     // Data.
@@ -588,6 +787,57 @@ private:
 
     //! The possible end point under cursor while performing drag.
     HWConnectionEndpoint* dragEndPoint_;
+
+    //! The component instances in the diagram by instance name.
+    QHash<QString, HWComponentItem*> instances_;
+
+    //! The component instances in the diagram in the order they were added.
+    QMap<int, HWComponentItem*> instanceOrder_;
+
+    //! The position of each component instance in the instance order.
+    QHash<HWComponentItem*, int> instancePositions_;
+
+    //! The top-level bus interface items in the diagram by interface name.
+    QHash<QString, HWConnectionEndpoint*> interfaces_;
+
+    //! The top-level ad-hoc interface items in the diagram by port name.
+    QHash<QString, HWConnectionEndpoint*> adHocInterfaces_;
+
+    //! The connections in the diagram in the order they were added.
+    QMap<int, HWConnection*> connections_;
+
+    //! The position of each connection in the connection order.
+    QHash<HWConnection*, int> connectionPositions_;
+
+    //! The position for the next added component instance or connection.
+    int nextItemPosition_;
+
+    //! The design data of the component instances created on the previous saves.
+    mutable QHash<HWComponentItem*, ComponentInstance> instanceModels_;
+
+    //! The component instances changed after their design data was created.
+    mutable QSet<HWComponentItem*> modifiedInstances_;
+
+    //! The design data of the connections between component instances created on the previous saves.
+    mutable QHash<HWConnection*, ConnectionModel> connectionModels_;
+
+    //! The connections changed after their design data was created.
+    mutable QSet<HWConnection*> modifiedConnections_;
+
+    //! The loaded connections without graphics items by identifier.
+    QMap<int, PendingConnection> pendingConnections_;
+
+    //! The identifiers of the pending connections by the connected instances.
+    QMultiHash<HWComponentItem*, int> pendingInstanceConnections_;
+
+    //! The identifiers of the pending connections by the grid cells their areas cover.
+    QMultiHash<QPair<int, int>, int> pendingCells_;
+
+    //! The area covered by all the pending connections.
+    QRectF pendingArea_;
+
+    //! The identifier for the next pending connection.
+    int nextPendingId_;
 };
 
 #endif // HWDESIGNDIAGRAM_H
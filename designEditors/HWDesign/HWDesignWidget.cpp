@@ -17,6 +17,7 @@
 
 #include <common/dialogs/newObjectDialog/newobjectdialog.h>
 #include <common/GenericEditProvider.h>
+#include <common/graphicsItems/GraphicsColumnLayout.h>
 
 #include <library/LibraryManager/libraryinterface.h>
 
@@ -186,6 +187,8 @@ bool HWDesignWidget::setDesign(QSharedPointer<Component> comp, const QString& vi
         }
     }
 
+    prefetchComponents(design);
+
     if (!getDiagram()->setDesign(comp, design, designConf))
     {
         return false;
@@ -327,6 +330,9 @@ void HWDesignWidget::keyPressEvent(QKeyEvent *event)
 
             QSharedPointer<QUndoCommand> cmd(new QUndoCommand());
 
+            // The columns are restacked once after all the instances have been removed.
+            getDiagram()->getLayout()->beginBatchUpdate();
+
             foreach (QGraphicsItem* selected, selectedItems)
             {
 			    HWComponentItem* component = static_cast<HWComponentItem*>(selected);
@@ -349,6 +355,8 @@ void HWDesignWidget::keyPressEvent(QKeyEvent *event)
                 }
             }
 
+            getDiagram()->getLayout()->endBatchUpdate();
+
             getGenericEditProvider()->addCommand(cmd);
         }
         else if (type == BusInterfaceItem::Type)
@@ -394,6 +402,8 @@ void HWDesignWidget::keyPressEvent(QKeyEvent *event)
             getDiagram()->clearSelection();
             QSharedPointer<QUndoCommand> cmd(new QUndoCommand());
 
+            getDiagram()->getLayout()->beginBatchUpdate();
+
             foreach (QGraphicsItem* selected, selectedItems)
             {
                 BusInterfaceItem* diagIf = static_cast<BusInterfaceItem*>(selected);
@@ -404,6 +414,8 @@ void HWDesignWidget::keyPressEvent(QKeyEvent *event)
                 childCmd->redo();
             }
 
+            getDiagram()->getLayout()->endBatchUpdate();
+
             getGenericEditProvider()->addCommand(cmd);
         }
         else if (type == BusPortItem::Type)
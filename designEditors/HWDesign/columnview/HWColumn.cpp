@@ -15,6 +15,7 @@
 #include "../BusInterfaceItem.h"
 #include "../HWComponentItem.h"
 #include "../HWConnection.h"
+#include "../HWDesignDiagram.h"
 #include "../AdHocInterfaceItem.h"
 #include "../BusPortItem.h"
 
@@ -85,15 +86,7 @@ bool HWColumn::isItemAllowed(QGraphicsItem* item, unsigned int allowedItems) con
 void HWColumn::prepareColumnMove()
 {
     // Begin position update for all connections.
-    foreach (QGraphicsItem *item, scene()->items())
-    {
-        GraphicsConnection* conn = dynamic_cast<GraphicsConnection*>(item);
-
-        if (conn != 0)
-        {
-            conn->beginUpdatePosition();
-        }
-    }
+    static_cast<HWDesignDiagram*>(scene())->beginUpdateConnectionPositions();
 }
 
 //-----------------------------------------------------------------------------
@@ -104,15 +97,7 @@ QSharedPointer<QUndoCommand> HWColumn::createMoveUndoCommand()
     QSharedPointer<QUndoCommand> cmd = GraphicsColumn::createMoveUndoCommand();
 
     // End the position update for all connections.
-    foreach (QGraphicsItem *item, scene()->items())
-    {
-        GraphicsConnection* conn = dynamic_cast<GraphicsConnection*>(item);
-
-        if (conn != 0)
-        {
-            conn->endUpdatePosition(cmd.data());
-        }
-    }
+    static_cast<HWDesignDiagram*>(scene())->endUpdateConnectionPositions(cmd.data());
 
     return cmd;
 }
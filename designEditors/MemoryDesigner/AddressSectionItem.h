@@ -112,6 +112,13 @@ public:
      */
     quint64 getEndAddress() const;
 
+    /*!
+     *  Sets the height of the section item.
+     *  
+     *      @param [in] height  The height to set.
+     */
+    virtual void setHeight(int height);
+
     int type() const { return Type; }
 
     enum
@@ -147,13 +154,6 @@ protected:
     //! Draws the memory item.
     virtual void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
 
-    /*!
-     *  Sets the height of the section item.
-     *  
-     *      @param [in] height  The height to set.
-     */
-    virtual void setHeight(int height);
-
 private:
     // Disable copying.
     AddressSectionItem(AddressSectionItem const& rhs);
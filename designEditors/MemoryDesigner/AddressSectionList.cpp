@@ -0,0 +1,145 @@
+//-----------------------------------------------------------------------------
+// File: AddressSectionList.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Lightweight description of the address sections of a memory map.
+//-----------------------------------------------------------------------------
+
+#include "AddressSectionList.h"
+
+#include <designEditors/common/diagramgrid.h>
+#include <designEditors/common/DiagramUtil.h>
+
+#include <QtAlgorithms>
+
+//-----------------------------------------------------------------------------
+// Function: AddressSectionList::AddressSectionList()
+//-----------------------------------------------------------------------------
+AddressSectionList::AddressSectionList(int spacing) : sections_(), offsets_(), spacing_(spacing)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressSectionList::~AddressSectionList()
+//-----------------------------------------------------------------------------
+AddressSectionList::~AddressSectionList()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressSectionList::append()
+//-----------------------------------------------------------------------------
+void AddressSectionList::append(Section const& section)
+{
+    sections_.append(section);
+    offsets_.append(0.0);
+    updateOffsets(sections_.size() - 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressSectionList::size()
+//-----------------------------------------------------------------------------
+int AddressSectionList::size() const
+{
+    return sections_.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressSectionList::at()
+//-----------------------------------------------------------------------------
+AddressSectionList::Section const& AddressSectionList::at(int index) const
+{
+    return sections_.at(index);
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressSectionList::setHeight()
+//-----------------------------------------------------------------------------
+void AddressSectionList::setHeight(int index, int height)
+{
+    if (sections_.at(index).height != height)
+    {
+        sections_[index].height = height;
+        updateOffsets(index + 1);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressSectionList::getOffset()
+//-----------------------------------------------------------------------------
+qreal AddressSectionList::getOffset(int index) const
+{
+    return offsets_.at(index);
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressSectionList::getTotalHeight()
+//-----------------------------------------------------------------------------
+qreal AddressSectionList::getTotalHeight() const
+{
+    if (sections_.isEmpty())
+    {
+        return 0.0;
+    }
+
+    return offsets_.last() + sections_.last().height;
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressSectionList::indexAt()
+//-----------------------------------------------------------------------------
+int AddressSectionList::indexAt(qreal y) const
+{
+    int index = qUpperBound(offsets_.constBegin(), offsets_.constEnd(), y) - offsets_.constBegin() - 1;
+    return qBound(0, index, sections_.size() - 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressSectionList::indexOfAddress()
+//-----------------------------------------------------------------------------
+int AddressSectionList::indexOfAddress(quint64 address) const
+{
+    // Find the last section starting at or before the address.
+    int first = 0;
+    int last = sections_.size() - 1;
+    int candidate = -1;
+
+    while (first <= last)
+    {
+        int middle = first + (last - first) / 2;
+        if (sections_.at(middle).startAddress <= address)
+        {
+            candidate = middle;
+            first = middle + 1;
+        }
+        else
+        {
+            last = middle - 1;
+        }
+    }
+
+    if (candidate == -1 || address - sections_.at(candidate).startAddress >= sections_.at(candidate).range)
+    {
+        return -1;
+    }
+
+    return candidate;
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressSectionList::updateOffsets()
+//-----------------------------------------------------------------------------
+void AddressSectionList::updateOffsets(int firstIndex)
+{
+    for (int i = qMax(firstIndex, 1); i < sections_.size(); ++i)
+    {
+        offsets_[i] = offsets_.at(i - 1) + DiagramUtil::clampCeil(sections_.at(i - 1).height, GridSize) +
+            spacing_;
+    }
+}
@@ -0,0 +1,137 @@
+//-----------------------------------------------------------------------------
+// File: AddressSectionList.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Lightweight description of the address sections of a memory map.
+//-----------------------------------------------------------------------------
+
+#ifndef ADDRESSSECTIONLIST_H
+#define ADDRESSSECTIONLIST_H
+
+#include "AddressSectionItem.h"
+
+#include <QColor>
+#include <QString>
+#include <QVector>
+
+//-----------------------------------------------------------------------------
+//! Lightweight description of the address sections of a memory map.
+//
+// The list stores the data needed to create the section items and the vertical offset of each
+// section in a stack, so that the items can be created only for the visible part of a large memory map.
+// The sections must be appended in ascending address order.
+//-----------------------------------------------------------------------------
+class AddressSectionList
+{
+public:
+
+    //-----------------------------------------------------------------------------
+    //! Data of a single address section.
+    //-----------------------------------------------------------------------------
+    struct Section
+    {
+        QString name;                               //!< The name of the section.
+        quint64 startAddress;                       //!< The start address of the section.
+        quint64 range;                              //!< The address range of the section.
+        QColor color;                               //!< The color of the section.
+        AddressSectionItem::UsageType usageType;    //!< The usage type of the section.
+        int height;                                 //!< The height of the section item.
+
+        Section() : name(), startAddress(0), range(0), color(),
+            usageType(AddressSectionItem::USAGE_UNSPECIFIED), height(AddressSectionItem::MIN_SECTION_HEIGHT)
+        {
+        }
+    };
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] spacing     The vertical spacing between the sections.
+     */
+    explicit AddressSectionList(int spacing);
+
+    //! The destructor.
+    ~AddressSectionList();
+
+    /*!
+     *  Adds a section to the end of the list.
+     *
+     *      @param [in] section     The section to add.
+     */
+    void append(Section const& section);
+
+    /*!
+     *  Returns the number of sections.
+     */
+    int size() const;
+
+    /*!
+     *  Returns the section in the given index.
+     */
+    Section const& at(int index) const;
+
+    /*!
+     *  Sets the height of the section in the given index and moves the sections after it.
+     *
+     *      @param [in] index   The index of the section.
+     *      @param [in] height  The new height of the section.
+     */
+    void setHeight(int index, int height);
+
+    /*!
+     *  Returns the vertical offset of the section in the given index from the top of the stack.
+     */
+    qreal getOffset(int index) const;
+
+    /*!
+     *  Returns the total height of the stacked sections.
+     */
+    qreal getTotalHeight() const;
+
+    /*!
+     *  Finds the section at the given vertical offset.
+     *
+     *      @param [in] y   The offset from the top of the stack.
+     *
+     *      @return The index of the section. Offsets outside the stack give the first or the last section.
+     */
+    int indexAt(qreal y) const;
+
+    /*!
+     *  Finds the section containing the given address.
+     *
+     *      @param [in] address     The address to search for.
+     *
+     *      @return The index of the section or -1, if no section contains the address.
+     */
+    int indexOfAddress(quint64 address) const;
+
+private:
+    // Disable copying.
+    AddressSectionList(AddressSectionList const& rhs);
+    AddressSectionList& operator=(AddressSectionList const& rhs);
+
+    /*!
+     *  Calculates the offsets of the sections starting from the given index.
+     */
+    void updateOffsets(int firstIndex);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The sections in ascending address order.
+    QVector<Section> sections_;
+
+    //! The offset of each section from the top of the stack.
+    QVector<qreal> offsets_;
+
+    //! The vertical spacing between the sections.
+    int spacing_;
+};
+
+#endif // ADDRESSSECTIONLIST_H
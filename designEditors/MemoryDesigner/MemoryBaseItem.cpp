@@ -77,6 +77,31 @@ QList<AddressSectionItem*> const& MemoryBaseItem::getSections() const
     return list;
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryBaseItem::mapAddressToScene()
+//-----------------------------------------------------------------------------
+bool MemoryBaseItem::mapAddressToScene(quint64 address, QPointF& scenePos) const
+{
+    foreach (AddressSectionItem* section, getSections())
+    {
+        if (address >= section->getStartAddress() && address <= section->getEndAddress())
+        {
+            scenePos = section->sceneBoundingRect().center();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryBaseItem::updateVisibleArea()
+//-----------------------------------------------------------------------------
+void MemoryBaseItem::updateVisibleArea(QRectF const& /*visibleArea*/)
+{
+
+}
+
 //-----------------------------------------------------------------------------
 // Function: MemoryBaseItem::convertAddress()
 //-----------------------------------------------------------------------------
@@ -78,6 +78,23 @@ public:
      */
     virtual QList<AddressSectionItem*> const& getSections() const;
 
+    /*!
+     *  Finds the scene position of the section containing the given address.
+     *
+     *      @param [in]  address    The address to search for.
+     *      @param [out] scenePos   The center of the containing section in scene coordinates.
+     *
+     *      @return True, if a section contains the address, otherwise false.
+     */
+    virtual bool mapAddressToScene(quint64 address, QPointF& scenePos) const;
+
+    /*!
+     *  Called when the visible area of the diagram has changed.
+     *
+     *      @param [in] visibleArea     The visible area in scene coordinates.
+     */
+    virtual void updateVisibleArea(QRectF const& visibleArea);
+
 signals:
     //! Sends an error message to the user.
     void errorMessage(const QString& errorMessage) const;
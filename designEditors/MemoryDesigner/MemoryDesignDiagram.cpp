@@ -13,6 +13,7 @@
 
 #include "MemoryDesignWidget.h"
 #include "MemoryItem.h"
+#include "MemoryBaseItem.h"
 #include "AddressSpaceItem.h"
 #include "AddressSectionItem.h"
 #include "MemoryColumn.h"
@@ -496,6 +497,53 @@ bool MemoryDesignDiagram::isConnected(AddressSpaceItem const* addrSpaceItem, Mem
     return false;
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryDesignDiagram::onVisibleAreaChanged()
+//-----------------------------------------------------------------------------
+void MemoryDesignDiagram::onVisibleAreaChanged(QRectF const& visibleArea)
+{
+    foreach (GraphicsColumn* column, getLayout()->getColumns())
+    {
+        foreach (QGraphicsItem* item, column->getItems())
+        {
+            MemoryBaseItem* memoryItem = dynamic_cast<MemoryBaseItem*>(item);
+
+            if (memoryItem != 0)
+            {
+                memoryItem->updateVisibleArea(visibleArea);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryDesignDiagram::jumpToAddress()
+//-----------------------------------------------------------------------------
+void MemoryDesignDiagram::jumpToAddress(quint64 address)
+{
+    QList<QGraphicsItem*> candidates = selectedItems();
+
+    foreach (GraphicsColumn* column, getLayout()->getColumns())
+    {
+        candidates.append(column->getItems());
+    }
+
+    foreach (QGraphicsItem* item, candidates)
+    {
+        MemoryBaseItem* memoryItem = dynamic_cast<MemoryBaseItem*>(item);
+        QPointF scenePos;
+
+        if (memoryItem != 0 && memoryItem->mapAddressToScene(address, scenePos))
+        {
+            parent_->centerViewTo(scenePos);
+            return;
+        }
+    }
+
+    emit errorMessage(tr("Address 0x%1 was not found in the memory maps or the address spaces.").arg(
+        QString::number(address, 16).toUpper()));
+}
+
 //-----------------------------------------------------------------------------
 // Function: MemoryDesignDiagram::findRoute()
 //-----------------------------------------------------------------------------
@@ -110,6 +110,21 @@ public:
     bool isConnected(AddressSpaceItem const* addrSpaceItem, MemoryItem const* memoryItem,
                      quint64* baseAddress) const;
 
+    /*!
+     *  Creates the address sections near the visible area for the memory items.
+     *
+     *      @param [in] visibleArea     The visible area in scene coordinates.
+     */
+    virtual void onVisibleAreaChanged(QRectF const& visibleArea);
+
+    /*!
+     *  Centers the view to the section containing the given address. The selected item is searched
+     *  first and then the memory maps and the address spaces.
+     *
+     *      @param [in] address     The address to jump to.
+     */
+    void jumpToAddress(quint64 address);
+
 public slots:
     /*!
      *  Called when the selection changes in the diagram.
@@ -14,6 +14,7 @@
 #include "MemoryDesignDiagram.h"
 
 #include <common/GenericEditProvider.h>
+#include <common/utils.h>
 
 #include <designEditors/HWDesign/columnview/ColumnEditDialog.h>
 #include <designEditors/common/Association/Association.h>
@@ -31,6 +32,7 @@
 #include <QVBoxLayout>
 #include <QMessageBox>
 #include <QFileInfo>
+#include <QInputDialog>
 
 //-----------------------------------------------------------------------------
 // Function: MemoryDesignWidget()
@@ -146,6 +148,8 @@ bool MemoryDesignWidget::setDesign(QSharedPointer<Component> comp, const QString
         }
     }
 
+    prefetchComponents(design);
+
     if (!getDiagram()->setDesign(comp, design, designConf))
     {
         return false;
@@ -174,6 +178,21 @@ unsigned int MemoryDesignWidget::getSupportedDrawModes() const
 //-----------------------------------------------------------------------------
 void MemoryDesignWidget::keyPressEvent(QKeyEvent* event)
 {
+    // Jumping to an address does not modify the design so it is allowed also in protected mode.
+    if (event->key() == Qt::Key_G && event->modifiers() == Qt::ControlModifier)
+    {
+        bool accepted = false;
+        QString address = QInputDialog::getText(this, tr("Go to Address"), tr("Address:"),
+            QLineEdit::Normal, QString("0x"), &accepted);
+
+        if (accepted && !address.isEmpty())
+        {
+            static_cast<MemoryDesignDiagram*>(getDiagram())->jumpToAddress(Utils::str2Uint(address));
+        }
+
+        return;
+    }
+
     // If the document is protected, skip all delete events.
     if (isProtected())
     {
@@ -58,6 +58,9 @@ MemoryItem::MemoryItem(LibraryInterface* libInterface, QString const& instanceNa
       aubLabel_(),
       sectionLayout_(new VStackedLayout<AddressSectionItem>(SPACING)),
       sections_(),
+      sectionList_(SPACING),
+      virtualized_(false),
+      visibleSections_(),
       oldColumn_(0),
       oldPos_()
 {
@@ -117,18 +120,19 @@ MemoryItem::MemoryItem(LibraryInterface* libInterface, QString const& instanceNa
             // Check if there is a hole in the memory before the next address block.
             if (startAddress > curAddress)
             {
-                AddressSectionItem* section = new AddressBlockItem(component_, memoryMap_,
-                                                                   tr("no memory"), curAddress, 
-                                                                   startAddress - curAddress, this);
-                section->setColor(KactusColors::ADDRESS_SEGMENT_UNSEGMENTED);
-                section->setPos(0.0, getHeight());
-                addItem(section);
+                AddressSectionList::Section hole;
+                hole.name = tr("no memory");
+                hole.startAddress = curAddress;
+                hole.range = startAddress - curAddress;
+                hole.color = KactusColors::ADDRESS_SEGMENT_UNSEGMENTED;
+                sectionList_.append(hole);
             }
 
-            AddressSectionItem* section = new AddressBlockItem(component_, memoryMap_,
-                                                               block->getName(), startAddress, range, this);
-            section->setColor(KactusColors::MEMORY_BLOCK);
-            section->setPos(0.0, getHeight());
+            AddressSectionList::Section section;
+            section.name = block->getName();
+            section.startAddress = startAddress;
+            section.range = range;
+            section.color = KactusColors::MEMORY_BLOCK;
 
             if (block->getUsage() == General::MEMORY)
             {
@@ -136,40 +140,53 @@ MemoryItem::MemoryItem(LibraryInterface* libInterface, QString const& instanceNa
                 {
                 case General::READ_ONLY:
                     {
-                        section->setUsageType(AddressSectionItem::USAGE_READ_ONLY);
+                        section.usageType = AddressSectionItem::USAGE_READ_ONLY;
                         break;
                     }
 
                 case General::READ_WRITE:
                     {
-                        section->setUsageType(AddressSectionItem::USAGE_READ_WRITE);
+                        section.usageType = AddressSectionItem::USAGE_READ_WRITE;
                         break;
                     }
 
                 case General::READ_WRITEONCE:
                     {
-                        section->setUsageType(AddressSectionItem::USAGE_READ_WRITE_ONCE);
+                        section.usageType = AddressSectionItem::USAGE_READ_WRITE_ONCE;
                         break;
                     }
 
                 default:
                     {
-                        section->setUsageType(AddressSectionItem::USAGE_UNSPECIFIED);
+                        section.usageType = AddressSectionItem::USAGE_UNSPECIFIED;
                         break;
                     }
                 }
             }
             else if (block->getUsage() == General::REGISTER)
             {
-                section->setUsageType(AddressSectionItem::USAGE_REGISTERS);
+                section.usageType = AddressSectionItem::USAGE_REGISTERS;
             }
 
-            addItem(section);
+            sectionList_.append(section);
 
             curAddress = startAddress + range;
         }
     }
 
+    // Large memory maps create their section items only when they are scrolled into view.
+    virtualized_ = sectionList_.size() > VIRTUALIZATION_THRESHOLD;
+
+    if (!virtualized_)
+    {
+        for (int i = 0; i < sectionList_.size(); ++i)
+        {
+            AddressSectionItem* section = createSection(i);
+            section->setPos(0.0, getHeight());
+            addItem(section);
+        }
+    }
+
     updateNameLabel(component->getVlnv()->getName() + "<br>" + memoryMap->getName());
     updateVisuals();
     updateSize();
@@ -309,6 +326,13 @@ void MemoryItem::addItem(QGraphicsItem* item, bool /*load*/)
 void MemoryItem::removeItem(QGraphicsItem* item)
 {
     sections_.removeAll(static_cast<AddressSectionItem*>(item));
+
+    int index = visibleSections_.key(static_cast<AddressSectionItem*>(item), -1);
+    if (index != -1)
+    {
+        visibleSections_.remove(index);
+    }
+
     item->setParentItem(0);
     updateItemPositions();
 }
@@ -365,6 +389,26 @@ void MemoryItem::onReleaseItem(QGraphicsItem* item)
 //-----------------------------------------------------------------------------
 void MemoryItem::updateItemPositions()
 {
+    if (virtualized_)
+    {
+        // Store the heights of the existing items so that resized sections keep their height
+        // when they are recreated.
+        for (QMap<int, AddressSectionItem*>::const_iterator i = visibleSections_.constBegin();
+            i != visibleSections_.constEnd(); ++i)
+        {
+            sectionList_.setHeight(i.key(), i.value()->rect().height());
+        }
+
+        for (QMap<int, AddressSectionItem*>::const_iterator i = visibleSections_.constBegin();
+            i != visibleSections_.constEnd(); ++i)
+        {
+            i.value()->setPos(SECTION_X, sectionList_.getOffset(i.key()));
+        }
+
+        updateSize();
+        return;
+    }
+
     // Just update the item positions.
     sectionLayout_->updateItemPositions(sections_, SECTION_X, 0.0);
     updateSize();
@@ -399,6 +443,11 @@ bool MemoryItem::isItemAllowed(QGraphicsItem* item) const
 //-----------------------------------------------------------------------------
 qreal MemoryItem::getHeight() const
 {
+    if (virtualized_)
+    {
+        return sectionList_.getTotalHeight();
+    }
+
     if (sections_.empty())
     {
         return MIN_HEIGHT;
@@ -522,6 +571,100 @@ QList<AddressSectionItem*> const& MemoryItem::getSections() const
     return sections_;
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::mapAddressToScene()
+//-----------------------------------------------------------------------------
+bool MemoryItem::mapAddressToScene(quint64 address, QPointF& scenePos) const
+{
+    if (!virtualized_)
+    {
+        return MemoryBaseItem::mapAddressToScene(address, scenePos);
+    }
+
+    int index = sectionList_.indexOfAddress(address);
+    if (index == -1)
+    {
+        return false;
+    }
+
+    scenePos = mapToScene(QPointF(SECTION_X, sectionList_.getOffset(index) + sectionList_.at(index).height / 2));
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::updateVisibleArea()
+//-----------------------------------------------------------------------------
+void MemoryItem::updateVisibleArea(QRectF const& visibleArea)
+{
+    if (!virtualized_)
+    {
+        return;
+    }
+
+    QRectF localArea = mapRectFromScene(visibleArea);
+    qreal top = localArea.top() - VISIBLE_MARGIN;
+    qreal bottom = localArea.bottom() + VISIBLE_MARGIN;
+
+    int first = 0;
+    int last = -1;
+    if (bottom >= 0.0 && top <= getHeight())
+    {
+        first = sectionList_.indexAt(top);
+        last = sectionList_.indexAt(bottom);
+    }
+
+    // Delete the items outside the area, but keep the selected ones so that the selection is not lost.
+    QMutableMapIterator<int, AddressSectionItem*> i(visibleSections_);
+    while (i.hasNext())
+    {
+        i.next();
+        if ((i.key() < first || i.key() > last) && !i.value()->isSelected())
+        {
+            sectionList_.setHeight(i.key(), i.value()->rect().height());
+            delete i.value();
+            i.remove();
+        }
+    }
+
+    bool created = false;
+    for (int index = first; index <= last; ++index)
+    {
+        if (!visibleSections_.contains(index))
+        {
+            AddressSectionItem* section = createSection(index);
+            if (sectionList_.at(index).height != AddressSectionItem::MIN_SECTION_HEIGHT)
+            {
+                section->setHeight(sectionList_.at(index).height);
+            }
+
+            visibleSections_.insert(index, section);
+            created = true;
+        }
+    }
+
+    sections_ = visibleSections_.values();
+
+    if (created)
+    {
+        updateItemPositions();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::createSection()
+//-----------------------------------------------------------------------------
+AddressSectionItem* MemoryItem::createSection(int index)
+{
+    AddressSectionList::Section const& data = sectionList_.at(index);
+
+    AddressSectionItem* section = new AddressBlockItem(component_, memoryMap_, data.name, data.startAddress,
+        data.range, this);
+    section->setColor(data.color);
+    section->setUsageType(data.usageType);
+
+    return section;
+}
+
 //-----------------------------------------------------------------------------
 // Function: MemoryItem::convertAddress()
 //-----------------------------------------------------------------------------
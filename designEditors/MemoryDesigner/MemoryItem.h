@@ -13,6 +13,7 @@
 #define MEMORYITEM_H
 
 #include "MemoryBaseItem.h"
+#include "AddressSectionList.h"
 
 #include <designEditors/common/diagramgrid.h>
 #include <common/graphicsItems/GraphicsItemTypes.h>
@@ -20,6 +21,7 @@
 #include <common/layouts/IVGraphicsLayout.h>
 
 #include <QGraphicsRectItem>
+#include <QMap>
 #include <QSharedPointer>
 
 class AddressBlock;
@@ -106,6 +108,23 @@ public:
      */
     virtual QList<AddressSectionItem*> const& getSections() const;
 
+    /*!
+     *  Finds the scene position of the section containing the given address.
+     *
+     *      @param [in]  address    The address to search for.
+     *      @param [out] scenePos   The center of the containing section in scene coordinates.
+     *
+     *      @return True, if a section contains the address, otherwise false.
+     */
+    virtual bool mapAddressToScene(quint64 address, QPointF& scenePos) const;
+
+    /*!
+     *  Creates the section items near the visible area and deletes the rest, if the memory map is large.
+     *
+     *      @param [in] visibleArea     The visible area in scene coordinates.
+     */
+    virtual void updateVisibleArea(QRectF const& visibleArea);
+
     int type() const { return Type; }
 
     //-----------------------------------------------------------------------------
@@ -204,13 +223,24 @@ private:
     MemoryItem(MemoryItem const& rhs);
     MemoryItem& operator=(MemoryItem const& rhs);
 
+    /*!
+     *  Creates the section item for the section in the given index.
+     *
+     *      @param [in] index   The index of the section in the section list.
+     *
+     *      @return The created section item.
+     */
+    AddressSectionItem* createSection(int index);
+
     enum
     {
         WIDTH = 160,
         NAME_COLUMN_WIDTH = 40,
         MIN_HEIGHT = 120,
         SPACING = 10,
-        SECTION_X = NAME_COLUMN_WIDTH / 2
+        SECTION_X = NAME_COLUMN_WIDTH / 2,
+        VIRTUALIZATION_THRESHOLD = 200,     //!< The section count above which the items are created on demand.
+        VISIBLE_MARGIN = 1000               //!< The distance beyond the visible area to keep the items in.
     };
 
     //-----------------------------------------------------------------------------
@@ -241,6 +271,15 @@ private:
     //! The address sections for the address blocks.
     QList<AddressSectionItem*> sections_;
 
+    //! The data of all the address sections, whether their items exist or not.
+    AddressSectionList sectionList_;
+
+    //! If true, the section items are created only for the visible part of the memory map.
+    bool virtualized_;
+
+    //! The existing section items by their index in the section list, when virtualized.
+    QMap<int, AddressSectionItem*> visibleSections_;
+
     //! The old column from where the mouse drag event began.
     MemoryColumn* oldColumn_;
     QPointF oldPos_;
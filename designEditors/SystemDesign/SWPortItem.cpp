@@ -17,6 +17,7 @@
 
 #include "SystemMoveCommands.h"
 
+#include <common/graphicsItems/DetailShadowEffect.h>
 #include <common/graphicsItems/GraphicsConnection.h>
 #include <common/GenericEditProvider.h>
 #include <designEditors/common/diagramgrid.h>
@@ -36,7 +37,6 @@
 #include <QStyleOptionGraphicsItem>
 #include <QColor>
 #include <QFont>
-#include <QGraphicsDropShadowEffect>
 #include <QDebug>
 #include <QVector2D>
 #include <QGraphicsScene>
@@ -812,7 +812,7 @@ void SWPortItem::initialize()
     nameLabel_.setFont(font);
     nameLabel_.setFlag(ItemStacksBehindParent);
 
-    QGraphicsDropShadowEffect *shadow = new QGraphicsDropShadowEffect;
+    DetailShadowEffect *shadow = new DetailShadowEffect;
     shadow->setXOffset(0);
     shadow->setYOffset(0);
     shadow->setBlurRadius(5);
@@ -12,6 +12,7 @@
 #ifndef SWPORTITEM_H
 #define SWPORTITEM_H
 
+#include <common/graphicsItems/DetailTextItem.h>
 #include <common/graphicsItems/GraphicsItemTypes.h>
 
 #include <QSharedPointer>
@@ -248,7 +249,7 @@ private:
     //-----------------------------------------------------------------------------
 
     //! The name label.
-    QGraphicsTextItem nameLabel_;
+    DetailTextItem nameLabel_;
 
     //! The COM interface, or null if not set.
     QSharedPointer<ComInterface> comInterface_;
@@ -196,6 +196,8 @@ bool SystemDesignWidget::setDesign(QSharedPointer<Component> comp, const QString
         updateSystemDesignV2(getLibraryInterface(), comp->getHierRef(hwViewRef), *design, designConf);
     }
 
+    prefetchComponents(design);
+
     if (!getDiagram()->setDesign(comp, design, designConf))
     {
         return false;
@@ -20,8 +20,10 @@
 #include <common/graphicsItems/GraphicsColumn.h>
 #include <common/graphicsItems/GraphicsColumnLayout.h>
 #include <common/graphicsItems/GraphicsConnection.h>
+#include <common/graphicsItems/OrthogonalRouter.h>
 
 #include <designEditors/common/DiagramUtil.h>
+#include <designEditors/common/diagramgrid.h>
 #include <designEditors/common/DesignWidget.h>
 
 #include <library/LibraryManager/libraryhandler.h>
@@ -32,6 +34,7 @@
 #include <QCoreApplication>
 #include <QApplication>
 #include <QMenu>
+#include <QtConcurrent/QtConcurrentRun>
 
 //-----------------------------------------------------------------------------
 // Function: ComponentDesignDiagram::ComponentDesignDiagram()
@@ -50,6 +53,10 @@ ComponentDesignDiagram::ComponentDesignDiagram(LibraryInterface* lh, GenericEdit
       addAction_(tr("Add to Library"), this),
       openComponentAction_(tr("Open Component"), this),
       openDesignMenu_(tr("Open Design")),
+      routeConnectionsAction_(tr("Route Connections"), this),
+      routingWatcher_(),
+      routedConnections_(),
+      routedOldRoutes_(),
       clickedPosition_()
 {
     connect(this, SIGNAL(selectionChanged()), this, SLOT(onSelectionChanged()));
@@ -223,6 +230,90 @@ void ComponentDesignDiagram::onOpenDesignAction(QAction* selectedAction)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentDesignDiagram::onRouteConnectionsAction()
+//-----------------------------------------------------------------------------
+void ComponentDesignDiagram::onRouteConnectionsAction()
+{
+    if (isProtected() || routingWatcher_.isRunning())
+    {
+        return;
+    }
+
+    // All the connections are routed, including the ones not yet shown.
+    createPendingItems();
+
+    QList<QRectF> obstacles;
+    QList<OrthogonalRouter::Request> requests;
+
+    routedConnections_.clear();
+    routedOldRoutes_.clear();
+
+    foreach (QGraphicsItem* item, items())
+    {
+        if (dynamic_cast<ComponentItem*>(item) != 0)
+        {
+            obstacles.append(item->sceneBoundingRect());
+            continue;
+        }
+
+        GraphicsConnection* connection = dynamic_cast<GraphicsConnection*>(item);
+        if (connection != 0 && connection != tempConnection_ &&
+            connection->endpoint1() != 0 && connection->endpoint2() != 0)
+        {
+            OrthogonalRouter::Request request;
+            request.start = connection->endpoint1()->scenePos();
+            request.startDirection = connection->endpoint1()->getDirection();
+            request.end = connection->endpoint2()->scenePos();
+            request.endDirection = connection->endpoint2()->getDirection();
+            requests.append(request);
+
+            routedConnections_.append(connection);
+            routedOldRoutes_.append(connection->route());
+        }
+    }
+
+    if (!requests.isEmpty())
+    {
+        // The router works on copies of the geometry so the diagram can be edited during the routing.
+        OrthogonalRouter router(obstacles, GridSize, 2 * GridSize);
+        routingWatcher_.setFuture(QtConcurrent::run(router, &OrthogonalRouter::routeAll, requests));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentDesignDiagram::onRoutingFinished()
+//-----------------------------------------------------------------------------
+void ComponentDesignDiagram::onRoutingFinished()
+{
+    QList<QList<QPointF> > routes = routingWatcher_.result();
+
+    QSharedPointer<QUndoCommand> cmd(new QUndoCommand());
+
+    for (int i = 0; i < routes.size() && i < routedConnections_.size(); ++i)
+    {
+        GraphicsConnection* connection = routedConnections_.at(i).data();
+
+        // Skip the connections removed or changed during the routing and the ones without a route.
+        if (connection == 0 || connection->scene() != this || routes.at(i).isEmpty() ||
+            connection->route() != routedOldRoutes_.at(i))
+        {
+            continue;
+        }
+
+        connection->setRoute(routes.at(i));
+        new ConnectionMoveCommand(connection, routedOldRoutes_.at(i), cmd.data());
+    }
+
+    routedConnections_.clear();
+    routedOldRoutes_.clear();
+
+    if (cmd->childCount() > 0)
+    {
+        getEditProvider().addCommand(cmd);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentDesignDiagram::mousePressEvent()
 //-----------------------------------------------------------------------------
@@ -408,6 +499,8 @@ QMenu* ComponentDesignDiagram::createContextMenu(QPointF const& pos)
         menu->addSeparator();
         menu->addAction(&copyAction_);
         menu->addAction(&pasteAction_);
+        menu->addSeparator();
+        menu->addAction(&routeConnectionsAction_);
 
         ComponentItem* compItem = dynamic_cast<ComponentItem*>(item);
         if (compItem)
@@ -453,6 +546,8 @@ void ComponentDesignDiagram::prepareContextMenuActions()
 
     copyAction_.setEnabled(copyActionEnabled());
     pasteAction_.setEnabled(pasteActionEnabled());
+
+    routeConnectionsAction_.setEnabled(!isProtected() && !routingWatcher_.isRunning());
 }
 
 //-----------------------------------------------------------------------------
@@ -572,6 +667,12 @@ void ComponentDesignDiagram::setupActions()
 
     connect(&openDesignMenu_, SIGNAL(triggered(QAction*)),
         this, SLOT(onOpenDesignAction(QAction*)), Qt::UniqueConnection);
+
+    getParent()->addAction(&routeConnectionsAction_);
+    connect(&routeConnectionsAction_, SIGNAL(triggered()),
+        this, SLOT(onRouteConnectionsAction()), Qt::UniqueConnection);
+
+    connect(&routingWatcher_, SIGNAL(finished()), this, SLOT(onRoutingFinished()), Qt::UniqueConnection);
 }
 
 //-----------------------------------------------------------------------------
@@ -681,6 +782,9 @@ void ComponentDesignDiagram::beginCreateConnection(QPointF const& startingPoint)
 
     addItem(tempConnection_);
 
+    // The pending connections must exist for the connected end points to be excluded.
+    createPendingItems();
+
     // Determine all potential end points to which the starting end point could be connected
     // and highlight them.
     highlightConnectableEndpoints();
@@ -14,6 +14,10 @@
 
 #include <designEditors/common/DesignDiagram.h>
 
+#include <QFutureWatcher>
+#include <QList>
+#include <QPointer>
+#include <QPointF>
 #include <QVector>
 #include <QSharedPointer>
 #include <QUndoCommand>
@@ -90,6 +94,13 @@ public slots:
      */
     virtual void onOpenDesignAction(QAction* selectedAction);
 
+    /*!
+     *  Called when route connections is selected from the context menu.
+     *
+     *      @remarks The routes are searched in the background and applied as a single undo command.
+     */
+    virtual void onRouteConnectionsAction();
+
 protected:
 
     /*!
@@ -258,6 +269,11 @@ protected:
      */
     virtual int connectionType() const = 0;
 
+private slots:
+
+    //! Called when the background routing of the connections has finished.
+    void onRoutingFinished();
+
 private:
     // Disable copying.
     ComponentDesignDiagram(ComponentDesignDiagram const& rhs);
@@ -517,6 +533,18 @@ private:
     //! Context menu sub-menu for opening a component design.
     QMenu openDesignMenu_;
 
+    //! Context menu action for routing all the connections.
+    QAction routeConnectionsAction_;
+
+    //! Watcher for the background routing of the connections.
+    QFutureWatcher<QList<QList<QPointF> > > routingWatcher_;
+
+    //! The connections being routed in the background.
+    QList<QPointer<GraphicsConnection> > routedConnections_;
+
+    //! The routes of the connections when the background routing was started.
+    QList<QList<QPointF> > routedOldRoutes_;
+
     //! Cursor position where the user right-presses to open the context menu.
     QPoint clickedPosition_;
 
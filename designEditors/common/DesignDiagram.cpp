@@ -52,6 +52,7 @@ DesignDiagram::DesignDiagram(LibraryInterface* lh,
       component_(),
       designConf_(),
       layout_(new GraphicsColumnLayout(this)),
+      segmentIndex_(),
       mode_(MODE_SELECT),
       instanceNames_(),
       loading_(false),
@@ -82,6 +83,9 @@ DesignDiagram::~DesignDiagram()
 void DesignDiagram::clearScene()
 {
     clearLayout();
+
+    // The connections are all removed, so there is no need to update the index one connection at a time.
+    segmentIndex_.clear();
     clear();    
 }
 
@@ -165,6 +169,30 @@ void DesignDiagram::updateInstanceName(const QString& oldName, const QString& ne
     instanceNames_.append(newName);
 }
 
+//-----------------------------------------------------------------------------
+// Function: DesignDiagram::markItemModified()
+//-----------------------------------------------------------------------------
+void DesignDiagram::markItemModified(QGraphicsItem*)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignDiagram::onVisibleAreaChanged()
+//-----------------------------------------------------------------------------
+void DesignDiagram::onVisibleAreaChanged(QRectF const&)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignDiagram::createPendingItems()
+//-----------------------------------------------------------------------------
+void DesignDiagram::createPendingItems()
+{
+
+}
+
 //-----------------------------------------------------------------------------
 // Function: DesignDiagram::setMode()
 //-----------------------------------------------------------------------------
@@ -602,6 +630,14 @@ QSharedPointer<GraphicsColumnLayout> DesignDiagram::getLayout() const
     return layout_;
 }
 
+//-----------------------------------------------------------------------------
+// Function: DesignDiagram::getConnectionSegmentIndex()
+//-----------------------------------------------------------------------------
+ConnectionSegmentIndex& DesignDiagram::getConnectionSegmentIndex()
+{
+    return segmentIndex_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: DesignDiagram::setLayout()
 //-----------------------------------------------------------------------------
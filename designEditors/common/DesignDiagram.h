@@ -15,6 +15,8 @@
 #include <designEditors/HWDesign/AdHocEnabled.h>
 #include <designEditors/common/DrawMode.h>
 
+#include <common/graphicsItems/ConnectionSegmentIndex.h>
+
 #include <IPXACTmodels/designconfiguration.h>
 #include <IPXACTmodels/ColumnDesc.h>
 
@@ -125,7 +127,32 @@ public:
 	 *      @param oldName The old name of the component instance.
 	 *      @param newName The new name of the component instance.
 	 */
-	void updateInstanceName(const QString& oldName, const QString& newName);
+	virtual void updateInstanceName(const QString& oldName, const QString& newName);
+
+    /*!
+     *  Called when the design data represented by an item in the diagram has changed.
+     *
+     *      @param [in] item   The changed item.
+     *
+     *      @remarks The default implementation does nothing.
+     */
+    virtual void markItemModified(QGraphicsItem* item);
+
+    /*!
+     *  Called when the area of the diagram shown in the view has changed.
+     *
+     *      @param [in] visibleArea   The visible area in scene coordinates.
+     *
+     *      @remarks The default implementation does nothing.
+     */
+    virtual void onVisibleAreaChanged(QRectF const& visibleArea);
+
+    /*!
+     *  Creates the graphics items whose creation was deferred when the design was loaded.
+     *
+     *      @remarks The default implementation does nothing.
+     */
+    virtual void createPendingItems();
 
     /*!
      *  Changes the state of a visibility control.
@@ -227,6 +254,13 @@ public:
       */
      QSharedPointer<GraphicsColumnLayout> getLayout() const;
 
+     /*!
+      *  Gets the spatial index of the connection route segments in the diagram.
+      *
+      *      @return The segment index.
+      */
+     ConnectionSegmentIndex& getConnectionSegmentIndex();
+
 public slots:
     //! Called when the diagram is shown.
     void onShow();
@@ -546,6 +580,9 @@ private:
     // Graphics column layout.
     QSharedPointer<GraphicsColumnLayout> layout_;
 
+    //! The spatial index of the connection route segments.
+    ConnectionSegmentIndex segmentIndex_;
+
     //! The current draw mode.
     DrawMode mode_;
 
@@ -12,6 +12,7 @@
 #include "DesignWidget.h"
 
 #include <common/GenericEditProvider.h>
+#include <common/graphicsItems/LevelOfDetail.h>
 
 #include <designEditors/common/DesignDiagram.h>
 #include <designEditors/common/StickyNote/StickyNote.h>
@@ -30,6 +31,7 @@
 #include <QPrintDialog>
 #include <QApplication>
 #include <QGraphicsItem>
+#include <QSettings>
 
 
 //-----------------------------------------------------------------------------
@@ -53,8 +55,12 @@ DesignWidget::DesignWidget(LibraryInterface* lh, QWidget* parent)
 
     view_->verticalScrollBar()->setTracking(true);
     connect(view_->verticalScrollBar(), SIGNAL(valueChanged(int)), this, SLOT(onVerticalScroll(int)));
+    connect(view_->horizontalScrollBar(), SIGNAL(valueChanged(int)), this, SLOT(onHorizontalScroll(int)));
 
 	addVisibilityControl(tr("Sticky Notes"), true);
+
+    QSettings settings;
+    applySettings(settings);
 }
 
 //-----------------------------------------------------------------------------
@@ -63,6 +69,7 @@ DesignWidget::DesignWidget(LibraryInterface* lh, QWidget* parent)
 DesignWidget::~DesignWidget()
 {
     view_->verticalScrollBar()->disconnect(this);
+    view_->horizontalScrollBar()->disconnect(this);
 
     delete diagram_;
     diagram_ = 0;
@@ -138,6 +145,8 @@ void DesignWidget::setZoomLevel(int level)
     view_->translate(oldMatrix.dx(), oldMatrix.dy());
     view_->scale(newScale, newScale);
 
+    updateVisibleArea();
+
     emit zoomChanged();
 }
 
@@ -298,6 +307,16 @@ void DesignWidget::onVerticalScroll(int y)
     QPointF pt(0.0, y);
     QMatrix mat = view_->matrix().inverted();
     diagram_->onVerticalScroll(mat.map(pt).y());
+
+    updateVisibleArea();
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignWidget::onHorizontalScroll()
+//-----------------------------------------------------------------------------
+void DesignWidget::onHorizontalScroll(int)
+{
+    updateVisibleArea();
 }
 
 //-----------------------------------------------------------------------------
@@ -307,9 +326,41 @@ bool DesignWidget::setDesign(QSharedPointer<Component> component, const QString&
 {
     editedComponent_ = component;
     viewName_ = viewName;
+
+    updateVisibleArea();
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: DesignWidget::prefetchComponents()
+//-----------------------------------------------------------------------------
+void DesignWidget::prefetchComponents(QSharedPointer<Design> design)
+{
+    if (!design)
+    {
+        return;
+    }
+
+    QList<VLNV> componentRefs;
+    foreach (ComponentInstance const& instance, design->getComponentInstances())
+    {
+        if (!componentRefs.contains(instance.getComponentRef()))
+        {
+            componentRefs.append(instance.getComponentRef());
+        }
+    }
+
+    foreach (SWInstance const& instance, design->getSWInstances())
+    {
+        if (!componentRefs.contains(instance.getComponentRef()))
+        {
+            componentRefs.append(instance.getComponentRef());
+        }
+    }
+
+    getLibraryInterface()->prefetchModels(componentRefs);
+}
+
 //-----------------------------------------------------------------------------
 // Function: DesignWidget::removeSelectedNotes()
 //-----------------------------------------------------------------------------
@@ -371,6 +422,7 @@ DesignDiagram* DesignWidget::getDiagram() const
 void DesignWidget::centerViewTo(QPointF const& centerPoint)
 {
     view_->centerOn(centerPoint);
+    updateVisibleArea();
 }
 
 //-----------------------------------------------------------------------------
@@ -397,11 +449,23 @@ QSharedPointer<Component> DesignWidget::getEditedComponent() const
     return editedComponent_;
 }
 
+//-----------------------------------------------------------------------------
+// Function: DesignWidget::applySettings()
+//-----------------------------------------------------------------------------
+void DesignWidget::applySettings(QSettings& settings)
+{
+    LevelOfDetail::applySettings(settings);
+    view_->viewport()->update();
+}
+
 //-----------------------------------------------------------------------------
 // Function: DesignWidget::print()
 //-----------------------------------------------------------------------------
 void DesignWidget::print()
 {
+    // The printout shows all the connections, including the ones not yet shown in the view.
+    diagram_->createPendingItems();
+
     // get the rect that bounds all items on box
     QRectF boundingRect = diagram_->itemsBoundingRect();
 
@@ -464,6 +528,29 @@ void DesignWidget::showEvent(QShowEvent* event)
 {
     TabDocument::showEvent(event);
     diagram_->onShow();
+
+    updateVisibleArea();
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignWidget::resizeEvent()
+//-----------------------------------------------------------------------------
+void DesignWidget::resizeEvent(QResizeEvent* event)
+{
+    TabDocument::resizeEvent(event);
+
+    updateVisibleArea();
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignWidget::updateVisibleArea()
+//-----------------------------------------------------------------------------
+void DesignWidget::updateVisibleArea()
+{
+    if (diagram_ != 0)
+    {
+        diagram_->onVisibleAreaChanged(view_->mapToScene(view_->viewport()->rect()).boundingRect());
+    }
 }
 
 //-----------------------------------------------------------------------------
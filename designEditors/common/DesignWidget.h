@@ -26,6 +26,7 @@ class ComponentItem;
 class ConnectionEndpoint;
 class GraphicsConnection;
 class Component;
+class Design;
 class DesignDiagram;
 
 //-----------------------------------------------------------------------------
@@ -82,6 +83,13 @@ public:
      */
     virtual void refresh();
 
+    /*!
+     *  Applies the zoom thresholds for the level of detail of the diagram items.
+     *
+     *      @param [in] settings   The settings to apply.
+     */
+    virtual void applySettings(QSettings& settings);
+
     /*!
      *  Prints the design.
      */
@@ -190,6 +198,9 @@ public slots:
     //! Called when the vertical scrollbar is scrolled.
     void onVerticalScroll(int y);
 
+    //! Called when the horizontal scrollbar is scrolled.
+    void onHorizontalScroll(int x);
+
 signals:
 
     //! Emitted when component with given vlnv should be opened in editor.
@@ -228,6 +239,9 @@ signals:
 protected:
     void showEvent(QShowEvent* event);
 
+    //! Called when the widget is resized.
+    virtual void resizeEvent(QResizeEvent* event);
+
     /*!
      *  Returns the library interface.
      */
@@ -235,6 +249,13 @@ protected:
 
     virtual bool setDesign(QSharedPointer<Component> component, const QString& viewName);
 
+    /*!
+     *  Parses the components instantiated in the given design in parallel before the diagram is built.
+     *
+     *      @param [in] design  The design whose instances are prefetched.
+     */
+    void prefetchComponents(QSharedPointer<Design> design);
+
     //! Removes all selected sticky notes.
     void removeSelectedNotes();
 
@@ -246,6 +267,11 @@ private:
     DesignWidget(DesignWidget const& rhs);
     DesignWidget& operator=(DesignWidget const& rhs);
 
+    /*!
+     *  Informs the diagram about the scene area currently visible in the view.
+     */
+    void updateVisibleArea();
+
     enum
     {
         EDIT_HISTORY_SIZE = 50
@@ -306,7 +306,7 @@ bool AddressSpacesModel::isValid() const
 	// if at least one address space is invalid
 	foreach (QSharedPointer<AddressSpace> addrSpace, addrSpaces_) 
     {
-		if (!addrSpace->isValid(component_->getChoices(), component_->getRemapStateNames()))
+		if (!addrSpace->isValid(component_->getChoices(), component_->getRemapStateNames().toSet()))
         {
 			return false;
 		}
@@ -86,6 +86,7 @@ bool BusInterfacesEditor::isValid() const {
 // Function: BusInterfacesEditor::refresh()
 //-----------------------------------------------------------------------------
 void BusInterfacesEditor::refresh() {
+	model_.refresh();
 	view_.setModel(&model_);
 }
 
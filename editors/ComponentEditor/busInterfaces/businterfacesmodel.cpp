@@ -21,6 +21,7 @@
 #include <IPXACTmodels/vlnv.h>
 #include <IPXACTmodels/masterinterface.h>
 #include <IPXACTmodels/mirroredslaveinterface.h>
+#include <IPXACTmodels/validators/ComponentValidationContext.h>
 
 #include <editors/ComponentEditor/memoryMaps/memoryMapsExpressionCalculators/ReferenceCalculator.h>
 
@@ -42,7 +43,8 @@ QAbstractTableModel(parent),
 libHandler_(libHandler),
 component_(component),
 busifs_(component->getBusInterfaces()),
-parameterFinder_(parameterFinder)
+parameterFinder_(parameterFinder),
+validationContext_(new ComponentValidationContext(*component))
 {
 	Q_ASSERT(libHandler_);
 	Q_ASSERT(component_);
@@ -181,8 +183,7 @@ QVariant BusInterfacesModel::data(QModelIndex const& index, int role) const
     }
 	else if (role == Qt::ForegroundRole)
     {
-		if (busInterface->isValid(component_->getPortBounds(), component_->getMemoryMapNames(),
-            component_->getAddressSpaceNames(), component_->getChoices()))
+		if (busInterface->isValid(*validationContext_, component_->getChoices()))
         {
 			return QColor("black");
 		}
@@ -427,13 +428,11 @@ void BusInterfacesModel::onMoveItem(QModelIndex const& originalPos, QModelIndex
 //-----------------------------------------------------------------------------
 bool BusInterfacesModel::isValid() const
 {
-	QList<General::PortBounds> physPorts = component_->getPortBounds();
-    QStringList memoryMaps = component_->getMemoryMapNames();
-    QStringList addressSpaces = component_->getAddressSpaceNames();
+	ComponentValidationContext context(*component_);
 
 	foreach (QSharedPointer<BusInterface> busif, busifs_)
     {
-		if (!busif->isValid(physPorts, memoryMaps, addressSpaces, component_->getChoices()))
+		if (!busif->isValid(context, component_->getChoices()))
         {
 			return false;
 		}
@@ -442,6 +441,14 @@ bool BusInterfacesModel::isValid() const
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: BusInterfacesModel::refresh()
+//-----------------------------------------------------------------------------
+void BusInterfacesModel::refresh()
+{
+    validationContext_ = QSharedPointer<ComponentValidationContext>(new ComponentValidationContext(*component_));
+}
+
 //-----------------------------------------------------------------------------
 // Function: businterfacesmodel::removeReferencesFromExpressions()
 //-----------------------------------------------------------------------------
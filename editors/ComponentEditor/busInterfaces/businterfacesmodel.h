@@ -19,6 +19,7 @@
 #include <QSharedPointer>
 #include <QList>
 
+class ComponentValidationContext;
 class LibraryInterface;
 class ParameterFinder;
 
@@ -103,6 +104,12 @@ public:
 	*/
 	bool isValid() const;
 
+    /*!
+     *  Collects the names and ports of the component again for checking the validity of the bus interfaces.
+     *  Must be called when the other elements of the component may have been changed.
+     */
+    void refresh();
+
     /*!
      *  Returns the supported actions of a drop.
      *
@@ -222,6 +229,9 @@ private:
 
     //! The parameter finder.
     QSharedPointer<ParameterFinder> parameterFinder_;
+
+    //! The names and ports of the component for checking the validity of the bus interfaces.
+    QSharedPointer<ComponentValidationContext> validationContext_;
 };
 
 #endif // BUSINTERFACESMODEL_H
@@ -17,6 +17,7 @@
 #include <IPXACTmodels/businterface.h>
 #include <IPXACTmodels/component.h>
 #include <IPXACTmodels/PortMap.h>
+#include <IPXACTmodels/validators/ComponentValidationContext.h>
 
 //-----------------------------------------------------------------------------
 // Function: PortMapsLogicalItem::PortMapsLogicalItem()
@@ -173,7 +174,8 @@ bool PortMapsLogicalItem::isValid() const
         return false;
     }
             
-    QList<General::PortBounds> bounds = component_->getPortBounds();
+    ComponentValidationContext context(*component_);
+    QHash<QString, General::PortBounds> const& bounds = context.getPhysicalPorts();
     foreach (QSharedPointer<PortMap> portMap, portMaps_)
     {
         if (QString::compare(portMap->logicalPort(), getName()) == 0)
@@ -224,7 +226,8 @@ bool PortMapsLogicalItem::isValid(QStringList& errorList) const
         valid = false;
     }
 
-    QList<General::PortBounds> bounds = component_->getPortBounds();
+    ComponentValidationContext context(*component_);
+    QHash<QString, General::PortBounds> const& bounds = context.getPhysicalPorts();
     foreach (QSharedPointer<PortMap> portMap, portMaps_)
     {
         if (QString::compare(portMap->logicalPort(), getName()) == 0)
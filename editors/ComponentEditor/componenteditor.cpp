@@ -40,6 +40,7 @@
 
 #include <common/dialogs/newObjectDialog/newobjectdialog.h>
 #include <common/dialogs/comboSelector/comboselector.h>
+#include <common/PerformanceTrace/ScopedTrace.h>
 
 #include <kactusGenerators/vhdlGenerator/vhdlgenerator2.h>
 #include <kactusGenerators/modelsimGenerator/modelsimgenerator.h>
@@ -80,6 +81,8 @@ parameterFinder_(new ComponentParameterFinder(component_)),
 referenceCounter_(new ParameterReferenceCounter(parameterFinder_)),
 expressionFormatter_(new ExpressionFormatter(parameterFinder_))
 {
+    SCOPED_TRACE_DETAIL(trace, "ComponentEditor::ComponentEditor", "editor", component->getVlnv()->toString());
+
     // these can be used when debugging to identify the objects
 	setObjectName(tr("ComponentEditor"));
 	navigationSplitter_.setObjectName(tr("NavigationSplitter"));
@@ -0,0 +1,278 @@
+//-----------------------------------------------------------------------------
+// File: FileDependencyColumnAllocator.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Assigns the dependency arrows of the file dependency graph into graph columns.
+//-----------------------------------------------------------------------------
+
+#include "FileDependencyColumnAllocator.h"
+
+#include <QPair>
+#include <QtAlgorithms>
+
+#include <limits>
+
+namespace
+{
+    //! The bounds of a column without intervals.
+    const int EMPTY_COLUMN_BOTTOM = std::numeric_limits<int>::min();
+    const int EMPTY_COLUMN_TOP = std::numeric_limits<int>::max();
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyColumnAllocator::FileDependencyColumnAllocator()
+//-----------------------------------------------------------------------------
+FileDependencyColumnAllocator::FileDependencyColumnAllocator(int margin) : margin_(margin), columns_(),
+    leafCount_(0), lowestBottoms_(), highestTops_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyColumnAllocator::~FileDependencyColumnAllocator()
+//-----------------------------------------------------------------------------
+FileDependencyColumnAllocator::~FileDependencyColumnAllocator()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyColumnAllocator::clear()
+//-----------------------------------------------------------------------------
+void FileDependencyColumnAllocator::clear()
+{
+    columns_.clear();
+    rebuildFreeSpace();
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyColumnAllocator::getColumnCount()
+//-----------------------------------------------------------------------------
+int FileDependencyColumnAllocator::getColumnCount() const
+{
+    return columns_.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyColumnAllocator::hasSpace()
+//-----------------------------------------------------------------------------
+bool FileDependencyColumnAllocator::hasSpace(int column, int top, int bottom) const
+{
+    QMap<int, int> const& intervals = columns_.at(column);
+
+    // The intervals in a column do not overlap, so the only candidate for a collision is
+    // the last interval starting above the bottom of the new interval.
+    QMap<int, int>::const_iterator next = intervals.upperBound(bottom + margin_);
+    if (next == intervals.constBegin())
+    {
+        return true;
+    }
+
+    --next;
+    return next.value() < top - margin_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyColumnAllocator::allocate()
+//-----------------------------------------------------------------------------
+int FileDependencyColumnAllocator::allocate(int top, int bottom)
+{
+    int column = findFreeColumn(top, bottom);
+    if (column == -1)
+    {
+        column = columns_.size();
+        columns_.append(QMap<int, int>());
+
+        if (column >= leafCount_)
+        {
+            columns_[column].insert(top, bottom);
+            rebuildFreeSpace();
+            return column;
+        }
+    }
+
+    columns_[column].insert(top, bottom);
+    updateFreeSpace(column);
+    return column;
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyColumnAllocator::release()
+//-----------------------------------------------------------------------------
+void FileDependencyColumnAllocator::release(int column, int top, int bottom)
+{
+    if (column < 0 || column >= columns_.size())
+    {
+        return;
+    }
+
+    QMap<int, int>::iterator interval = columns_[column].find(top);
+    if (interval != columns_[column].end() && interval.value() == bottom)
+    {
+        columns_[column].erase(interval);
+        updateFreeSpace(column);
+    }
+
+    // Drop empty columns from the right so that the graph shrinks.
+    while (!columns_.isEmpty() && columns_.last().isEmpty())
+    {
+        columns_.removeLast();
+        updateFreeSpace(columns_.size());
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyColumnAllocator::allocateAll()
+//-----------------------------------------------------------------------------
+QVector<int> FileDependencyColumnAllocator::allocateAll(QVector<Interval> const& intervals)
+{
+    columns_.clear();
+
+    // Sweep the intervals from top to bottom.
+    QVector<QPair<int, int> > order;
+    order.reserve(intervals.size());
+    for (int i = 0; i < intervals.size(); ++i)
+    {
+        order.append(qMakePair(intervals.at(i).top, i));
+    }
+
+    qSort(order);
+
+    QVector<int> assignedColumns(intervals.size(), 0);
+
+    // The columns whose last interval may still collide, keyed by the bottom of that interval.
+    QMultiMap<int, int> busyColumns;
+
+    // The columns that have space for any interval below the current sweep position.
+    QMap<int, bool> freeColumns;
+
+    for (int i = 0; i < order.size(); ++i)
+    {
+        int index = order.at(i).second;
+        Interval const& interval = intervals.at(index);
+
+        while (!busyColumns.isEmpty() && busyColumns.begin().key() < interval.top - margin_)
+        {
+            freeColumns.insert(busyColumns.begin().value(), true);
+            busyColumns.erase(busyColumns.begin());
+        }
+
+        int column = 0;
+        if (freeColumns.isEmpty())
+        {
+            column = columns_.size();
+            columns_.append(QMap<int, int>());
+        }
+        else
+        {
+            column = freeColumns.begin().key();
+            freeColumns.erase(freeColumns.begin());
+        }
+
+        columns_[column].insert(interval.top, interval.bottom);
+        busyColumns.insert(interval.bottom, column);
+        assignedColumns[index] = column;
+    }
+
+    rebuildFreeSpace();
+    return assignedColumns;
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyColumnAllocator::findFreeColumn()
+//-----------------------------------------------------------------------------
+int FileDependencyColumnAllocator::findFreeColumn(int top, int bottom) const
+{
+    if (leafCount_ == 0 || !hasFreeSpace(1, top, bottom))
+    {
+        return -1;
+    }
+
+    // Descend to the leftmost leaf with space, preferring the left subtree at each node.
+    int node = 1;
+    while (node < leafCount_)
+    {
+        node *= 2;
+        if (!hasFreeSpace(node, top, bottom))
+        {
+            ++node;
+        }
+    }
+
+    return node - leafCount_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyColumnAllocator::hasFreeSpace()
+//-----------------------------------------------------------------------------
+bool FileDependencyColumnAllocator::hasFreeSpace(int node, int top, int bottom) const
+{
+    return lowestBottoms_.at(node) < top - margin_ || highestTops_.at(node) > bottom + margin_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyColumnAllocator::updateFreeSpace()
+//-----------------------------------------------------------------------------
+void FileDependencyColumnAllocator::updateFreeSpace(int column)
+{
+    if (column >= leafCount_)
+    {
+        return;
+    }
+
+    int node = leafCount_ + column;
+
+    // Leaves without a column never have space.
+    if (column >= columns_.size())
+    {
+        lowestBottoms_[node] = EMPTY_COLUMN_TOP;
+        highestTops_[node] = EMPTY_COLUMN_BOTTOM;
+    }
+    else if (columns_.at(column).isEmpty())
+    {
+        lowestBottoms_[node] = EMPTY_COLUMN_BOTTOM;
+        highestTops_[node] = EMPTY_COLUMN_TOP;
+    }
+    else
+    {
+        // The intervals do not overlap, so the last interval by top is also the last by bottom.
+        QMap<int, int> const& intervals = columns_.at(column);
+        lowestBottoms_[node] = (intervals.constEnd() - 1).value();
+        highestTops_[node] = intervals.constBegin().key();
+    }
+
+    for (node /= 2; node > 0; node /= 2)
+    {
+        lowestBottoms_[node] = qMin(lowestBottoms_.at(2 * node), lowestBottoms_.at(2 * node + 1));
+        highestTops_[node] = qMax(highestTops_.at(2 * node), highestTops_.at(2 * node + 1));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyColumnAllocator::rebuildFreeSpace()
+//-----------------------------------------------------------------------------
+void FileDependencyColumnAllocator::rebuildFreeSpace()
+{
+    leafCount_ = 0;
+    if (!columns_.isEmpty())
+    {
+        // Reserve room for twice the columns so that adding columns rarely rebuilds the tree.
+        leafCount_ = 1;
+        while (leafCount_ < 2 * columns_.size())
+        {
+            leafCount_ *= 2;
+        }
+    }
+
+    lowestBottoms_.fill(EMPTY_COLUMN_TOP, 2 * leafCount_);
+    highestTops_.fill(EMPTY_COLUMN_BOTTOM, 2 * leafCount_);
+
+    for (int column = 0; column < columns_.size(); ++column)
+    {
+        updateFreeSpace(column);
+    }
+}
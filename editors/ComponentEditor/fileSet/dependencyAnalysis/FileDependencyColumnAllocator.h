@@ -0,0 +1,164 @@
+//-----------------------------------------------------------------------------
+// File: FileDependencyColumnAllocator.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Assigns the dependency arrows of the file dependency graph into graph columns.
+//-----------------------------------------------------------------------------
+
+#ifndef FILEDEPENDENCYCOLUMNALLOCATOR_H
+#define FILEDEPENDENCYCOLUMNALLOCATOR_H
+
+#include <QMap>
+#include <QVector>
+
+//-----------------------------------------------------------------------------
+//! Assigns the dependency arrows of the file dependency graph into graph columns.
+//
+// Each column keeps its arrows as an ordered tree of disjoint vertical intervals so that checking
+// a column for space is a logarithmic lookup. The free space above and below the arrows of all the
+// columns is kept in a tournament tree, so the column for a new arrow is found with a single
+// logarithmic descent. Arrows can be added and removed one at a time or the whole graph can be laid
+// out in a single sweep.
+//-----------------------------------------------------------------------------
+class FileDependencyColumnAllocator
+{
+public:
+
+    //-----------------------------------------------------------------------------
+    //! Vertical interval of a dependency arrow.
+    //-----------------------------------------------------------------------------
+    struct Interval
+    {
+        int top;
+        int bottom;
+
+        /*!
+         *  Constructor.
+         */
+        Interval(int top = 0, int bottom = 0) : top(top), bottom(bottom)
+        {
+        }
+    };
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] margin  The minimum vertical space required between arrows in the same column.
+     */
+    explicit FileDependencyColumnAllocator(int margin);
+
+    //! The destructor.
+    ~FileDependencyColumnAllocator();
+
+    /*!
+     *  Removes all columns and intervals.
+     */
+    void clear();
+
+    /*!
+     *  Returns the number of columns in use.
+     */
+    int getColumnCount() const;
+
+    /*!
+     *  Checks whether the given column has space for the given interval.
+     *
+     *      @param [in] column  The index of the column to check.
+     *      @param [in] top     The top of the interval.
+     *      @param [in] bottom  The bottom of the interval.
+     *
+     *      @return True, if the interval fits in the column, otherwise false.
+     */
+    bool hasSpace(int column, int top, int bottom) const;
+
+    /*!
+     *  Places the given interval in the first column from the left which has space for it above or
+     *  below all of its intervals. A new column is added, if none of the columns has space.
+     *
+     *      @param [in] top     The top of the interval.
+     *      @param [in] bottom  The bottom of the interval.
+     *
+     *      @return The index of the column where the interval was placed.
+     */
+    int allocate(int top, int bottom);
+
+    /*!
+     *  Removes the given interval from the given column.
+     *
+     *      @param [in] column  The index of the column containing the interval.
+     *      @param [in] top     The top of the interval.
+     *      @param [in] bottom  The bottom of the interval.
+     */
+    void release(int column, int top, int bottom);
+
+    /*!
+     *  Replaces all columns with a new layout for the given intervals.
+     *
+     *      @param [in] intervals   The intervals to place.
+     *
+     *      @return The column index for each interval in the same order as the intervals.
+     *
+     *      @remarks The result equals placing the intervals one by one in top-down order, but takes
+     *               only O(n log n) time in total and uses the minimum number of columns.
+     */
+    QVector<int> allocateAll(QVector<Interval> const& intervals);
+
+private:
+    // Disable copying.
+    FileDependencyColumnAllocator(FileDependencyColumnAllocator const& rhs);
+    FileDependencyColumnAllocator& operator=(FileDependencyColumnAllocator const& rhs);
+
+    /*!
+     *  Finds the first column from the left which has space for the given interval above or below
+     *  all of its intervals.
+     *
+     *      @param [in] top     The top of the interval.
+     *      @param [in] bottom  The bottom of the interval.
+     *
+     *      @return The index of the column or -1, if none of the columns has space.
+     */
+    int findFreeColumn(int top, int bottom) const;
+
+    /*!
+     *  Checks if any of the columns under the given node of the free space tree has space for the
+     *  given interval above or below all of its intervals.
+     */
+    bool hasFreeSpace(int node, int top, int bottom) const;
+
+    /*!
+     *  Updates the free space of the given column in the free space tree.
+     *
+     *      @param [in] column  The index of the column to update.
+     */
+    void updateFreeSpace(int column);
+
+    /*!
+     *  Builds the free space tree for all the columns.
+     */
+    void rebuildFreeSpace();
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The minimum vertical space between arrows in the same column.
+    int margin_;
+
+    //! The occupied intervals of each column as top -> bottom.
+    QVector<QMap<int, int> > columns_;
+
+    //! The number of leaves in the free space tree. Leaf i is for column i.
+    int leafCount_;
+
+    //! The lowest bottom of the intervals in the columns under each node of the free space tree.
+    QVector<int> lowestBottoms_;
+
+    //! The highest top of the intervals in the columns under each node of the free space tree.
+    QVector<int> highestTops_;
+};
+
+#endif // FILEDEPENDENCYCOLUMNALLOCATOR_H
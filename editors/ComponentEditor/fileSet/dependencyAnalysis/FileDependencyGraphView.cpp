@@ -24,6 +24,7 @@
 #include <QDebug>
 #include <QMenu>
 #include <QFileDialog>
+#include <QtAlgorithms>
 
 //-----------------------------------------------------------------------------
 // Function: FileDependencyGraphWidget::FileDependencyGraphWidget()
@@ -33,6 +34,9 @@ FileDependencyGraphView::FileDependencyGraphView(QWidget* parent)
       sortFilter_(new FileDependencySortFilter(this)),
       model_(0),
       columns_(),
+      columnAllocator_(SAFE_MARGIN),
+      dependencyColumns_(),
+      graphDirty_(false),
       maxVisibleGraphColumns_(0),
       scrollIndex_(0),
       hoveredDependency_(0),
@@ -49,6 +53,7 @@ FileDependencyGraphView::FileDependencyGraphView(QWidget* parent)
 
     connect(header(), SIGNAL(sectionResized(int, int, int)),
             this, SLOT(onSectionResized()), Qt::UniqueConnection);
+    connect(sortFilter_, SIGNAL(layoutChanged()), this, SLOT(onLayoutChanged()), Qt::UniqueConnection);
 
     connect(this, SIGNAL(collapsed(QModelIndex const&)), this, SLOT(onDependenciesReset()), Qt::UniqueConnection);
     connect(this, SIGNAL(expanded(QModelIndex const&)), this, SLOT(onDependenciesReset()), Qt::UniqueConnection);
@@ -104,6 +109,32 @@ void FileDependencyGraphView::setModel(QAbstractItemModel* model)
 // Function: FileDependencyGraphWidget::onDependencyAdded()
 //-----------------------------------------------------------------------------
 void FileDependencyGraphView::onDependencyAdded(FileDependency* dependency, bool immediateRepaint)
+{
+    GraphDependency graphDep(dependency, 0, 0);
+
+    // The dependency will be placed when the whole graph is recalculated, if the graph is not valid.
+    if (createGraphDependency(dependency, graphDep) && !graphDirty_)
+    {
+        int columnCount = columns_.size();
+        int columnIndex = placeDependency(graphDep);
+
+        if (immediateRepaint)
+        {
+            if (columns_.size() != columnCount)
+            {
+                onSectionResized();
+            }
+
+            // Repaint only the region of the new dependency.
+            viewport()->update(getDependencyRect(columnIndex, graphDep));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyGraphView::createGraphDependency()
+//-----------------------------------------------------------------------------
+bool FileDependencyGraphView::createGraphDependency(FileDependency* dependency, GraphDependency& graphDependency)
 {
     FileDependencyItem* fromItem = dependency->getFileItem1();
     FileDependencyItem* toItem = dependency->getFileItem2();
@@ -119,66 +150,24 @@ void FileDependencyGraphView::onDependencyAdded(FileDependency* dependency, bool
     Q_ASSERT(toItem != 0);
 
     // Check if the dependency should not be visible.
-    if (!filterDependency(dependency))
+    if (fromItem == 0 || toItem == 0 || !filterDependency(dependency))
     {
-        return;
+        return false;
     }
 
-    if (fromItem != 0 && toItem != 0)
-    {
-        // Determine the y coordinates for the dependency.
-        int fromY = 0;
-        int toY = 0;
-
-        getVisualRowY(sortFilter_->mapFromSource(model_->getItemIndex(fromItem, 0)), fromY);
-        getVisualRowY(sortFilter_->mapFromSource(model_->getItemIndex(toItem, 0)), toY);
-
-        // The user may be scrolling the view so scroll bar position must be taken into account.
-        int vOffset = verticalOffset();
-        fromY += vOffset;
-        toY += vOffset;
-
-        GraphDependency graphDep(dependency, fromY, toY);
-
-        // Find the first column from the left which has space for the dependency.
-        GraphColumn* selColumn = 0;
-        int x = GRAPH_MARGIN - scrollIndex_ * GRAPH_SPACING;
-
-        for (int i = 0; i < columns_.size(); ++i)
-        {
-            GraphColumn* column = &columns_[i];
-
-            if (hasSpace(*column, graphDep))
-            {
-                selColumn = column;
-                break;
-            }
-
-            x += GRAPH_SPACING;
-        }
-
-        // If no free column was found, create a new one.
-        if (selColumn == 0)
-        {
-            columns_.append(GraphColumn());
-            selColumn = &columns_.back();
-
-            onSectionResized();
-        }
-        
-        selColumn->dependencies.append(graphDep);
+    // Determine the y coordinates for the dependency.
+    int fromY = 0;
+    int toY = 0;
 
-        // Repaint only the region of the new dependency.
-        int columnOffset = columnViewportPosition(FILE_DEPENDENCY_COLUMN_DEPENDENCIES);
-        
-        if (immediateRepaint)
-        {
-            viewport()->repaint(QRect(columnOffset + x - ARROW_WIDTH - SAFE_MARGIN,
-                                      qMin(fromY, toY) - POINTER_OFFSET - SAFE_MARGIN,
-                                      2 * (ARROW_WIDTH + SAFE_MARGIN),
-                                      qAbs(toY - fromY) + 2 * (POINTER_OFFSET + SAFE_MARGIN)));
-        }
+    if (!getCoordinates(dependency, fromY, toY))
+    {
+        return false;
     }
+
+    // The user may be scrolling the view so scroll bar position must be taken into account.
+    int vOffset = verticalOffset();
+    graphDependency = GraphDependency(dependency, fromY + vOffset, toY + vOffset);
+    return true;
 }
 
 //-----------------------------------------------------------------------------
@@ -194,40 +183,40 @@ void FileDependencyGraphView::onDependencyChanged(FileDependency* dependency)
 //-----------------------------------------------------------------------------
 void FileDependencyGraphView::onDependencyRemoved(FileDependency* dependency)
 {
-    int x = GRAPH_MARGIN - scrollIndex_ * GRAPH_SPACING;
+    int columnIndex = dependencyColumns_.value(dependency, -1);
+    dependencyColumns_.remove(dependency);
 
-    for (int i = 0; i < columns_.size(); ++i)
+    if (columnIndex < 0 || columnIndex >= columns_.size())
     {
-        GraphColumn& column = columns_[i];
+        return;
+    }
 
-        for (int j = 0; j < column.dependencies.size(); ++j)
-        {
-            GraphDependency& dep = column.dependencies[j];
+    GraphColumn& column = columns_[columnIndex];
 
-            if (dep.dependency == dependency)
-            {
-                // Repaint only the area of the dependency.
-                int columnOffset = columnViewportPosition(FILE_DEPENDENCY_COLUMN_DEPENDENCIES);
-                int fromY = 0;
-                int toY = 0;
-                bool visible = getCoordinates(dep, fromY, toY);
+    for (int j = 0; j < column.dependencies.size(); ++j)
+    {
+        GraphDependency dep = column.dependencies.at(j);
 
-                column.dependencies.removeAt(j);
+        if (dep.dependency == dependency)
+        {
+            column.dependencies.removeAt(j);
+            columnAllocator_.release(columnIndex, dep.top(), dep.bottom());
 
-                if (visible)
+            // Drop the columns that became unused.
+            if (columns_.size() != columnAllocator_.getColumnCount())
+            {
+                while (columns_.size() > columnAllocator_.getColumnCount())
                 {
-                    viewport()->repaint(QRect(columnOffset + x - ARROW_WIDTH - SAFE_MARGIN,
-                                        qMin(fromY, toY) - POINTER_OFFSET - SAFE_MARGIN,
-                                        2 * (ARROW_WIDTH + SAFE_MARGIN),
-                                        qAbs(toY - fromY) + 2 * (POINTER_OFFSET + SAFE_MARGIN)));
+                    columns_.removeLast();
                 }
 
-
-                return;
+                onSectionResized();
             }
-        }
 
-        x += GRAPH_SPACING;
+            // Repaint only the area of the dependency.
+            viewport()->repaint(getDependencyRect(columnIndex, dep));
+            return;
+        }
     }
 }
 
@@ -236,6 +225,8 @@ void FileDependencyGraphView::onDependencyRemoved(FileDependency* dependency)
 //-----------------------------------------------------------------------------
 void FileDependencyGraphView::paintEvent(QPaintEvent* event)
 {
+    updateGraph();
+
     QTreeView::paintEvent(event);
 
     QPainter painter(viewport());
@@ -269,6 +260,8 @@ void FileDependencyGraphView::mousePressEvent(QMouseEvent* event)
         }
     }
 
+    updateGraph();
+
     int column = columnAt(event->x());
 
     // Check if the user pressed over the dependencies column.
@@ -442,6 +435,7 @@ void FileDependencyGraphView::mouseMoveEvent(QMouseEvent* event)
     else
     {
         QTreeView::mouseMoveEvent(event);
+        updateGraph();
 
         // Show dependency description as the tool tip when hovering over a dependency.
         FileDependency* hovered = findDependencyAt(event->pos());
@@ -624,22 +618,84 @@ bool FileDependencyGraphView::getVisualRowY(QModelIndex const& index, int& y) co
 }
 
 //-----------------------------------------------------------------------------
-// Function: FileDependencyGraphWidget::hasSpace()
+// Function: FileDependencyGraphView::findDependencyRange()
 //-----------------------------------------------------------------------------
-bool FileDependencyGraphView::hasSpace(GraphColumn const& column, GraphDependency const& dependency) const
+void FileDependencyGraphView::findDependencyRange(GraphColumn const& column, int top, int bottom,
+    int& first, int& last) const
 {
-    int minY = qMin(dependency.fromY, dependency.toY) - SAFE_MARGIN;
-    int maxY = qMax(dependency.fromY, dependency.toY) + SAFE_MARGIN;
+    // The dependencies in a column never overlap, so sorting them by the top coordinate also sorts
+    // them by the bottom coordinate. Binary search for the first one ending below the range top.
+    QList<GraphDependency> const& dependencies = column.dependencies;
 
-    foreach (GraphDependency const& dep, column.dependencies)
+    int low = 0;
+    int high = dependencies.size();
+    while (low < high)
     {
-        if (!(maxY < qMin(dep.fromY, dep.toY) || minY > qMax(dep.fromY, dep.toY)))
+        int middle = (low + high) / 2;
+        if (dependencies.at(middle).bottom() < top)
         {
-            return false;
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
         }
     }
 
-    return true;
+    first = low;
+
+    // Then search for the first one starting below the range bottom.
+    high = dependencies.size();
+    while (low < high)
+    {
+        int middle = (low + high) / 2;
+        if (dependencies.at(middle).top() <= bottom)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    last = low;
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyGraphView::placeDependency()
+//-----------------------------------------------------------------------------
+int FileDependencyGraphView::placeDependency(GraphDependency const& dependency)
+{
+    int columnIndex = columnAllocator_.allocate(dependency.top(), dependency.bottom());
+
+    while (columns_.size() <= columnIndex)
+    {
+        columns_.append(GraphColumn());
+    }
+
+    // Keep the column sorted by the top coordinate for the range queries.
+    int first = 0;
+    int position = 0;
+    findDependencyRange(columns_.at(columnIndex), dependency.top(), dependency.top(), first, position);
+    columns_[columnIndex].dependencies.insert(position, dependency);
+
+    dependencyColumns_.insert(dependency.dependency, columnIndex);
+    return columnIndex;
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyGraphView::getDependencyRect()
+//-----------------------------------------------------------------------------
+QRect FileDependencyGraphView::getDependencyRect(int columnIndex, GraphDependency const& dependency) const
+{
+    int x = columnViewportPosition(FILE_DEPENDENCY_COLUMN_DEPENDENCIES) + GRAPH_MARGIN +
+        (columnIndex - scrollIndex_) * GRAPH_SPACING;
+    int top = dependency.top() - verticalOffset();
+
+    return QRect(x - ARROW_WIDTH - SAFE_MARGIN, top - POINTER_OFFSET - SAFE_MARGIN,
+        2 * (ARROW_WIDTH + SAFE_MARGIN),
+        dependency.bottom() - dependency.top() + 2 * (POINTER_OFFSET + SAFE_MARGIN));
 }
 
 //-----------------------------------------------------------------------------
@@ -647,62 +703,66 @@ bool FileDependencyGraphView::hasSpace(GraphColumn const& column, GraphDependenc
 //-----------------------------------------------------------------------------
 void FileDependencyGraphView::drawDependencyGraph(QPainter& painter, QRect const& rect)
 {
-    //onSectionResized();
-
     int columnOffset = columnViewportPosition(FILE_DEPENDENCY_COLUMN_DEPENDENCIES);
     int width = columnWidth(FILE_DEPENDENCY_COLUMN_DEPENDENCIES);
+    int vOffset = verticalOffset();
     int x = GRAPH_MARGIN;
+
+    int lastVisibleColumn = qMin(columns_.size(), scrollIndex_ + maxVisibleGraphColumns_);
     
-    for (int i = scrollIndex_; i < qMin(columns_.size(), scrollIndex_ + maxVisibleGraphColumns_); ++i)
+    for (int i = scrollIndex_; i < lastVisibleColumn; ++i)
     {
+        // Cull columns that are not inside the view rectangle.
+        if (columnOffset + x + ARROW_WIDTH < rect.left() || columnOffset + x - ARROW_WIDTH > rect.right())
+        {
+            x += GRAPH_SPACING;
+            continue;
+        }
+
         GraphColumn const& column = columns_[i];
 
-        foreach (GraphDependency const& dep, column.dependencies)
+        // Draw only the arrows that intersect the view rectangle.
+        int first = 0;
+        int last = 0;
+        findDependencyRange(column, rect.top() + vOffset - POINTER_OFFSET, rect.bottom() + vOffset + POINTER_OFFSET,
+            first, last);
+
+        for (int j = first; j < last; ++j)
         {
-            int fromY = 0;
-            int toY = 0;
+            GraphDependency const& dep = column.dependencies.at(j);
             
-            if (getCoordinates(dep, fromY, toY) &&
-                ((filters_ & FILTER_DIFFERENCE) || dep.dependency->getStatus() != FileDependency::STATUS_REMOVED))
+            if ((filters_ & FILTER_DIFFERENCE) || dep.dependency->getStatus() != FileDependency::STATUS_REMOVED)
             {
-                // Cull arrows that are not inside the view rectangle.
-                QRect arrowRect(columnOffset + x - ARROW_WIDTH,
-                                qMin(fromY, toY) - POINTER_OFFSET,
-                                2 * ARROW_WIDTH,
-                                qAbs(toY - fromY) + 2 * POINTER_OFFSET);
+                // Choose color for the arrow based on the dependency information
+                // and the selected dependency.
+                QColor color = Qt::black;
 
-                if (arrowRect.intersects(rect))
+                if (dep.dependency == selectedDependency_)
                 {
-                    // Choose color for the arrow based on the dependency information
-                    // and the selected dependency.
-                    QColor color = Qt::black;
-
-                    if (dep.dependency == selectedDependency_)
-                    {
-                        color = Qt::blue;
-                    }
-                    else if (dep.dependency == hoveredDependency_)
-                    {
-                        color = QColor(0, 158, 255);
-                    }
-                    else if (dep.dependency->isManual())
+                    color = Qt::blue;
+                }
+                else if (dep.dependency == hoveredDependency_)
+                {
+                    color = QColor(0, 158, 255);
+                }
+                else if (dep.dependency->isManual())
+                {
+                    color = Qt::magenta;
+                }
+                else if (filters_ & FILTER_DIFFERENCE)
+                {
+                    if (dep.dependency->getStatus() == FileDependency::STATUS_ADDED)
                     {
-                        color = Qt::magenta;
+                        color = QColor(0, 222, 0);
                     }
-                    else if (filters_ & FILTER_DIFFERENCE)
+                    else if (dep.dependency->getStatus() == FileDependency::STATUS_REMOVED)
                     {
-                        if (dep.dependency->getStatus() == FileDependency::STATUS_ADDED)
-                        {
-                            color = QColor(0, 222, 0);
-                        }
-                        else if (dep.dependency->getStatus() == FileDependency::STATUS_REMOVED)
-                        {
-                            color = Qt::red;
-                        }
+                        color = Qt::red;
                     }
-
-                    drawArrow(painter, columnOffset + x, fromY, toY, color, dep.dependency->isBidirectional());
                 }
+
+                drawArrow(painter, columnOffset + x, dep.fromY - vOffset, dep.toY - vOffset, color,
+                    dep.dependency->isBidirectional());
             }
         }
 
@@ -714,46 +774,41 @@ void FileDependencyGraphView::drawDependencyGraph(QPainter& painter, QRect const
     painter.setRenderHint(QPainter::Antialiasing, false);
 
     // Left side coverage.
-    x = columnOffset + 2;
+    drawCoverage(painter, columnOffset + 2, 0, qMin(scrollIndex_, columns_.size()), rect);
 
-    for (int i = 0; i < scrollIndex_; ++i)
-    {
-        GraphColumn const& column = columns_[i];
+    // Right side coverage.
+    drawCoverage(painter, columnOffset + width - 2, scrollIndex_ + maxVisibleGraphColumns_, columns_.size(), rect);
 
-        foreach (GraphDependency const& dep, column.dependencies)
-        {
-            // Determine the y coordinates for the dependency.
-            int fromY = 0;
-            int toY = 0;
+    painter.setRenderHint(QPainter::Antialiasing);
+}
 
-            if (getCoordinates(dep, fromY, toY))
-            {
-                painter.drawLine(x, fromY, x, toY);
-            }
-        }
+//-----------------------------------------------------------------------------
+// Function: FileDependencyGraphView::drawCoverage()
+//-----------------------------------------------------------------------------
+void FileDependencyGraphView::drawCoverage(QPainter& painter, int x, int firstIndex, int lastIndex,
+    QRect const& rect)
+{
+    if (x < rect.left() - 2 || x > rect.right() + 2)
+    {
+        return;
     }
 
-    // Right side coverage.
-    x = columnOffset + width - 2;
+    int vOffset = verticalOffset();
 
-    for (int i = scrollIndex_ + maxVisibleGraphColumns_; i < columns_.size(); ++i)
+    for (int i = firstIndex; i < lastIndex; ++i)
     {
         GraphColumn const& column = columns_[i];
 
-        foreach (GraphDependency const& dep, column.dependencies)
-        {
-            // Determine the y coordinates for the dependency.
-            int fromY = 0;
-            int toY = 0;
+        int first = 0;
+        int last = 0;
+        findDependencyRange(column, rect.top() + vOffset, rect.bottom() + vOffset, first, last);
 
-            if (getCoordinates(dep, fromY, toY))
-            {
-                painter.drawLine(x, fromY, x, toY);
-            }
+        for (int j = first; j < last; ++j)
+        {
+            GraphDependency const& dep = column.dependencies.at(j);
+            painter.drawLine(x, dep.fromY - vOffset, x, dep.toY - vOffset);
         }
     }
-
-    painter.setRenderHint(QPainter::Antialiasing);
 }
 
 //-----------------------------------------------------------------------------
@@ -782,15 +837,90 @@ void FileDependencyGraphView::onDependenciesReset()
     selectedDependency_ = 0;
     emit selectionChanged(0);
 
+    rebuildGraph();
+
+    viewport()->repaint();
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyGraphView::onLayoutChanged()
+//-----------------------------------------------------------------------------
+void FileDependencyGraphView::onLayoutChanged()
+{
+    invalidateGraph();
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyGraphView::invalidateGraph()
+//-----------------------------------------------------------------------------
+void FileDependencyGraphView::invalidateGraph()
+{
+    graphDirty_ = true;
+    viewport()->update();
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyGraphView::updateGraph()
+//-----------------------------------------------------------------------------
+void FileDependencyGraphView::updateGraph()
+{
+    if (graphDirty_)
+    {
+        rebuildGraph();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: FileDependencyGraphView::rebuildGraph()
+//-----------------------------------------------------------------------------
+void FileDependencyGraphView::rebuildGraph()
+{
     columns_.clear();
-    emit graphColumnScollMaximumChanged(0);
+    dependencyColumns_.clear();
+    graphDirty_ = false;
 
-    foreach (QSharedPointer<FileDependency> dependency, model_->getDependencies())
+    QList<GraphDependency> graphDependencies;
+
+    if (model_ != 0)
     {
-        onDependencyAdded(dependency.data(), false);
+        foreach (QSharedPointer<FileDependency> dependency, model_->getDependencies())
+        {
+            GraphDependency graphDep(dependency.data(), 0, 0);
+            if (createGraphDependency(dependency.data(), graphDep))
+            {
+                graphDependencies.append(graphDep);
+            }
+        }
     }
 
-    viewport()->repaint();
+    // Lay out all dependencies in one top-down sweep. Since the dependencies are handled in
+    // top-down order, appending them keeps every column sorted.
+    qStableSort(graphDependencies);
+
+    QVector<FileDependencyColumnAllocator::Interval> intervals;
+    intervals.reserve(graphDependencies.size());
+
+    foreach (GraphDependency const& graphDep, graphDependencies)
+    {
+        intervals.append(FileDependencyColumnAllocator::Interval(graphDep.top(), graphDep.bottom()));
+    }
+
+    QVector<int> assignedColumns = columnAllocator_.allocateAll(intervals);
+
+    for (int i = 0; i < graphDependencies.size(); ++i)
+    {
+        int columnIndex = assignedColumns.at(i);
+
+        while (columns_.size() <= columnIndex)
+        {
+            columns_.append(GraphColumn());
+        }
+
+        columns_[columnIndex].dependencies.append(graphDependencies.at(i));
+        dependencyColumns_.insert(graphDependencies.at(i).dependency, columnIndex);
+    }
+
+    onSectionResized();
 }
 
 //-----------------------------------------------------------------------------
@@ -903,37 +1033,31 @@ void FileDependencyGraphView::onMenuDelete()
 //-----------------------------------------------------------------------------
 FileDependency* FileDependencyGraphView::findDependencyAt(QPoint const& pt) const
 {
-    int x = columnViewportPosition(FILE_DEPENDENCY_COLUMN_DEPENDENCIES) + GRAPH_MARGIN;
+    // Find the nearest graph column to the x coordinate.
+    int columnOffset = columnViewportPosition(FILE_DEPENDENCY_COLUMN_DEPENDENCIES) + GRAPH_MARGIN;
+    int columnIndex = scrollIndex_ + qRound(qreal(pt.x() - columnOffset) / GRAPH_SPACING);
 
-    for (int i = scrollIndex_; i < columns_.size(); ++i)
+    if (columnIndex < scrollIndex_ || columnIndex >= columns_.size())
     {
-        GraphColumn const& column = columns_[i];
-
-        // Check if the column contains the x coordinate.
-        if (qAbs(x - pt.x()) <= ARROW_WIDTH + SELECTION_MARGIN)
-        {
-            // Go through all dependencies in the column until we find a match.
-            foreach (GraphDependency const& dep, column.dependencies)
-            {
-                // Determine the y coordinates for the dependency.
-                int fromY = 0;
-                int toY = 0;
+        return 0;
+    }
 
-                if (getCoordinates(dep, fromY, toY))
-                {
-                    // Interval intersection test.
-                    if (pt.y() >= qMin(fromY, toY) - SELECTION_MARGIN &&
-                        pt.y() <= qMax(fromY, toY) + SELECTION_MARGIN)
-                    {
-                        return dep.dependency;
-                    }
-                }
-            }
+    // Check if the column contains the x coordinate.
+    int x = columnOffset + (columnIndex - scrollIndex_) * GRAPH_SPACING;
+    if (qAbs(x - pt.x()) > ARROW_WIDTH + SELECTION_MARGIN)
+    {
+        return 0;
+    }
 
-            break;
-        }
+    // Interval intersection test.
+    int y = pt.y() + verticalOffset();
+    int first = 0;
+    int last = 0;
+    findDependencyRange(columns_.at(columnIndex), y - SELECTION_MARGIN, y + SELECTION_MARGIN, first, last);
 
-        x += GRAPH_SPACING;
+    if (first < last)
+    {
+        return columns_.at(columnIndex).dependencies.at(first).dependency;
     }
 
     return 0;
@@ -942,10 +1066,10 @@ FileDependency* FileDependencyGraphView::findDependencyAt(QPoint const& pt) cons
 //-----------------------------------------------------------------------------
 // Function: FileDependencyGraphView::getCoordinates()
 //-----------------------------------------------------------------------------
-bool FileDependencyGraphView::getCoordinates(GraphDependency const &dep, int& fromY, int& toY) const
+bool FileDependencyGraphView::getCoordinates(FileDependency const* dependency, int& fromY, int& toY) const
 {
-    FileDependencyItem* fromItem = dep.dependency->getFileItem1();
-    FileDependencyItem* toItem = dep.dependency->getFileItem2();
+    FileDependencyItem* fromItem = dependency->getFileItem1();
+    FileDependencyItem* toItem = dependency->getFileItem2();
     Q_ASSERT(fromItem != 0);
     Q_ASSERT(toItem != 0);
 
@@ -1010,11 +1134,23 @@ void FileDependencyGraphView::rowsInserted(QModelIndex const& parent, int start,
 {
     QTreeView::rowsInserted(parent, start, end);
 
+    // The rows below the inserted ones have moved.
+    invalidateGraph();
+
     disconnect(this, SIGNAL(expanded(QModelIndex const&)), this, SLOT(onDependenciesReset()));
     setExpanded(parent, true);
     connect(this, SIGNAL(expanded(QModelIndex const&)), this, SLOT(onDependenciesReset()), Qt::UniqueConnection);
 }
 
+//-----------------------------------------------------------------------------
+// Function: FileDependencyGraphView::rowsAboutToBeRemoved()
+//-----------------------------------------------------------------------------
+void FileDependencyGraphView::rowsAboutToBeRemoved(QModelIndex const& parent, int start, int end)
+{
+    QTreeView::rowsAboutToBeRemoved(parent, start, end);
+    invalidateGraph();
+}
+
 //-----------------------------------------------------------------------------
 // Function: FileDependencyGraphView::reset()
 //-----------------------------------------------------------------------------
@@ -1024,6 +1160,7 @@ void FileDependencyGraphView::reset()
     emit selectionChanged(0);
 
     QTreeView::reset();
+    invalidateGraph();
 
     disconnect(this, SIGNAL(expanded(QModelIndex const&)), this, SLOT(onDependenciesReset()));
     expandAll();
@@ -1035,32 +1172,26 @@ void FileDependencyGraphView::reset()
 //-----------------------------------------------------------------------------
 void FileDependencyGraphView::repaintDependency(FileDependency const* dependency)
 {
-    // Repaint only the area of the dependency.
-    int x = GRAPH_MARGIN - scrollIndex_ * GRAPH_SPACING;
-
-    foreach (GraphColumn const& column, columns_)
+    // The whole graph is repainted when the layout is recalculated.
+    if (graphDirty_)
     {
-        foreach (GraphDependency const& dep, column.dependencies)
-        {
-            if (dep.dependency == dependency)
-            {
-                int columnOffset = columnViewportPosition(FILE_DEPENDENCY_COLUMN_DEPENDENCIES);
-                int fromY = 0;
-                int toY = 0;
+        return;
+    }
 
-                if (getCoordinates(dep, fromY, toY))
-                {
-                    viewport()->repaint(QRect(columnOffset + x - ARROW_WIDTH - SAFE_MARGIN,
-                        qMin(fromY, toY) - POINTER_OFFSET - SAFE_MARGIN,
-                        2 * (ARROW_WIDTH + SAFE_MARGIN),
-                        qAbs(toY - fromY) + 2 * (POINTER_OFFSET + SAFE_MARGIN)));
-                }
+    int columnIndex = dependencyColumns_.value(dependency, -1);
+    if (columnIndex < 0 || columnIndex >= columns_.size())
+    {
+        return;
+    }
 
-                break;
-            }
+    // Repaint only the area of the dependency.
+    foreach (GraphDependency const& dep, columns_.at(columnIndex).dependencies)
+    {
+        if (dep.dependency == dependency)
+        {
+            viewport()->repaint(getDependencyRect(columnIndex, dep));
+            break;
         }
-
-        x += GRAPH_SPACING;
     }
 }
 
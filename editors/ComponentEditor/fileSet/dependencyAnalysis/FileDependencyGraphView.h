@@ -12,8 +12,10 @@
 #ifndef FILEDEPENDENCYGRAPHVIEW_H
 #define FILEDEPENDENCYGRAPHVIEW_H
 
+#include <QHash>
 #include <QTreeView>
 
+#include "FileDependencyColumnAllocator.h"
 #include "FileDependencyItem.h"
 
 class FileDependency;
@@ -170,6 +172,15 @@ protected:
      */
     virtual void rowsInserted(QModelIndex const& parent, int start, int end);
 
+    /*!
+     *  Invalidates the graph layout when rows are about to be removed.
+     *
+     *      @param [in] parent The parent model index.
+     *      @param [in] start  The start index of the removed rows.
+     *      @param [in] end    The end index of the removed rows.
+     */
+    virtual void rowsAboutToBeRemoved(QModelIndex const& parent, int start, int end);
+
     virtual void reset();
 
 private slots:
@@ -198,6 +209,11 @@ private slots:
      */
     void onSectionResized();
 
+    /*!
+     *  Called when the row layout of the view has changed e.g. by sorting.
+     */
+    void onLayoutChanged();
+
     /*!
      *  Called when adding a location to external dependency.
      */
@@ -235,8 +251,8 @@ private:
     struct GraphDependency
     {
         FileDependency* dependency;
-        int fromY;
-        int toY;
+        int fromY;  //!< The "from" y coordinate in content coordinates i.e. without the scroll offset.
+        int toY;    //!< The "to" y coordinate in content coordinates i.e. without the scroll offset.
 
         /*!
          *  Constructor.
@@ -247,6 +263,15 @@ private:
               toY(toY)
         {
         }
+
+        //! Returns the topmost y coordinate of the dependency.
+        int top() const { return qMin(fromY, toY); }
+
+        //! Returns the bottommost y coordinate of the dependency.
+        int bottom() const { return qMax(fromY, toY); }
+
+        //! Orders the dependencies by their top coordinate.
+        bool operator<(GraphDependency const& other) const { return top() < other.top(); }
     };
     
     //-----------------------------------------------------------------------------
@@ -254,6 +279,7 @@ private:
     //-----------------------------------------------------------------------------
     struct GraphColumn
     {
+        //! The dependencies in the column, sorted by their top coordinate.
         QList<GraphDependency> dependencies;
         
         /*!
@@ -277,13 +303,79 @@ private:
     void drawDependencyGraph(QPainter& painter, QRect const& rect);
 
     /*!
-     *  Retrieves the final drawing coordinates and the items for the given dependency.
+     *  Draws the coverage lines of the dependencies in the given columns that are out of sight.
+     *
+     *      @param [in] painter     The drawing context.
+     *      @param [in] x           The x coordinate for the coverage lines.
+     *      @param [in] firstIndex  The index of the first column.
+     *      @param [in] lastIndex   The index of the last column, exclusive.
+     *      @param [in] rect        The currently visible drawing area.
+     */
+    void drawCoverage(QPainter& painter, int x, int firstIndex, int lastIndex, QRect const& rect);
+
+    /*!
+     *  Retrieves the final drawing coordinates for the given dependency.
+     *
+     *      @param [in]  dependency     The dependency.
+     *      @param [out] fromY          The resulted from y coordinate.
+     *      @param [out] toY            The resulted to y coordinate.
+     *
+     *      @return True, if the dependency is visible, otherwise false.
+     */
+    bool getCoordinates(FileDependency const* dependency, int& fromY, int& toY) const;
+
+    /*!
+     *  Finds the range of dependencies in a column that intersect the given vertical range.
+     *
+     *      @param [in]  column     The column to search.
+     *      @param [in]  top        The top of the range in content coordinates.
+     *      @param [in]  bottom     The bottom of the range in content coordinates.
+     *      @param [out] first      The index of the first intersecting dependency.
+     *      @param [out] last       The index after the last intersecting dependency.
+     */
+    void findDependencyRange(GraphColumn const& column, int top, int bottom, int& first, int& last) const;
+
+    /*!
+     *  Resolves the items and the graph coordinates for the given dependency.
+     *
+     *      @param [in]  dependency         The dependency.
+     *      @param [out] graphDependency    The dependency with its coordinates in the graph.
      *
-     *      @param [in]  dep    The dependency.
-     *      @param [out] fromY  The resulted from y coordinate.
-     *      @param [out] toY    The resulted to y coordinate.
+     *      @return True, if the dependency is shown in the graph, otherwise false.
      */
-    bool getCoordinates(GraphDependency const& dep, int& fromY, int& toY) const;
+    bool createGraphDependency(FileDependency* dependency, GraphDependency& graphDependency);
+
+    /*!
+     *  Places the given dependency in the first graph column that has space for it.
+     *
+     *      @param [in] dependency  The dependency to place.
+     *
+     *      @return The index of the column where the dependency was placed.
+     */
+    int placeDependency(GraphDependency const& dependency);
+
+    /*!
+     *  Returns the bounding rectangle for repainting a dependency in the given column.
+     *
+     *      @param [in] columnIndex     The index of the graph column.
+     *      @param [in] dependency      The dependency.
+     */
+    QRect getDependencyRect(int columnIndex, GraphDependency const& dependency) const;
+
+    /*!
+     *  Marks the graph layout to be recalculated before it is used next time.
+     */
+    void invalidateGraph();
+
+    /*!
+     *  Recalculates the graph layout, if it has been invalidated.
+     */
+    void updateGraph();
+
+    /*!
+     *  Recalculates the graph columns for all dependencies.
+     */
+    void rebuildGraph();
 
     /*!
      *  Draws the temporary manual dependency arrow when the user is creating a manual connection.
@@ -314,11 +406,6 @@ private:
      */
     bool getVisualRowY(QModelIndex const& index, int& y) const;
 
-    /*!
-     *  Checks whether the given column has space for the given dependency.
-     */
-    bool hasSpace(GraphColumn const& column, GraphDependency const& dependency) const;
-
     /*!
      *  Searches for a dependency at the given mouse coordinate.
      *
@@ -414,6 +501,15 @@ private:
     //! The graph columns.
     QList<GraphColumn> columns_;
 
+    //! Assigns the dependencies into the graph columns.
+    FileDependencyColumnAllocator columnAllocator_;
+
+    //! The graph column index of each placed dependency.
+    QHash<FileDependency const*, int> dependencyColumns_;
+
+    //! If true, the graph column layout must be recalculated before use.
+    bool graphDirty_;
+
     //! The number of graph columns that can be visible.
     int maxVisibleGraphColumns_;
 
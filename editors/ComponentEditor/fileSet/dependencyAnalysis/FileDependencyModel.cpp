@@ -753,11 +753,17 @@ void FileDependencyModel::analyze(FileDependencyItem* fileItem)
 
             QString file1 = fileItem->getPath();
 
+            // The analyzers find the dependencies from their cached directory listings, so the paths are
+            // only cleaned here instead of querying the file system again for every dependency.
+            QString sourceDirectory = QFileInfo(absPath).path();
+            QFileInfo baseInfo(basePath_);
+            QDir baseDirectory(baseInfo.isDir() ? baseInfo.absoluteFilePath() : baseInfo.absolutePath());
+
             // Go through all current dependencies.
             foreach (FileDependencyDesc const& desc, dependencyDescs)
             {
-                QString file2 = General::getRelativePath(basePath_,
-                    QFileInfo(QFileInfo(absPath).path() + "/" + desc.filename).canonicalFilePath());
+                QString file2 = baseDirectory.relativeFilePath(
+                    QDir::cleanPath(sourceDirectory + "/" + desc.filename));
 
                 // Retrieve the item pointers.
                 FileDependencyItem* fileItem1 = findFileItem(file1);
@@ -90,7 +90,7 @@ bool SingleMemoryMapEditor::isValid() const
     if (isMemoryMap())
     {
         memoryRemapIsValid =
-            parentMemoryMap_->isValid(component()->getChoices(), component()->getRemapStateNames());
+            parentMemoryMap_->isValid(component()->getChoices(), component()->getRemapStateNames().toSet());
     }
     else
     {
@@ -98,7 +98,7 @@ bool SingleMemoryMapEditor::isValid() const
         if (transformedMemoryRemap)
         {
             memoryRemapIsValid =
-                transformedMemoryRemap->isValid(component()->getChoices(), component()->getRemapStateNames());
+                transformedMemoryRemap->isValid(component()->getChoices(), component()->getRemapStateNames().toSet());
         }
     }
 
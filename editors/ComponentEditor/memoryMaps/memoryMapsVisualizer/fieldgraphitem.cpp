@@ -55,6 +55,7 @@ FieldGraphItem::~FieldGraphItem()
 void FieldGraphItem::refresh()
 {
     updateDisplay();
+    markChangedInParent();
     ExpandableItem::reorganizeChildren();
 }
 
@@ -95,6 +95,7 @@ void RegisterGraphItem::removeChild( MemoryVisualizationItem* childItem )
 
     Q_ASSERT(childItems_.contains(offset));
     childItems_.remove(offset, childItem);
+    forgetChild(childItem);
 }
 
 //-----------------------------------------------------------------------------
@@ -263,14 +263,14 @@ bool MemoryMapsModel::isValid() const
 {
 	foreach (QSharedPointer<MemoryMap> memMap, rootMemoryMaps_)
     {
-		if (!memMap->isValid(component_->getChoices(), component_->getRemapStateNames()))
+		if (!memMap->isValid(component_->getChoices(), component_->getRemapStateNames().toSet()))
         {
 			return false;
 		}
 
         foreach (QSharedPointer<MemoryRemap> memoryRemap, *memMap->getMemoryRemaps())
         {
-            if (memoryRemap->isValid(component_->getChoices(), component_->getRemapStateNames()))
+            if (memoryRemap->isValid(component_->getChoices(), component_->getRemapStateNames().toSet()))
             {
                 return false;
             }
@@ -676,7 +676,7 @@ QColor MemoryMapsModel::getForegroundColor(QModelIndex const& index) const
     {
         QSharedPointer<MemoryRemap> memoryRemap = getIndexedMemoryRemap(index.parent(), index.row());
         
-        if (!memoryRemap->isValid(component_->getChoices(), component_->getRemapStateNames()))
+        if (!memoryRemap->isValid(component_->getChoices(), component_->getRemapStateNames().toSet()))
         {
             return QColor("red");
         }
@@ -117,8 +117,8 @@ QVariant SWViewsModel::data( const QModelIndex& index, int role /*= Qt::DisplayR
 	}
 	else if (Qt::ForegroundRole == role) {
 
-		QStringList fileSetNames = component_->getFileSetNames();
-		QStringList cpuNames = component_->getCpuNames();
+		QSet<QString> fileSetNames = component_->getFileSetNames().toSet();
+		QSet<QString> cpuNames = component_->getCpuNames().toSet();
 
 		if (views_.at(index.row())->isValid(fileSetNames, cpuNames)) {
 			return QColor("black");
@@ -185,8 +185,8 @@ bool SWViewsModel::setData( const QModelIndex& index, const QVariant& value, int
 }
 
 bool SWViewsModel::isValid() const {
-	QStringList fileSetNames = component_->getFileSetNames();
-	QStringList cpuNames = component_->getCpuNames();
+	QSet<QString> fileSetNames = component_->getFileSetNames().toSet();
+	QSet<QString> cpuNames = component_->getCpuNames().toSet();
 
 	// check that each software view is valid
 	foreach (QSharedPointer<SWView> swView, views_) {
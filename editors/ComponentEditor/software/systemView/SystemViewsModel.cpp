@@ -114,8 +114,8 @@ QVariant SystemViewsModel::data( const QModelIndex& index, int role /*= Qt::Disp
 	}
 	else if (Qt::ForegroundRole == role) {
 
-		QStringList fileSetNames = component_->getFileSetNames();
-		QStringList viewNames = component_->getViewNames();
+		QSet<QString> fileSetNames = component_->getFileSetNames().toSet();
+		QSet<QString> viewNames = component_->getViewNames().toSet();
 
 		if (views_.at(index.row())->isValid(fileSetNames, viewNames)) {
 			return QColor("black");
@@ -183,8 +183,8 @@ bool SystemViewsModel::setData( const QModelIndex& index, const QVariant& value,
 
 bool SystemViewsModel::isValid() const {
 
-	QStringList fileSetNames = component_->getFileSetNames();
-	QStringList viewNames = component_->getViewNames();
+	QSet<QString> fileSetNames = component_->getFileSetNames().toSet();
+	QSet<QString> viewNames = component_->getViewNames().toSet();
 
 	// check that each software view is valid
 	foreach (QSharedPointer<SystemView> swView, views_) {
@@ -39,8 +39,8 @@ QString ComponentEditorSystemViewItem::text() const {
 
 bool ComponentEditorSystemViewItem::isValid() const {
 
-	QStringList fileSetNames = component_->getFileSetNames();
-	QStringList viewNames = component_->getViewNames();
+	QSet<QString> fileSetNames = component_->getFileSetNames().toSet();
+	QSet<QString> viewNames = component_->getViewNames().toSet();
 
 	// if system view is not valid
 	if (!systemView_->isValid(fileSetNames, viewNames)) {
@@ -101,7 +101,7 @@ bool MemoryRemapItem::isValid() const
     QSharedPointer<MemoryRemap> transformedMemoryRemap = memoryRemap_.dynamicCast<MemoryRemap>();
     if (transformedMemoryRemap)
     {
-        return transformedMemoryRemap->isValid(component_->getChoices(), component_->getRemapStateNames());
+        return transformedMemoryRemap->isValid(component_->getChoices(), component_->getRemapStateNames().toSet());
     }
 
     return memoryRemap_->isValid(component_->getChoices());
@@ -178,6 +178,20 @@ void MemoryRemapItem::createChild( int index )
 //-----------------------------------------------------------------------------
 ItemVisualizer* MemoryRemapItem::visualizer()
 {
+    // The visualizer is created when it is first shown.
+    if (!visualizer_)
+    {
+        if (memoryRemap_.dynamicCast<MemoryRemap>())
+        {
+            setVisualizer(new MemoryMapsVisualizer());
+        }
+        else if (parent() && parent()->parent())
+        {
+            // The default memory maps share the visualizer of the memory maps item.
+            parent()->parent()->visualizer();
+        }
+    }
+
     return visualizer_;
 }
 
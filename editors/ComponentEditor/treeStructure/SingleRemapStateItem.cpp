@@ -57,7 +57,7 @@ QString SingleRemapStateItem::text() const
 //-----------------------------------------------------------------------------
 bool SingleRemapStateItem::isValid() const
 {
-    return remapState_->isValid(component_->getPortNames());
+    return remapState_->isValid(component_->getPortNames().toSet());
 }
 
 //-----------------------------------------------------------------------------
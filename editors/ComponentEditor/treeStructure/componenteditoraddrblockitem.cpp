@@ -7,6 +7,7 @@
 
 #include "componenteditoraddrblockitem.h"
 #include "componenteditorregisteritem.h"
+#include "componenteditortreemodel.h"
 
 #include <editors/ComponentEditor/memoryMaps/SingleAddressBlockEditor.h>
 #include <editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/memorymapsvisualizer.h>
@@ -41,19 +42,8 @@ addressUnitBits_(0)
 
 	setObjectName(tr("ComponentEditorAddrBlockItem"));
 
-	foreach (QSharedPointer<RegisterModel> regModel, addrBlock->getRegisterData())
-    {
-		QSharedPointer<Register> reg = regModel.dynamicCast<Register>();
-		
-		// if the item was a register 
-		if (reg)
-        {
-			QSharedPointer<ComponentEditorRegisterItem> regItem(new ComponentEditorRegisterItem(reg, model,
-                libHandler, component, parameterFinder_, expressionFormatter_, referenceCounter_,
-                expressionParser_, this));
-			childItems_.append(regItem);
-		}
-	}
+	// The register items are created when the address block item is expanded.
+	deferChildItems();
 
 	Q_ASSERT(addrBlock_);
 }
@@ -89,6 +79,14 @@ bool ComponentEditorAddrBlockItem::isValid() const
 	return addrBlock_->isValid(component_->getChoices());
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::changesAffectOtherItems()
+//-----------------------------------------------------------------------------
+bool ComponentEditorAddrBlockItem::changesAffectOtherItems() const
+{
+    return false;
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorAddrBlockItem::editor()
 //-----------------------------------------------------------------------------
@@ -126,22 +124,55 @@ void ComponentEditorAddrBlockItem::createChild( int index )
 	QSharedPointer<Register> reg = regmodel.dynamicCast<Register>();
 	if (reg)
     {
-		QSharedPointer<ComponentEditorRegisterItem> regItem(new ComponentEditorRegisterItem(reg, model_,
-            libHandler_, component_, parameterFinder_, expressionFormatter_, referenceCounter_, 
-            expressionParser_, this));
-		regItem->setLocked(locked_);
-		
-		if (visualizer_)
-        {
-			regItem->setVisualizer(visualizer_);
-		}
+		createRegisterItem(reg, index);
 
         onGraphicsChanged();
-
-		childItems_.insert(index, regItem);
 	}
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::deferredChildCount()
+//-----------------------------------------------------------------------------
+int ComponentEditorAddrBlockItem::deferredChildCount() const
+{
+    int registerCount = 0;
+    foreach (QSharedPointer<RegisterModel> regModel, addrBlock_->getRegisterData())
+    {
+        if (regModel.dynamicCast<Register>())
+        {
+            registerCount++;
+        }
+    }
+
+    return registerCount;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::hasDeferredChildItems()
+//-----------------------------------------------------------------------------
+bool ComponentEditorAddrBlockItem::hasDeferredChildItems() const
+{
+    // Counting the registers would create the packed registers of the address block.
+    return addrBlock_->registerCount() > 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::createDeferredChildItems()
+//-----------------------------------------------------------------------------
+void ComponentEditorAddrBlockItem::createDeferredChildItems()
+{
+    foreach (QSharedPointer<RegisterModel> regModel, addrBlock_->getRegisterData())
+    {
+        QSharedPointer<Register> reg = regModel.dynamicCast<Register>();
+
+        // if the item was a register 
+        if (reg)
+        {
+            createRegisterItem(reg, childItems_.size());
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorAddrBlockItem::onEditorChanged()
 //-----------------------------------------------------------------------------
@@ -174,6 +205,12 @@ void ComponentEditorAddrBlockItem::onGraphicsChanged()
 //-----------------------------------------------------------------------------
 ItemVisualizer* ComponentEditorAddrBlockItem::visualizer()
 {
+    // The visualizer is created by the memory maps item when it is first needed.
+    if (!visualizer_ && parent())
+    {
+        parent()->visualizer();
+    }
+
 	return visualizer_;
 }
 
@@ -194,6 +231,10 @@ void ComponentEditorAddrBlockItem::setVisualizer( MemoryMapsVisualizer* visualiz
 
 	// register the addr block graph item for the parent
 	parentItem->addChild(graphItem_);
+
+    // The register items are created when the address block is expanded.
+    graphItem_->setPendingChildren(hasChildren());
+    connect(graphItem_, SIGNAL(childrenRequested()), this, SLOT(onRegisterGraphicsRequested()), Qt::UniqueConnection);
 	
 	// update the visualizers for register items
 	foreach (QSharedPointer<ComponentEditorItem> item, childItems_)
@@ -249,6 +290,41 @@ void ComponentEditorAddrBlockItem::removeGraphicsItem()
 	}
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::onRegisterGraphicsRequested()
+//-----------------------------------------------------------------------------
+void ComponentEditorAddrBlockItem::onRegisterGraphicsRequested()
+{
+    // The register items are needed for the graphics even if the tree item has not been expanded.
+    if (childItemsDeferred())
+    {
+        model_->fetchMore(model_->index(this));
+    }
+
+    foreach (QSharedPointer<ComponentEditorItem> item, childItems_)
+    {
+        item->updateGraphics();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::createRegisterItem()
+//-----------------------------------------------------------------------------
+void ComponentEditorAddrBlockItem::createRegisterItem(QSharedPointer<Register> reg, int index)
+{
+    QSharedPointer<ComponentEditorRegisterItem> regItem(new ComponentEditorRegisterItem(reg, model_,
+        libHandler_, component_, parameterFinder_, expressionFormatter_, referenceCounter_, 
+        expressionParser_, this));
+    regItem->setLocked(locked_);
+
+    if (visualizer_)
+    {
+        regItem->setVisualizer(visualizer_);
+    }
+
+    childItems_.insert(index, regItem);
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorAddrBlockItem::addressUnitBitsChanged()
 //-----------------------------------------------------------------------------
@@ -21,6 +21,7 @@
 #include <QSharedPointer>
 
 class MemoryMapsVisualizer;
+class Register;
 class AddressBlockGraphItem;
 class ExpressionParser;
 
@@ -76,6 +77,12 @@ public:
 	*/
 	virtual bool isValid() const;
 
+	/*! Tells if changes in the item may change the validity of items outside its own branch.
+	 *
+	 *      @return False, the other elements of the component do not refer to the item.
+	*/
+	virtual bool changesAffectOtherItems() const;
+
 	/*! Get pointer to the editor of this item.
 	 *
 	 *      @return The editor to use for this item.
@@ -89,6 +96,12 @@ public:
 	*/
 	virtual void createChild(int index);
 
+	/*! Get the number of register items created when the address block item is first expanded.
+	 *
+	 *      @return The number of registers in the address block.
+	*/
+	virtual int deferredChildCount() const;
+
 	/*! Get pointer to the visualizer of this item.
 	 * 
 	 * 
@@ -125,6 +138,19 @@ public:
      */
     void addressUnitBitsChanged(int newAddressUnitBits);
 
+protected:
+
+	/*! Tells if the address block has registers without an item.
+	 *
+	 *      @return True, if there are registers in the address block.
+	*/
+	virtual bool hasDeferredChildItems() const;
+
+	/*! Create the items for the registers of the address block.
+	 *
+	*/
+	virtual void createDeferredChildItems();
+
 protected slots:
 
 	/*! Handler for editor's contentChanged signal.
@@ -137,6 +163,11 @@ protected slots:
      */
     virtual void onGraphicsChanged();
 
+private slots:
+
+    //! Creates the graphics items of the registers when the address block item is first expanded.
+    void onRegisterGraphicsRequested();
+
 signals:
     void changeInAddressUnitBits(int newAddressUnitBits);
 
@@ -146,6 +177,13 @@ private:
 	ComponentEditorAddrBlockItem(const ComponentEditorAddrBlockItem& other);
 	ComponentEditorAddrBlockItem& operator=(const ComponentEditorAddrBlockItem& other);
 
+	/*! Create the item for a register.
+	 *
+	 *      @param [in] reg     The register to create the item for.
+	 *      @param [in] index   The index to add the item into.
+	*/
+	void createRegisterItem(QSharedPointer<Register> reg, int index);
+
 	//! The address block being edited.
 	QSharedPointer<AddressBlock> addrBlock_;
 
@@ -30,7 +30,7 @@ localMemMap_(addrSpace->getLocalMemoryMap()),
 items_(addrSpace->getLocalMemoryMap()->getItems()),
 graphItem_(NULL),
 localMemMapVisualizer_(new MemoryMapsVisualizer()),
-addrSpaceVisualizer_(new AddressSpaceVisualizer(addrSpace, expressionParser)),
+addrSpaceVisualizer_(NULL),
 expressionParser_(expressionParser)
 {
     setReferenceCounter(referenceCounter);
@@ -90,7 +90,7 @@ QString ComponentEditorAddrSpaceItem::text() const
 //-----------------------------------------------------------------------------
 bool ComponentEditorAddrSpaceItem::isValid() const
 {
-	return addrSpace_->isValid(component_->getChoices(), component_->getRemapStateNames());
+	return addrSpace_->isValid(component_->getChoices(), component_->getRemapStateNames().toSet());
 }
 
 //-----------------------------------------------------------------------------
@@ -185,6 +185,12 @@ void ComponentEditorAddrSpaceItem::removeGraphicsItem()
 //-----------------------------------------------------------------------------
 ItemVisualizer* ComponentEditorAddrSpaceItem::visualizer()
 {
+    // The visualizer is created when it is first shown.
+    if (!addrSpaceVisualizer_)
+    {
+        addrSpaceVisualizer_ = new AddressSpaceVisualizer(addrSpace_, expressionParser_);
+    }
+
 	return addrSpaceVisualizer_;
 }
 
@@ -193,5 +199,8 @@ ItemVisualizer* ComponentEditorAddrSpaceItem::visualizer()
 //-----------------------------------------------------------------------------
 void ComponentEditorAddrSpaceItem::onGraphicsChanged()
 {
-	addrSpaceVisualizer_->refresh();
+    if (addrSpaceVisualizer_)
+    {
+        addrSpaceVisualizer_->refresh();
+    }
 }
@@ -10,6 +10,8 @@
 #include <editors/ComponentEditor/busInterfaces/businterfaceeditor.h>
 #include <editors/ComponentEditor/common/ExpressionParser.h>
 
+#include "componenteditortreemodel.h"
+
 #include <IPXACTmodels/PortMap.h>
 
 ComponentEditorBusInterfaceItem::ComponentEditorBusInterfaceItem(QSharedPointer<BusInterface> busif,
@@ -41,8 +43,7 @@ QString ComponentEditorBusInterfaceItem::text() const {
 
 bool ComponentEditorBusInterfaceItem::isValid() const {
 	// check that the bus interface is valid
-	if (!busif_->isValid(component_->getPortBounds(), component_->getMemoryMapNames(), 
-        component_->getAddressSpaceNames(), component_->getChoices()))
+	if (!busif_->isValid(model_->getValidationContext(*component_), component_->getChoices()))
     {
 		return false;
 	}
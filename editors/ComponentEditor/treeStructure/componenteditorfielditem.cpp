@@ -78,6 +78,14 @@ bool ComponentEditorFieldItem::isValid() const
 	return field_->isValid(reg_->getSize(), component_->getChoices());
 }
 
+//-----------------------------------------------------------------------------
+// Function: componenteditorfielditem::changesAffectOtherItems()
+//-----------------------------------------------------------------------------
+bool ComponentEditorFieldItem::changesAffectOtherItems() const
+{
+    return false;
+}
+
 //-----------------------------------------------------------------------------
 // Function: componenteditorfielditem::editor()
 //-----------------------------------------------------------------------------
@@ -129,6 +137,12 @@ void ComponentEditorFieldItem::onEditorChanged()
 //-----------------------------------------------------------------------------
 ItemVisualizer* ComponentEditorFieldItem::visualizer()
 {
+    // The visualizer is created by the memory maps item when it is first needed.
+    if (!visualizer_ && parent())
+    {
+        parent()->visualizer();
+    }
+
 	return visualizer_;
 }
 
@@ -139,17 +153,7 @@ void ComponentEditorFieldItem::setVisualizer( MemoryMapsVisualizer* visualizer )
 {
 	visualizer_ = visualizer;
 
-	// get the graphics item for the memory map
-	MemoryVisualizationItem* parentItem = static_cast<MemoryVisualizationItem*>(parent()->getGraphicsItem());
-	Q_ASSERT(parentItem);
-
-	// create the graph item for the address block
-	graphItem_ = new FieldGraphItem(field_, expressionParser_, parentItem);
-
-	// register the addr block graph item for the parent
-	parentItem->addChild(graphItem_);
-
-	connect(graphItem_, SIGNAL(selectEditor()), this, SLOT(onSelectRequest()), Qt::UniqueConnection);
+    updateGraphics();
 }
 
 //-----------------------------------------------------------------------------
@@ -168,7 +172,22 @@ void ComponentEditorFieldItem::updateGraphics()
 	if (graphItem_)
     {
 		graphItem_->refresh();
+        return;
 	}
+
+    // get the graphics item for the register
+    MemoryVisualizationItem* parentItem = static_cast<MemoryVisualizationItem*>(parent()->getGraphicsItem());
+
+    // The graph item is created when the register item is expanded.
+    if (visualizer_ && parentItem && !parentItem->hasPendingChildren())
+    {
+        graphItem_ = new FieldGraphItem(field_, expressionParser_, parentItem);
+
+        // register the field graph item for the parent
+        parentItem->addChild(graphItem_);
+
+        connect(graphItem_, SIGNAL(selectEditor()), this, SLOT(onSelectRequest()), Qt::UniqueConnection);
+    }
 }
 
 //-----------------------------------------------------------------------------
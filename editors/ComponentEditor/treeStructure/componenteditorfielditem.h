@@ -77,6 +77,12 @@ public:
 	*/
 	virtual bool isValid() const;
 
+	/*! Tells if changes in the item may change the validity of items outside its own branch.
+	 *
+	 *       @return False, the other elements of the component do not refer to the item.
+	*/
+	virtual bool changesAffectOtherItems() const;
+
 	/*! Get the editor of this item.
 	 *
 	 *       @return The editor to use for this item.
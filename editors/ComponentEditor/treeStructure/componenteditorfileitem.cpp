@@ -65,16 +65,22 @@ QString ComponentEditorFileItem::text() const
 // Function: ComponentEditorFileItem::isValid()
 //-----------------------------------------------------------------------------
 bool ComponentEditorFileItem::isValid() const
+{
+    // get the path to the xml file
+    return isValidFile(file_, libHandler_->getPath(*component_->getVlnv()));
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorFileItem::isValidFile()
+//-----------------------------------------------------------------------------
+bool ComponentEditorFileItem::isValidFile(QSharedPointer<File> file, QString const& basePath)
 {
 	// if the file is not valid
-	if (!file_->isValid(true)) {
+	if (!file->isValid(true)) {
 		return false;
 	}
 
-	QString filePath = file_->getName();
-
-    // get the path to the xml file
-    QString basePath = libHandler_->getPath(*component_->getVlnv());
+	QString filePath = file->getName();
 
     QString absPath;
 
@@ -59,6 +59,15 @@ public:
 	*/
 	virtual bool isValid() const;
 
+	/*! \brief Check the validity of a file and that it exists in the file system.
+	 *
+	 * \param file The file to check.
+	 * \param basePath The path of the component's xml file the relative file paths start from.
+	 *
+	 * \return bool True if the file is valid.
+	*/
+	static bool isValidFile(QSharedPointer<File> file, QString const& basePath);
+
 	/*! \brief Get pointer to the editor of this item.
 	 *
 	 * \return Pointer to the editor to use for this item.
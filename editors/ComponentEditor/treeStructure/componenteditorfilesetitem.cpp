@@ -24,11 +24,8 @@ files_(fileSet->getFiles())
 {
 	Q_ASSERT(fileSet);
 
-    int childCount = files_.size();
-    for (int i = 0; i < childCount; i++)
-    {
-        createChild(i);
-    }
+    // The file items are created when the file set item is expanded.
+    deferChildItems();
 }
 
 //-----------------------------------------------------------------------------
@@ -69,9 +66,18 @@ bool ComponentEditorFileSetItem::isValid() const {
 	}
 
 	// check that all files are valid
-	foreach (QSharedPointer<ComponentEditorItem> childItem, childItems_) {
-		if (!childItem->isValid()) {
-			return false;
+	if (childItemsDeferred()) {
+		foreach (QSharedPointer<File> file, files_) {
+			if (!ComponentEditorFileItem::isValidFile(file, xmlPath)) {
+				return false;
+			}
+		}
+	}
+	else {
+		foreach (QSharedPointer<ComponentEditorItem> childItem, childItems_) {
+			if (!childItem->isValid()) {
+				return false;
+			}
 		}
 	}
 
@@ -125,6 +131,26 @@ void ComponentEditorFileSetItem::createChild(int index)
 	childItems_.insert(index, fileItem);
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorFileSetItem::deferredChildCount()
+//-----------------------------------------------------------------------------
+int ComponentEditorFileSetItem::deferredChildCount() const
+{
+    return files_.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorFileSetItem::createDeferredChildItems()
+//-----------------------------------------------------------------------------
+void ComponentEditorFileSetItem::createDeferredChildItems()
+{
+    int childCount = files_.size();
+    for (int i = 0; i < childCount; i++)
+    {
+        createChild(i);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorFileSetItem::onFileAdded()
 //-----------------------------------------------------------------------------
@@ -69,6 +69,12 @@ public:
 	*/
 	virtual void createChild(int index);
 
+	/*! \brief Get the number of file items created when the file set item is first expanded.
+	 *
+	 * \return The number of files in the file set.
+	*/
+	virtual int deferredChildCount() const;
+
     /*!
      *  Handles the addition of a file outside the editor.
      */
@@ -82,6 +88,13 @@ public:
 signals:
     void childRemoved(int index);
 
+protected:
+
+	/*! \brief Create the items for the files of the file set.
+	 *
+	*/
+	virtual void createDeferredChildItems();
+
 private:
 	//! \brief No copying
 	ComponentEditorFileSetItem(const ComponentEditorFileSetItem& other);
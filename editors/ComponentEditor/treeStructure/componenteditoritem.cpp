@@ -28,7 +28,10 @@ highlight_(false),
 referenceCounter_(0),
 parameterFinder_(0),
 expressionFormatter_(0),
-parent_(parent)
+parent_(parent),
+valid_(true),
+validityRevision_(-1),
+childItemsDeferred_(false)
 {
 
 	connect(this, SIGNAL(contentChanged(ComponentEditorItem*)),
@@ -73,7 +76,10 @@ childItems_(),
 editor_(NULL),
 locked_(true),
 highlight_(false),
-parent_(NULL) {
+parent_(NULL),
+valid_(true),
+validityRevision_(-1),
+childItemsDeferred_(false) {
 
 	connect(this, SIGNAL(contentChanged(ComponentEditorItem*)),
 		parent, SLOT(onContentChanged(ComponentEditorItem*)), Qt::UniqueConnection);
@@ -109,7 +115,67 @@ int ComponentEditorItem::rowCount() const {
 }
 
 bool ComponentEditorItem::hasChildren() const {
-	return !childItems_.isEmpty();
+	return !childItems_.isEmpty() || canFetchMore();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::canFetchMore()
+//-----------------------------------------------------------------------------
+bool ComponentEditorItem::canFetchMore() const
+{
+    return childItemsDeferred_ && hasDeferredChildItems();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::fetchMore()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::fetchMore()
+{
+    if (childItemsDeferred_)
+    {
+        childItemsDeferred_ = false;
+        createDeferredChildItems();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::childItemsDeferred()
+//-----------------------------------------------------------------------------
+bool ComponentEditorItem::childItemsDeferred() const
+{
+    return childItemsDeferred_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::deferredChildCount()
+//-----------------------------------------------------------------------------
+int ComponentEditorItem::deferredChildCount() const
+{
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::deferChildItems()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::deferChildItems()
+{
+    childItemsDeferred_ = true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::hasDeferredChildItems()
+//-----------------------------------------------------------------------------
+bool ComponentEditorItem::hasDeferredChildItems() const
+{
+    return deferredChildCount() > 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::createDeferredChildItems()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::createDeferredChildItems()
+{
+
 }
 
 QSharedPointer<ComponentEditorItem> ComponentEditorItem::child( const int index ) {
@@ -132,7 +198,7 @@ bool ComponentEditorItem::isValid() const {
 	
 	// if at least one child is not valid then this is not valid
 	foreach (QSharedPointer<ComponentEditorItem> childItem, childItems_) {
-		if (!childItem->isValid()) {
+		if (!childItem->isValidCached()) {
 			return false;
 		}
 	}
@@ -141,6 +207,55 @@ bool ComponentEditorItem::isValid() const {
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::isValidCached()
+//-----------------------------------------------------------------------------
+bool ComponentEditorItem::isValidCached() const
+{
+    int revision = model_->getValidityRevision();
+    if (validityRevision_ != revision)
+    {
+        valid_ = isValid();
+        validityRevision_ = revision;
+    }
+
+    return valid_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::invalidateValidity()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::invalidateValidity()
+{
+    invalidateSubItemValidity();
+
+    for (ComponentEditorItem* item = parent_; item != 0; item = item->parent_)
+    {
+        item->validityRevision_ = -1;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::invalidateSubItemValidity()
+//-----------------------------------------------------------------------------
+void ComponentEditorItem::invalidateSubItemValidity()
+{
+    validityRevision_ = -1;
+
+    foreach (QSharedPointer<ComponentEditorItem> childItem, childItems_)
+    {
+        childItem->invalidateSubItemValidity();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorItem::changesAffectOtherItems()
+//-----------------------------------------------------------------------------
+bool ComponentEditorItem::changesAffectOtherItems() const
+{
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorItem::setHighlight()
 //-----------------------------------------------------------------------------
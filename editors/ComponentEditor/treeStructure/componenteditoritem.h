@@ -87,10 +87,37 @@ public:
 
 	/*! \brief Returns true if item contains child items.
 	 *
-	 * \return True if child items exist.
+	 * \return True if child items exist or they can be created with fetchMore().
 	*/
 	bool hasChildren() const;
 
+	/*! \brief Tells if the item has child items that have not been created yet.
+	 *
+	 * \return True if the deferred child items can be created with fetchMore().
+	*/
+	bool canFetchMore() const;
+
+	/*! \brief Create the child items that have been deferred until they are needed.
+	 *
+	 * The model must be informed of the new rows, so this is called through
+	 * ComponentEditorTreeModel::fetchMore().
+	*/
+	void fetchMore();
+
+	/*! \brief Tells if the creation of the child items is still deferred.
+	 *
+	 * \return True if fetchMore() has not yet been called for an item that defers its children.
+	*/
+	bool childItemsDeferred() const;
+
+	/*! \brief Get the number of child items fetchMore() creates.
+	 *
+	 * The base class implementation returns 0. Reimplement together with createDeferredChildItems().
+	 *
+	 * \return The number of the deferred child items.
+	*/
+	virtual int deferredChildCount() const;
+
 	/*! \brief Get pointer to the child in given index.
 	 *
 	 * \param index The index identifying the child.
@@ -163,6 +190,30 @@ public:
 	*/
 	virtual bool isValid() const;
 
+	/*! \brief Get the validity of this item and sub items.
+	 *
+	 * The validity is checked with isValid() only if the item or the component has changed since
+	 * the last check.
+	 *
+	 * \return bool True if item is in valid state.
+	*/
+	bool isValidCached() const;
+
+	/*! \brief Invalidates the cached validity of this item, its sub items and its parent items.
+	 *
+	 * The sub items are invalidated because their validity may depend on the changed item.
+	*/
+	void invalidateValidity();
+
+	/*! \brief Tells if changes in the item may change the validity of items outside its own branch.
+	 *
+	 * The base class implementation returns true. Reimplement for elements that are not referred to
+	 * by the other elements of the component.
+	 *
+	 * \return True if the changes may affect the other items.
+	*/
+	virtual bool changesAffectOtherItems() const;
+
     virtual void setHighlight(bool highlight);
 
     virtual bool highlight() const;
@@ -360,6 +411,29 @@ protected:
      */
     void connectReferenceTree();
 
+	/*! \brief Defer the creation of the child items until the item is expanded or they are needed.
+	 *
+	 * Items with possibly thousands of children call this in their constructor instead of creating
+	 * the children.
+	*/
+	void deferChildItems();
+
+	/*! \brief Tells if there are deferred child items to create.
+	 *
+	 * This is called whenever the view checks if the item can be expanded, so reimplement with a
+	 * quick check if deferredChildCount() must go through the elements. The base class implementation
+	 * calls deferredChildCount().
+	 *
+	 * \return True if the item has deferred child items.
+	*/
+	virtual bool hasDeferredChildItems() const;
+
+	/*! \brief Create the deferred child items.
+	 *
+	 * The base class implementation does nothing. Exactly deferredChildCount() items must be created.
+	*/
+	virtual void createDeferredChildItems();
+
     //! \brief Pointer to the instance that manages the library.
 	LibraryInterface* libHandler_;
 
@@ -436,8 +510,22 @@ private:
 	//! \brief No assignment
 	ComponentEditorItem& operator=(const ComponentEditorItem& other);
 
+	/*! \brief Invalidates the cached validity of this item and all of its sub items.
+	 *
+	*/
+	void invalidateSubItemValidity();
+
 	//! \brief Pointer to the parent item.
 	ComponentEditorItem* parent_;
+
+	//! \brief The cached validity of the item and sub items.
+	mutable bool valid_;
+
+	//! \brief The model revision the cached validity was checked in or -1 if it has been invalidated.
+	mutable int validityRevision_;
+
+	//! \brief True if the creation of the child items is deferred until fetchMore() is called.
+	bool childItemsDeferred_;
 };
 
 #endif // COMPONENTEDITORITEM_H
@@ -59,9 +59,6 @@ expressionParser_(expressionParser)
             libHandler, component, referenceCounter, parameterFinder, expressionFormatter, expressionParser_, this));
         memoryRemapItem->setLocked(locked_);
 
-        MemoryMapsVisualizer* memoryRemapVisualizer = new MemoryMapsVisualizer();
-        memoryRemapItem->setVisualizer(memoryRemapVisualizer);
-
         childItems_.append(memoryRemapItem);
     }
 
@@ -91,7 +88,7 @@ bool ComponentEditorMemMapItem::isValid() const
 {
     bool isParentValid = ComponentEditorItem::isValid();
 
-    bool isMemoryMapValid = memoryMap_->isValid(component_->getChoices(), component_->getRemapStateNames());
+    bool isMemoryMapValid = memoryMap_->isValid(component_->getChoices(), component_->getRemapStateNames().toSet());
 
     return isParentValid && isMemoryMapValid;
 }
@@ -124,9 +121,6 @@ void ComponentEditorMemMapItem::createChild( int index )
         libHandler_, component_, referenceCounter_, parameterFinder_, expressionFormatter_, expressionParser_, this));
     memoryRemapItem->setLocked(locked_);
 
-    MemoryMapsVisualizer* memoryRemapVisualizer = new MemoryMapsVisualizer();
-    memoryRemapItem->setVisualizer(memoryRemapVisualizer);
-
     childItems_.append(memoryRemapItem);
 }
 
@@ -21,7 +21,7 @@ ComponentEditorMemMapsItem::ComponentEditorMemMapsItem( ComponentEditorTreeModel
 													   ComponentEditorItem* parent ):
 ComponentEditorItem(model, libHandler, component, parent),
 memoryMaps_(component->getMemoryMaps()),
-visualizer_(new MemoryMapsVisualizer()),
+visualizer_(NULL),
 expressionParser_(expressionParser)
 {
     setReferenceCounter(referenceCounter);
@@ -34,7 +34,6 @@ expressionParser_(expressionParser)
     {
 		QSharedPointer<ComponentEditorMemMapItem> memoryMapItem(new ComponentEditorMemMapItem(memoryMap, model,
             libHandler, component, referenceCounter_, parameterFinder_, expressionFormatter_, expressionParser_, this));
-		memoryMapItem->setVisualizer(visualizer_);
 		childItems_.append(memoryMapItem);
 
         connect(this, SIGNAL(memoryRemapAdded(int, QSharedPointer<MemoryMap>)),
@@ -121,6 +120,15 @@ void ComponentEditorMemMapsItem::createChild( int index )
 }
 
 ItemVisualizer* ComponentEditorMemMapsItem::visualizer() {
+	// the visualizer is created when it is first shown
+	if (!visualizer_) {
+		visualizer_ = new MemoryMapsVisualizer();
+
+		foreach (QSharedPointer<ComponentEditorItem> item, childItems_) {
+			item.staticCast<ComponentEditorMemMapItem>()->setVisualizer(visualizer_);
+		}
+	}
+
 	return visualizer_;
 }
 
@@ -11,6 +11,7 @@
 
 #include "componenteditorregisteritem.h"
 #include "componenteditorfielditem.h"
+#include "componenteditortreemodel.h"
 
 #include <editors/ComponentEditor/memoryMaps/SingleRegisterEditor.h>
 #include <editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/memorymapsvisualizer.h>
@@ -45,18 +46,8 @@ expressionParser_(expressionParser)
 
 	setObjectName(tr("ComponentEditorRegisterItem"));
 
-	foreach(QSharedPointer<Field> field, reg_->getFields())
-    {
-		if (field)
-        {
-			QSharedPointer<ComponentEditorFieldItem> fieldItem(new ComponentEditorFieldItem(
-				reg, field, model, libHandler, component, parameterFinder, referenceCounter, expressionParser_, 
-                this));
-			childItems_.append(fieldItem);
-
-            connect(fieldItem.data(), SIGNAL(graphicsChanged()), this, SLOT(onGraphicsChanged()), Qt::UniqueConnection);
-		}
-	}
+    // The field items are created when the register item is expanded.
+    deferChildItems();
 }
 
 //-----------------------------------------------------------------------------
@@ -91,6 +82,14 @@ bool ComponentEditorRegisterItem::isValid() const
 	return reg_->isValid(component_->getChoices());
 }
 
+//-----------------------------------------------------------------------------
+// Function: componenteditorregisteritem::changesAffectOtherItems()
+//-----------------------------------------------------------------------------
+bool ComponentEditorRegisterItem::changesAffectOtherItems() const
+{
+    return false;
+}
+
 //-----------------------------------------------------------------------------
 // Function: componenteditorregisteritem::editor()
 //-----------------------------------------------------------------------------
@@ -118,20 +117,38 @@ ItemEditor* ComponentEditorRegisterItem::editor()
 //-----------------------------------------------------------------------------
 void ComponentEditorRegisterItem::createChild( int index )
 {
-	QSharedPointer<ComponentEditorFieldItem> fieldItem(new ComponentEditorFieldItem(
-		reg_, reg_->getFields().at(index), model_, libHandler_, component_, parameterFinder_, 
-        referenceCounter_, expressionParser_, this));
-	fieldItem->setLocked(locked_);
-	
-	if (visualizer_)
-    {
-		fieldItem->setVisualizer(visualizer_);
-	}
+	createFieldItem(reg_->getFields().at(index), index);
+}
 
+//-----------------------------------------------------------------------------
+// Function: componenteditorregisteritem::deferredChildCount()
+//-----------------------------------------------------------------------------
+int ComponentEditorRegisterItem::deferredChildCount() const
+{
+    int fieldCount = 0;
+    foreach (QSharedPointer<Field> field, reg_->getFields())
+    {
+        if (field)
+        {
+            fieldCount++;
+        }
+    }
 
-    connect(fieldItem.data(), SIGNAL(graphicsChanged()), this, SLOT(onGraphicsChanged()), Qt::UniqueConnection);
+    return fieldCount;
+}
 
-	childItems_.insert(index, fieldItem);
+//-----------------------------------------------------------------------------
+// Function: componenteditorregisteritem::createDeferredChildItems()
+//-----------------------------------------------------------------------------
+void ComponentEditorRegisterItem::createDeferredChildItems()
+{
+    foreach (QSharedPointer<Field> field, reg_->getFields())
+    {
+        if (field)
+        {
+            createFieldItem(field, childItems_.size());
+        }
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -160,6 +177,12 @@ void ComponentEditorRegisterItem::onEditorChanged()
 //-----------------------------------------------------------------------------
 ItemVisualizer* ComponentEditorRegisterItem::visualizer()
 {
+    // The visualizer is created by the memory maps item when it is first needed.
+    if (!visualizer_ && parent())
+    {
+        parent()->visualizer();
+    }
+
 	return visualizer_;
 }
 
@@ -229,7 +252,12 @@ void ComponentEditorRegisterItem::removeGraphicsItem()
 {
     // get the graphics item for the address block.
     MemoryVisualizationItem* parentItem = static_cast<MemoryVisualizationItem*>(parent()->getGraphicsItem());
-    Q_ASSERT(parentItem);
+
+    // The address block has no graphics item before the visualizer is shown.
+    if (!parentItem)
+    {
+        return;
+    }
 
     foreach (RegisterGraphItem* registerDimension, registerDimensions_)
     {	
@@ -252,7 +280,8 @@ void ComponentEditorRegisterItem::resizeGraphicsToCurrentDimensionSize()
 {
     MemoryVisualizationItem* parentItem = static_cast<MemoryVisualizationItem*>(parent()->getGraphicsItem());
     
-    if(!parentItem)
+    // The dimensions are created when the address block is expanded.
+    if(!parentItem || parentItem->hasPendingChildren())
     {
         return;
     }
@@ -283,9 +312,34 @@ void ComponentEditorRegisterItem::createDimensionGraphicsItem(int dimensionIndex
     parentItem->addChild(newDimension);
     registerDimensions_.append(newDimension);
 
+    // The fields are visualized under the first dimension and created when it is expanded.
+    if (dimensionIndex == 0 && hasChildren())
+    {
+        newDimension->setPendingChildren(true);
+        connect(newDimension, SIGNAL(childrenRequested()), 
+            this, SLOT(onFieldGraphicsRequested()), Qt::UniqueConnection);
+    }
+
     connect(newDimension, SIGNAL(selectEditor()), this, SLOT(onSelectRequest()), Qt::UniqueConnection);
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorRegisterItem::onFieldGraphicsRequested()
+//-----------------------------------------------------------------------------
+void ComponentEditorRegisterItem::onFieldGraphicsRequested()
+{
+    // The field items are needed for the graphics even if the tree item has not been expanded.
+    if (childItemsDeferred())
+    {
+        model_->fetchMore(model_->index(this));
+    }
+
+    foreach (QSharedPointer<ComponentEditorItem> item, childItems_)
+    {
+        item->updateGraphics();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorRegisterItem::removeDimensionGraphicsItem()
 //-----------------------------------------------------------------------------
@@ -300,4 +354,24 @@ void ComponentEditorRegisterItem::removeDimensionGraphicsItem(int dimensionIndex
 
     delete removedDimension;
     removedDimension = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorRegisterItem::createFieldItem()
+//-----------------------------------------------------------------------------
+void ComponentEditorRegisterItem::createFieldItem(QSharedPointer<Field> field, int index)
+{
+	QSharedPointer<ComponentEditorFieldItem> fieldItem(new ComponentEditorFieldItem(
+		reg_, field, model_, libHandler_, component_, parameterFinder_, referenceCounter_, expressionParser_,
+        this));
+	fieldItem->setLocked(locked_);
+	
+	if (visualizer_)
+    {
+		fieldItem->setVisualizer(visualizer_);
+	}
+
+    connect(fieldItem.data(), SIGNAL(graphicsChanged()), this, SLOT(onGraphicsChanged()), Qt::UniqueConnection);
+
+	childItems_.insert(index, fieldItem);
 }
\ No newline at end of file
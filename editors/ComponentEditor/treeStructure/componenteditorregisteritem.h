@@ -83,6 +83,12 @@ public:
 	*/
 	virtual bool isValid() const;
 
+	/*! Tells if changes in the item may change the validity of items outside its own branch.
+	 *
+	 *      @return False, the other elements of the component do not refer to the item.
+	*/
+	virtual bool changesAffectOtherItems() const;
+
 	/*! Get pointer to the editor of this item.
 	 *
 	 *      @return Pointer to the editor to use for this item.
@@ -95,6 +101,12 @@ public:
 	*/
 	virtual void createChild(int index);
 
+	/*! Get the number of field items created when the register item is first expanded.
+	 *
+	 *      @return The number of fields in the register.
+	*/
+	virtual int deferredChildCount() const;
+
 	/*! Get pointer to the visualizer of this item.
 	 * 
 	 *      @return Pointer to the visualizer to use for this item.
@@ -117,6 +129,11 @@ public:
 	//! Remove the graphics item of the register.
 	virtual void removeGraphicsItem();
 
+protected:
+
+	//! Create the items for the fields of the register.
+	virtual void createDeferredChildItems();
+
 protected slots:
 
 	//! Handler for editor's contentChanged signal.
@@ -126,8 +143,11 @@ protected slots:
     virtual void updateGraphics();
 
     virtual void onGraphicsChanged();
-    
 
+private slots:
+
+    //! Creates the graphics items of the fields when the register item is first expanded.
+    void onFieldGraphicsRequested();
 
 private:
 	
@@ -135,6 +155,14 @@ private:
 	ComponentEditorRegisterItem(const ComponentEditorRegisterItem& other);
 	ComponentEditorRegisterItem& operator=(const ComponentEditorRegisterItem& other);
 
+    /*!
+     *  Creates the item for a field.
+     *
+     *      @param [in] field   The field to create the item for.
+     *      @param [in] index   The index to add the item into.
+     */
+    void createFieldItem(QSharedPointer<Field> field, int index);
+
     //! Updates the graphical items to match the current register dimension.
     void resizeGraphicsToCurrentDimensionSize();
 
@@ -35,8 +35,8 @@ QString ComponentEditorSWViewItem::text() const {
 
 bool ComponentEditorSWViewItem::isValid() const {
 
-	QStringList fileSetNames = component_->getFileSetNames();
-	QStringList cpuNames = component_->getCpuNames();
+	QSet<QString> fileSetNames = component_->getFileSetNames().toSet();
+	QSet<QString> cpuNames = component_->getCpuNames().toSet();
 
 	// if sw view is not valid
 	if (!swView_->isValid(fileSetNames, cpuNames)) {
@@ -9,6 +9,8 @@
 
 #include <common/KactusColors.h>
 
+#include <IPXACTmodels/validators/ComponentValidationContext.h>
+
 #include <QColor>
 #include <QIcon>
 
@@ -16,7 +18,10 @@
 
 ComponentEditorTreeModel::ComponentEditorTreeModel(QObject* parent)
     : QAbstractItemModel(parent),
-      rootItem_()
+      rootItem_(),
+      validityRevision_(0),
+      validationContext_(),
+      validationContextRevision_(-1)
 {
 	setObjectName(tr("ComponentEditorTreeModel"));
 }
@@ -29,6 +34,7 @@ void ComponentEditorTreeModel::setRootItem(QSharedPointer<ComponentEditorRootIte
 {
 	beginResetModel();
     rootItem_ = root;
+    invalidateValidity();
 	endResetModel();
 }
 
@@ -70,6 +76,48 @@ bool ComponentEditorTreeModel::hasChildren( const QModelIndex& parent /*= QModel
 	return parentItem->hasChildren();
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorTreeModel::canFetchMore()
+//-----------------------------------------------------------------------------
+bool ComponentEditorTreeModel::canFetchMore(const QModelIndex& parent) const
+{
+    if (!parent.isValid())
+    {
+        return false;
+    }
+
+    ComponentEditorItem* parentItem = static_cast<ComponentEditorItem*>(parent.internalPointer());
+    return parentItem->canFetchMore();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorTreeModel::fetchMore()
+//-----------------------------------------------------------------------------
+void ComponentEditorTreeModel::fetchMore(const QModelIndex& parent)
+{
+    if (!parent.isValid())
+    {
+        return;
+    }
+
+    ComponentEditorItem* parentItem = static_cast<ComponentEditorItem*>(parent.internalPointer());
+    if (!parentItem->childItemsDeferred())
+    {
+        return;
+    }
+
+    int childCount = parentItem->deferredChildCount();
+    if (childCount == 0)
+    {
+        parentItem->fetchMore();
+        return;
+    }
+
+    beginInsertRows(parent, parentItem->rowCount(), parentItem->rowCount() + childCount - 1);
+    parentItem->fetchMore();
+    endInsertRows();
+}
+
 int ComponentEditorTreeModel::columnCount( const QModelIndex&) const {
 	return 1;
 }
@@ -101,7 +149,7 @@ QVariant ComponentEditorTreeModel::data( const QModelIndex& index,
 	}
 	else if (role == Qt::ForegroundRole) {
         
-        if (!item->isValid())
+        if (!item->isValidCached())
         {
             return QColor("red");
         }         
@@ -136,6 +184,14 @@ Qt::ItemFlags ComponentEditorTreeModel::flags( const QModelIndex& index ) const
 }
 
 void ComponentEditorTreeModel::onContentChanged(ComponentEditorItem* item ) {
+	// Elements refer to each other by name, so most changes may change the validity of any item.
+	if (item->changesAffectOtherItems()) {
+		invalidateValidity();
+	}
+	else {
+		item->invalidateValidity();
+	}
+
 	QModelIndex index = ComponentEditorTreeModel::index(item);
 	emit dataChanged(index, index);
 }
@@ -212,6 +268,28 @@ QModelIndex ComponentEditorTreeModel::parent( const QModelIndex& index ) const {
 	return createIndex(row, 0, parent);
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorTreeModel::getValidityRevision()
+//-----------------------------------------------------------------------------
+int ComponentEditorTreeModel::getValidityRevision() const
+{
+    return validityRevision_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorTreeModel::getValidationContext()
+//-----------------------------------------------------------------------------
+ComponentValidationContext const& ComponentEditorTreeModel::getValidationContext(Component const& component) const
+{
+    if (!validationContext_ || validationContextRevision_ != validityRevision_)
+    {
+        validationContext_ = QSharedPointer<ComponentValidationContext>(new ComponentValidationContext(component));
+        validationContextRevision_ = validityRevision_;
+    }
+
+    return *validationContext_;
+}
+
 void ComponentEditorTreeModel::setLocked( bool locked ) {
 	rootItem_->setLocked(locked);
 }
@@ -223,8 +301,18 @@ void ComponentEditorTreeModel::addItem( ComponentEditorItem* parentItem, int chi
 	// find the index of the parent item
 	QModelIndex parentIndex = index(parentItem);
 
+	// the new child is created with the rest of the deferred children
+	if (parentItem->childItemsDeferred()) {
+		fetchMore(parentIndex);
+		parentItem->updateGraphics();
+		invalidateValidity();
+		emit expandItem(parentIndex);
+		return;
+	}
+
 	beginInsertRows(parentIndex, childIndex, childIndex);
 	parentItem->createChild(childIndex);
+	invalidateValidity();
 	endInsertRows();
 
 	emit expandItem(parentIndex);
@@ -237,8 +325,16 @@ void ComponentEditorTreeModel::removeItem( ComponentEditorItem* parentItem, int
 	// find the index of the parent item
 	QModelIndex parentIndex = index(parentItem);
 
+	// the removed child was never created
+	if (parentItem->childItemsDeferred()) {
+		invalidateValidity();
+		emit dataChanged(parentIndex, parentIndex);
+		return;
+	}
+
 	beginRemoveRows(parentIndex, childIndex, childIndex);
 	parentItem->removeChild(childIndex);
+	invalidateValidity();
 	endRemoveRows();
 }
 
@@ -247,8 +343,8 @@ void ComponentEditorTreeModel::moveItem( ComponentEditorItem* parentItem, int ch
 	Q_ASSERT(childSource >= 0);
 	Q_ASSERT(childtarget >= 0);
 
-	// if the location of the item does not change
-	if (childSource == childtarget) {
+	// if the location of the item does not change or the children have not been created
+	if (childSource == childtarget || parentItem->childItemsDeferred()) {
 		return;
 	}
 
@@ -285,3 +381,11 @@ void ComponentEditorTreeModel::onSelectItem( ComponentEditorItem* item ) {
 	QModelIndex itemIndex = index(item);
 	emit selectItem(itemIndex);
 }
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorTreeModel::invalidateValidity()
+//-----------------------------------------------------------------------------
+void ComponentEditorTreeModel::invalidateValidity()
+{
+    ++validityRevision_;
+}
@@ -15,6 +15,7 @@
 #include <QWidget>
 #include <QSharedPointer>
 
+class ComponentValidationContext;
 class LibraryInterface;
 class PluginManager;
 
@@ -61,6 +62,23 @@ public:
     */
     virtual bool hasChildren(const QModelIndex& parent = QModelIndex()) const;
 
+	/*! \brief Tells if the specified item has child items that have not been created yet.
+	 *
+	 * \param parent Model index of the item.
+	 *
+	 * \return True if the children of the item can be created with fetchMore().
+	*/
+	virtual bool canFetchMore(const QModelIndex& parent) const;
+
+	/*! \brief Create the deferred child items of the specified item.
+	 *
+	 * The view calls this when the item is expanded.
+	 *
+	 * \param parent Model index of the item.
+	 *
+	*/
+	virtual void fetchMore(const QModelIndex& parent);
+
 	/*! \brief Get the number of columns the item has to be displayed.
 	 *
 	 * \param parent Identifies the parent that's column count is requested.
@@ -113,6 +131,25 @@ public:
 	*/
 	virtual QModelIndex parent(const QModelIndex& index) const;
 
+	/*! \brief Get the revision of the tree contents for checking the cached validity of the items.
+	 *
+	 * The revision changes whenever the tree or the edited component changes so that the validity
+	 * of items outside the changed branch may change.
+	 *
+	 * \return The current revision.
+	*/
+	int getValidityRevision() const;
+
+	/*! \brief Get the names and ports of the edited component for checking the validity of the items.
+	 *
+	 * The context is collected once for each revision and shared by all the items.
+	 *
+	 * \param component The edited component.
+	 *
+	 * \return The validation context of the current revision.
+	*/
+	ComponentValidationContext const& getValidationContext(Component const& component) const;
+
 public slots:
 
 	/*! \brief Handler for component editor item's content changed signal.
@@ -218,8 +255,22 @@ private:
 	//! \brief No assignment
 	ComponentEditorTreeModel& operator=(const ComponentEditorTreeModel& other);
 
+	/*! \brief Invalidates the cached validity of all the items in the tree.
+	 *
+	*/
+	void invalidateValidity();
+
 	//! \brief Pointer to the root item of the tree.
 	QSharedPointer<ComponentEditorRootItem> rootItem_;
+
+	//! \brief The revision of the tree contents the cached validity of the items is checked against.
+	int validityRevision_;
+
+	//! \brief The validation context collected for the items.
+	mutable QSharedPointer<ComponentValidationContext> validationContext_;
+
+	//! \brief The revision the validation context was collected in.
+	mutable int validationContextRevision_;
 };
 
 #endif // COMPONENTEDITORTREEMODEL_H
@@ -50,7 +50,7 @@ QString ComponentEditorViewItem::text() const {
 //-----------------------------------------------------------------------------
 bool ComponentEditorViewItem::isValid() const {
 	// check that view is valid
-	if (!view_->isValid(component_->getFileSetNames(), component_->getChoices())) {
+	if (!view_->isValid(component_->getFileSetNames().toSet(), component_->getChoices())) {
 		return false;
 	}
 	// check that the reference can be found
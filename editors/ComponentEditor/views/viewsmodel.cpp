@@ -166,7 +166,7 @@ QVariant ViewsModel::data(QModelIndex const& index, int role) const
         {
             return QColor("gray");
         }
-		else if (view->isValid(component_->getFileSetNames(), component_->getChoices()))
+		else if (view->isValid(component_->getFileSetNames().toSet(), component_->getChoices()))
         {
 			return QColor("black");
 		}
@@ -236,7 +236,7 @@ bool ViewsModel::setData(QModelIndex const& index, const QVariant& value, int ro
 bool ViewsModel::isValid() const
 {
 	// file set names are needed to check that references within views are valid
-	QStringList fileSetNames = component_->getFileSetNames();
+	QSet<QString> fileSetNames = component_->getFileSetNames().toSet();
 
 	// if at least one view is invalid
 	foreach (QSharedPointer<View> view, views_)
@@ -14,8 +14,40 @@
 
 #include <common/KactusColors.h>
 
-#include <QRectF>
+#include <QPair>
 #include <QPen>
+#include <QRectF>
+#include <QtAlgorithms>
+
+namespace
+{
+    //! A child and its last address for ordering the children sharing an offset.
+    typedef QPair<quint64, MemoryVisualizationItem*> OrderedChild;
+
+    /*!
+     *  Orders the children so that the one with the bigger last address precedes the other.
+     */
+    bool compareLastAddresses(OrderedChild const& lhs, OrderedChild const& rhs)
+    {
+        return lhs.first > rhs.first;
+    }
+
+    //-----------------------------------------------------------------------------
+    //! The state of a child calculated in the update of the child map.
+    //-----------------------------------------------------------------------------
+    struct ChildLayout
+    {
+        MemoryVisualizationItem* item;
+        quint64 offset;
+        quint64 lastAddress;
+        bool present;
+        bool outOfBounds;
+        bool conflicted;
+        quint64 displayOffset;
+        quint64 displayLastAddress;
+        bool completeOverlap;
+    };
+}
 
 //-----------------------------------------------------------------------------
 // Function: MemoryVisualizationItem::MemoryVisualizationItem()
@@ -26,11 +58,20 @@ MemoryVisualizationItem::MemoryVisualizationItem(QGraphicsItem* parent)
       lastFreeAddress_(-1),
       childWidth_(VisualizerItem::DEFAULT_WIDTH),
       conflicted_(false),
-      overlapped_(false)
+      overlapped_(false),
+      childRanges_(),
+      changedChildren_(),
+      gaps_(),
+      layoutOffset_(0),
+      layoutAddressUnitSize_(0),
+      pendingChildren_(false),
+      creatingChildren_(false)
 {
     QPen pen(Qt::gray);
     setPen(pen);
     setExpansionPen(pen);
+
+    connect(this, SIGNAL(expandStateChanged()), this, SLOT(onExpandStateChanged()), Qt::UniqueConnection);
 }
 
 //-----------------------------------------------------------------------------
@@ -54,13 +95,21 @@ void MemoryVisualizationItem::setBrush(QBrush const& brush)
 //-----------------------------------------------------------------------------
 void MemoryVisualizationItem::addChild(MemoryVisualizationItem* childItem)
 {
-    childItems_.insertMulti(childItem->getOffset(), childItem);
+    quint64 offset = childItem->getOffset();
+
+    childItems_.insertMulti(offset, childItem);
+    childRanges_.insert(childItem, ChildRange(offset, offset));
+    changedChildren_.insert(childItem);
 
     childItem->setWidth(childWidth_);
     childItem->setVisible(isExpanded());
 
-    reorganizeChildren();
-    emit expandStateChanged();
+    // The requested children are organized once, after all of them have been added.
+    if (!creatingChildren_)
+    {
+        reorganizeChildren();
+        emit expandStateChanged();
+    }
 
     connect(childItem, SIGNAL(expandStateChanged()), this, SLOT(reorganizeChildren()), Qt::UniqueConnection);
     connect(childItem, SIGNAL(expandStateChanged()), this, SIGNAL(expandStateChanged()), Qt::UniqueConnection);
@@ -74,10 +123,12 @@ void MemoryVisualizationItem::addChild(MemoryVisualizationItem* childItem)
 //-----------------------------------------------------------------------------
 void MemoryVisualizationItem::removeChild(MemoryVisualizationItem* childItem)
 {
-    quint64 offset = childItem->getOffset();
+    // The child is stored with the offset of the previous update.
+    Q_ASSERT(childRanges_.contains(childItem));
+    quint64 offset = childRanges_.value(childItem).offset;
 
-    Q_ASSERT(childItems_.contains(offset));
     childItems_.remove(offset, childItem);
+    forgetChild(childItem);
 
     showExpandIconIfHasChildren();
 }
@@ -207,6 +258,9 @@ bool MemoryVisualizationItem::isConflicted() const
 //-----------------------------------------------------------------------------
 void MemoryVisualizationItem::reorganizeChildren()
 {
+    // The address range of this item may have changed, so the parent checks it on its next update.
+    markChangedInParent();
+
     showExpandIconIfHasChildren();
 
     if (mustRepositionChildren())
@@ -235,21 +289,46 @@ bool MemoryVisualizationItem::isPresent() const
 }
 
 //-----------------------------------------------------------------------------
-// Function: MemoryVisualizationItem::showExpandIconIfHasChildren()
+// Function: MemoryVisualizationItem::setPendingChildren()
 //-----------------------------------------------------------------------------
-void MemoryVisualizationItem::showExpandIconIfHasChildren()
+void MemoryVisualizationItem::setPendingChildren(bool pending)
 {
-    foreach (MemoryVisualizationItem* item, childItems_)
+    pendingChildren_ = pending;
+    showExpandIconIfHasChildren();
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryVisualizationItem::hasPendingChildren()
+//-----------------------------------------------------------------------------
+bool MemoryVisualizationItem::hasPendingChildren() const
+{
+    return pendingChildren_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryVisualizationItem::onExpandStateChanged()
+//-----------------------------------------------------------------------------
+void MemoryVisualizationItem::onExpandStateChanged()
+{
+    if (pendingChildren_ && isExpanded())
     {
-        MemoryGapItem* gap = dynamic_cast<MemoryGapItem*>(item);
-        if (!gap)
-        {
-            ExpandableItem::setShowExpandableItem(true);
-            return;
-        }
+        pendingChildren_ = false;
+
+        creatingChildren_ = true;
+        emit childrenRequested();
+        creatingChildren_ = false;
+
+        reorganizeChildren();
+        emit expandStateChanged();
     }
+}
 
-    ExpandableItem::setShowExpandableItem(false);
+//-----------------------------------------------------------------------------
+// Function: MemoryVisualizationItem::showExpandIconIfHasChildren()
+//-----------------------------------------------------------------------------
+void MemoryVisualizationItem::showExpandIconIfHasChildren()
+{
+    ExpandableItem::setShowExpandableItem(pendingChildren_ || !childRanges_.isEmpty());
 }
 
 //-----------------------------------------------------------------------------
@@ -257,108 +336,313 @@ void MemoryVisualizationItem::showExpandIconIfHasChildren()
 //-----------------------------------------------------------------------------
 void MemoryVisualizationItem::updateChildMap()
 {
-    QMap<quint64, MemoryVisualizationItem*> updatedMap;
+    quint64 offset = getOffset();
+    unsigned int addressUnitSize = getAddressUnitSize();
+
+    // The addresses of all the children depend on the offset and the addressable unit of this item.
+    if (offset != layoutOffset_ || addressUnitSize != layoutAddressUnitSize_)
+    {
+        layoutOffset_ = offset;
+        layoutAddressUnitSize_ = addressUnitSize;
+        changedChildren_ = childRanges_.keys().toSet();
+    }
 
-    foreach (MemoryVisualizationItem* item, childItems_)
+    // Query the address ranges of the changed children only and move them in the map if necessary.
+    QSet<quint64> changedOffsets;
+    foreach (MemoryVisualizationItem* child, changedChildren_)
     {
-        MemoryGapItem* gap = dynamic_cast<MemoryGapItem*>(item);
-        if (gap)
+        ChildRange& range = childRanges_[child];
+
+        quint64 childOffset = child->getOffset();
+        quint64 childLastAddress = child->getLastAddress();
+
+        if (childOffset != range.offset)
+        {
+            childItems_.remove(range.offset, child);
+            childItems_.insertMulti(childOffset, child);
+
+            changedOffsets.insert(range.offset);
+            changedOffsets.insert(childOffset);
+        }
+        else if (childLastAddress != range.lastAddress)
         {
-            childItems_.remove(gap->getOffset(), gap);
-            delete gap;
+            changedOffsets.insert(childOffset);
         }
+
+        range.offset = childOffset;
+        range.lastAddress = childLastAddress;
+        range.present = child->isPresent();
     }
 
+    foreach (quint64 changedOffset, changedOffsets)
+    {
+        sortChildrenAt(changedOffset);
+    }
+
+    QSet<MemoryVisualizationItem*> changedChildren = changedChildren_;
+    changedChildren_.clear();
+
+    // Find the gaps and the conflicts between the children using the stored address ranges.
     quint64 lastAvailableAddress = getLastAddress();
-    foreach (MemoryVisualizationItem* item, childItems_)
-    {       
-        item->updateDisplay();
-        item->setConflicted(item->getLastAddress() > lastAvailableAddress);
-        item->setVisible(isExpanded() && item->isPresent());
 
-        updatedMap.insertMulti(item->getOffset(), item);
-    }
+    QVector<ChildLayout> layouts;
+    layouts.reserve(childRanges_.size());
 
-    // Sort childs with same offset for stable order.
-    foreach(quint64 offset, updatedMap.uniqueKeys())
+    QVector<GapRange> gaps;
+
+    quint64 lastAddressInUse = offset;
+    int previous = -1;
+    int previousOverlap = -1;
+    quint64 previousLastAddress = lastAddressInUse;
+    for (QMultiMap<quint64, MemoryVisualizationItem*>::const_iterator i = childItems_.constBegin();
+        i != childItems_.constEnd(); ++i)
     {
-        if(updatedMap.count(offset) != 1)
+        QHash<MemoryVisualizationItem*, ChildRange>::const_iterator range = childRanges_.constFind(i.value());
+        if (range == childRanges_.constEnd())
+        {
+            continue;
+        }
+
+        bool firstChild = layouts.isEmpty();
+
+        ChildLayout layout;
+        layout.item = i.value();
+        layout.offset = range->offset;
+        layout.lastAddress = range->lastAddress;
+        layout.present = range->present;
+        layout.outOfBounds = range->lastAddress > lastAvailableAddress;
+        layout.conflicted = layout.outOfBounds;
+        layout.displayOffset = range->offset;
+        layout.displayLastAddress = range->lastAddress;
+        layout.completeOverlap = false;
+        layouts.append(layout);
+
+        if (!layout.present)
         {
-            QList<MemoryVisualizationItem*> childs = updatedMap.values(offset);
-            updatedMap.remove(offset);
+            continue;
+        }
 
-            qStableSort(childs.begin(), childs.end(), compareItems);
+        int current = layouts.size() - 1;
+        quint64 currentOffset = layout.offset;
+        quint64 currentLastAddress = layout.lastAddress;
+
+        if (firstChild && currentOffset > offset)
+        {
+            gaps.append(GapRange(offset, currentOffset - 1));
+        }  
+        else if (currentOffset > lastAddressInUse + 1)
+        {
+            gaps.append(GapRange(lastAddressInUse + 1, currentOffset - 1));
+        }
+        else if (previous != -1 && layouts.at(previous).lastAddress >= currentOffset)
+        {
+            layouts[current].conflicted = true;
+            layouts[previous].conflicted = true;
 
-            foreach(MemoryVisualizationItem* child, childs)
+            if (currentLastAddress > previousLastAddress)
             {
-                updatedMap.insertMulti(offset, child);
+                layouts[current].displayOffset = previousLastAddress + 1;
+                layouts[previous].displayLastAddress = qMin(previousLastAddress, currentOffset - 1);
+
+                // If previous block is completely overlapped by the preceding block and this block.
+                if (previousOverlap != -1 && gaps.at(previousOverlap).lastAddress + 1 >= currentOffset)
+                {
+                    layouts[previous].completeOverlap = true;
+                }
+
+                gaps.append(GapRange(currentOffset, previousLastAddress, true));
+                previousOverlap = gaps.size() - 1;
+            }
+            else
+            {
+                layouts[current].displayOffset = qMax(currentOffset, layouts.at(previous).displayOffset);
             }
         }
-    }
+        else if (previous != -1 && currentOffset <= lastAddressInUse)
+        {
+            layouts[current].conflicted = true;
+        }
 
-    childItems_ = updatedMap;
+        lastAddressInUse = qMax(currentLastAddress, lastAddressInUse);
 
-    quint64 lastAddressInUse = getOffset();
+        previous = current;
+        previousLastAddress = currentLastAddress;
+    }
 
-    MemoryGapItem* previousOverlap = 0;
-    MemoryVisualizationItem* previous = 0;
-    quint64 previousLastAddress = lastAddressInUse;
-    foreach (MemoryVisualizationItem* current, childItems_)
+    // Fill in any addresses left between children and the end of this item.
+    if (!layouts.isEmpty() && lastAvailableAddress > lastAddressInUse)
     {
-        if (current->isPresent())
+        gaps.append(GapRange(lastAddressInUse + 1, lastAvailableAddress));
+    }
+
+    // Update only the children whose state differs from the calculated one.
+    foreach (ChildLayout const& layout, layouts)
+    {
+        MemoryVisualizationItem* item = layout.item;
+
+        if (changedChildren.contains(item) || layout.completeOverlap || item->isCompletelyOverlapped() ||
+            item->isConflicted() != layout.conflicted ||
+            item->getDisplayOffset() != layout.displayOffset ||
+            item->getDisplayLastAddress() != layout.displayLastAddress)
         {
-            quint64 currentOffset = current->getOffset();
-            quint64 currentLastAddress = current->getLastAddress();
-            if (emptySpaceBeforeFirstChild(current))
+            item->updateDisplay();
+            item->setConflicted(layout.outOfBounds);
+
+            if (layout.conflicted)
+            {
+                item->setConflicted(true);
+            }
+            if (item->getDisplayOffset() != layout.displayOffset)
             {
-                createMemoryGap(getOffset(), currentOffset - 1);
-            }  
-            else if (emptySpaceBeforeChild(current, lastAddressInUse))
+                item->setDisplayOffset(layout.displayOffset);
+            }
+            if (item->getDisplayLastAddress() != layout.displayLastAddress)
             {
-                createMemoryGap(lastAddressInUse + 1, currentOffset - 1);
+                item->setDisplayLastAddress(layout.displayLastAddress);
             }
-            else if (childrenOverlap(current, previous))
+            if (layout.completeOverlap)
             {
-                current->setConflicted(true);
-                previous->setConflicted(true);
+                item->setCompleteOverlap();
+            }
+        }
 
-                if (currentLastAddress > previousLastAddress)
-                {
-                    current->setDisplayOffset(previousLastAddress + 1);
+        item->setVisible(isExpanded() && layout.present);
+    }
 
-                    previous->setDisplayLastAddress(qMin(previousLastAddress, currentOffset - 1));
+    updateGaps(gaps);
+}
 
-                    // If previous block is completely overlapped by the preceding block and this block.
-                    if (previousOverlap && previousOverlap->getLastAddress() + 1 >= currentOffset)
-                    {
-                        previous->setCompleteOverlap();
-                    }
+//-----------------------------------------------------------------------------
+// Function: MemoryVisualizationItem::forgetChild()
+//-----------------------------------------------------------------------------
+void MemoryVisualizationItem::forgetChild(MemoryVisualizationItem* childItem)
+{
+    childRanges_.remove(childItem);
+    changedChildren_.remove(childItem);
+}
 
-                    previousOverlap = createConflictItem(currentOffset, previousLastAddress);
-                }
-                else
-                {
-                    quint64 nonOverlappingOffset = qMax(currentOffset, previous->getDisplayOffset());
-                    current->setDisplayOffset(nonOverlappingOffset);
-                }
-            }
-            else if (previous && currentOffset <= lastAddressInUse)
+//-----------------------------------------------------------------------------
+// Function: MemoryVisualizationItem::markChangedInParent()
+//-----------------------------------------------------------------------------
+void MemoryVisualizationItem::markChangedInParent()
+{
+    MemoryVisualizationItem* parent = dynamic_cast<MemoryVisualizationItem*>(parentItem());
+    if (parent)
+    {
+        parent->markChildChanged(this);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryVisualizationItem::markChildChanged()
+//-----------------------------------------------------------------------------
+void MemoryVisualizationItem::markChildChanged(MemoryVisualizationItem* childItem)
+{
+    if (childRanges_.contains(childItem))
+    {
+        changedChildren_.insert(childItem);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryVisualizationItem::sortChildrenAt()
+//-----------------------------------------------------------------------------
+void MemoryVisualizationItem::sortChildrenAt(quint64 offset)
+{
+    QList<MemoryVisualizationItem*> children = childItems_.values(offset);
+    if (children.size() < 2)
+    {
+        return;
+    }
+
+    QList<OrderedChild> items;
+    QList<OrderedChild> gaps;
+    foreach (MemoryVisualizationItem* child, children)
+    {
+        QHash<MemoryVisualizationItem*, ChildRange>::const_iterator range = childRanges_.constFind(child);
+        if (range != childRanges_.constEnd())
+        {
+            items.append(OrderedChild(range->lastAddress, child));
+        }
+        else
+        {
+            gaps.append(OrderedChild(child->getLastAddress(), child));
+        }
+    }
+
+    // Sort childs with same offset for stable order. The gaps are inserted last as in a full update.
+    qStableSort(items.begin(), items.end(), compareLastAddresses);
+    qStableSort(gaps.begin(), gaps.end(), compareLastAddresses);
+
+    childItems_.remove(offset);
+    foreach (OrderedChild const& child, items + gaps)
+    {
+        childItems_.insertMulti(offset, child.second);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryVisualizationItem::updateGaps()
+//-----------------------------------------------------------------------------
+void MemoryVisualizationItem::updateGaps(QVector<GapRange> const& gaps)
+{
+    QMultiHash<quint64, MemoryGapItem*> unusedGaps;
+    foreach (MemoryGapItem* gap, gaps_)
+    {
+        unusedGaps.insert(gap->getOffset(), gap);
+    }
+
+    QList<MemoryGapItem*> updatedGaps;
+    QSet<quint64> changedOffsets;
+
+    foreach (GapRange const& range, gaps)
+    {
+        MemoryGapItem* gap = 0;
+
+        QMultiHash<quint64, MemoryGapItem*>::iterator existing = unusedGaps.find(range.offset);
+        while (existing != unusedGaps.end() && existing.key() == range.offset)
+        {
+            if (existing.value()->getLastAddress() == range.lastAddress &&
+                existing.value()->isConflicted() == range.conflicted)
             {
-                current->setConflicted(true);
+                gap = existing.value();
+                unusedGaps.erase(existing);
+                break;
             }
 
+            ++existing;
+        }
 
-            lastAddressInUse = qMax(currentLastAddress, lastAddressInUse);
+        if (gap == 0)
+        {
+            if (range.conflicted)
+            {
+                gap = createConflictItem(range.offset, range.lastAddress);
+            }
+            else
+            {
+                gap = createMemoryGap(range.offset, range.lastAddress);
+            }
 
-            previous = current;
-            previousLastAddress = currentLastAddress;
+            changedOffsets.insert(range.offset);
         }
+
+        gap->setVisible(isExpanded());
+        updatedGaps.append(gap);
     }
 
-    // Fill in any addresses left between children and the end of this item.
-    if (!childItems_.isEmpty() && getLastAddress() > lastAddressInUse)
+    foreach (MemoryGapItem* gap, unusedGaps)
     {
-        createMemoryGap(lastAddressInUse + 1, getLastAddress());
+        childItems_.remove(gap->getOffset(), gap);
+        changedOffsets.insert(gap->getOffset());
+        delete gap;
+    }
+
+    gaps_ = updatedGaps;
+
+    foreach (quint64 changedOffset, changedOffsets)
+    {
+        sortChildrenAt(changedOffset);
     }
 }
 
@@ -392,11 +676,10 @@ void MemoryVisualizationItem::repositionChildren()
 //-----------------------------------------------------------------------------
 void MemoryVisualizationItem::recursiveRefresh()
 {
-    // Note: Refreshing children may change memory gap items, foreach for childItems_ will not work.
-    int childCount = childItems_.count();
-    for (int i = 0; i < childCount; i++)
+    // Note: Refreshing children may change memory gap items, so only the actual children are refreshed.
+    foreach (MemoryVisualizationItem* child, childRanges_.keys())
     {
-        childItems_.values().at(i)->recursiveRefresh();
+        child->recursiveRefresh();
     }
 
     refresh();
@@ -464,28 +747,6 @@ void MemoryVisualizationItem::setLeftBottomCorner(quint64 address)
     VisualizerItem::setLeftBottomCorner(toHexString(address));
 }
 //-----------------------------------------------------------------------------
-// Function: MemoryVisualizationItem::emptySpaceBeforeFirstChild()
-//-----------------------------------------------------------------------------
-bool MemoryVisualizationItem::emptySpaceBeforeFirstChild(MemoryVisualizationItem* current) const
-{
-    return current == childItems_.first() && current->getOffset() > getOffset(); 
-}
-
-//-----------------------------------------------------------------------------
-// Function: MemoryVisualizationItem::emptySpaceBeforeChild()
-//-----------------------------------------------------------------------------
-bool MemoryVisualizationItem::emptySpaceBeforeChild(MemoryVisualizationItem* current, quint64 lastAddressInUse) const
-{
-    return current->getOffset() > lastAddressInUse + 1;
-}
-//-----------------------------------------------------------------------------
-// Function: MemoryVisualizationItem::childrenOverlap()
-//-----------------------------------------------------------------------------
-bool MemoryVisualizationItem::childrenOverlap(MemoryVisualizationItem* current, MemoryVisualizationItem* previous) const
-{
-    return previous && previous->getLastAddress() >= current->getOffset();
-}
-//-----------------------------------------------------------------------------
 // Function: MemoryVisualizationItem::createConflictItem()
 //-----------------------------------------------------------------------------
 MemoryGapItem* MemoryVisualizationItem::createConflictItem(qint64 offset, qint64 lastAddress)
@@ -517,15 +778,6 @@ MemoryGapItem* MemoryVisualizationItem::createMemoryGap(quint64 offset, quint64
     return gap;
 }
 
-//-----------------------------------------------------------------------------
-// Function: MemoryVisualizationItem::compareItems()
-//-----------------------------------------------------------------------------
-bool MemoryVisualizationItem::compareItems(const MemoryVisualizationItem* s1, const MemoryVisualizationItem* s2)
-{
-    // Item with bigger last address precedes the other.
-    return s1->getLastAddress() > s2->getLastAddress();
-}
-
 //-----------------------------------------------------------------------------
 // Function: MemoryVisualizationItem::groupByFourDigits()
 //-----------------------------------------------------------------------------
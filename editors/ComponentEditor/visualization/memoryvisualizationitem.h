@@ -15,7 +15,11 @@
 #include <common/graphicsItems/expandableitem.h>
 #include <common/graphicsItems/graphicsexpandcollapseitem.h>
 
+#include <QHash>
+#include <QList>
 #include <QMultiMap>
+#include <QSet>
+#include <QVector>
 #include <QGraphicsSceneMouseEvent>
 
 class MemoryGapItem;
@@ -164,6 +168,23 @@ public:
      */
     virtual bool isPresent() const;
 
+    /*!
+     *  Sets the item to have child items that have not been created yet.
+     *
+     *  An item with pending children shows the expand icon and emits childrenRequested() when it is
+     *  expanded for the first time.
+     *
+     *      @param [in] pending     True, if the children are created later, otherwise false.
+     */
+    void setPendingChildren(bool pending);
+
+    /*!
+     *  Checks if the item has child items that have not been created yet.
+     *
+     *      @return True, if the children are created when the item is expanded, otherwise false.
+     */
+    bool hasPendingChildren() const;
+
 public slots:
 
     //! Refresh the item and all the sub items.
@@ -174,6 +195,12 @@ signals:
 	//! Emitted when this item's editor should be displayed.
 	void selectEditor();
 
+    /*!
+     *  Emitted when an item with pending children is expanded. The children added while handling the
+     *  signal are organized once after all of them have been added.
+     */
+    void childrenRequested();
+
 protected slots:
 
     
@@ -182,13 +209,36 @@ protected slots:
      */
     virtual void repositionChildren();
 
+private slots:
+
+    //! Requests the pending children, if the item has been expanded.
+    void onExpandStateChanged();
+
 protected:
    
     //! Shows the expand/collapse icon if the item has any children. Otherwise the icon is hidden.
     void showExpandIconIfHasChildren();
 
-    //! Update the offsets of the child items in the map and fills the empty gaps between them..
+    /*!
+     *  Update the offsets of the child items in the map and fills the empty gaps between them.
+     *
+     *  Only the children whose address range may have changed are queried and only the children and
+     *  the gaps whose state differs from the previous update are modified.
+     */
     virtual void updateChildMap();
+
+    /*!
+     *  Removes the given child from the bookkeeping of the child address ranges.
+     *
+     *      @param [in] childItem   The removed child.
+     */
+    void forgetChild(MemoryVisualizationItem* childItem);
+
+    /*!
+     *  Marks this item changed in the parent item, so that the parent queries the address range of this
+     *  item on its next update.
+     */
+    void markChangedInParent();
         
     /*!
      *  Checks if the children must be repositioned inside this item.
@@ -255,34 +305,56 @@ private:
 	MemoryVisualizationItem(const MemoryVisualizationItem& other);
 	MemoryVisualizationItem& operator=(const MemoryVisualizationItem& other);
 
+    //-----------------------------------------------------------------------------
+    //! The address range of a child item at the previous update of the child map.
+    //-----------------------------------------------------------------------------
+    struct ChildRange
+    {
+        quint64 offset;         //!< The first address of the child.
+        quint64 lastAddress;    //!< The last address of the child.
+        bool present;           //!< True, if the child is used in the visualization.
+
+        ChildRange(quint64 firstAddress = 0, quint64 last = 0, bool isPresent = true):
+        offset(firstAddress), lastAddress(last), present(isPresent)
+        {
+        }
+    };
+
+    //-----------------------------------------------------------------------------
+    //! An empty or overlapping memory slot between the children.
+    //-----------------------------------------------------------------------------
+    struct GapRange
+    {
+        quint64 offset;         //!< The first address of the slot.
+        quint64 lastAddress;    //!< The last address of the slot.
+        bool conflicted;        //!< True, if the slot is overlapped by several children.
+
+        GapRange(quint64 firstAddress = 0, quint64 last = 0, bool isConflicted = false):
+        offset(firstAddress), lastAddress(last), conflicted(isConflicted)
+        {
+        }
+    };
+
     /*!
-     *  Checks if there is empty memory space between the beginning of the item and its first child.
-     *
-     *      @param [in] current   The currently iterated child.
+     *  Marks the address range of the given child to be checked on the next update of the child map.
      *
-     *      @return True, if there is empty space, otherwise false.
+     *      @param [in] childItem   The child that may have changed.
      */
-    bool emptySpaceBeforeFirstChild(MemoryVisualizationItem* current) const;
-    
+    void markChildChanged(MemoryVisualizationItem* childItem);
+
     /*!
-     *  Checks if there is empty memory space between the given child and the last known used address.
-     *
-     *      @param [in] current             The currently iterated child.
-     *      @param [in] lastAddressInUse    The last known used address.
+     *  Restores the order of the children sharing the given offset in the child map.
      *
-     *      @return True, if there is empty space, otherwise false.
+     *      @param [in] offset  The offset of the children to order.
      */
-    bool emptySpaceBeforeChild(MemoryVisualizationItem* current, quint64 lastAddressInUse) const;
+    void sortChildrenAt(quint64 offset);
 
     /*!
-     *  Checks if the two consecutive children overlap.
-     *
-     *      @param [in] current     The currently iterated child.
-     *      @param [in] previous    The previously iterated child.
+     *  Replaces the gap and conflict items with the given slots, reusing the items that did not change.
      *
-     *      @return True, if the children overlap, otherwise false.
+     *      @param [in] gaps    The empty and overlapping memory slots between the children.
      */
-    bool childrenOverlap(MemoryVisualizationItem* current, MemoryVisualizationItem* previous) const;
+    void updateGaps(QVector<GapRange> const& gaps);
 
     /*!
      *  Creates a new child for representing a free memory slot.
@@ -304,9 +376,6 @@ private:
      */
     MemoryGapItem* createConflictItem(qint64 offset, qint64 lastAddress);
 
-    //! comparison function for two equal offsets.
-    static bool compareItems(const MemoryVisualizationItem* s1, const MemoryVisualizationItem* s2);
-
     /*!
      *  Groups a given address text to groups of four digits.
      *
@@ -325,6 +394,27 @@ private:
 
     //! Tells if the item is completely overlapped by other items.
     bool overlapped_;
+
+    //! The address ranges of the actual children at the previous update, excluding the gaps.
+    QHash<MemoryVisualizationItem*, ChildRange> childRanges_;
+
+    //! The children whose address range may have changed since the previous update.
+    QSet<MemoryVisualizationItem*> changedChildren_;
+
+    //! The gap and conflict items between the children.
+    QList<MemoryGapItem*> gaps_;
+
+    //! The offset of this item at the previous update.
+    quint64 layoutOffset_;
+
+    //! The size of the addressable unit of this item at the previous update.
+    unsigned int layoutAddressUnitSize_;
+
+    //! If true, the children are created when the item is expanded for the first time.
+    bool pendingChildren_;
+
+    //! If true, the requested children are being added.
+    bool creatingChildren_;
 };
 
 #endif // MEMORYVISUALIZATIONITEM_H
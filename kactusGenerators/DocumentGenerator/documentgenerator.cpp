@@ -1324,6 +1324,9 @@ void DocumentGenerator::createDesignPicture( QStringList& pictureList, const QSt
 		designPicFile.remove();
 	}
 
+    // The picture shows all the connections, including the ones not yet shown in a view.
+    designWidget->getDiagram()->createPendingItems();
+
 	// get the rect that bounds all items on box
     QRectF boundingRect = designWidget->getDiagram()->itemsBoundingRect();
 	boundingRect.setHeight(boundingRect.height() + 2);
@@ -0,0 +1,284 @@
+//-----------------------------------------------------------------------------
+// File: HeadlessLibraryHandler.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Library access without any widgets for the batch mode.
+//-----------------------------------------------------------------------------
+
+#include "HeadlessLibraryHandler.h"
+
+#include "librarydata.h"
+#include "librarytreemodel.h"
+#include "HierarchyView/hierarchymodel.h"
+
+#include <IPXACTmodels/librarycomponent.h>
+
+#include <QDir>
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::HeadlessLibraryHandler()
+//-----------------------------------------------------------------------------
+HeadlessLibraryHandler::HeadlessLibraryHandler(QObject* parent):
+QObject(parent),
+LibraryHandlerBase(),
+saveInProgress_(false)
+{
+    data_ = new LibraryData(this, 0);
+    data_->setInteractive(false);
+
+    treeModel_ = new LibraryTreeModel(this, data_, this);
+    hierarchyModel_ = new HierarchyModel(data_, this, this);
+
+    connect(data_, SIGNAL(removeVLNV(const VLNV&)),
+        treeModel_, SLOT(onRemoveVLNV(const VLNV&)), Qt::UniqueConnection);
+    connect(data_, SIGNAL(removeVLNV(const VLNV&)),
+        hierarchyModel_, SLOT(onRemoveVLNV(const VLNV&)), Qt::UniqueConnection);
+    connect(data_, SIGNAL(resetModel()), treeModel_, SLOT(onResetModel()), Qt::UniqueConnection);
+    connect(data_, SIGNAL(resetModel()), hierarchyModel_, SLOT(onResetModel()), Qt::UniqueConnection);
+    connect(data_, SIGNAL(addVLNV(const VLNV&)), treeModel_, SLOT(onAddVLNV(const VLNV&)), Qt::UniqueConnection);
+
+    connect(treeModel_, SIGNAL(errorMessage(const QString&)),
+        this, SIGNAL(errorMessage(const QString&)), Qt::UniqueConnection);
+    connect(treeModel_, SIGNAL(noticeMessage(const QString&)),
+        this, SIGNAL(noticeMessage(const QString&)), Qt::UniqueConnection);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::~HeadlessLibraryHandler()
+//-----------------------------------------------------------------------------
+HeadlessLibraryHandler::~HeadlessLibraryHandler()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::writeModelToFile()
+//-----------------------------------------------------------------------------
+bool HeadlessLibraryHandler::writeModelToFile(const QString path, QSharedPointer<LibraryComponent> model,
+    bool printErrors)
+{
+    if (path.isEmpty())
+    {
+        return false;
+    }
+
+    if (printErrors)
+    {
+        reportModelErrors(model);
+    }
+
+    VLNV vlnv = *model->getVlnv();
+    Q_ASSERT(!data_->contains(vlnv));
+
+    if (!QDir(path).exists() && !QDir().mkpath(path))
+    {
+        emit errorMessage(tr("Could not create directory \"%1\".").arg(path));
+        return false;
+    }
+
+    QString filePath = path + "/" + vlnv.getName() + "." + vlnv.getVersion() + ".xml";
+
+    QString error = writeFile(model, filePath);
+    if (!error.isEmpty())
+    {
+        emit errorMessage(error);
+        return false;
+    }
+
+    data_->addVLNV(vlnv, filePath);
+
+    if (!saveInProgress_)
+    {
+        hierarchyModel_->onResetModel();
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::writeModelToFile()
+//-----------------------------------------------------------------------------
+bool HeadlessLibraryHandler::writeModelToFile(QSharedPointer<LibraryComponent> model, bool printErrors)
+{
+    VLNV vlnv = *model->getVlnv();
+    Q_ASSERT(data_->contains(vlnv));
+
+    if (printErrors)
+    {
+        reportModelErrors(model);
+    }
+
+    // Make sure the document is parsed again next time.
+    objects_.remove(vlnv);
+    data_->discardPrefetchedModel(vlnv);
+
+    QString error = writeFile(model, data_->getPath(vlnv));
+    if (!error.isEmpty())
+    {
+        emit errorMessage(error);
+        return false;
+    }
+
+    if (data_->getType(vlnv) == VLNV::COMPONENT)
+    {
+        VLNV savedItem = vlnv;
+        savedItem.setType(VLNV::COMPONENT);
+        hierarchyModel_->onComponentSaved(savedItem);
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::searchForIPXactFiles()
+//-----------------------------------------------------------------------------
+void HeadlessLibraryHandler::searchForIPXactFiles()
+{
+    objects_.clear();
+    data_->parseLibrary();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::getAllVLNVs()
+//-----------------------------------------------------------------------------
+QList<VLNV> HeadlessLibraryHandler::getAllVLNVs() const
+{
+    return data_->getItems();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::getInvalidItems()
+//-----------------------------------------------------------------------------
+QMap<VLNV, QString> HeadlessLibraryHandler::getInvalidItems() const
+{
+    return data_->getInvalidItems();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::getIntegrityErrorCount()
+//-----------------------------------------------------------------------------
+int HeadlessLibraryHandler::getIntegrityErrorCount() const
+{
+    return data_->getErrorCount();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::onCheckLibraryIntegrity()
+//-----------------------------------------------------------------------------
+void HeadlessLibraryHandler::onCheckLibraryIntegrity()
+{
+    data_->checkLibraryIntegrity();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::onSelectionChanged()
+//-----------------------------------------------------------------------------
+void HeadlessLibraryHandler::onSelectionChanged(const VLNV& /*vlnv*/)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::onClearSelection()
+//-----------------------------------------------------------------------------
+void HeadlessLibraryHandler::onClearSelection()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::onEditItem()
+//-----------------------------------------------------------------------------
+void HeadlessLibraryHandler::onEditItem(const VLNV& /*vlnv*/)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::onOpenDesign()
+//-----------------------------------------------------------------------------
+void HeadlessLibraryHandler::onOpenDesign(const VLNV& /*vlnv*/)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::onCreateNewItem()
+//-----------------------------------------------------------------------------
+void HeadlessLibraryHandler::onCreateNewItem(const VLNV& /*vlnv*/)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::onCreateDesign()
+//-----------------------------------------------------------------------------
+void HeadlessLibraryHandler::onCreateDesign(const VLNV& /*vlnv*/)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::removeObject()
+//-----------------------------------------------------------------------------
+void HeadlessLibraryHandler::removeObject(const VLNV& vlnv)
+{
+    if (!vlnv.isValid() || !data_->contains(vlnv))
+    {
+        return;
+    }
+
+    objects_.remove(vlnv);
+    data_->onRemoveVLNV(vlnv);
+    treeModel_->onRemoveVLNV(vlnv);
+    hierarchyModel_->onRemoveVLNV(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::removeObjects()
+//-----------------------------------------------------------------------------
+void HeadlessLibraryHandler::removeObjects(const QList<VLNV>& vlnvList)
+{
+    foreach (VLNV const& vlnv, vlnvList)
+    {
+        removeObject(vlnv);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::beginSave()
+//-----------------------------------------------------------------------------
+void HeadlessLibraryHandler::beginSave()
+{
+    saveInProgress_ = true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::endSave()
+//-----------------------------------------------------------------------------
+void HeadlessLibraryHandler::endSave()
+{
+    saveInProgress_ = false;
+    hierarchyModel_->onResetModel();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::reportError()
+//-----------------------------------------------------------------------------
+void HeadlessLibraryHandler::reportError(QString const& message)
+{
+    emit errorMessage(message);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HeadlessLibraryHandler::reportNotice()
+//-----------------------------------------------------------------------------
+void HeadlessLibraryHandler::reportNotice(QString const& message)
+{
+    emit noticeMessage(message);
+}
+
@@ -0,0 +1,166 @@
+//-----------------------------------------------------------------------------
+// File: HeadlessLibraryHandler.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Library access without any widgets for the batch mode.
+//-----------------------------------------------------------------------------
+
+#ifndef HEADLESSLIBRARYHANDLER_H
+#define HEADLESSLIBRARYHANDLER_H
+
+#include "LibraryHandlerBase.h"
+
+#include <IPXACTmodels/vlnv.h>
+
+#include <QList>
+#include <QMap>
+#include <QObject>
+#include <QSharedPointer>
+#include <QString>
+
+class LibraryComponent;
+
+//-----------------------------------------------------------------------------
+//! Library access without any widgets for the batch mode.
+//
+// The library is scanned and checked without progress dialogs and the documents are written
+// synchronously. The operations that would open an editor or ask the user are ignored.
+//-----------------------------------------------------------------------------
+class HeadlessLibraryHandler : public QObject, public LibraryHandlerBase
+{
+    Q_OBJECT
+
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] parent   The owner of the library handler.
+     */
+    HeadlessLibraryHandler(QObject* parent = 0);
+
+    //! The destructor.
+    virtual ~HeadlessLibraryHandler();
+
+    /*!
+     *  Writes a new model to the given directory and adds it to the library.
+     *
+     *      @param [in] path            The directory to write the document to.
+     *      @param [in] model           The model to write.
+     *      @param [in] printErrors     If true, the errors in the model are reported.
+     *
+     *      @return True, if the document was written, otherwise false.
+     */
+    virtual bool writeModelToFile(const QString path, QSharedPointer<LibraryComponent> model,
+        bool printErrors = true);
+
+    /*!
+     *  Writes a model that is already in the library to its file.
+     *
+     *      @param [in] model           The model to write.
+     *      @param [in] printErrors     If true, the errors in the model are reported.
+     *
+     *      @return True, if the document was written, otherwise false.
+     */
+    virtual bool writeModelToFile(QSharedPointer<LibraryComponent> model, bool printErrors = true);
+
+    //! Scans the active library locations for IP-XACT documents.
+    virtual void searchForIPXactFiles();
+
+    /*!
+     *  Gets all the VLNVs in the library.
+     *
+     *      @return The VLNVs in the library.
+     */
+    QList<VLNV> getAllVLNVs() const;
+
+    /*!
+     *  Gets the documents found invalid by the last integrity check.
+     *
+     *      @return The paths of the invalid documents by their VLNVs.
+     */
+    QMap<VLNV, QString> getInvalidItems() const;
+
+    /*!
+     *  Gets the number of errors found by the last integrity check.
+     *
+     *      @return The number of errors.
+     */
+    int getIntegrityErrorCount() const;
+
+public slots:
+
+    //! Checks the integrity of the library without progress dialogs.
+    virtual void onCheckLibraryIntegrity();
+
+    //! There is no selection in the batch mode.
+    virtual void onSelectionChanged(const VLNV& vlnv);
+
+    //! There is no selection in the batch mode.
+    virtual void onClearSelection();
+
+    //! The batch mode has no editors.
+    virtual void onEditItem(const VLNV& vlnv);
+
+    //! The batch mode has no editors.
+    virtual void onOpenDesign(const VLNV& vlnv);
+
+    //! The batch mode does not create new documents.
+    virtual void onCreateNewItem(const VLNV& vlnv);
+
+    //! The batch mode does not create new documents.
+    virtual void onCreateDesign(const VLNV& vlnv);
+
+    /*!
+     *  Removes the given document from the library. The file is not removed.
+     *
+     *      @param [in] vlnv   Identifies the document.
+     */
+    virtual void removeObject(const VLNV& vlnv);
+
+    /*!
+     *  Removes the given documents from the library. The files are not removed.
+     *
+     *      @param [in] vlnvList   Identifies the documents.
+     */
+    virtual void removeObjects(const QList<VLNV>& vlnvList);
+
+    //! The documents are always written synchronously in the batch mode.
+    virtual void beginSave();
+
+    //! Updates the library hierarchy after a group of documents has been written.
+    virtual void endSave();
+
+signals:
+
+    //! Emitted when an error should be reported.
+    void errorMessage(const QString& message);
+
+    //! Emitted when a notice should be reported.
+    void noticeMessage(const QString& message);
+
+private:
+
+    // Disable copying.
+    HeadlessLibraryHandler(HeadlessLibraryHandler const& rhs);
+    HeadlessLibraryHandler& operator=(HeadlessLibraryHandler const& rhs);
+
+    //! Emits the error as errorMessage().
+    virtual void reportError(QString const& message);
+
+    //! Emits the notice as noticeMessage().
+    virtual void reportNotice(QString const& message);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! True, if a group of documents is being written.
+    bool saveInProgress_;
+};
+
+#endif // HEADLESSLIBRARYHANDLER_H
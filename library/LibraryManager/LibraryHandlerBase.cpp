@@ -0,0 +1,379 @@
+//-----------------------------------------------------------------------------
+// File: LibraryHandlerBase.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// The library access shared by the library handlers with and without widgets.
+//-----------------------------------------------------------------------------
+
+#include "LibraryHandlerBase.h"
+
+#include "librarydata.h"
+#include "librarytreemodel.h"
+#include "HierarchyView/hierarchymodel.h"
+
+#include <common/PerformanceTrace/ScopedTrace.h>
+
+#include <IPXACTmodels/design.h>
+#include <IPXACTmodels/designconfiguration.h>
+#include <IPXACTmodels/librarycomponent.h>
+
+#include <QDir>
+#include <QFileInfo>
+#include <QObject>
+#include <QSaveFile>
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::LibraryHandlerBase()
+//-----------------------------------------------------------------------------
+LibraryHandlerBase::LibraryHandlerBase():
+data_(0),
+treeModel_(0),
+hierarchyModel_(0),
+objects_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::~LibraryHandlerBase()
+//-----------------------------------------------------------------------------
+LibraryHandlerBase::~LibraryHandlerBase()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::getModel()
+//-----------------------------------------------------------------------------
+QSharedPointer<LibraryComponent> LibraryHandlerBase::getModel(const VLNV& vlnv)
+{
+    QSharedPointer<LibraryComponent const> libComp = getModelReadOnly(vlnv);
+    if (libComp)
+    {
+        return libComp->clone();
+    }
+
+    return QSharedPointer<LibraryComponent>();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::getModelReadOnly()
+//-----------------------------------------------------------------------------
+QSharedPointer<LibraryComponent const> LibraryHandlerBase::getModelReadOnly(const VLNV& vlnv)
+{
+    SCOPED_TRACE_DETAIL(trace, "LibraryHandlerBase::getModelReadOnly", "library", vlnv.toString());
+
+    if (objects_.contains(vlnv))
+    {
+        return objects_.value(vlnv);
+    }
+
+    QSharedPointer<LibraryComponent> libComp = data_->getModel(vlnv);
+    if (libComp)
+    {
+        objects_.insert(vlnv, libComp);
+    }
+
+    return libComp;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::prefetchModels()
+//-----------------------------------------------------------------------------
+void LibraryHandlerBase::prefetchModels(QList<VLNV> const& vlnvs)
+{
+    ScopedTrace trace("LibraryHandlerBase::prefetchModels", "library");
+
+    QList<VLNV> unparsed;
+    foreach (VLNV const& vlnv, vlnvs)
+    {
+        if (!objects_.contains(vlnv) && !unparsed.contains(vlnv))
+        {
+            unparsed.append(vlnv);
+        }
+    }
+
+    // A single document gains nothing from the worker threads.
+    if (unparsed.size() < 2)
+    {
+        return;
+    }
+
+    data_->prefetchModels(unparsed);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::contains()
+//-----------------------------------------------------------------------------
+bool LibraryHandlerBase::contains(const VLNV& vlnv)
+{
+    return objects_.contains(vlnv) || data_->contains(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::getPath()
+//-----------------------------------------------------------------------------
+const QString LibraryHandlerBase::getPath(const VLNV& vlnv) const
+{
+    if (!vlnv.isValid())
+    {
+        return QString();
+    }
+
+    return data_->getPath(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::getDirectoryPath()
+//-----------------------------------------------------------------------------
+QString LibraryHandlerBase::getDirectoryPath(const VLNV& vlnv) const
+{
+    return QFileInfo(getPath(vlnv)).absolutePath();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::getNeededVLNVs()
+//-----------------------------------------------------------------------------
+void LibraryHandlerBase::getNeededVLNVs(const VLNV& vlnv, QList<VLNV>& list)
+{
+    if (!vlnv.isValid())
+    {
+        return;
+    }
+
+    QSharedPointer<LibraryComponent const> libComp = getModelReadOnly(vlnv);
+    if (!libComp)
+    {
+        reportError(QObject::tr("No item with following info was found in library: \n"
+            "Vendor: %1\n"
+            "Library: %2\n"
+            "Name: %3\n"
+            "Version: %4").arg(vlnv.getVendor(), vlnv.getLibrary(), vlnv.getName(), vlnv.getVersion()));
+        return;
+    }
+
+    list.append(vlnv);
+
+    foreach (VLNV const& dependency, libComp->getDependentVLNVs())
+    {
+        if (!list.contains(dependency))
+        {
+            getNeededVLNVs(dependency, list);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::getDependencyFiles()
+//-----------------------------------------------------------------------------
+void LibraryHandlerBase::getDependencyFiles(const VLNV& vlnv, QStringList& list)
+{
+    QSharedPointer<LibraryComponent const> libComp = getModelReadOnly(vlnv);
+    if (!libComp)
+    {
+        return;
+    }
+
+    QFileInfo documentInfo(data_->getPath(vlnv));
+    QDir documentDirectory(documentInfo.absolutePath());
+
+    foreach (QString const& relativePath, libComp->getDependentFiles())
+    {
+        if (!documentInfo.exists())
+        {
+            reportError(QObject::tr("File %1 can't be found in file system").arg(documentInfo.filePath()));
+            return;
+        }
+
+        QFileInfo fileInfo(documentDirectory.absoluteFilePath(relativePath));
+        if (fileInfo.exists() && !list.contains(fileInfo.canonicalFilePath()))
+        {
+            list.append(fileInfo.canonicalFilePath());
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::getHierarchicalDependencyFiles()
+//-----------------------------------------------------------------------------
+void LibraryHandlerBase::getHierarchicalDependencyFiles(const VLNV& vlnv, QStringList& list)
+{
+    getDependencyFiles(vlnv, list);
+
+    QSharedPointer<LibraryComponent const> libComp = getModelReadOnly(vlnv);
+    if (!libComp)
+    {
+        return;
+    }
+
+    foreach (VLNV const& dependency, libComp->getDependentVLNVs())
+    {
+        getHierarchicalDependencyFiles(dependency, list);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::getTreeRoot()
+//-----------------------------------------------------------------------------
+LibraryItem const* LibraryHandlerBase::getTreeRoot() const
+{
+    return treeModel_->getRoot();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::getDocumentType()
+//-----------------------------------------------------------------------------
+VLNV::IPXactType LibraryHandlerBase::getDocumentType(const VLNV& vlnv)
+{
+    if (!vlnv.isValid())
+    {
+        return VLNV::INVALID;
+    }
+
+    return data_->getType(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::referenceCount()
+//-----------------------------------------------------------------------------
+int LibraryHandlerBase::referenceCount(const VLNV& vlnv) const
+{
+    QList<VLNV> list;
+    hierarchyModel_->getOwners(list, vlnv);
+    return list.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::getOwners()
+//-----------------------------------------------------------------------------
+int LibraryHandlerBase::getOwners(QList<VLNV>& list, const VLNV& vlnvToSearch) const
+{
+    hierarchyModel_->getOwners(list, vlnvToSearch);
+    return list.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::getChildren()
+//-----------------------------------------------------------------------------
+int LibraryHandlerBase::getChildren(QList<VLNV>& list, const VLNV& vlnvToSearch) const
+{
+    if (!vlnvToSearch.isValid())
+    {
+        return 0;
+    }
+
+    hierarchyModel_->getChildren(list, vlnvToSearch);
+    return list.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::getDesignVLNV()
+//-----------------------------------------------------------------------------
+VLNV LibraryHandlerBase::getDesignVLNV(const VLNV& hierarchyRef)
+{
+    if (!data_->contains(hierarchyRef))
+    {
+        reportError(QObject::tr("VLNV: %1 was not found in library.").arg(hierarchyRef.toString()));
+        return VLNV();
+    }
+
+    VLNV::IPXactType type = data_->getType(hierarchyRef);
+    if (type == VLNV::DESIGN)
+    {
+        return hierarchyRef;
+    }
+    else if (type != VLNV::DESIGNCONFIGURATION)
+    {
+        reportError(QObject::tr("VLNV: %1 was not valid hierarchical reference.").arg(hierarchyRef.toString()));
+        return VLNV();
+    }
+
+    QSharedPointer<DesignConfiguration const> designConfiguration =
+        getModelReadOnly(hierarchyRef).staticCast<DesignConfiguration const>();
+
+    VLNV designVLNV = designConfiguration->getDesignRef();
+    if (!data_->contains(designVLNV))
+    {
+        reportError(QObject::tr("VLNV: %1 was not found in library.").arg(designVLNV.toString()));
+        return VLNV();
+    }
+    else if (data_->getType(designVLNV) != VLNV::DESIGN)
+    {
+        reportError(QObject::tr("VLNV: %1 was not for design.").arg(designVLNV.toString()));
+        return VLNV();
+    }
+
+    designVLNV.setType(VLNV::DESIGN);
+    return designVLNV;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::getDesign()
+//-----------------------------------------------------------------------------
+QSharedPointer<Design> LibraryHandlerBase::getDesign(const VLNV& hierarchyRef)
+{
+    VLNV designVLNV = getDesignVLNV(hierarchyRef);
+    if (!designVLNV.isValid())
+    {
+        return QSharedPointer<Design>();
+    }
+
+    return getModel(designVLNV).staticCast<Design>();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::isValid()
+//-----------------------------------------------------------------------------
+bool LibraryHandlerBase::isValid(const VLNV& vlnv)
+{
+    if (!getModelReadOnly(vlnv))
+    {
+        return false;
+    }
+
+    // The check does not modify the model, so the parsed document can be used.
+    return data_->checkObject(objects_.value(vlnv), data_->getPath(vlnv), false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::reportModelErrors()
+//-----------------------------------------------------------------------------
+void LibraryHandlerBase::reportModelErrors(QSharedPointer<LibraryComponent> model)
+{
+    QStringList errorList;
+    if (!model->isValid(errorList))
+    {
+        reportNotice(QObject::tr("Item %1 contained following errors:").arg(model->getVlnv()->toString()));
+
+        foreach (QString const& error, errorList)
+        {
+            reportError(error);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandlerBase::writeFile()
+//-----------------------------------------------------------------------------
+QString LibraryHandlerBase::writeFile(QSharedPointer<LibraryComponent> model, QString const& filePath)
+{
+    // The old file is replaced only after the new document has been completely written.
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        return QObject::tr("Could not open file %1 for writing").arg(filePath);
+    }
+
+    model->write(file);
+
+    if (!file.commit())
+    {
+        return QObject::tr("Could not write file %1. %2").arg(filePath, file.errorString());
+    }
+
+    return QString();
+}
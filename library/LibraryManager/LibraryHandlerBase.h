@@ -0,0 +1,252 @@
+//-----------------------------------------------------------------------------
+// File: LibraryHandlerBase.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// The library access shared by the library handlers with and without widgets.
+//-----------------------------------------------------------------------------
+
+#ifndef LIBRARYHANDLERBASE_H
+#define LIBRARYHANDLERBASE_H
+
+#include "libraryinterface.h"
+
+#include <IPXACTmodels/vlnv.h>
+
+#include <QList>
+#include <QMap>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+
+class HierarchyModel;
+class LibraryComponent;
+class LibraryData;
+class LibraryTreeModel;
+
+//-----------------------------------------------------------------------------
+//! The library access shared by the library handlers with and without widgets.
+//
+// Implements the parts of LibraryInterface that only read the library data and the parsed documents.
+// The derived classes create the library data and the item models, and report the messages to the user.
+//-----------------------------------------------------------------------------
+class LibraryHandlerBase : public LibraryInterface
+{
+public:
+
+    //! The constructor.
+    LibraryHandlerBase();
+
+    //! The destructor.
+    virtual ~LibraryHandlerBase();
+
+    /*!
+     *  Gets a copy of the model that matches the given VLNV.
+     *
+     *      @param [in] vlnv   Identifies the document.
+     *
+     *      @return The model or null, if the document is not in the library.
+     */
+    virtual QSharedPointer<LibraryComponent> getModel(const VLNV& vlnv);
+
+    /*!
+     *  Gets the model that matches the given VLNV for read-only access.
+     *
+     *      @param [in] vlnv   Identifies the document.
+     *
+     *      @return The model or null, if the document is not in the library.
+     */
+    virtual QSharedPointer<LibraryComponent const> getModelReadOnly(const VLNV& vlnv);
+
+    /*!
+     *  Parses the models matching the given VLNVs in advance on worker threads.
+     *
+     *      @param [in] vlnvs   Identifies the documents to parse.
+     */
+    virtual void prefetchModels(QList<VLNV> const& vlnvs);
+
+    /*!
+     *  Checks if the library contains the given VLNV.
+     *
+     *      @param [in] vlnv   The VLNV to search for.
+     *
+     *      @return True, if the VLNV is in the library, otherwise false.
+     */
+    virtual bool contains(const VLNV& vlnv);
+
+    /*!
+     *  Gets the path of the document with the given VLNV.
+     *
+     *      @param [in] vlnv   Identifies the document.
+     *
+     *      @return The path of the document or an empty string, if not found.
+     */
+    virtual const QString getPath(const VLNV& vlnv) const;
+
+    /*!
+     *  Gets the directory of the document with the given VLNV.
+     *
+     *      @param [in] vlnv   Identifies the document.
+     *
+     *      @return The directory path of the document.
+     */
+    virtual QString getDirectoryPath(const VLNV& vlnv) const;
+
+    /*!
+     *  Gets the VLNVs needed by the given VLNV, including itself.
+     *
+     *      @param [in] vlnv    The VLNV whose dependencies are searched.
+     *      @param [out] list   The list where the VLNVs are appended.
+     */
+    virtual void getNeededVLNVs(const VLNV& vlnv, QList<VLNV>& list);
+
+    /*!
+     *  Gets the files referenced by the given document.
+     *
+     *      @param [in] vlnv    Identifies the document.
+     *      @param [out] list   The list where the absolute file paths are appended.
+     */
+    virtual void getDependencyFiles(const VLNV& vlnv, QStringList& list);
+
+    /*!
+     *  Gets the files referenced by the given document and the documents it depends on.
+     *
+     *      @param [in] vlnv    Identifies the document.
+     *      @param [out] list   The list where the absolute file paths are appended.
+     */
+    virtual void getHierarchicalDependencyFiles(const VLNV& vlnv, QStringList& list);
+
+    /*!
+     *  Gets the root of the library tree.
+     *
+     *      @return The root item.
+     */
+    virtual LibraryItem const* getTreeRoot() const;
+
+    /*!
+     *  Gets the type of the document with the given VLNV.
+     *
+     *      @param [in] vlnv   Identifies the document.
+     *
+     *      @return The document type or VLNV::INVALID, if not found.
+     */
+    virtual VLNV::IPXactType getDocumentType(const VLNV& vlnv);
+
+    /*!
+     *  Counts the documents that refer to the given VLNV.
+     *
+     *      @param [in] vlnv   The referenced VLNV.
+     *
+     *      @return The number of documents referring to the VLNV.
+     */
+    virtual int referenceCount(const VLNV& vlnv) const;
+
+    /*!
+     *  Gets the documents that refer to the given VLNV.
+     *
+     *      @param [out] list           The list where the owners are appended.
+     *      @param [in] vlnvToSearch    The referenced VLNV.
+     *
+     *      @return The number of owners found.
+     */
+    virtual int getOwners(QList<VLNV>& list, const VLNV& vlnvToSearch) const;
+
+    /*!
+     *  Gets the documents the given VLNV refers to.
+     *
+     *      @param [out] list           The list where the children are appended.
+     *      @param [in] vlnvToSearch    The referring VLNV.
+     *
+     *      @return The number of children found.
+     */
+    virtual int getChildren(QList<VLNV>& list, const VLNV& vlnvToSearch) const;
+
+    /*!
+     *  Gets the VLNV of the design referenced directly or through a design configuration.
+     *
+     *      @param [in] hierarchyRef   The hierarchical reference.
+     *
+     *      @return The design VLNV or an invalid VLNV, if the design was not found.
+     */
+    virtual VLNV getDesignVLNV(const VLNV& hierarchyRef);
+
+    /*!
+     *  Gets the design referenced directly or through a design configuration.
+     *
+     *      @param [in] hierarchyRef   The hierarchical reference.
+     *
+     *      @return The design or null, if not found.
+     */
+    virtual QSharedPointer<Design> getDesign(const VLNV& hierarchyRef);
+
+    /*!
+     *  Checks if the document with the given VLNV is valid.
+     *
+     *      @param [in] vlnv   Identifies the document.
+     *
+     *      @return True, if the document is valid, otherwise false.
+     */
+    virtual bool isValid(const VLNV& vlnv);
+
+protected:
+
+    /*!
+     *  Reports an error to the user.
+     *
+     *      @param [in] message   The error message.
+     */
+    virtual void reportError(QString const& message) = 0;
+
+    /*!
+     *  Reports a notice to the user.
+     *
+     *      @param [in] message   The notice message.
+     */
+    virtual void reportNotice(QString const& message) = 0;
+
+    /*!
+     *  Reports the errors found in the given model.
+     *
+     *      @param [in] model   The model to check.
+     */
+    void reportModelErrors(QSharedPointer<LibraryComponent> model);
+
+    /*!
+     *  Writes the model to the given file. The file is replaced only if the model is written completely.
+     *
+     *      @param [in] model       The model to write.
+     *      @param [in] filePath    The path of the file to write.
+     *
+     *      @return The error that occurred or an empty string, if the file was written.
+     *
+     *      @remarks Does not access the library so it may be called from any thread.
+     */
+    static QString writeFile(QSharedPointer<LibraryComponent> model, QString const& filePath);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The library data, created by the derived class.
+    LibraryData* data_;
+
+    //! The model for the library tree, created by the derived class.
+    LibraryTreeModel* treeModel_;
+
+    //! The model for the library hierarchy, created by the derived class.
+    HierarchyModel* hierarchyModel_;
+
+    //! The parsed documents by their VLNVs.
+    QMap<VLNV, QSharedPointer<LibraryComponent> > objects_;
+
+private:
+
+    // Disable copying.
+    LibraryHandlerBase(LibraryHandlerBase const& rhs);
+    LibraryHandlerBase& operator=(LibraryHandlerBase const& rhs);
+};
+
+#endif // LIBRARYHANDLERBASE_H
@@ -13,6 +13,7 @@
 #include <IPXACTmodels/vlnv.h>
 
 #include <common/utils.h>
+#include <common/PerformanceTrace/ScopedTrace.h>
 #include <common/widgets/ScanProgressWidget/scanprogresswidget.h>
 
 #include <IPXACTmodels/librarycomponent.h>
@@ -25,7 +26,17 @@
 #include <IPXACTmodels/generaldeclarations.h>
 #include <IPXACTmodels/ComDefinition.h>
 #include <IPXACTmodels/ApiDefinition.h>
+#include <IPXACTmodels/StringPool.h>
 
+#include <IPXACTmodels/streamReaders/AbstractionDefinitionStreamReader.h>
+#include <IPXACTmodels/streamReaders/BusDefinitionStreamReader.h>
+#include <IPXACTmodels/streamReaders/ComponentStreamReader.h>
+#include <IPXACTmodels/streamReaders/DesignConfigurationStreamReader.h>
+#include <IPXACTmodels/streamReaders/DesignStreamReader.h>
+
+#include <QBuffer>
+#include <QCryptographicHash>
+#include <QDateTime>
 #include <QFile>
 #include <QDir>
 #include <QStringList>
@@ -37,18 +48,187 @@
 #include <QWidget>
 #include <QFileDialog>
 #include <QSettings>
+#include <QtConcurrent/QtConcurrentMap>
 #include <QList>
 #include <QProgressBar>
 #include <QMap>
+#include <QSaveFile>
+#include <QSet>
 #include <QSharedPointer>
 #include <QTimer>
 #include <QUrl>
 
-LibraryData::LibraryData(LibraryHandler* parent, QWidget* parentWidget)
+namespace
+{
+    /*!
+     *  Reads a model from the given device with the given type of stream reader.
+     *
+     *      @param [in]  device             The device to read the model from.
+     *      @param [in]  snapshotDevice     The device to record the snapshot of the document to or null.
+     *      @param [out] readError          The error of the reader, if the model could not be read.
+     *
+     *      @return The read model or null, if the document could not be read.
+     */
+    template <typename Reader>
+    QSharedPointer<LibraryComponent> readWith(QIODevice* device, QIODevice* snapshotDevice, QString& readError)
+    {
+        Reader reader;
+        reader.setSnapshotDevice(snapshotDevice);
+
+        QSharedPointer<LibraryComponent> model = reader.read(device);
+        readError = reader.errorString();
+        return model;
+    }
+
+    /*!
+     *  Reads a model of the given type from the given device.
+     *
+     *      @param [in]  type               The type of the document.
+     *      @param [in]  device             The device to read the XML document or its snapshot from.
+     *      @param [in]  snapshotDevice     The device to record the snapshot of the document to or null.
+     *      @param [out] readError          The error of the reader, if the model could not be read.
+     *
+     *      @return The read model or null, if the document could not be read.
+     */
+    QSharedPointer<LibraryComponent> readModelOfType(VLNV::IPXactType type, QIODevice* device,
+        QIODevice* snapshotDevice, QString& readError)
+    {
+        if (type == VLNV::COMPONENT)
+        {
+            return readWith<ComponentStreamReader>(device, snapshotDevice, readError);
+        }
+        else if (type == VLNV::DESIGN)
+        {
+            return readWith<DesignStreamReader>(device, snapshotDevice, readError);
+        }
+        else if (type == VLNV::DESIGNCONFIGURATION)
+        {
+            return readWith<DesignConfigurationStreamReader>(device, snapshotDevice, readError);
+        }
+        else if (type == VLNV::BUSDEFINITION)
+        {
+            return readWith<BusDefinitionStreamReader>(device, snapshotDevice, readError);
+        }
+        else if (type == VLNV::ABSTRACTIONDEFINITION)
+        {
+            return readWith<AbstractionDefinitionStreamReader>(device, snapshotDevice, readError);
+        }
+
+        return QSharedPointer<LibraryComponent>();
+    }
+
+    //! The file in a snapshot directory naming the snapshot recorded for the current document file.
+    const QString SNAPSHOT_STAMP("stamp");
+
+    /*!
+     *  Checks if the documents of the given type are read by the stream readers and may have snapshots.
+     *
+     *      @param [in] type    The type of the document.
+     *
+     *      @return True, if the documents are streamed, otherwise false.
+     */
+    bool isStreamedType(VLNV::IPXactType type)
+    {
+        return type == VLNV::COMPONENT || type == VLNV::DESIGN || type == VLNV::DESIGNCONFIGURATION ||
+            type == VLNV::BUSDEFINITION || type == VLNV::ABSTRACTIONDEFINITION;
+    }
+
+    /*!
+     *  Gets the directory containing the snapshot directories of all documents.
+     *
+     *      @return The directory next to the settings file containing the library locations.
+     */
+    QString snapshotRoot()
+    {
+        QSettings settings;
+        return QFileInfo(settings.fileName()).absolutePath() + "/ModelSnapshots";
+    }
+
+    /*!
+     *  Gets the name of the snapshot directory of the document in the given path.
+     *
+     *      @param [in] path    The path to the document.
+     *
+     *      @return The name of the snapshot directory.
+     */
+    QString snapshotDirectoryName(QString const& path)
+    {
+        return QString::fromLatin1(QCryptographicHash::hash(QFileInfo(path).absoluteFilePath().toUtf8(),
+            QCryptographicHash::Sha1).toHex());
+    }
+
+    /*!
+     *  Gets the directory for the snapshots of the document in the given path.
+     *
+     *      @param [in] path    The path to the document.
+     *
+     *      @return The snapshot directory of the document.
+     */
+    QString snapshotDirectory(QString const& path)
+    {
+        return snapshotRoot() + "/" + snapshotDirectoryName(path);
+    }
+
+    /*!
+     *  Gets the size and modification time of the given file for identifying an unchanged file.
+     *
+     *      @param [in] path    The path to the file.
+     *
+     *      @return The stamp of the file.
+     */
+    QString fileStamp(QString const& path)
+    {
+        QFileInfo fileInfo(path);
+        return QString::number(fileInfo.size()) + " " + QString::number(fileInfo.lastModified().toMSecsSinceEpoch());
+    }
+
+    /*!
+     *  Gets the snapshot recorded for the document file with the given stamp.
+     *
+     *      @param [in] directory   The snapshot directory of the document.
+     *      @param [in] stamp       The stamp of the document file.
+     *
+     *      @return The path to the snapshot or an empty string, if the document file has changed since.
+     */
+    QString stampedSnapshot(QString const& directory, QString const& stamp)
+    {
+        QFile stampFile(directory + "/" + SNAPSHOT_STAMP);
+        if (!stampFile.open(QIODevice::ReadOnly))
+        {
+            return QString();
+        }
+
+        QStringList lines = QString::fromLatin1(stampFile.readAll()).split('\n');
+        if (lines.size() != 2 || lines.first() != stamp)
+        {
+            return QString();
+        }
+
+        return directory + "/" + lines.last();
+    }
+
+    /*!
+     *  Records the snapshot of the document file with the given stamp.
+     *
+     *      @param [in] directory       The snapshot directory of the document.
+     *      @param [in] stamp           The stamp of the document file.
+     *      @param [in] snapshotName    The file name of the snapshot.
+     */
+    void writeSnapshotStamp(QString const& directory, QString const& stamp, QString const& snapshotName)
+    {
+        QSaveFile stampFile(directory + "/" + SNAPSHOT_STAMP);
+        if (stampFile.open(QIODevice::WriteOnly))
+        {
+            stampFile.write(QString(stamp + "\n" + snapshotName).toLatin1());
+            stampFile.commit();
+        }
+    }
+}
+
+LibraryData::LibraryData(QObject* parent, QWidget* parentWidget)
     : QObject(parent),
       parentWidget_(parentWidget),
       libraryItems_(),
-      handler_(parent),
       progWidget_(0),
       timerSteps_(0),
       timerStep_(0),
@@ -61,7 +241,11 @@ LibraryData::LibraryData(LibraryHandler* parent, QWidget* parentWidget)
       vlnvErrors_(0),
       fileErrors_(0),
       fileCount_(0),
-      urlTester_(new QRegExpValidator(Utils::URL_VALIDITY_REG_EXP, this))
+      invalidItems_(),
+      urlTester_(new QRegExpValidator(Utils::URL_VALIDITY_REG_EXP, this)),
+      interactive_(true),
+      pendingModels_(),
+      prefetchedModels_()
 {
 	connect(this, SIGNAL(errorMessage(const QString&)),
 		parent, SIGNAL(errorMessage(const QString&)), Qt::UniqueConnection);
@@ -79,12 +263,28 @@ QList<VLNV> LibraryData::getItems() const {
     return libraryItems_.keys();
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryData::getInvalidItems()
+//-----------------------------------------------------------------------------
+QMap<VLNV, QString> LibraryData::getInvalidItems() const
+{
+    return invalidItems_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryData::getErrorCount()
+//-----------------------------------------------------------------------------
+int LibraryData::getErrorCount() const
+{
+    return errors_;
+}
+
 void LibraryData::getDirectory(QStringList& list) {
 	// empty the list
 	list.clear();
 
 	// create the dialog
-	QFileDialog fileChooser(handler_, Qt::Dialog);
+	QFileDialog fileChooser(parentWidget_, Qt::Dialog);
 
 	// select directories
 	fileChooser.setFileMode(QFileDialog::Directory);
@@ -144,6 +344,7 @@ bool LibraryData::addVLNV( const VLNV& vlnv, const QString& path) {
 
 	// add the component to the library
 	libraryItems_.insert(vlnv, path);
+	discardPrefetchedModel(vlnv);
 
 	emit addVLNV(vlnv);
 
@@ -164,6 +365,7 @@ void LibraryData::onRemoveVLNV( const VLNV& vlnv ) {
 
 	// remove the vlnv, no delete operation is needed because VLNVs are statically created
     libraryItems_.remove(vlnv);
+    discardPrefetchedModel(vlnv);
 }
 
 VLNV::IPXactType LibraryData::getType( const VLNV& vlnv ) const {
@@ -183,6 +385,8 @@ void LibraryData::resetLibrary() {
 
 void LibraryData::checkLibraryIntegrity() {
 
+    ScopedTrace trace("LibraryData::checkLibraryIntegrity", "library");
+
 	int max = libraryItems_.size();
 	errors_ = 0;
 	failedObjects_ = 0;
@@ -190,6 +394,7 @@ void LibraryData::checkLibraryIntegrity() {
 	vlnvErrors_ = 0;
 	fileErrors_ = 0;
 	fileCount_ = 0;
+	invalidItems_.clear();
 
 	emit noticeMessage(tr("------ Library Integrity Check ------"));
 
@@ -197,17 +402,29 @@ void LibraryData::checkLibraryIntegrity() {
     timerSteps_ = max;
     iterObjects_ = libraryItems_.begin();
 
-    // create the progress bar that displays the progress of the check
-    progWidget_ = new ScanProgressWidget(parentWidget_);
-    progWidget_->setWindowTitle(tr("Checking integrity..."));
-    progWidget_->setRange(0, max);
-    progWidget_->setMessage(tr("Processing item %1 of %2...").arg(QString::number(timerStep_ + 1),
-        QString::number(libraryItems_.size())));
-    timer_ = new QTimer(this);
-    connect(timer_, SIGNAL(timeout()), this, SLOT(performIntegrityCheckStep()));
-    timer_->start();
+    if (interactive_)
+    {
+        // create the progress bar that displays the progress of the check
+        progWidget_ = new ScanProgressWidget(parentWidget_);
+        progWidget_->setWindowTitle(tr("Checking integrity..."));
+        progWidget_->setRange(0, max);
+        progWidget_->setMessage(tr("Processing item %1 of %2...").arg(QString::number(timerStep_ + 1),
+            QString::number(libraryItems_.size())));
+        timer_ = new QTimer(this);
+        connect(timer_, SIGNAL(timeout()), this, SLOT(performIntegrityCheckStep()));
+        timer_->start();
+
+        progWidget_->exec();
+    }
+    else
+    {
+        while (iterObjects_ != libraryItems_.end())
+        {
+            checkNextObject();
+        }
 
-    progWidget_->exec();
+        emit resetModel();
+    }
 
 	emit noticeMessage(tr("========== Library integrity check complete =========="));
 	emit noticeMessage(tr("Total library object count: %1").arg(libraryItems_.size()));
@@ -224,8 +441,14 @@ void LibraryData::checkLibraryIntegrity() {
 
 void LibraryData::parseLibrary()
 {
+    ScopedTrace trace("LibraryData::parseLibrary", "library");
+
 	// clear the previous items in the library
 	libraryItems_.clear();
+    clearPrefetchedModels();
+
+    // The identifiers of the removed documents are released. The models still in use keep their strings.
+    StringPool::clear();
 
 	QSettings settings(this);
 
@@ -237,6 +460,14 @@ void LibraryData::parseLibrary()
     {
 		locations_.clear();
     }
+    else if (!interactive_)
+    {
+        locations_ = locations;
+        foreach (QString const& location, locations_)
+        {
+            parseLocation(location);
+        }
+    }
     else
     {
         // create the progress bar that displays the progress of the scan
@@ -254,6 +485,8 @@ void LibraryData::parseLibrary()
         progWidget_->exec();
     }
 
+    removeOrphanSnapshots();
+
     // check the integrity of the items in the library
 	checkLibraryIntegrity();
 }
@@ -372,12 +605,169 @@ QSharedPointer<LibraryComponent> LibraryData::getModel( const VLNV& vlnv ) {
 		return QSharedPointer<LibraryComponent>();
 	}
 
+	QString error;
+	QSharedPointer<LibraryComponent> libComp;
+
+    ParseTask prefetched;
+    if (takePrefetchedModel(toCreate, prefetched))
+    {
+        libComp = prefetched.model;
+        error = prefetched.error;
+    }
+    else
+    {
+        libComp = createModel(toCreate, path, error);
+    }
+
+	if (!libComp) {
+		if (error.isEmpty()) {
+			emit noticeMessage(tr("Document was not supported type"));
+		}
+		else {
+			emit errorMessage(error);
+		}
+	}
+
+	return libComp;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryData::prefetchModels()
+//-----------------------------------------------------------------------------
+void LibraryData::prefetchModels(QList<VLNV> const& vlnvs)
+{
+    SCOPED_TRACE_DETAIL(trace, "LibraryData::prefetchModels", "library", QString::number(vlnvs.size()));
+
+    // Resolve the documents here so that the library is not accessed from the worker threads.
+    QList<ParseTask> tasks;
+    foreach (VLNV const& vlnv, vlnvs)
+    {
+        QMap<VLNV, QString>::const_iterator item = libraryItems_.constFind(vlnv);
+        if (item != libraryItems_.constEnd() && !item.value().isEmpty() &&
+            !pendingModels_.contains(vlnv) && !prefetchedModels_.contains(vlnv))
+        {
+            ParseTask task;
+            task.vlnv = item.key();
+            task.path = item.value();
+            tasks.append(task);
+        }
+    }
+
+    if (tasks.isEmpty())
+    {
+        return;
+    }
+
+    QFutureWatcher<ParseTask>* watcher = new QFutureWatcher<ParseTask>(this);
+    connect(watcher, SIGNAL(finished()), this, SLOT(onPrefetchFinished()), Qt::UniqueConnection);
+
+    for (int i = 0; i < tasks.size(); ++i)
+    {
+        PendingModel pending;
+        pending.watcher = watcher;
+        pending.index = i;
+        pendingModels_.insert(tasks.at(i).vlnv, pending);
+    }
+
+    watcher->setFuture(QtConcurrent::mapped(tasks, &LibraryData::runParseTask));
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryData::keepSnapshots()
+//-----------------------------------------------------------------------------
+void LibraryData::keepSnapshots(VLNV const& vlnv)
+{
+    QMap<VLNV, QString>::const_iterator item = libraryItems_.constFind(vlnv);
+    if (item != libraryItems_.constEnd() && !item.value().isEmpty() && isStreamedType(item.key().getType()))
+    {
+        QDir().mkpath(snapshotDirectory(item.value()));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryData::discardPrefetchedModel()
+//-----------------------------------------------------------------------------
+void LibraryData::discardPrefetchedModel(VLNV const& vlnv)
+{
+    // A running parse cannot be cancelled, but its result is ignored when it finishes.
+    pendingModels_.remove(vlnv);
+    prefetchedModels_.remove(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryData::onPrefetchFinished()
+//-----------------------------------------------------------------------------
+void LibraryData::onPrefetchFinished()
+{
+    QFutureWatcher<ParseTask>* watcher = static_cast<QFutureWatcher<ParseTask>*>(sender());
+
+    QMap<VLNV, PendingModel>::iterator i = pendingModels_.begin();
+    while (i != pendingModels_.end())
+    {
+        if (i.value().watcher == watcher)
+        {
+            prefetchedModels_.insert(i.key(), watcher->resultAt(i.value().index));
+            i = pendingModels_.erase(i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    watcher->deleteLater();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryData::takePrefetchedModel()
+//-----------------------------------------------------------------------------
+bool LibraryData::takePrefetchedModel(VLNV const& vlnv, ParseTask& result)
+{
+    if (prefetchedModels_.contains(vlnv))
+    {
+        result = prefetchedModels_.take(vlnv);
+        return true;
+    }
+
+    if (pendingModels_.contains(vlnv))
+    {
+        // Only the requested document is waited for, the rest of the prefetch continues in the background.
+        PendingModel pending = pendingModels_.take(vlnv);
+        result = pending.watcher->future().resultAt(pending.index);
+        return true;
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryData::clearPrefetchedModels()
+//-----------------------------------------------------------------------------
+void LibraryData::clearPrefetchedModels()
+{
+    pendingModels_.clear();
+    prefetchedModels_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryData::createModel()
+//-----------------------------------------------------------------------------
+QSharedPointer<LibraryComponent> LibraryData::createModel(VLNV const& vlnv, QString const& path,
+    QString& error)
+{
+    VLNV::IPXactType type = vlnv.getType();
+
+    // The documents that may grow large are read without building the DOM of the whole document.
+    if (isStreamedType(type))
+    {
+        return readModel(vlnv, path, error);
+    }
+
 	// create file handle and use it to read the IP-Xact document into memory
 	QFile file(path);
 	QDomDocument doc;
 	if (!doc.setContent(&file)) {
-		emit errorMessage(tr("The document %1 in file %2 could not be opened.").arg(
-			toCreate.toString()).arg(path));
+		error = tr("The document %1 in file %2 could not be opened.").arg(vlnv.toString(), path);
 		return QSharedPointer<LibraryComponent>();
 	}
 	file.close();
@@ -386,34 +776,11 @@ QSharedPointer<LibraryComponent> LibraryData::getModel( const VLNV& vlnv ) {
 
 	try {
 		// create correct type of object and cast the pointer
-		switch (toCreate.getType()) {
-			case VLNV::BUSDEFINITION: {
-				libComp = QSharedPointer<LibraryComponent>(new BusDefinition(doc));
-				break;
-									  }
-			case VLNV::COMPONENT: {
-				libComp = QSharedPointer<LibraryComponent>(new Component(doc));
-				break;
-								  }
-			case VLNV::DESIGN: {
-				libComp = QSharedPointer<LibraryComponent>(new Design(doc));
-				break;
-							   }
-
+		switch (type) {
 			case VLNV::GENERATORCHAIN: {
 				libComp = QSharedPointer<LibraryComponent>(new GeneratorChain(doc));
 				break;
 									   }
-			case VLNV::DESIGNCONFIGURATION: {
-				libComp = QSharedPointer<LibraryComponent>(new DesignConfiguration(doc));
-				break;
-											}
-
-			case VLNV::ABSTRACTIONDEFINITION: {
-				libComp = QSharedPointer<LibraryComponent>(new AbstractionDefinition(doc));
-				break;
-											  }
-
             case VLNV::COMDEFINITION: {
                 libComp = QSharedPointer<LibraryComponent>(new ComDefinition(doc));
                 break;
@@ -424,21 +791,168 @@ QSharedPointer<LibraryComponent> LibraryData::getModel( const VLNV& vlnv ) {
                 break;
                                       }
 			default: {
-				emit noticeMessage(tr("Document was not supported type"));
 				return QSharedPointer<LibraryComponent>();
 					 }
 		}
 	}
 	// if an exception occurred during the parsing
 	catch (...) {
-		emit errorMessage(
-			tr("Error occurred during parsing of the document %1").arg(path));
+		error = tr("Error occurred during parsing of the document %1").arg(path);
 		return QSharedPointer<LibraryComponent>();
 	}
 
 	return libComp;
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryData::readModel()
+//-----------------------------------------------------------------------------
+QSharedPointer<LibraryComponent> LibraryData::readModel(VLNV const& vlnv, QString const& path,
+    QString& error)
+{
+    VLNV::IPXactType type = vlnv.getType();
+
+    // Only the documents that have been opened for editing have a snapshot directory.
+    QString directory = snapshotDirectory(path);
+    bool useSnapshots = QFileInfo(directory).isDir();
+    QString stamp = fileStamp(path);
+
+    QSharedPointer<LibraryComponent> libComp;
+    QString readError;
+
+    try
+    {
+        // The snapshot of an untouched document file is read without reading the document at all.
+        if (useSnapshots)
+        {
+            QFile snapshotFile(stampedSnapshot(directory, stamp));
+            if (!snapshotFile.fileName().isEmpty() && snapshotFile.open(QIODevice::ReadOnly))
+            {
+                libComp = readModelOfType(type, &snapshotFile, 0, readError);
+            }
+        }
+
+        if (!libComp)
+        {
+            QFile file(path);
+            if (!file.open(QIODevice::ReadOnly))
+            {
+                error = tr("The document %1 in file %2 could not be opened.").arg(vlnv.toString(), path);
+                return QSharedPointer<LibraryComponent>();
+            }
+
+            QByteArray content = file.readAll();
+            file.close();
+
+            QBuffer buffer(&content);
+            buffer.open(QIODevice::ReadOnly);
+
+            if (!useSnapshots)
+            {
+                libComp = readModelOfType(type, &buffer, 0, readError);
+            }
+            else
+            {
+                // The snapshot is keyed by the content of the document, so a touched but unchanged
+                // document still finds its snapshot.
+                QString snapshotName =
+                    QString::fromLatin1(QCryptographicHash::hash(content, QCryptographicHash::Sha1).toHex());
+                QString snapshotPath = directory + "/" + snapshotName;
+
+                QFile snapshotFile(snapshotPath);
+                if (snapshotFile.open(QIODevice::ReadOnly))
+                {
+                    libComp = readModelOfType(type, &snapshotFile, 0, readError);
+                }
+
+                if (!libComp)
+                {
+                    QSaveFile snapshot(snapshotPath);
+                    bool recordSnapshot = snapshot.open(QIODevice::WriteOnly);
+
+                    libComp = readModelOfType(type, &buffer, recordSnapshot ? &snapshot : 0, readError);
+
+                    if (libComp && recordSnapshot && snapshot.commit())
+                    {
+                        removeStaleSnapshots(directory, snapshotPath);
+                    }
+                }
+
+                if (libComp && QFileInfo(snapshotPath).exists())
+                {
+                    writeSnapshotStamp(directory, stamp, snapshotName);
+                }
+            }
+        }
+    }
+    // if an exception occurred during the parsing
+    catch (...)
+    {
+        error = tr("Error occurred during parsing of the document %1").arg(path);
+        return QSharedPointer<LibraryComponent>();
+    }
+
+    if (!libComp && !readError.isEmpty())
+    {
+        error = tr("The document %1 in file %2 could not be opened. %3").arg(vlnv.toString(), path, readError);
+    }
+
+    return libComp;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryData::removeStaleSnapshots()
+//-----------------------------------------------------------------------------
+void LibraryData::removeStaleSnapshots(QString const& directory, QString const& currentSnapshot)
+{
+    QDir snapshotDir(directory);
+    QString currentName = QFileInfo(currentSnapshot).fileName();
+
+    foreach (QString const& name, snapshotDir.entryList(QDir::Files))
+    {
+        if (name != currentName && name != SNAPSHOT_STAMP)
+        {
+            snapshotDir.remove(name);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryData::removeOrphanSnapshots()
+//-----------------------------------------------------------------------------
+void LibraryData::removeOrphanSnapshots()
+{
+    QDir rootDir(snapshotRoot());
+    if (!rootDir.exists())
+    {
+        return;
+    }
+
+    QSet<QString> documentDirectories;
+    foreach (QString const& path, libraryItems_)
+    {
+        documentDirectories.insert(snapshotDirectoryName(path));
+    }
+
+    foreach (QString const& name, rootDir.entryList(QDir::Dirs | QDir::NoDotAndDotDot))
+    {
+        if (!documentDirectories.contains(name))
+        {
+            QDir(rootDir.absoluteFilePath(name)).removeRecursively();
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryData::runParseTask()
+//-----------------------------------------------------------------------------
+LibraryData::ParseTask LibraryData::runParseTask(ParseTask const& task)
+{
+    ParseTask result = task;
+    result.model = createModel(task.vlnv, task.path, result.error);
+    return result;
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryData::performParseLibrary()
 //-----------------------------------------------------------------------------
@@ -449,19 +963,7 @@ void LibraryData::performParseLibraryStep()
 		return;
 	}
 
-	QString location = locations_.at(timerStep_);
-	QFileInfo locationInfo(location);
-
-	// if the location is a directory
-	if (locationInfo.isDir())
-	{
-		parseDirectory(location);
-	}
-	// if the location is a direct file
-	else if (locationInfo.isFile())
-	{
-		parseFile(location);
-	}
+	parseLocation(locations_.at(timerStep_));
 
 	++timerStep_;
 
@@ -492,21 +994,7 @@ void LibraryData::performIntegrityCheckStep()
 
 	if (timerStep_ < timerSteps_)
 	{
-
-		QSharedPointer<LibraryComponent> libComp = getModel(iterObjects_.key());
-		// if the object could not be parsed
-		if (!libComp) {
-
-			// remove the pair from the map and move on
-			QMap<VLNV, QString>::iterator i = libraryItems_.find(iterObjects_.key());
-			++iterObjects_;
-            libraryItems_.erase(i);
-		}
-        else
-        {
-            checkObject(libComp, iterObjects_.value());
-            ++iterObjects_;
-        }
+        checkNextObject();
 	}
 	else
 	{
@@ -541,6 +1029,57 @@ void LibraryData::performIntegrityCheckStep()
 	}
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryData::setInteractive()
+//-----------------------------------------------------------------------------
+void LibraryData::setInteractive(bool interactive)
+{
+    interactive_ = interactive;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryData::parseLocation()
+//-----------------------------------------------------------------------------
+void LibraryData::parseLocation(QString const& location)
+{
+    QFileInfo locationInfo(location);
+
+    // if the location is a directory
+    if (locationInfo.isDir())
+    {
+        parseDirectory(location);
+    }
+    // if the location is a direct file
+    else if (locationInfo.isFile())
+    {
+        parseFile(location);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryData::checkNextObject()
+//-----------------------------------------------------------------------------
+void LibraryData::checkNextObject()
+{
+    QSharedPointer<LibraryComponent> libComp = getModel(iterObjects_.key());
+
+    // if the object could not be parsed, remove the pair from the map and move on
+    if (!libComp)
+    {
+        invalidItems_.insert(iterObjects_.key(), iterObjects_.value());
+        iterObjects_ = libraryItems_.erase(iterObjects_);
+    }
+    else
+    {
+        if (!checkObject(libComp, iterObjects_.value()))
+        {
+            invalidItems_.insert(iterObjects_.key(), iterObjects_.value());
+        }
+
+        ++iterObjects_;
+    }
+}
+
 bool LibraryData::checkObject( QSharedPointer<LibraryComponent> libComp, const QString& path, bool print /*= true*/ ) {
 
 	// in the start assume that document is valid and if errors are 
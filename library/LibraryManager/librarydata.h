@@ -9,6 +9,7 @@
 
 #include <IPXACTmodels/vlnv.h>
 
+#include <QFutureWatcher>
 #include <QObject>
 #include <QList>
 #include <QMap>
@@ -17,7 +18,6 @@
 #include <QRegExpValidator>
 #include <QWidget>
 
-class LibraryHandler;
 class LibraryComponent;
 class ScanProgressWidget;
 
@@ -36,10 +36,12 @@ public:
 
 	/*! \brief The constructor
 	 *
-	 * \param parent Pointer to the owner of this widget.
+	 * \param parent Pointer to the owner of this widget. It must provide the
+	 * errorMessage() and noticeMessage() signals.
+	 * \param parentWidget Pointer to the parent of the dialogs or null in the batch mode.
 	 *
 	*/
-	LibraryData(LibraryHandler *parent, QWidget* parentWidget);
+	LibraryData(QObject* parent, QWidget* parentWidget);
 
 	//! \brief The destructor
 	virtual ~LibraryData();
@@ -93,6 +95,13 @@ public:
 	*/
 	void parseLibrary();
 
+    /*!
+     *  Sets whether the library scans display progress dialogs.
+     *
+     *      @param [in] interactive     If false, the scans are run at once without showing any dialogs.
+     */
+    void setInteractive(bool interactive);
+
     /*! \brief Get a model that matches given VLNV.
 	 *
 	 * This function can be called to get a model that matches an IP-Xact document.
@@ -105,11 +114,51 @@ public:
 	*/
 	QSharedPointer<LibraryComponent> getModel(const VLNV& vlnv);
 
+    /*!
+     *  Starts parsing the models matching the given VLNVs in parallel. The call returns at once.
+     *
+     *      @param [in] vlnvs   Identifies the documents to parse.
+     *
+     *      @remarks getModel() returns the prefetched model and waits only for that document, if it is
+     *               still being parsed. The errors are reported when the model is requested.
+     */
+    void prefetchModels(QList<VLNV> const& vlnvs);
+
+    /*!
+     *  Keeps snapshots of the given document from now on so that reopening it for editing is fast.
+     *
+     *      @param [in] vlnv    Identifies the document opened for editing.
+     *
+     *      @remarks The snapshot is recorded the next time the document is read.
+     */
+    void keepSnapshots(VLNV const& vlnv);
+
+    /*!
+     *  Discards the prefetched model of the given document, e.g. when the document has been rewritten.
+     *
+     *      @param [in] vlnv    Identifies the document.
+     */
+    void discardPrefetchedModel(VLNV const& vlnv);
+
 	/*! \brief Check the integrity of the library.
 	 *
 	*/
 	void checkLibraryIntegrity();
 
+    /*!
+     *  Gets the documents found invalid or unparsable by the last integrity check.
+     *
+     *      @return The paths of the invalid documents by their VLNVs.
+     */
+    QMap<VLNV, QString> getInvalidItems() const;
+
+    /*!
+     *  Gets the number of errors found by the last integrity check.
+     *
+     *      @return The number of errors.
+     */
+    int getErrorCount() const;
+
 	/*! \brief Check the specified library object's validity.
 	 * 
 	 * Note:
@@ -164,6 +213,11 @@ public slots:
 	//! \brief Reset the library
 	void resetLibrary();
 
+private slots:
+
+    //! Stores the models of a finished prefetch until they are requested.
+    void onPrefetchFinished();
+
 private:
 
 	//! \brief No copying
@@ -196,6 +250,119 @@ private:
 	*/
 	void parseFile(const QString& filePath);
 
+    //-----------------------------------------------------------------------------
+    //! A single document to parse in a parallel parse.
+    //-----------------------------------------------------------------------------
+    struct ParseTask
+    {
+        //! The VLNV of the document, including its type.
+        VLNV vlnv;
+
+        //! The path to the document.
+        QString path;
+
+        //! The parsed model or null, if the parsing failed.
+        QSharedPointer<LibraryComponent> model;
+
+        //! The error that occurred during the parsing.
+        QString error;
+    };
+
+    //-----------------------------------------------------------------------------
+    //! A document being parsed in a prefetch.
+    //-----------------------------------------------------------------------------
+    struct PendingModel
+    {
+        //! The watcher of the prefetch parsing the document.
+        QFutureWatcher<ParseTask>* watcher;
+
+        //! The index of the document in the results of the prefetch.
+        int index;
+    };
+
+    /*!
+     *  Creates a model of the given document from the given path.
+     *
+     *      @param [in]  vlnv   The VLNV of the document, including its type.
+     *      @param [in]  path   The path to the document.
+     *      @param [out] error  The error that occurred, or empty if the type is not supported.
+     *
+     *      @return The created model or null, if the model could not be created.
+     *
+     *      @remarks Does not access the library so it may be called from any thread.
+     */
+    static QSharedPointer<LibraryComponent> createModel(VLNV const& vlnv, QString const& path,
+        QString& error);
+
+    /*!
+     *  Reads a model of the given type from the document in the given path in a single streaming pass.
+     *  For the documents kept in snapshots, the model is read from the snapshot of the document, if the
+     *  document has not changed since the snapshot was recorded. Otherwise the snapshot is recorded while
+     *  reading the document. The document file is not read, if its size and modification time match
+     *  the snapshot.
+     *
+     *      @param [in]  vlnv   The VLNV of the document, including its type.
+     *      @param [in]  path   The path to the document.
+     *      @param [out] error  The error that occurred.
+     *
+     *      @return The read model or null, if the model could not be read.
+     *
+     *      @remarks Does not access the library so it may be called from any thread.
+     */
+    static QSharedPointer<LibraryComponent> readModel(VLNV const& vlnv, QString const& path,
+        QString& error);
+
+    /*!
+     *  Removes the snapshots of a document except the current one.
+     *
+     *      @param [in] directory           The snapshot directory of the document.
+     *      @param [in] currentSnapshot     The path to the current snapshot of the document.
+     */
+    static void removeStaleSnapshots(QString const& directory, QString const& currentSnapshot);
+
+    /*!
+     *  Removes the snapshot directories of the documents that are no longer in the library.
+     */
+    void removeOrphanSnapshots();
+
+    /*!
+     *  Parses the document of the given task.
+     *
+     *      @param [in] task    The document to parse.
+     *
+     *      @return The task with the parsed model or the error.
+     */
+    static ParseTask runParseTask(ParseTask const& task);
+
+    /*!
+     *  Takes the prefetched model of the given document.
+     *
+     *      @param [in]  vlnv       Identifies the document.
+     *      @param [out] result     The parsed model and the error of the document.
+     *
+     *      @return True, if the document was prefetched, otherwise false.
+     *
+     *      @remarks Waits for the document, if it is still being parsed.
+     */
+    bool takePrefetchedModel(VLNV const& vlnv, ParseTask& result);
+
+    //! Discards all the prefetched models.
+    void clearPrefetchedModels();
+
+    /*!
+     *  Searches the given library location for IP-XACT objects.
+     *
+     *      @param [in] location    The directory or file to search.
+     */
+    void parseLocation(QString const& location);
+
+    /*!
+     *  Checks the object at the integrity check iterator and moves the iterator to the next object.
+     *
+     *      @remarks The object is removed from the library, if it cannot be parsed.
+     */
+    void checkNextObject();
+
     //! The parent widget.
     QWidget* parentWidget_;
 
@@ -206,9 +373,6 @@ private:
 	 */
 	QMap<VLNV, QString> libraryItems_;
 
-	//! \brief Pointer to the LibraryHandler instance that owns this class.
-	LibraryHandler *handler_;
-
     //! The progress dialog widget for scans.
     ScanProgressWidget* progWidget_;
 
@@ -245,8 +409,20 @@ private:
 	//! \brief The total number of files all library components contain.
 	 int fileCount_;
 
+    //! The documents found invalid by the last integrity check and their paths.
+    QMap<VLNV, QString> invalidItems_;
+
 	//! \brief Checks if the given string is a URL (invalids are allowed) or not.
 	 QRegExpValidator* urlTester_;
+
+    //! If false, the scans are run without progress dialogs.
+    bool interactive_;
+
+    //! The documents being parsed in the running prefetches.
+    QMap<VLNV, PendingModel> pendingModels_;
+
+    //! The documents parsed in the finished prefetches that have not been requested yet.
+    QMap<VLNV, ParseTask> prefetchedModels_;
 };
 
 #endif // LIBRARYDATA_H
@@ -38,36 +38,35 @@
 #include <QCoreApplication>
 #include <QSettings>
 #include <QApplication>
+#include <QtConcurrent/QtConcurrentRun>
 
 LibraryHandler::LibraryHandler(VLNVDialer* dialer, QWidget* parent): 
 QTabWidget(parent), 
-data_(), 
-treeModel_(),
-hierarchyModel_(),
+LibraryHandlerBase(),
 treeWidget_(0),
 hierarchyWidget_(0),
-objects_(),
 saveInProgress_(false),
-itemsToAdd_() 
+itemsToAdd_(),
+backgroundSaves_()
 {
 	setWindowTitle(tr("LibraryHandler"));
 
-	data_ = QSharedPointer<LibraryData>(new LibraryData(this, parent));   
+	data_ = new LibraryData(this, parent);
 
-    treeModel_ = QSharedPointer<LibraryTreeModel>(new LibraryTreeModel(this, data_.data(), this));
+    treeModel_ = new LibraryTreeModel(this, data_, this);
 
-    hierarchyModel_ = QSharedPointer<HierarchyModel>(new HierarchyModel(data_.data(), this, this));
+    hierarchyModel_ = new HierarchyModel(data_, this, this);
 
 	// create the connections between models and library handler
 	syncronizeModels();
 
-	treeWidget_ = new LibraryTreeWidget(this, treeModel_.data(), this);
+	treeWidget_ = new LibraryTreeWidget(this, treeModel_, this);
     connectLibraryFilter(treeWidget_->getFilter(), dialer);
 
 	connect(treeWidget_, SIGNAL(itemSelected(const VLNV&)),
 		this, SIGNAL(itemSelected(const VLNV&)), Qt::UniqueConnection);
 
-	hierarchyWidget_ = new HierarchyWidget(this, hierarchyModel_.data(), this);
+	hierarchyWidget_ = new HierarchyWidget(this, hierarchyModel_, this);
     connectLibraryFilter(hierarchyWidget_->getFilter(), dialer);
 
 	connect(hierarchyWidget_, SIGNAL(componentSelected(const VLNV&)),
@@ -78,118 +77,123 @@ itemsToAdd_()
 }
 
 LibraryHandler::~LibraryHandler() {
+    // Make sure the documents being saved are written before the library is destroyed.
+    foreach (QFutureWatcher<QString>* watcher, backgroundSaves_.keys())
+    {
+        watcher->waitForFinished();
+    }
 }
 
 void LibraryHandler::syncronizeModels() {
 
 	// connect the signals from the data model
-	connect(data_.data(), SIGNAL(removeVLNV(const VLNV&)),
-		treeModel_.data(), SLOT(onRemoveVLNV(const VLNV&)), Qt::UniqueConnection);
-	connect(data_.data(), SIGNAL(removeVLNV(const VLNV&)),
-		hierarchyModel_.data(), SLOT(onRemoveVLNV(const VLNV&)), Qt::UniqueConnection);
+	connect(data_, SIGNAL(removeVLNV(const VLNV&)),
+		treeModel_, SLOT(onRemoveVLNV(const VLNV&)), Qt::UniqueConnection);
+	connect(data_, SIGNAL(removeVLNV(const VLNV&)),
+		hierarchyModel_, SLOT(onRemoveVLNV(const VLNV&)), Qt::UniqueConnection);
 
-	connect(data_.data(), SIGNAL(resetModel()),
-		hierarchyModel_.data(), SLOT(onResetModel()), Qt::UniqueConnection);
-	connect(data_.data(), SIGNAL(resetModel()),
-		treeModel_.data(), SLOT(onResetModel()), Qt::UniqueConnection);
+	connect(data_, SIGNAL(resetModel()),
+		hierarchyModel_, SLOT(onResetModel()), Qt::UniqueConnection);
+	connect(data_, SIGNAL(resetModel()),
+		treeModel_, SLOT(onResetModel()), Qt::UniqueConnection);
 
-	connect(data_.data(), SIGNAL(addVLNV(const VLNV&)),
-		treeModel_.data(), SLOT(onAddVLNV(const VLNV&)), Qt::UniqueConnection);
+	connect(data_, SIGNAL(addVLNV(const VLNV&)),
+		treeModel_, SLOT(onAddVLNV(const VLNV&)), Qt::UniqueConnection);
 
 	// signals from data model to library handler
-	connect(data_.data(), SIGNAL(errorMessage(const QString&)),
+	connect(data_, SIGNAL(errorMessage(const QString&)),
 		this, SIGNAL(errorMessage(const QString&)), Qt::UniqueConnection);
-	connect(data_.data(), SIGNAL(noticeMessage(const QString&)),
+	connect(data_, SIGNAL(noticeMessage(const QString&)),
 		this, SIGNAL(noticeMessage(const QString&)), Qt::UniqueConnection);
 
 	/**************************************************************************/
 	// connect the signals from the tree model
-	connect(treeModel_.data(), SIGNAL(removeVLNV(const QList<VLNV>)),
+	connect(treeModel_, SIGNAL(removeVLNV(const QList<VLNV>)),
 		this, SLOT(onRemoveVLNV(const QList<VLNV>)), Qt::UniqueConnection);
 
 	// signals from tree model to library handler
-	connect(treeModel_.data(), SIGNAL(errorMessage(const QString&)),
+	connect(treeModel_, SIGNAL(errorMessage(const QString&)),
 		this, SIGNAL(errorMessage(const QString&)), Qt::UniqueConnection);
-	connect(treeModel_.data(), SIGNAL(noticeMessage(const QString&)),
+	connect(treeModel_, SIGNAL(noticeMessage(const QString&)),
 		this, SIGNAL(noticeMessage(const QString&)), Qt::UniqueConnection);
-	connect(treeModel_.data(), SIGNAL(openDesign(const VLNV&)),
+	connect(treeModel_, SIGNAL(openDesign(const VLNV&)),
 		this, SLOT(onOpenDesign(const VLNV&)), Qt::UniqueConnection);
-//     connect(treeModel_.data(), SIGNAL(openMemoryDesign(const VLNV&)),
+//     connect(treeModel_, SIGNAL(openMemoryDesign(const VLNV&)),
 //         this, SLOT(onOpenMemoryDesign(const VLNV&)), Qt::UniqueConnection);
-    connect(treeModel_.data(), SIGNAL(openSWDesign(const VLNV&)),
+    connect(treeModel_, SIGNAL(openSWDesign(const VLNV&)),
         this, SLOT(onOpenSWDesign(const VLNV&)), Qt::UniqueConnection);
-    connect(treeModel_.data(), SIGNAL(openSystemDesign(const VLNV&)),
+    connect(treeModel_, SIGNAL(openSystemDesign(const VLNV&)),
         this, SLOT(onOpenSystemDesign(const VLNV&)), Qt::UniqueConnection);
-	connect(treeModel_.data(), SIGNAL(editItem(const VLNV&)),
+	connect(treeModel_, SIGNAL(editItem(const VLNV&)),
 		this, SLOT(onEditItem(const VLNV&)), Qt::UniqueConnection);
-	connect(treeModel_.data(), SIGNAL(createBus(const VLNV&)),
+	connect(treeModel_, SIGNAL(createBus(const VLNV&)),
 		this, SLOT(onCreateNewItem(const VLNV&)), Qt::UniqueConnection);
-	connect(treeModel_.data(), SIGNAL(createAbsDef(const VLNV&)),
+	connect(treeModel_, SIGNAL(createAbsDef(const VLNV&)),
 		this, SLOT(onCreateAbsDef(const VLNV&)), Qt::UniqueConnection);
-    connect(treeModel_.data(), SIGNAL(createComDef(const VLNV&)),
+    connect(treeModel_, SIGNAL(createComDef(const VLNV&)),
         this, SLOT(onCreateNewItem(const VLNV&)), Qt::UniqueConnection);
-    connect(treeModel_.data(), SIGNAL(createApiDef(const VLNV&)),
+    connect(treeModel_, SIGNAL(createApiDef(const VLNV&)),
         this, SLOT(onCreateNewItem(const VLNV&)), Qt::UniqueConnection);
-	connect(treeModel_.data(), SIGNAL(createComponent(const VLNV&)),
+	connect(treeModel_, SIGNAL(createComponent(const VLNV&)),
 		this, SLOT(onCreateNewItem(const VLNV&)), Qt::UniqueConnection);
-	connect(treeModel_.data(), SIGNAL(createDesign(const VLNV&)),
+	connect(treeModel_, SIGNAL(createDesign(const VLNV&)),
 		this, SLOT(onCreateDesign(const VLNV&)), Qt::UniqueConnection);
-    connect(treeModel_.data(), SIGNAL(createSWDesign(const VLNV&)),
+    connect(treeModel_, SIGNAL(createSWDesign(const VLNV&)),
         this, SIGNAL(createSWDesign(const VLNV&)), Qt::UniqueConnection);
-    connect(treeModel_.data(), SIGNAL(createSystemDesign(const VLNV&)),
+    connect(treeModel_, SIGNAL(createSystemDesign(const VLNV&)),
         this, SIGNAL(createSystemDesign(const VLNV&)), Qt::UniqueConnection);
-	connect(treeModel_.data(), SIGNAL(exportItems(const QList<VLNV>)),
+	connect(treeModel_, SIGNAL(exportItems(const QList<VLNV>)),
 		this, SLOT(onExportItems(const QList<VLNV>)), Qt::UniqueConnection);
-	connect(treeModel_.data(), SIGNAL(refreshDialer()),
+	connect(treeModel_, SIGNAL(refreshDialer()),
 		this, SIGNAL(refreshDialer()), Qt::UniqueConnection);
 
-    connect(treeModel_.data(), SIGNAL(showErrors(const VLNV)),
+    connect(treeModel_, SIGNAL(showErrors(const VLNV)),
         this, SLOT(onShowErrors(const VLNV)), Qt::UniqueConnection);
 
 	/*************************************************************************/
 	// connect the signals from the hierarchy model
 
 	// signals from hierarchy model to library handler
-	connect(hierarchyModel_.data(), SIGNAL(openDesign(const VLNV&, const QString&)),
+	connect(hierarchyModel_, SIGNAL(openDesign(const VLNV&, const QString&)),
 		this, SIGNAL(openDesign(const VLNV&, const QString&)), Qt::UniqueConnection);
-    connect(hierarchyModel_.data(), SIGNAL(openMemoryDesign(const VLNV&, const QString&)),
+    connect(hierarchyModel_, SIGNAL(openMemoryDesign(const VLNV&, const QString&)),
         this, SIGNAL(openMemoryDesign(const VLNV&, const QString&)), Qt::UniqueConnection);
 
-    connect(hierarchyModel_.data(), SIGNAL(openMemoryDesign(const VLNV&, const QString&)),
+    connect(hierarchyModel_, SIGNAL(openMemoryDesign(const VLNV&, const QString&)),
         this, SLOT(onOpenMemoryDesign(const VLNV&)), Qt::UniqueConnection);
 
-    connect(hierarchyModel_.data(), SIGNAL(openSWDesign(const VLNV&, const QString&)),
+    connect(hierarchyModel_, SIGNAL(openSWDesign(const VLNV&, const QString&)),
         this, SIGNAL(openSWDesign(const VLNV&, const QString&)), Qt::UniqueConnection);
-    connect(hierarchyModel_.data(), SIGNAL(openSystemDesign(const VLNV&, const QString&)),
+    connect(hierarchyModel_, SIGNAL(openSystemDesign(const VLNV&, const QString&)),
         this, SIGNAL(openSystemDesign(const VLNV&, const QString&)), Qt::UniqueConnection);
 
-	connect(hierarchyModel_.data(), SIGNAL(editItem(const VLNV&)),
+	connect(hierarchyModel_, SIGNAL(editItem(const VLNV&)),
 		this, SLOT(onEditItem(const VLNV&)), Qt::UniqueConnection);
 
-	connect(hierarchyModel_.data(), SIGNAL(createBusDef(const VLNV&)),
+	connect(hierarchyModel_, SIGNAL(createBusDef(const VLNV&)),
 		this, SLOT(onCreateNewItem(const VLNV&)), Qt::UniqueConnection);
-	connect(hierarchyModel_.data(), SIGNAL(createComponent(const VLNV&)),
+	connect(hierarchyModel_, SIGNAL(createComponent(const VLNV&)),
 		this, SLOT(onCreateNewItem(const VLNV&)), Qt::UniqueConnection);
-	connect(hierarchyModel_.data(), SIGNAL(createBus(const VLNV&)),
+	connect(hierarchyModel_, SIGNAL(createBus(const VLNV&)),
 		this, SLOT(onCreateNewItem(const VLNV&)), Qt::UniqueConnection);
-	connect(hierarchyModel_.data(), SIGNAL(createAbsDef(const VLNV&)),
+	connect(hierarchyModel_, SIGNAL(createAbsDef(const VLNV&)),
 		this, SLOT(onCreateAbsDef(const VLNV&)), Qt::UniqueConnection);
-    connect(hierarchyModel_.data(), SIGNAL(createComDef(const VLNV&)),
+    connect(hierarchyModel_, SIGNAL(createComDef(const VLNV&)),
         this, SLOT(onCreateNewItem(const VLNV&)), Qt::UniqueConnection);
-    connect(hierarchyModel_.data(), SIGNAL(createApiDef(const VLNV&)),
+    connect(hierarchyModel_, SIGNAL(createApiDef(const VLNV&)),
         this, SLOT(onCreateNewItem(const VLNV&)), Qt::UniqueConnection);
 
-    connect(hierarchyModel_.data(), SIGNAL(createDesign(const VLNV&)),
+    connect(hierarchyModel_, SIGNAL(createDesign(const VLNV&)),
             this, SLOT(onCreateDesign(const VLNV&)), Qt::UniqueConnection);
-	connect(hierarchyModel_.data(), SIGNAL(createSWDesign(const VLNV&)),
+	connect(hierarchyModel_, SIGNAL(createSWDesign(const VLNV&)),
 		    this, SIGNAL(createSWDesign(const VLNV&)), Qt::UniqueConnection);
-    connect(hierarchyModel_.data(), SIGNAL(createSystemDesign(const VLNV&)),
+    connect(hierarchyModel_, SIGNAL(createSystemDesign(const VLNV&)),
             this, SIGNAL(createSystemDesign(const VLNV&)), Qt::UniqueConnection);
 
-	connect(hierarchyModel_.data(), SIGNAL(exportItem(const VLNV)),
+	connect(hierarchyModel_, SIGNAL(exportItem(const VLNV)),
 		    this, SLOT(onExportItem(const VLNV)), Qt::UniqueConnection);
 
-    connect(hierarchyModel_.data(), SIGNAL(showErrors(const VLNV)),
+    connect(hierarchyModel_, SIGNAL(showErrors(const VLNV)),
             this, SLOT(onShowErrors(const VLNV)), Qt::UniqueConnection);
 }
 
@@ -486,76 +490,6 @@ QDir& targetDir, fileList& handledFiles, bool& yesToAll, bool& noToAll) {
 	return;
 }
 
-QSharedPointer<LibraryComponent> LibraryHandler::getModel( const VLNV& vlnv ) {
-
-	// if object has already been previously parsed
-	if (objects_.contains(vlnv)) {
-		QSharedPointer<LibraryComponent> copy = objects_.value(vlnv)->clone();
-		return copy;
-	}
-	else {
-
-		QSharedPointer<LibraryComponent> libComp = data_->getModel(vlnv);
-
-		// if item was found
-		if (libComp) {
-			// save the parsed item to the map and return pointer to it
-			objects_.insert(vlnv, libComp);
-			QSharedPointer<LibraryComponent> copy = libComp->clone();
-			return copy;
-		}
-
-		// if item was not found
-		return libComp;
-	}
-}
-
-//-----------------------------------------------------------------------------
-// Function: getModel()
-//-----------------------------------------------------------------------------
-QSharedPointer<LibraryComponent const> LibraryHandler::getModelReadOnly(const VLNV& vlnv)
-{
-    // if object has already been previously parsed
-    if (objects_.contains(vlnv)) {
-        return objects_.value(vlnv);
-    }
-    else {
-        
-		QSharedPointer<LibraryComponent> libComp = data_->getModel(vlnv);
-
-		// if item was found
-		if (libComp) {
-			// save the parsed item to the map and return pointer to it
-			objects_.insert(vlnv, libComp);
-		}
-
-        return libComp;
-    }
-}
-
-bool LibraryHandler::contains( const VLNV& vlnv ) {
-
-	// if the 
-	if (objects_.contains(vlnv)) {
-		return true;
-	}
-	return data_->contains(vlnv);
-}
-
-const QString LibraryHandler::getPath( const VLNV& vlnv ) const {
-	if (!vlnv.isValid())
-		return QString();
-	else
-		return data_->getPath(vlnv);
-}
-
-QString LibraryHandler::getDirectoryPath( const VLNV& vlnv ) const {
-	QString path = getPath(vlnv);
-
-	QFileInfo pathInfo(path);
-	return pathInfo.absolutePath();
-}
-
 bool LibraryHandler::writeModelToFile( const QString path, 
 									  QSharedPointer<LibraryComponent> model,
 									  bool printErrors /* = true */) {
@@ -564,25 +498,13 @@ bool LibraryHandler::writeModelToFile( const QString path,
 		return false;
 	}
 
-	// if the model is not in the state that it can be written
-	QStringList errorList;
-	if (!model->isValid(errorList)) {
-
-		if (printErrors) {
-
-			emit noticeMessage(tr("Item %1 contained following errors:").arg(
-				model->getVlnv()->toString()));
-
-			// print all errors that were found
-			foreach (QString errorMsg, errorList) {
-				emit errorMessage(errorMsg);
-			}
-		}
+	if (printErrors) {
+		reportModelErrors(model);
 	}
 
 	VLNV vlnv = *model->getVlnv();
 	Q_ASSERT(!data_->contains(vlnv));
-	Q_ASSERT(!objects_.contains(vlnv));
+	Q_ASSERT(!objects_.contains(vlnv) || itemsToAdd_.contains(vlnv));
 
     // Create the path if it does not exist.
     if (!QDir(path).exists())
@@ -598,39 +520,24 @@ bool LibraryHandler::writeModelToFile( const QString path,
 
 	QString filePath = path + "/" + vlnv.getName() + "." + vlnv.getVersion() + ".xml";
 
-	// create file info instance representing the file in the path
-	QFileInfo oldFileInfo;
-	oldFileInfo.setFile(filePath);
-
-	// remove the old file
-	if (oldFileInfo.exists()) {
-		QFile oldFile(oldFileInfo.filePath());
-		oldFile.remove();
+	if (saveInProgress_) {
+		// the item is registered when all the documents being saved have been written
+		itemsToAdd_.insert(vlnv, filePath);
+		saveInBackground(model, filePath);
+		return true;
 	}
 
-	// create a new file
-	QFile newFile(filePath);
-	if (!newFile.open(QFile::WriteOnly | QFile::Truncate)) {
-		emit errorMessage(tr("Could not open file %1 for writing").arg(filePath));
+	QString error = writeFile(model, filePath);
+	if (!error.isEmpty()) {
+		emit errorMessage(error);
 		return false;
 	}
 
-	// write the parsed model
-    model->write(newFile);
-
-    // close the file
-    newFile.close();
-
-	if (!saveInProgress_) {
-		// tell library to register the vlnv
-		data_->addVLNV(vlnv, filePath);
+	// tell library to register the vlnv
+	data_->addVLNV(vlnv, filePath);
 
-		// the hierarchy model must be re-built
-		hierarchyModel_->onResetModel();
-	}
-	else {
-		itemsToAdd_.insert(vlnv, filePath);
-	}
+	// the hierarchy model must be re-built
+	hierarchyModel_->onResetModel();
 
 	return true;
 }
@@ -640,54 +547,29 @@ bool LibraryHandler::writeModelToFile( QSharedPointer<LibraryComponent> model,
 	
 	Q_ASSERT(data_->contains(*model->getVlnv()));
 
-	// if the model is not in the state that it can be written
-	QStringList errorList;
-	if (!model->isValid(errorList)) {
-
-		if (printErrors) {
-
-			emit noticeMessage(tr("Item %1 contained following errors:").arg(
-				model->getVlnv()->toString()));
-
-			// print all errors that were found
-			foreach (QString errorMsg, errorList) {
-				emit errorMessage(errorMsg);
-			}
-		}
+	if (printErrors) {
+		reportModelErrors(model);
 	}
 
 	// make sure the object is parsed again next time
 	VLNV objectVLNV = *model->getVlnv();
 	objects_.remove(objectVLNV);
+	data_->discardPrefetchedModel(objectVLNV);
 
 	QString filePath = data_->getPath(*model->getVlnv());
 
-	// create file info instance representing the file in the path
-	QFileInfo oldFileInfo;
-	oldFileInfo.setFile(filePath);
-
-	// remove the old file
-	if (oldFileInfo.exists()) {
-		QFile oldFile(oldFileInfo.filePath());
-		oldFile.remove();
+	if (saveInProgress_) {
+		saveInBackground(model, filePath);
+		return true;
 	}
 
-	// create a new file
-	QFile newFile(filePath);
-	if (!newFile.open(QFile::WriteOnly | QFile::Truncate)) {
-		emit errorMessage(tr("Could not open file %1 for writing").arg(filePath));
+	QString error = writeFile(model, filePath);
+	if (!error.isEmpty()) {
+		emit errorMessage(error);
 		return false;
 	}
 
-	// write the parsed model
-    model->write(newFile);
-
-	// close the file
-	newFile.close();
-
-	if (!saveInProgress_) {
-		onItemSaved(*model->getVlnv());
-	}
+	onItemSaved(*model->getVlnv());
 
 	return true;
 }
@@ -706,103 +588,6 @@ void LibraryHandler::onCheckLibraryIntegrity() {
 	QApplication::restoreOverrideCursor();
 }
 
-void LibraryHandler::getNeededVLNVs( const VLNV& vlnv, QList<VLNV>& list ) {
-	// if invalid vlnv
-	if (!vlnv.isValid())
-		return;
-
-	// get the vlnvs needed by this vlnv
-	QSharedPointer<LibraryComponent> libComponent = getModel(vlnv);
-
-	// if there was no match for the vlnv
-	if (!libComponent) {
-		emit errorMessage(tr("No item with following info was found in library: \n"
-			"Vendor: %1\n"
-			"Library: %2\n"
-			"Name: %3\n"
-			"Version: %4").arg(vlnv.getVendor()).arg(vlnv.getLibrary()).arg(
-			vlnv.getName()).arg(vlnv.getVersion()));
-		return;
-	}
-
-	QList<VLNV> tempList = libComponent->getDependentVLNVs();
-
-	// this document is searched so add it to the list
-	list.append(vlnv);
-
-	// search all documents that are not yet added to the list
-	for (int i = 0; i < tempList.size(); ++i) {
-
-		// if the vlnv is not yet added to the list
-		if (!list.contains(tempList.at(i))) {
-
-			// search recursively for vlnvs
-			getNeededVLNVs(tempList.at(i), list);
-		}
-	}
-}
-
-void LibraryHandler::getHierarchicalDependencyFiles( const VLNV& vlnv, QStringList& list ) {
-	
-	// first get files of the top component
-	getDependencyFiles(vlnv, list);
-	
-	// create the model of the vlnv
-	QSharedPointer<LibraryComponent> libComponent = getModel(vlnv);
-
-	// ask the dependencies of the object and call function recursively for children
-	QList<VLNV> dependencies = libComponent->getDependentVLNVs();
-	foreach (VLNV dependency, dependencies) {
-		getHierarchicalDependencyFiles(dependency, list);
-	}
-}
-
-void LibraryHandler::getDependencyFiles( const VLNV& vlnv, QStringList& list ) {
-
-	// create the model of the vlnv
-	QSharedPointer<LibraryComponent> libComponent = getModel(vlnv);
-	QStringList ownList = libComponent->getDependentFiles();
-
-	// go through all files and convert the relative file path to an absolute
-	// one to make the file accessible in the caller function
-	for (int i = 0; i < ownList.size(); ++i) {
-
-		// get path to the IP-Xact document that is used as base for relative
-		// file paths
-		QString ipPath = data_->getPath(vlnv);
-
-		QFileInfo ipInfo(ipPath);
-
-		// if the file can't be found print error to the user
-		if (!ipInfo.exists()) {
-			emit errorMessage(tr("File %1 can't be found in file system").arg(
-				ipInfo.filePath()));
-
-			// and continue to next file
-			continue;
-		}
-
-		QDir ipDir(ipInfo.absolutePath());
-
-		// path to the single dependency file
-		QString fullFilePath = ipDir.absoluteFilePath(ownList.at(i));
-
-		// make sure the file exists
-		QFileInfo fileInfo(fullFilePath);
-		if (fileInfo.exists() && !list.contains(fileInfo.canonicalFilePath())) {
-
-			// if file existed and it wasn't yet on the list, add it to the
-			// list of files
-			list.append(fileInfo.canonicalFilePath());
-		}
-	}
-}
-
-LibraryItem const* LibraryHandler::getTreeRoot() const {
-	
-	return treeModel_->getRoot();
-}
-
 void LibraryHandler::onSelectionChanged( const VLNV& vlnv ) {
 	// if vlnv was invalid
 	if (!vlnv.isValid())
@@ -820,14 +605,6 @@ void LibraryHandler::onClearSelection() {
 	treeWidget_->selectItem(VLNV());
 }
 
-VLNV::IPXactType LibraryHandler::getDocumentType(const VLNV& vlnv) {
-
-	if (!vlnv.isValid())
-		return VLNV::INVALID;
-
-	return data_->getType(vlnv);
-}
-
 void LibraryHandler::onEditItem( const VLNV& vlnv ) {
 
 	if (!vlnv.isValid())
@@ -1125,28 +902,6 @@ void LibraryHandler::onCreateDesign( const VLNV& vlnv ) {
 	//emit openDesign(vlnv, QString());
 }
 
-int LibraryHandler::referenceCount( const VLNV& vlnv ) const {
-	QList<VLNV> list;
-	hierarchyModel_->getOwners(list, vlnv);
-	return list.size();
-}
-
-int LibraryHandler::getOwners( QList<VLNV>& list, const VLNV& vlnvToSearch ) const {
-	hierarchyModel_->getOwners(list, vlnvToSearch);
-	return list.size();
-}
-
-int LibraryHandler::getChildren( QList<VLNV>& list, const VLNV& vlnvToSearch ) const {
-
-	if (!vlnvToSearch.isValid()) {
-		return 0;
-	}
-
-	// find the child items
-	hierarchyModel_->getChildren(list, vlnvToSearch);
-	return list.size();
-}
-
 void LibraryHandler::removeObject( const VLNV& vlnv ) {
 
 	if (!vlnv.isValid())
@@ -1401,82 +1156,6 @@ void LibraryHandler::onItemSaved( const VLNV& vlnv ) {
 	}
 }
 
-VLNV LibraryHandler::getDesignVLNV( const VLNV& hierarchyRef ) {
-	if (!data_->contains(hierarchyRef)) {
-		emit errorMessage(tr("VLNV: %1:%2:%3:%4 was not found in library.").arg(
-			hierarchyRef.getVendor()).arg(
-			hierarchyRef.getLibrary()).arg(
-			hierarchyRef.getName()).arg(
-			hierarchyRef.getVersion()));
-		return VLNV();
-	}
-
-	QSharedPointer<LibraryComponent> libComp = getModel(hierarchyRef);
-
-	// if the hierarchical reference was for design configuration
-	if (data_->getType(hierarchyRef) == VLNV::DESIGNCONFIGURATION) {
-		QSharedPointer<DesignConfiguration> desConf = libComp.staticCast<DesignConfiguration>();
-
-		VLNV designVLNV = desConf->getDesignRef();
-		// if design vlnv was not found in library
-		if (!data_->contains(designVLNV)) {
-			QString errorMsg(tr("VLNV: %1:%2:%3:%4 was not found in library.").arg(
-				designVLNV.getVendor()).arg(designVLNV.getLibrary()).arg(designVLNV.getName()).arg(
-				designVLNV.getVersion()));
-			emit errorMessage(errorMsg);
-			return VLNV();
-		}
-		// if the vlnv is not for design
-		else if (data_->getType(designVLNV) != VLNV::DESIGN) {
-			QString errorMsg(tr("VLNV: %1:%2:%3:%4 was not for design.").arg(
-				designVLNV.getVendor()).arg(designVLNV.getLibrary()).arg(designVLNV.getName()).arg(
-				designVLNV.getVersion()));
-			emit errorMessage(errorMsg);
-			return VLNV();
-		}
-		designVLNV.setType(VLNV::DESIGN);
-		return designVLNV;
-	}
-
-	// if the hierarchical reference was directly for a design
-	else if (data_->getType(hierarchyRef) == VLNV::DESIGN) {
-		return hierarchyRef;
-	}
-	// if hierarchy reference is not for design or design configuration
-	else {
-		emit errorMessage(tr("VLNV: %1:%2:%3:%4 was not valid hierarchical reference.").arg(
-			hierarchyRef.getVendor()).arg(
-			hierarchyRef.getLibrary()).arg(
-			hierarchyRef.getName()).arg(
-			hierarchyRef.getVersion()));
-		return VLNV();
-	}
-}
-
-QSharedPointer<Design> LibraryHandler::getDesign( const VLNV& hierarchyRef ) {
-	if (!data_->contains(hierarchyRef)) {
-		emit errorMessage(tr("VLNV: %1:%2:%3:%4 was not found in library.").arg(
-			hierarchyRef.getVendor()).arg(
-			hierarchyRef.getLibrary()).arg(
-			hierarchyRef.getName()).arg(
-			hierarchyRef.getVersion()));
-		return QSharedPointer<Design>();
-	}
-
-	// get the vlnv for the design
-	VLNV designVlnv = getDesignVLNV(hierarchyRef);
-	
-	// if design was found
-	if (designVlnv.isValid()) {
-		QSharedPointer<LibraryComponent> libComp = getModel(designVlnv);
-		return libComp.staticCast<Design>();
-	}
-	// design was not found
-	else {
-		return QSharedPointer<Design>();
-	}
-}
-
 void LibraryHandler::beginSave() {
 	saveInProgress_ = true;
 }
@@ -1484,6 +1163,17 @@ void LibraryHandler::beginSave() {
 void LibraryHandler::endSave() {
 	saveInProgress_ = false;
 
+	// the library is updated when the last document being saved has been written
+	if (backgroundSaves_.isEmpty()) {
+		finishSave();
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::finishSave()
+//-----------------------------------------------------------------------------
+void LibraryHandler::finishSave()
+{
 	// if there are no new items to add
 	if (itemsToAdd_.isEmpty()) {
 		hierarchyModel_->onResetModel();
@@ -1496,6 +1186,9 @@ void LibraryHandler::endSave() {
 			i != itemsToAdd_.end(); ++i) {
 
 			data_->addVLNV(i.key(), i.value());
+
+			// make sure the item is parsed from the written file next time
+			objects_.remove(i.key());
 		}
 		itemsToAdd_.clear();
 
@@ -1504,27 +1197,109 @@ void LibraryHandler::endSave() {
 	}
 }
 
-bool LibraryHandler::isValid( const VLNV& vlnv ) {
-	
-	QSharedPointer<LibraryComponent> libComp;
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::onBackgroundSaveFinished()
+//-----------------------------------------------------------------------------
+void LibraryHandler::onBackgroundSaveFinished()
+{
+    QFutureWatcher<QString>* watcher = static_cast<QFutureWatcher<QString>*>(sender());
+    if (backgroundSaves_.contains(watcher))
+    {
+        commitBackgroundSave(watcher);
+    }
+}
 
-	// if object has already been parsed before
-	if (objects_.contains(vlnv)) {
-		libComp = objects_.value(vlnv);
-	}
-	else {
-		libComp = getModel(vlnv);
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::finishBackgroundSaves()
+//-----------------------------------------------------------------------------
+void LibraryHandler::finishBackgroundSaves()
+{
+    while (!backgroundSaves_.isEmpty())
+    {
+        QFutureWatcher<QString>* watcher = backgroundSaves_.firstKey();
+        watcher->waitForFinished();
+        commitBackgroundSave(watcher);
+    }
+}
 
-		// if the object was not found
-		if (!libComp) {
-			return false;
-		}
-	}
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::onDocumentOpened()
+//-----------------------------------------------------------------------------
+void LibraryHandler::onDocumentOpened(VLNV const& vlnv)
+{
+    data_->keepSnapshots(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::commitBackgroundSave()
+//-----------------------------------------------------------------------------
+void LibraryHandler::commitBackgroundSave(QFutureWatcher<QString>* watcher)
+{
+    BackgroundSave save = backgroundSaves_.take(watcher);
+
+    QString error = watcher->result();
+    watcher->disconnect(this);
+    watcher->deleteLater();
+
+    VLNV vlnv = *save.cachedModel->getVlnv();
+
+    if (!error.isEmpty())
+    {
+        emit errorMessage(error);
+
+        // A new item that could not be written is not added to the library.
+        if (itemsToAdd_.value(vlnv) == save.filePath)
+        {
+            itemsToAdd_.remove(vlnv);
+        }
+    }
+
+    // Make sure the object is parsed again next time, unless it is being saved again. The new items
+    // are kept until they have been added to the library.
+    if (objects_.value(vlnv) == save.cachedModel && !itemsToAdd_.contains(vlnv))
+    {
+        objects_.remove(vlnv);
+    }
 
-	QString path = data_->getPath(vlnv);
-	Q_ASSERT(!path.isEmpty());
+    if (backgroundSaves_.isEmpty() && !saveInProgress_)
+    {
+        finishSave();
+    }
 
-	return data_->checkObject(libComp, path, false);
+    emit backgroundSaveFinished(vlnv, error.isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::saveInBackground()
+//-----------------------------------------------------------------------------
+void LibraryHandler::saveInBackground(QSharedPointer<LibraryComponent> model, QString const& filePath)
+{
+    // The writes to the same file must be committed in the order they were requested.
+    for (QMap<QFutureWatcher<QString>*, BackgroundSave>::const_iterator i = backgroundSaves_.constBegin();
+        i != backgroundSaves_.constEnd(); ++i)
+    {
+        if (i.value().filePath == filePath)
+        {
+            i.key()->waitForFinished();
+        }
+    }
+
+    // The caller may continue editing the model, so the worker writes a copy of it. The copy is only
+    // read from now on, so it is also used as the parsed object until the file has been written.
+    BackgroundSave save;
+    save.filePath = filePath;
+    save.cachedModel = model->clone();
+
+    VLNV vlnv = *save.cachedModel->getVlnv();
+    objects_.insert(vlnv, save.cachedModel);
+
+    QFutureWatcher<QString>* watcher = new QFutureWatcher<QString>(this);
+    connect(watcher, SIGNAL(finished()), this, SLOT(onBackgroundSaveFinished()), Qt::UniqueConnection);
+
+    backgroundSaves_.insert(watcher, save);
+    watcher->setFuture(QtConcurrent::run(&LibraryHandlerBase::writeFile, save.cachedModel, filePath));
+
+    emit backgroundSaveStarted(vlnv);
 }
 
 void LibraryHandler::clearDirectoryStructure( const QString& dirPath,
@@ -1618,4 +1393,19 @@ void LibraryHandler::connectLibraryFilter(LibraryFilter* filter, VLNVDialer* dia
         filter, SLOT(onTypeChanged(const Utils::TypeOptions&)), Qt::UniqueConnection);
     connect(dialer, SIGNAL(hierarchyChanged(const Utils::HierarchyOptions&)),
         filter, SLOT(onHierarchyChanged(const Utils::HierarchyOptions&)), Qt::UniqueConnection);
+}
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::reportError()
+//-----------------------------------------------------------------------------
+void LibraryHandler::reportError(QString const& message)
+{
+    emit errorMessage(message);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::reportNotice()
+//-----------------------------------------------------------------------------
+void LibraryHandler::reportNotice(QString const& message)
+{
+    emit noticeMessage(message);
 }
\ No newline at end of file
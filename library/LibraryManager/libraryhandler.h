@@ -7,7 +7,7 @@
 #ifndef LIBRARYHANDLER_H
 #define LIBRARYHANDLER_H
 
-#include "libraryinterface.h"
+#include "LibraryHandlerBase.h"
 #include "librarytreewidget.h"
 #include "librarydata.h"
 #include "librarytreemodel.h"
@@ -22,6 +22,7 @@
 #include <QDir>
 #include <QList>
 #include <QFileInfo>
+#include <QFutureWatcher>
 #include <QSharedPointer>
 #include <QMap>
 #include <QObject>
@@ -35,7 +36,7 @@ class VLNVDialer;
 /*! \brief LibraryHandler is the class that implements the services to manage library
  *
  */
-class LibraryHandler : public QTabWidget, public LibraryInterface
+class LibraryHandler : public QTabWidget, public LibraryHandlerBase
 {
     Q_OBJECT
 
@@ -51,30 +52,6 @@ public:
 	//! \brief The destructor
     virtual ~LibraryHandler();
 
-	/*! \brief Get a model that matches given VLNV.
-	 *
-	 * This function can be called to get a model that matches an IP-Xact document.
-	 * 
-	 * \param vlnv Identifies the desired document.
-	 *
-	 * \return Shared pointer to the model that matches the document.
-	 * If vlnv is not found in library a null pointer is returned. The ownership 
-	 * of the parsed object remains on Library Handler.
-	*/
-	virtual QSharedPointer<LibraryComponent> getModel(const VLNV& vlnv);
-
-    /*! \brief Get a model that matches given VLNV for read-only access.
-	 *
-	 * This function can be called to get a model that matches an IP-Xact document.
-	 * 
-	 * \param vlnv Identifies the desired document.
-	 *
-	 * \return Shared pointer to the model that matches the document.
-	 * If vlnv is not found in library a null pointer is returned. The ownership 
-	 * of the parsed object remains on Library Handler.
-	*/
-	virtual QSharedPointer<LibraryComponent const> getModelReadOnly(const VLNV& vlnv);
-
 	/*! \brief Add a new VLNV tag to the library
 	 *
 	 * This function adds the specified VLNV into the library. The document
@@ -89,35 +66,6 @@ public:
 	 */
 	//virtual bool registerVLNV(const VLNV& vlnv, const QString& path);
 
-	/*! \brief Checks if the library already contains the specified vlnv.
-	 *
-	 * \param vlnv The vlnv that is searched within the library.
-	 *
-	 * \return True if the vlnv was found
-	*/
-	virtual bool contains(const VLNV& vlnv);
-
-	/*! \brief Get a path to the specified IP-Xact document.
-	 *
-	 * \param vlnv Specifies the wanted IP-Xact document.
-	 *
-	 * \return const QString containing the path to the document. If vlnv is not
-	 * found then null string is returned.
-	*/
-	virtual const QString getPath(const VLNV& vlnv) const;
-
-	/*! \brief Get the directory path to the specified IP-XACT document.
-	 *
-	 * Method: 		getDirectoryPath
-	 * Full name:	LibraryInterface::getDirectoryPath
-	 * Access:		virtual public 
-	 *
-	 * \param vlnv Specifies the wanted IP-XACT document.
-	 *
-	 * \return QString containing the directory path to the document. Does not contain the xml file name.
-	*/
-	virtual QString getDirectoryPath(const VLNV& vlnv) const;
-
 	/*! \brief Write the model to file system to given file path
      *
      * This function takes the given directory path and writes the given model to
@@ -127,11 +75,16 @@ public:
      * When model is saved using this function it is not necessary to call 
      * onItemSaved() because it is called by this function.
      *
+     * Between beginSave() and endSave() a copy of the model is written on a worker
+     * thread. The write is reported with backgroundSaveStarted() and its result with
+     * backgroundSaveFinished().
+     *
      * \param path Directory path that specifies the directory to save to file into.
      * \param model Pointer to the library component that is written.
      * \param printErrors If true then the errors detected in the model are printed to user.
      * 
-     * \return True if the model was in valid state and was successfully written.
+     * \return True if the model was in valid state and was successfully written or,
+     * between beginSave() and endSave(), if the write was started.
      */
     virtual bool writeModelToFile(const QString path, 
 		QSharedPointer<LibraryComponent> model,
@@ -144,10 +97,15 @@ public:
 	 * to the previous file so the model can not be restored to it's previous 
 	 * state after this operation.
 	 * 
+	 * Between beginSave() and endSave() a copy of the model is written on a worker
+	 * thread. The write is reported with backgroundSaveStarted() and its result with
+	 * backgroundSaveFinished().
+	 * 
 	 * \param model Pointer to the model to be written.
 	 * \param printErrors If true then the errors detected in the model are printed to user.
 	 * 
-	 * \return True if the model was in valid state and was successfully written.
+	 * \return True if the model was in valid state and was successfully written or,
+	 * between beginSave() and endSave(), if the write was started.
 	*/
 	virtual bool writeModelToFile(QSharedPointer<LibraryComponent> model,
 		bool printErrors = true);
@@ -158,124 +116,6 @@ public:
 	 * within subdirectories.
 	*/
 	virtual void searchForIPXactFiles();
-    
-	/*! \brief Get list of vlnvs that are needed by given document.
-	 *
-	 * This function takes an IP-Xact document and searches it and returns list
-	 * of all vlnvs that are needed by that document. Function also searches
-	 * all possible sub vlnvs that need other vlnvs and adds them to the list.
-	 * The list doesn't contain single vlnv twice.
-	 *
-	 * \param vlnv Reference to the vlnv that is used as starting point for the
-	 * search.
-	 * \param list Reference to the list where all vlnvs are added to.
-	 *
-	 * \return List containing all vlnvs that are referenced in any of the
-	 * documents.
-	 */
-	 virtual void getNeededVLNVs(const VLNV& vlnv, QList<VLNV>& list);
-
-	 /*! \brief Get list of files that are needed by the given document.
-	 *
-	 * This function returns a list of file paths that are converted as
-	 * absolute file paths to the needed files. This function searches files
-	 * only from this document, it does not search possible subcomponents.
-	 *
-	 * \param vlnv Reference to the vlnv that is used for the search.
-	 * \param list The files are appended to the list if they are not
-	 * already on the list.
-	 */
-	 virtual void getDependencyFiles(const VLNV& vlnv, QStringList& list);
-
-	 /*! \brief Get list of the files that are needed by the given document either directly or indirectly.
-	  *
-	  * \param vlnv The vlnv identifying the document.
-	  * \param list The files are appended to the list if they are not already on the list.
-	  *
-	 */
-	 virtual void getHierarchicalDependencyFiles(const VLNV& vlnv, QStringList& list);
-
-	 /*! \brief Get const-pointer to the library tree's root item
-	 *
-	 * \return LibraryItem const* Pointer to the root item.
-	 */
-	 virtual LibraryItem const* getTreeRoot() const;
-
-	 /*! \brief Get the document type of given vlnv.
-	 * 
-	 * If vlnv is not found in the library then VLNV::INVALID is returned.
-	 *
-	 * \param vlnv Specifies the document that's type is wanted.
-	 *
-	 * \return VLNV::IPXactType Type of the document.
-	*/
-	virtual VLNV::IPXactType getDocumentType(const VLNV& vlnv);
-
-	/*! \brief Count how many times the given component is instantiated in the library.
-	 *
-	 * \param vlnv Identifies the component that's instances are searched.
-	 *
-	 * \return Number of found instances.
-	 */
-	virtual int referenceCount(const VLNV& vlnv) const;
-
-	/*! \brief Get the items that have referenced the given vlnv in their meta data.
-	 *
-	 * \param list QList where the search results are appended.
-	 * \param vlnvToSearch Identifies the item to search for.
-	 * 
-	 * \return Number of owners found.
-	 *
-	*/
-	virtual int getOwners(QList<VLNV>& list, const VLNV& vlnvToSearch) const;
-
-	/*! \brief Get the items that are needed by the specified item.
-	 *
-	 * \param list QList where the search results are appended.
-	 * \param vlnvToSearch Identifies the item thats child-items are wanted.
-	 *
-	 * \return int The number of found children.
-	*/
-	virtual int getChildren(QList<VLNV>& list, const VLNV& vlnvToSearch) const;
-
-	/*! \brief Get the VLNV of the design for a given hierarchy reference.
-	 *
-	 * This function can be used by calling it with a hierarchy reference found
-	 * if a component's hierarchical view. Function checks if the reference is
-	 * directly for a design and returns the design vlnv. If reference is for a
-	 * configuration then the design vlnv is searched from the configuration and
-	 * design vlnv is returned. If design is not found then invalid vlnv is 
-	 * returned.
-	 * 
-	 * \param hierarchyRef The hierarchical reference obtained from component's view.
-	 *
-	 * \return VLNV The vlnv identifying the design object.
-	*/
-	virtual VLNV getDesignVLNV(const VLNV& hierarchyRef);
-
-	/*! \brief Get pointer to the design for a given hierarchy reference.
-	 * 
-	 * * This function can be used by calling it with a hierarchy reference found
-	 * if a component's hierarchical view. Function checks if the reference is
-	 * directly for a design and returns the design pointer. If reference is for a
-	 * configuration then the design vlnv is searched from the configuration and
-	 * design pointer is returned. If design is not found then null pointer is 
-	 * returned.
-	 * 
-	 * \param hierarchyRef The hierarchical reference obtained from component's view.
-	 *
-	 * \return QSharedPointer<Design> Pointer to the design.
-	*/
-	virtual QSharedPointer<Design> getDesign(const VLNV& hierarchyRef);
-
-	/*! \brief Check if the identified object is in valid state.
-	 *
-	 * \param vlnv Identifies the object to check.
-	 *
-	 * \return bool True if the object was valid. False if invalid or object was
-	 * not found in library.
-	*/
-	virtual bool isValid(const VLNV& vlnv);
 
 public slots:
 
@@ -395,7 +235,8 @@ public slots:
 	*
 	* When calling this before saving and then using writeModelToFile() the 
 	* library is not update between each save operation thus making the program
-	* faster.
+	* faster. The documents are written on worker threads and each file is replaced
+	* only after the new document has been completely written.
 	* 
 	* Be sure to call endSave() after all items are saved.
 	*/
@@ -404,9 +245,22 @@ public slots:
 	/*! \brief End the saving operation and update the library.
 	*
 	* This function must be called always after calling the beginSave().
+	* The library is updated when all the documents have been written.
 	*/
 	virtual void endSave();
 
+    /*!
+     *  Waits until all the documents being written on worker threads have been written or failed.
+     */
+    void finishBackgroundSaves();
+
+    /*!
+     *  Keeps snapshots of the given document so that reopening it for editing is fast.
+     *
+     *      @param [in] vlnv    Identifies the document opened for editing.
+     */
+    void onDocumentOpened(VLNV const& vlnv);
+
 signals:
 
 	//! \brief Emit an error message to be printed to user.
@@ -474,6 +328,21 @@ signals:
 	//! \brief Signal that user wants to open a platform component.
 	void openPlatformComponent(const VLNV& vlnv);
 
+    /*!
+     *  Emitted when a document starts to be written on a worker thread.
+     *
+     *      @param [in] vlnv    The VLNV of the document being written.
+     */
+    void backgroundSaveStarted(VLNV const& vlnv);
+
+    /*!
+     *  Emitted when a document written on a worker thread has been written or the write has failed.
+     *
+     *      @param [in] vlnv        The VLNV of the written document.
+     *      @param [in] succeeded   True, if the file was written, otherwise false.
+     */
+    void backgroundSaveFinished(VLNV const& vlnv, bool succeeded);
+
 private slots:
 
 	/*! \brief Remove the item with specified vlnv from the library.
@@ -501,6 +370,11 @@ private slots:
 	*/
 	void onItemSaved(const VLNV& vlnv);
 
+    /*!
+     *  Called when a document has been written on a worker thread.
+     */
+    void onBackgroundSaveFinished();
+
 private:
 
     //! \brief No copying
@@ -584,18 +458,44 @@ private:
      */
     void connectLibraryFilter(LibraryFilter* filter, VLNVDialer* dialer) const;
 
-    //-----------------------------------------------------------------------------
-    // Data.
-    //-----------------------------------------------------------------------------
+    //! Emits the error as errorMessage().
+    virtual void reportError(QString const& message);
 
-	//! \brief The data model that contains the library and is model for search view
-    QSharedPointer<LibraryData> data_;
+    //! Emits the notice as noticeMessage().
+    virtual void reportNotice(QString const& message);
 
-	//! \brief The model for the tree view
-    QSharedPointer<LibraryTreeModel> treeModel_;
+    /*!
+     *  Writes a copy of the model to the given file on a worker thread.
+     *
+     *      @param [in] model       The model to write.
+     *      @param [in] filePath    The path of the file to write.
+     */
+    void saveInBackground(QSharedPointer<LibraryComponent> model, QString const& filePath);
 
-	//! \brief The model for the hierarchy view
-	QSharedPointer<HierarchyModel> hierarchyModel_;
+    /*!
+     *  Updates the library with the result of a document written on a worker thread.
+     *
+     *      @param [in] watcher     The watcher of the finished write.
+     */
+    void commitBackgroundSave(QFutureWatcher<QString>* watcher);
+
+    /*!
+     *  Updates the library with the items saved after beginSave().
+     */
+    void finishSave();
+
+    //-----------------------------------------------------------------------------
+    //! A document being written on a worker thread.
+    //-----------------------------------------------------------------------------
+    struct BackgroundSave
+    {
+        QString filePath;                               //!< The path of the file being written.
+        QSharedPointer<LibraryComponent> cachedModel;   //!< The copy being written, also the parsed object.
+    };
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
 
 	//! \brief The widget that contains the GUI items for the tree tab
     LibraryTreeWidget* treeWidget_;
@@ -603,18 +503,14 @@ private:
 	//! \brief The widget that contains the GUI items for the hierarchy tab
 	HierarchyWidget* hierarchyWidget_;
 
-	/*! \brief Contains the library objects that have been parsed.
-	 *
-	 * Key = VLNV that identifies the library object.
-	 * Value = pointer to the library object that has been parsed.
-	 */
-	QMap<VLNV, QSharedPointer<LibraryComponent> > objects_;
-
 	//! \brief If true then items are being saved and library is not refreshed
 	bool saveInProgress_;
 
 	//! \brief Contains the IP-Xact items to be added to the library
 	QMap<VLNV, QString> itemsToAdd_;
+
+    //! The documents being written on worker threads.
+    QMap<QFutureWatcher<QString>*, BackgroundSave> backgroundSaves_;
 };
 
 #endif // LIBRARYHANDLER_H
@@ -49,6 +49,17 @@ public:
 	*/
 	virtual QSharedPointer<LibraryComponent const> getModelReadOnly(const VLNV& vlnv) = 0;
 
+    /*!
+     *  Parses the models matching the given VLNVs in advance so that the following calls to getModel()
+     *  for them are served from memory.
+     *
+     *      @param [in] vlnvs   Identifies the documents to parse.
+     *
+     *      @remarks The documents are parsed in parallel in the background and the call returns at once.
+     *               A call to getModel() waits only for the requested document, if it is still being parsed.
+     */
+    virtual void prefetchModels(QList<VLNV> const& vlnvs) = 0;
+
 	/*! \brief Add a new VLNV tag to the library
 	 *
 	 * This function adds the specified VLNV into the library. The document
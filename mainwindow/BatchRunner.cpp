@@ -0,0 +1,477 @@
+//-----------------------------------------------------------------------------
+// File: BatchRunner.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Runs the library integrity check and generators without the user interface.
+//-----------------------------------------------------------------------------
+
+#include "BatchRunner.h"
+
+#include <library/LibraryManager/HeadlessLibraryHandler.h>
+
+#include <common/PerformanceTrace/PerformanceTrace.h>
+#include <common/PerformanceTrace/ScopedTrace.h>
+
+#include <IPXACTmodels/component.h>
+#include <IPXACTmodels/librarycomponent.h>
+
+#include <Plugins/PluginSystem/IGeneratorPlugin.h>
+#include <Plugins/PluginSystem/PluginManager.h>
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonDocument>
+#include <QMap>
+#include <QSettings>
+#include <QTextStream>
+
+namespace
+{
+    //! The command line option that selects the batch mode.
+    const QString BATCH_OPTION = "--batch";
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::BatchRunner()
+//-----------------------------------------------------------------------------
+BatchRunner::BatchRunner(QObject* parent):
+QObject(parent),
+library_(0),
+pluginManager_(),
+generatorNames_(),
+targets_(),
+viewName_(),
+outputPath_(),
+settingsPath_(),
+messages_(),
+errorCount_(0)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::~BatchRunner()
+//-----------------------------------------------------------------------------
+BatchRunner::~BatchRunner()
+{
+    delete library_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::isBatchMode()
+//-----------------------------------------------------------------------------
+bool BatchRunner::isBatchMode(int argc, char* argv[])
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        if (BATCH_OPTION == argv[i])
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::run()
+//-----------------------------------------------------------------------------
+int BatchRunner::run(QStringList const& arguments)
+{
+    if (!parseArguments(arguments))
+    {
+        printUsage();
+        return INVALID_ARGUMENTS;
+    }
+
+    // Use the same settings as the user interface.
+    QCoreApplication::setOrganizationDomain(tr("tut.fi"));
+    QCoreApplication::setOrganizationName(tr("TUT"));
+    QCoreApplication::setApplicationName(tr("Kactus2"));
+    QCoreApplication::setApplicationVersion("2.0");
+    QSettings::setDefaultFormat(QSettings::IniFormat);
+
+    if (!settingsPath_.isEmpty())
+    {
+        QSettings::setPath(QSettings::IniFormat, QSettings::UserScope, settingsPath_);
+    }
+
+    PerformanceTrace::enableFromSettings();
+
+    library_ = new HeadlessLibraryHandler();
+
+    connect(library_, SIGNAL(errorMessage(const QString&)),
+        this, SLOT(onErrorMessage(QString const&)), Qt::UniqueConnection);
+    connect(library_, SIGNAL(noticeMessage(const QString&)),
+        this, SLOT(onNoticeMessage(QString const&)), Qt::UniqueConnection);
+
+    QSettings settings;
+    QStringList pluginsPath = settings.value("Platform/PluginsPath", QStringList("Plugins")).toStringList();
+    pluginManager_ = QSharedPointer<PluginManager>(new PluginManager(pluginsPath));
+
+    QJsonObject libraryResults = checkLibrary();
+    bool success = libraryResults.value("valid").toBool();
+
+    QJsonArray generatorResults;
+    foreach (VLNV const& target, targets_)
+    {
+        foreach (QJsonValue result, runGenerators(target))
+        {
+            success = success && result.toObject().value("status").toString() == "completed";
+            generatorResults.append(result);
+        }
+    }
+
+    QJsonObject results;
+    results.insert("library", libraryResults);
+    results.insert("generators", generatorResults);
+    results.insert("success", success);
+
+    if (!writeResults(results))
+    {
+        return FAILURE;
+    }
+
+    if (success)
+    {
+        return SUCCESS;
+    }
+
+    return FAILURE;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::printError()
+//-----------------------------------------------------------------------------
+void BatchRunner::printError(QString const& message)
+{
+    addMessage("error", message);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::printInfo()
+//-----------------------------------------------------------------------------
+void BatchRunner::printInfo(QString const& message)
+{
+    addMessage("info", message);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::getLibraryInterface()
+//-----------------------------------------------------------------------------
+LibraryInterface* BatchRunner::getLibraryInterface()
+{
+    return library_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::getParentWidget()
+//-----------------------------------------------------------------------------
+QWidget* BatchRunner::getParentWidget()
+{
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::isInteractive()
+//-----------------------------------------------------------------------------
+bool BatchRunner::isInteractive() const
+{
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::onErrorMessage()
+//-----------------------------------------------------------------------------
+void BatchRunner::onErrorMessage(QString const& message)
+{
+    addMessage("error", message);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::onNoticeMessage()
+//-----------------------------------------------------------------------------
+void BatchRunner::onNoticeMessage(QString const& message)
+{
+    addMessage("info", message);
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::parseArguments()
+//-----------------------------------------------------------------------------
+bool BatchRunner::parseArguments(QStringList const& arguments)
+{
+    for (int i = 1; i < arguments.size(); ++i)
+    {
+        QString const& option = arguments.at(i);
+
+        if (option == BATCH_OPTION)
+        {
+            continue;
+        }
+
+        // All other options require a value.
+        if (i + 1 == arguments.size())
+        {
+            return false;
+        }
+
+        QString value = arguments.at(++i);
+
+        if (option == "--generator")
+        {
+            generatorNames_.append(value);
+        }
+        else if (option == "--vlnv")
+        {
+            VLNV target(VLNV::COMPONENT, value);
+            if (!target.isValid())
+            {
+                return false;
+            }
+
+            targets_.append(target);
+        }
+        else if (option == "--view")
+        {
+            viewName_ = value;
+        }
+        else if (option == "--output")
+        {
+            outputPath_ = value;
+        }
+        else if (option == "--settings")
+        {
+            settingsPath_ = value;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return generatorNames_.isEmpty() || !targets_.isEmpty();
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::printUsage()
+//-----------------------------------------------------------------------------
+void BatchRunner::printUsage() const
+{
+    QTextStream errorStream(stderr);
+    errorStream << "Usage: Kactus2 --batch [options]" << endl
+        << endl
+        << "Scans the active library locations, checks the library integrity and runs the" << endl
+        << "given generators. The results are written as JSON." << endl
+        << endl
+        << "Options:" << endl
+        << "  --generator <name>    Run the named generator plugin. Can be given multiple times." << endl
+        << "  --vlnv <vlnv>         Run the generators for vendor:library:name:version." << endl
+        << "                        Can be given multiple times." << endl
+        << "  --view <name>         Use the design of the given hierarchical view." << endl
+        << "  --output <file>       Write the results to the file instead of standard output." << endl
+        << "  --settings <dir>      Read the settings from the given directory." << endl;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::checkLibrary()
+//-----------------------------------------------------------------------------
+QJsonObject BatchRunner::checkLibrary()
+{
+    messages_ = QJsonArray();
+    errorCount_ = 0;
+
+    // Scanning the library also runs the integrity check.
+    library_->searchForIPXactFiles();
+
+    // The results of the integrity check are reported as such instead of checking each document again.
+    int itemCount = library_->getAllVLNVs().size();
+
+    QJsonArray invalidItems;
+    QMap<VLNV, QString> invalidPaths = library_->getInvalidItems();
+    for (QMap<VLNV, QString>::const_iterator i = invalidPaths.constBegin(); i != invalidPaths.constEnd(); ++i)
+    {
+        QJsonObject item;
+        item.insert("vlnv", i.key().toString());
+        item.insert("path", i.value());
+        invalidItems.append(item);
+
+        // The documents that could not be parsed have been removed from the library.
+        if (!library_->contains(i.key()))
+        {
+            itemCount++;
+        }
+    }
+
+    int integrityErrors = library_->getIntegrityErrorCount();
+
+    QJsonObject results;
+    results.insert("itemCount", itemCount);
+    results.insert("errorCount", errorCount_);
+    results.insert("integrityErrorCount", integrityErrors);
+    results.insert("valid", errorCount_ == 0 && integrityErrors == 0 && invalidItems.isEmpty());
+    results.insert("invalidItems", invalidItems);
+    results.insert("messages", messages_);
+
+    return results;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::runGenerators()
+//-----------------------------------------------------------------------------
+QJsonArray BatchRunner::runGenerators(VLNV const& vlnv)
+{
+    QJsonArray results;
+
+    foreach (QString const& generatorName, generatorNames_)
+    {
+        messages_ = QJsonArray();
+        errorCount_ = 0;
+
+        QString status = "failed";
+
+        IGeneratorPlugin* plugin = findGenerator(generatorName);
+        if (plugin == 0)
+        {
+            printError(tr("Generator %1 was not found.").arg(generatorName));
+        }
+        else if (!library_->contains(vlnv))
+        {
+            printError(tr("VLNV %1 was not found in the library.").arg(vlnv.toString()));
+        }
+        else
+        {
+            status = runGeneratorPlugin(plugin, vlnv);
+        }
+
+        QJsonObject result;
+        result.insert("generator", generatorName);
+        result.insert("vlnv", vlnv.toString());
+        result.insert("status", status);
+        result.insert("messages", messages_);
+
+        results.append(result);
+    }
+
+    return results;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::runGeneratorPlugin()
+//-----------------------------------------------------------------------------
+QString BatchRunner::runGeneratorPlugin(IGeneratorPlugin* plugin, VLNV const& vlnv)
+{
+    // Each generator gets its own copy of the models, since generators may modify them.
+    QSharedPointer<LibraryComponent> libComp = library_->getModel(vlnv);
+    QSharedPointer<LibraryComponent> libDesConf;
+    QSharedPointer<LibraryComponent> libDes;
+
+    QSharedPointer<Component> component = libComp.dynamicCast<Component>();
+    if (component && !viewName_.isEmpty())
+    {
+        VLNV hierarchyRef = component->getHierRef(viewName_);
+        if (!hierarchyRef.isValid())
+        {
+            hierarchyRef = component->getHierSWRef(viewName_);
+        }
+        if (!hierarchyRef.isValid())
+        {
+            hierarchyRef = component->getHierSystemRef(viewName_);
+        }
+
+        if (!hierarchyRef.isValid())
+        {
+            printError(tr("Component %1 has no hierarchical view %2.").arg(vlnv.toString(), viewName_));
+            return "failed";
+        }
+
+        // If the hierarchy reference is not directly to the design, a design configuration is in between.
+        VLNV designVLNV = library_->getDesignVLNV(hierarchyRef);
+        libDes = library_->getModel(designVLNV);
+
+        if (designVLNV != hierarchyRef)
+        {
+            libDesConf = library_->getModel(hierarchyRef);
+        }
+    }
+
+    if (!plugin->checkGeneratorSupport(libComp, libDesConf, libDes))
+    {
+        printInfo(tr("Generator %1 does not support %2.").arg(plugin->getName(), vlnv.toString()));
+        return "unsupported";
+    }
+
+    {
+        SCOPED_TRACE_DETAIL(trace, plugin->getName(), "generator", vlnv.toString());
+        plugin->runGenerator(this, libComp, libDesConf, libDes);
+    }
+
+    if (errorCount_ == 0)
+    {
+        return "completed";
+    }
+
+    return "failed";
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::findGenerator()
+//-----------------------------------------------------------------------------
+IGeneratorPlugin* BatchRunner::findGenerator(QString const& name) const
+{
+    foreach (IPlugin* plugin, pluginManager_->getActivePlugins())
+    {
+        IGeneratorPlugin* generator = dynamic_cast<IGeneratorPlugin*>(plugin);
+        if (generator != 0 && generator->getName().compare(name, Qt::CaseInsensitive) == 0)
+        {
+            return generator;
+        }
+    }
+
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::writeResults()
+//-----------------------------------------------------------------------------
+bool BatchRunner::writeResults(QJsonObject const& results) const
+{
+    QByteArray output = QJsonDocument(results).toJson();
+
+    if (outputPath_.isEmpty())
+    {
+        QFile outputFile;
+        return outputFile.open(stdout, QFile::WriteOnly) && outputFile.write(output) == output.size();
+    }
+
+    QFile outputFile(outputPath_);
+    if (!outputFile.open(QFile::WriteOnly | QFile::Truncate))
+    {
+        QTextStream(stderr) << tr("Could not open file %1 for writing.").arg(outputPath_) << endl;
+        return false;
+    }
+
+    return outputFile.write(output) == output.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: BatchRunner::addMessage()
+//-----------------------------------------------------------------------------
+void BatchRunner::addMessage(QString const& type, QString const& message)
+{
+    if (type == "error")
+    {
+        ++errorCount_;
+    }
+
+    QJsonObject entry;
+    entry.insert("type", type);
+    entry.insert("message", message);
+    messages_.append(entry);
+
+    QTextStream(stderr) << type << ": " << message << endl;
+}
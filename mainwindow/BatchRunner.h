@@ -0,0 +1,210 @@
+//-----------------------------------------------------------------------------
+// File: BatchRunner.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Runs the library integrity check and generators without the user interface.
+//-----------------------------------------------------------------------------
+
+#ifndef BATCHRUNNER_H
+#define BATCHRUNNER_H
+
+#include <Plugins/PluginSystem/IPluginUtility.h>
+
+#include <IPXACTmodels/vlnv.h>
+
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QObject>
+#include <QSharedPointer>
+#include <QStringList>
+
+class HeadlessLibraryHandler;
+class IGeneratorPlugin;
+class PluginManager;
+
+//-----------------------------------------------------------------------------
+//! Runs the library integrity check and generators without the user interface.
+//
+// The library is scanned from the active library locations without any dialogs. The results of the
+// integrity check and the generator runs are written as a JSON document.
+//-----------------------------------------------------------------------------
+class BatchRunner : public QObject, public IPluginUtility
+{
+    Q_OBJECT
+
+public:
+
+    //! Exit codes of the batch run.
+    enum ExitCode
+    {
+        SUCCESS = 0,        //!< The library was valid and all generators completed.
+        FAILURE = 1,        //!< Errors were found in the library or a generator failed.
+        INVALID_ARGUMENTS   //!< The command line could not be parsed.
+    };
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] parent   The parent object.
+     */
+    BatchRunner(QObject* parent = 0);
+
+    //! The destructor.
+    virtual ~BatchRunner();
+
+    /*!
+     *  Checks if the given command line requests batch mode.
+     *
+     *      @param [in] argc    The number of command line arguments.
+     *      @param [in] argv    The command line arguments.
+     *
+     *      @return True, if batch mode was requested, otherwise false.
+     */
+    static bool isBatchMode(int argc, char* argv[]);
+
+    /*!
+     *  Runs the batch with the given command line arguments.
+     *
+     *      @param [in] arguments   The command line arguments including the program name.
+     *
+     *      @return The exit code of the run.
+     */
+    int run(QStringList const& arguments);
+
+    /*!
+     *  Prints an error message to the batch output.
+     *
+     *      @param [in] message The error message to print.
+     */
+    virtual void printError(QString const& message);
+
+    /*!
+     *  Prints an info message to the batch output.
+     *
+     *      @param [in] message The info message to print.
+     */
+    virtual void printInfo(QString const& message);
+
+    //! Returns the library interface.
+    virtual LibraryInterface* getLibraryInterface();
+
+    //! Returns the parent widget to be used for e.g. dialogs.
+    virtual QWidget* getParentWidget();
+
+    //! Checks if the user can be asked for input e.g. with dialogs.
+    virtual bool isInteractive() const;
+
+private slots:
+
+    //! Called when an error message is printed by the library.
+    void onErrorMessage(QString const& message);
+
+    //! Called when a notice message is printed by the library.
+    void onNoticeMessage(QString const& message);
+
+private:
+    // Disable copying.
+    BatchRunner(BatchRunner const& rhs);
+    BatchRunner& operator=(BatchRunner const& rhs);
+
+    /*!
+     *  Reads the command line arguments.
+     *
+     *      @param [in] arguments   The command line arguments including the program name.
+     *
+     *      @return True, if the arguments were valid, otherwise false.
+     */
+    bool parseArguments(QStringList const& arguments);
+
+    //! Prints the command line usage.
+    void printUsage() const;
+
+    /*!
+     *  Scans the library and runs the integrity check.
+     *
+     *      @return The results of the integrity check.
+     */
+    QJsonObject checkLibrary();
+
+    /*!
+     *  Runs the requested generators for the given document.
+     *
+     *      @param [in] vlnv    The document to run the generators for.
+     *
+     *      @return The results of the generator runs.
+     */
+    QJsonArray runGenerators(VLNV const& vlnv);
+
+    /*!
+     *  Runs a single generator plugin.
+     *
+     *      @param [in] plugin  The generator to run.
+     *      @param [in] vlnv    The document to run the generator for.
+     *
+     *      @return The result status of the run.
+     */
+    QString runGeneratorPlugin(IGeneratorPlugin* plugin, VLNV const& vlnv);
+
+    /*!
+     *  Finds a generator plugin by name.
+     *
+     *      @param [in] name    The name of the generator, case insensitive.
+     *
+     *      @return The generator plugin or 0, if no generator was found.
+     */
+    IGeneratorPlugin* findGenerator(QString const& name) const;
+
+    /*!
+     *  Writes the given results to the output file or to standard output.
+     *
+     *      @param [in] results     The results to write.
+     *
+     *      @return True, if the results were written, otherwise false.
+     */
+    bool writeResults(QJsonObject const& results) const;
+
+    /*!
+     *  Adds a message to the messages of the current task and echoes it to standard error.
+     *
+     *      @param [in] type        The type of the message.
+     *      @param [in] message     The message text.
+     */
+    void addMessage(QString const& type, QString const& message);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The library handler used to access the library without any widgets.
+    HeadlessLibraryHandler* library_;
+
+    //! The loaded plugins.
+    QSharedPointer<PluginManager> pluginManager_;
+
+    //! The names of the generators to run.
+    QStringList generatorNames_;
+
+    //! The documents to run the generators for.
+    QList<VLNV> targets_;
+
+    //! The hierarchical view used to select the design for the generators.
+    QString viewName_;
+
+    //! The file to write the results to, empty for standard output.
+    QString outputPath_;
+
+    //! The directory containing the settings to use, empty for the default settings.
+    QString settingsPath_;
+
+    //! The messages printed during the current task.
+    QJsonArray messages_;
+
+    //! The number of errors printed during the current task.
+    int errorCount_;
+};
+
+#endif // BATCHRUNNER_H
@@ -23,7 +23,7 @@
 //-----------------------------------------------------------------------------
 // Function: DrawingBoard::DrawingBoard()
 //-----------------------------------------------------------------------------
-DrawingBoard::DrawingBoard(QWidget* parent) : QTabWidget(parent)
+DrawingBoard::DrawingBoard(QWidget* parent) : QTabWidget(parent), startedSaves_(), pendingSaves_()
 {
     connect(this, SIGNAL(tabCloseRequested(int)), this, SLOT(closeAndRemoveDocument(int)), Qt::UniqueConnection);
 }
@@ -60,6 +60,7 @@ void DrawingBoard::addAndOpenDocument(TabDocument* doc, bool forceUnlocked)
         this, SIGNAL(helpUrlRequested(QString const&)), Qt::UniqueConnection);
 
     connect(doc, SIGNAL(contentChanged()), this, SIGNAL(documentContentChanged()), Qt::UniqueConnection);
+    connect(doc, SIGNAL(contentChanged()), this, SLOT(onDocumentContentChanged()), Qt::UniqueConnection);
     connect(doc, SIGNAL(modifiedChanged(bool)), this, SIGNAL(documentModifiedChanged(bool)), Qt::UniqueConnection);
     connect(doc, SIGNAL(documentSaved(TabDocument*)),
         this, SLOT(onDocumentSaved(TabDocument*)), Qt::UniqueConnection);
@@ -73,6 +74,13 @@ void DrawingBoard::addAndOpenDocument(TabDocument* doc, bool forceUnlocked)
 
     addTab(doc, doc->getTitle());
     setCurrentWidget(doc);
+
+    emit documentOpened(doc->getDocumentVLNV());
+
+    if (doc->getIdentifyingVLNV() != doc->getDocumentVLNV())
+    {
+        emit documentOpened(doc->getIdentifyingVLNV());
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -186,6 +194,17 @@ void DrawingBoard::closeAndRemoveDocument(int index)
             {
                 return;
             }
+
+            // The document is closed only after it has been written.
+            if (pendingSaves_.contains(document))
+            {
+                emit finishBackgroundSaves();
+
+                if (document->isModified())
+                {
+                    return;
+                }
+            }
         }
         else if (saveChanges == QMessageBox::No)
         {
@@ -198,6 +217,8 @@ void DrawingBoard::closeAndRemoveDocument(int index)
         }
     }
 
+    pendingSaves_.remove(document);
+
     // Deleting a document will automatically remove the associated tab from this widget.
     // Using removeTab() triggers showEvent() in the next tab before deleted() 
     // triggers MainWindow::onClearItemSelection. This wrong order of triggers would cause the instance 
@@ -273,6 +294,62 @@ void DrawingBoard::onDocumentSaved(TabDocument* doc)
             otherDoc->requestRefresh();
         }
     }
+
+    // The changes could still be lost if the documents being written fail, so the document is kept
+    // modified until they have been written.
+    if (!startedSaves_.isEmpty())
+    {
+        pendingSaves_[doc].append(startedSaves_);
+        startedSaves_.clear();
+
+        doc->setModified(true);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: DrawingBoard::onDocumentContentChanged()
+//-----------------------------------------------------------------------------
+void DrawingBoard::onDocumentContentChanged()
+{
+    // A document changed after it was saved stays modified when the documents have been written.
+    pendingSaves_.remove(static_cast<TabDocument*>(sender()));
+}
+
+//-----------------------------------------------------------------------------
+// Function: DrawingBoard::onBackgroundSaveStarted()
+//-----------------------------------------------------------------------------
+void DrawingBoard::onBackgroundSaveStarted(VLNV const& vlnv)
+{
+    startedSaves_.append(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DrawingBoard::onBackgroundSaveFinished()
+//-----------------------------------------------------------------------------
+void DrawingBoard::onBackgroundSaveFinished(VLNV const& vlnv, bool succeeded)
+{
+    startedSaves_.removeOne(vlnv);
+
+    int documentCount = count();
+    for (int i = 0; i < documentCount; i++)
+    {
+        TabDocument* doc = static_cast<TabDocument*>(widget(i));
+
+        if (pendingSaves_.contains(doc) && pendingSaves_[doc].removeOne(vlnv))
+        {
+            if (!succeeded)
+            {
+                // The changes are kept in the document so that it can be saved again.
+                pendingSaves_.remove(doc);
+                emit errorMessage(tr("Document %1 could not be saved.").arg(doc->getDocumentName()));
+            }
+            else if (pendingSaves_.value(doc).isEmpty())
+            {
+                pendingSaves_.remove(doc);
+                doc->setModified(false);
+            }
+        }
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -12,6 +12,10 @@
 #ifndef DRAWINGBOARD_H
 #define DRAWINGBOARD_H
 
+#include <IPXACTmodels/vlnv.h>
+
+#include <QList>
+#include <QMap>
 #include <QTabWidget>
 
 class TabDocument;
@@ -71,6 +75,21 @@ public slots:
      */
     void closeAndRemoveDocument(int index);
 
+    /*!
+     *  Called when the library starts to write a document on a worker thread.
+     *
+     *      @param [in] vlnv    The VLNV of the document being written.
+     */
+    void onBackgroundSaveStarted(VLNV const& vlnv);
+
+    /*!
+     *  Called when the library has written a document on a worker thread or the write has failed.
+     *
+     *      @param [in] vlnv        The VLNV of the written document.
+     *      @param [in] succeeded   True, if the file was written, otherwise false.
+     */
+    void onBackgroundSaveFinished(VLNV const& vlnv, bool succeeded);
+
 signals:
     
     //! Emitted to notify the user of an error.
@@ -94,6 +113,12 @@ signals:
     //! Emitted when the last document has been closed.
     void lastDocumentClosed();
 
+    //! Emitted to wait until the documents being written on worker threads have been written or failed.
+    void finishBackgroundSaves();
+
+    //! Emitted when a library document has been opened for editing.
+    void documentOpened(VLNV const& vlnv);
+
 private slots:
 
     //! Called when the title of a document changes.
@@ -102,6 +127,9 @@ private slots:
     //! Called when a document has been saved.
     void onDocumentSaved(TabDocument* doc);
 
+    //! Called when the content of a document has changed.
+    void onDocumentContentChanged();
+
 private:
     // Disable copying.
     DrawingBoard(DrawingBoard const& rhs);
@@ -116,6 +144,16 @@ private:
      */
     bool shouldSave(TabDocument* doc);
 
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The library documents started to be written since a document was last saved.
+    QList<VLNV> startedSaves_;
+
+    //! The library documents being written for each saved document. The document is kept modified until
+    //! they have been written.
+    QMap<TabDocument*, QList<VLNV> > pendingSaves_;
 };
 
 //-----------------------------------------------------------------------------
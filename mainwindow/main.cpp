@@ -11,6 +11,9 @@
 
 #include "mainwindow.h"
 #include "SplashScreen.h"
+#include "BatchRunner.h"
+
+#include <common/PerformanceTrace/PerformanceTrace.h>
 
 #include <QApplication>
 #include <QDebug>
@@ -20,8 +23,28 @@
 int main(int argc, char *argv[])
 {
     Q_INIT_RESOURCE(kactus);
+
+    bool batchMode = BatchRunner::isBatchMode(argc, argv);
+
+#ifndef Q_OS_WIN
+    // No windows are shown in batch mode so it can be run without a display.
+    if (batchMode && qgetenv("QT_QPA_PLATFORM").isEmpty())
+    {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+#endif
+
     QApplication a(argc, argv);
 
+    if (batchMode)
+    {
+        BatchRunner runner;
+        int exitCode = runner.run(a.arguments());
+
+        PerformanceTrace::writeTrace();
+        return exitCode;
+    }
+
     // Set the palette to use nice pastel colors.
     QPalette palette = a.palette();
     palette.setColor(QPalette::Active, QPalette::Highlight, QColor(33, 135, 237));
@@ -52,5 +75,8 @@ int main(int argc, char *argv[])
 	w.show();    
 	#endif    
     
-	return a.exec();
+	int exitCode = a.exec();
+
+    PerformanceTrace::writeTrace();
+    return exitCode;
 }
@@ -40,6 +40,8 @@
 #include <common/dialogs/listSelectDialog/ListSelectDialog.h>
 #include <common/widgets/componentPreviewBox/ComponentPreviewBox.h>
 #include <common/dialogs/propertyPageDialog/PropertyPageDialog.h>
+#include <common/PerformanceTrace/PerformanceTrace.h>
+#include <common/PerformanceTrace/ScopedTrace.h>
 
 #include <designEditors/MemoryDesigner/MemoryDesignWidget.h>
 
@@ -219,6 +221,8 @@ MainWindow::MainWindow(QWidget *parent)
 
     SettingsUpdater::runUpgrade(this);
 
+    PerformanceTrace::enableFromSettings();
+
 	setWindowTitle(QCoreApplication::applicationName());
 	setWindowIcon(QIcon(":icons/common/graphics/appicon.png"));
 
@@ -1135,6 +1139,16 @@ void MainWindow::setupLibraryDock() {
 		this, SLOT(createComponent(KactusAttribute::ProductHierarchy,
 		KactusAttribute::Firmness,
 		const VLNV&, const QString&)), Qt::UniqueConnection);
+
+    // The documents are kept modified until the library has written them.
+    connect(libraryHandler_, SIGNAL(backgroundSaveStarted(VLNV const&)),
+        designTabs_, SLOT(onBackgroundSaveStarted(VLNV const&)), Qt::UniqueConnection);
+    connect(libraryHandler_, SIGNAL(backgroundSaveFinished(VLNV const&, bool)),
+        designTabs_, SLOT(onBackgroundSaveFinished(VLNV const&, bool)), Qt::UniqueConnection);
+    connect(designTabs_, SIGNAL(finishBackgroundSaves()),
+        libraryHandler_, SLOT(finishBackgroundSaves()), Qt::UniqueConnection);
+    connect(designTabs_, SIGNAL(documentOpened(VLNV const&)),
+        libraryHandler_, SLOT(onDocumentOpened(VLNV const&)), Qt::UniqueConnection);
 }
 
 //-----------------------------------------------------------------------------
@@ -1738,7 +1752,11 @@ void MainWindow::runGeneratorPlugin(QAction* action)
         this, SIGNAL(noticeMessage(QString const&)), Qt::UniqueConnection);
 
     // Run the generator and refresh the document.
-    plugin->runGenerator(&adapter, libComp, libDesConf, libDes);
+    {
+        SCOPED_TRACE_DETAIL(trace, plugin->getName(), "generator", libComp->getVlnv()->toString());
+        plugin->runGenerator(&adapter, libComp, libDesConf, libDes);
+    }
+
     doc->refresh();
 }
 
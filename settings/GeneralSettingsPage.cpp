@@ -24,7 +24,9 @@
 //-----------------------------------------------------------------------------
 GeneralSettingsPage::GeneralSettingsPage(QSettings& settings):
 SettingsPage(settings),
-usernameEdit_(0)
+usernameEdit_(0),
+labelZoomEdit_(0),
+outlineZoomEdit_(0)
 {
     // Create the username line edit and label.
     QLabel* usernameLabel = new QLabel(tr("User name:"), this);
@@ -32,10 +34,27 @@ usernameEdit_(0)
     QString username = settings.value("General/Username", Utils::getCurrentUser()).toString();
     usernameEdit_ = new QLineEdit(username, this);
 
+    // Create the zoom thresholds for the level of detail in the designs.
+    QLabel* labelZoomLabel = new QLabel(tr("Hide labels in designs below zoom level:"), this);
+    labelZoomEdit_ = new QSpinBox(this);
+    labelZoomEdit_->setRange(0, 300);
+    labelZoomEdit_->setSuffix("%");
+    labelZoomEdit_->setValue(settings.value("Design/LabelZoomThreshold", 50).toInt());
+
+    QLabel* outlineZoomLabel = new QLabel(tr("Draw designs as plain shapes below zoom level:"), this);
+    outlineZoomEdit_ = new QSpinBox(this);
+    outlineZoomEdit_->setRange(0, 300);
+    outlineZoomEdit_->setSuffix("%");
+    outlineZoomEdit_->setValue(settings.value("Design/OutlineZoomThreshold", 25).toInt());
+
     // Setup the layout.
     QVBoxLayout* layout = new QVBoxLayout(this);
     layout->addWidget(usernameLabel);
     layout->addWidget(usernameEdit_);
+    layout->addWidget(labelZoomLabel);
+    layout->addWidget(labelZoomEdit_);
+    layout->addWidget(outlineZoomLabel);
+    layout->addWidget(outlineZoomEdit_);
     layout->addStretch(1);
 }
 
@@ -73,4 +92,6 @@ void GeneralSettingsPage::apply()
 {
     // Save the settings.
     settings().setValue("General/Username", usernameEdit_->text());
+    settings().setValue("Design/LabelZoomThreshold", labelZoomEdit_->value());
+    settings().setValue("Design/OutlineZoomThreshold", outlineZoomEdit_->value());
 }
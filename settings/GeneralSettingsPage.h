@@ -16,6 +16,7 @@
 
 #include <QLineEdit>
 #include <QSettings>
+#include <QSpinBox>
 
 //-----------------------------------------------------------------------------
 //! GeneralSettingsPage class.
@@ -62,6 +63,12 @@ private:
 
     //! Username line edit.
     QLineEdit* usernameEdit_;
+
+    //! The zoom level below which labels are hidden in the designs.
+    QSpinBox* labelZoomEdit_;
+
+    //! The zoom level below which the items are drawn as plain shapes in the designs.
+    QSpinBox* outlineZoomEdit_;
 };
 
 //-----------------------------------------------------------------------------
@@ -0,0 +1,194 @@
+//-----------------------------------------------------------------------------
+// File: tst_ComponentValidation.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Unit test and benchmark for validating large components.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <IPXACTmodels/businterface.h>
+#include <IPXACTmodels/component.h>
+#include <IPXACTmodels/masterinterface.h>
+#include <IPXACTmodels/model.h>
+#include <IPXACTmodels/port.h>
+#include <IPXACTmodels/PortMap.h>
+#include <IPXACTmodels/vlnv.h>
+
+#include <QSharedPointer>
+
+class tst_ComponentValidation : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_ComponentValidation();
+
+private slots:
+
+    void initTestCase();
+
+    void testLargeComponentIsValid();
+    void testMissingPhysicalPortIsReported();
+    void testDuplicatePortIsReported();
+
+    void benchmarkIsValid();
+    void benchmarkIsValidWithErrorList();
+
+private:
+
+    QSharedPointer<Component> createComponent(int portCount, int interfaceCount, int portMapsPerInterface) const;
+
+    //! The synthetic component used in the benchmarks.
+    QSharedPointer<Component> largeComponent_;
+};
+
+namespace
+{
+    //! The size of the synthetic component.
+    const int PORT_COUNT = 10000;
+    const int INTERFACE_COUNT = 500;
+    const int PORT_MAPS_PER_INTERFACE = 20;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentValidation::tst_ComponentValidation()
+//-----------------------------------------------------------------------------
+tst_ComponentValidation::tst_ComponentValidation(): largeComponent_()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentValidation::initTestCase()
+//-----------------------------------------------------------------------------
+void tst_ComponentValidation::initTestCase()
+{
+    largeComponent_ = createComponent(PORT_COUNT, INTERFACE_COUNT, PORT_MAPS_PER_INTERFACE);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentValidation::testLargeComponentIsValid()
+//-----------------------------------------------------------------------------
+void tst_ComponentValidation::testLargeComponentIsValid()
+{
+    QCOMPARE(largeComponent_->getPorts().size(), PORT_COUNT);
+    QCOMPARE(largeComponent_->getBusInterfaces().size(), INTERFACE_COUNT);
+
+    QVERIFY(largeComponent_->isValid());
+
+    QStringList errorList;
+    QVERIFY(largeComponent_->isValid(errorList));
+    QVERIFY(errorList.join(QString()).isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentValidation::testMissingPhysicalPortIsReported()
+//-----------------------------------------------------------------------------
+void tst_ComponentValidation::testMissingPhysicalPortIsReported()
+{
+    QSharedPointer<Component> component = createComponent(10, 2, 2);
+
+    QSharedPointer<PortMap> portMap(new PortMap());
+    portMap->setLogicalPort("extra");
+    portMap->setPhysicalPort("missing");
+    component->getBusInterfaces().last()->getPortMaps().append(portMap);
+
+    QVERIFY(!component->isValid());
+
+    QStringList errorList;
+    QVERIFY(!component->isValid(errorList));
+    QCOMPARE(errorList.filter("physical port missing").size(), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentValidation::testDuplicatePortIsReported()
+//-----------------------------------------------------------------------------
+void tst_ComponentValidation::testDuplicatePortIsReported()
+{
+    QSharedPointer<Component> component = createComponent(10, 2, 2);
+    component->getModel()->getPorts().append(QSharedPointer<Port>(
+        new Port("port_3", General::OUT, 0, 0, QString(), false)));
+
+    QVERIFY(!component->isValid());
+
+    QStringList errorList;
+    QVERIFY(!component->isValid(errorList));
+    QCOMPARE(errorList.filter("several ports with name port_3").size(), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentValidation::benchmarkIsValid()
+//-----------------------------------------------------------------------------
+void tst_ComponentValidation::benchmarkIsValid()
+{
+    bool valid = false;
+
+    QBENCHMARK
+    {
+        valid = largeComponent_->isValid();
+    }
+
+    QVERIFY(valid);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentValidation::benchmarkIsValidWithErrorList()
+//-----------------------------------------------------------------------------
+void tst_ComponentValidation::benchmarkIsValidWithErrorList()
+{
+    bool valid = false;
+
+    QBENCHMARK
+    {
+        QStringList errorList;
+        valid = largeComponent_->isValid(errorList);
+    }
+
+    QVERIFY(valid);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentValidation::createComponent()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> tst_ComponentValidation::createComponent(int portCount, int interfaceCount,
+    int portMapsPerInterface) const
+{
+    QSharedPointer<Component> component(new Component(
+        VLNV(VLNV::COMPONENT, "tut.fi", "TestLibrary", "LargeComponent", "1.0")));
+
+    QList<QSharedPointer<Port> >& ports = component->getModel()->getPorts();
+    for (int i = 0; i < portCount; ++i)
+    {
+        ports.append(QSharedPointer<Port>(
+            new Port(QString("port_%1").arg(i), General::IN, 7, 0, QString(), false)));
+    }
+
+    for (int i = 0; i < interfaceCount; ++i)
+    {
+        QSharedPointer<BusInterface> busInterface(new BusInterface());
+        busInterface->setName(QString("interface_%1").arg(i));
+        busInterface->setBusType(VLNV(VLNV::BUSDEFINITION, "tut.fi", "TestLibrary", "TestBus", "1.0"));
+        busInterface->setMaster(QSharedPointer<MasterInterface>(new MasterInterface()));
+        busInterface->setInterfaceMode(General::MASTER);
+
+        for (int j = 0; j < portMapsPerInterface; ++j)
+        {
+            QSharedPointer<PortMap> portMap(new PortMap());
+            portMap->setLogicalPort(QString("logical_%1").arg(j));
+            portMap->setPhysicalPort(QString("port_%1").arg((i * portMapsPerInterface + j) % portCount));
+            busInterface->getPortMaps().append(portMap);
+        }
+
+        component->getBusInterfaces().append(busInterface);
+    }
+
+    return component;
+}
+
+QTEST_MAIN(tst_ComponentValidation)
+
+#include "tst_ComponentValidation.moc"
@@ -13,4 +13,10 @@ TEMPLATE = subdirs
 
 CONFIG += testcase
 SUBDIRS += validators\tst_ParameterValidator.pro \
-		   validators\tst_ParameterValidator2014.pro
+		   validators\tst_ParameterValidator2014.pro \
+		   streamReaders\tst_DocumentStreamReader.pro \
+		   PackedRegisterTable\tst_PackedRegisterTable.pro \
+		   ComponentValidation\tst_ComponentValidation.pro \
+		   ParallelValidator\tst_ParallelValidator.pro \
+		   StringPool\tst_StringPool.pro \
+		   NameIndex\tst_NameIndex.pro
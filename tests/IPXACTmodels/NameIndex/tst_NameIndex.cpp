@@ -0,0 +1,255 @@
+//-----------------------------------------------------------------------------
+// File: tst_NameIndex.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class NameIndex.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <IPXACTmodels/businterface.h>
+#include <IPXACTmodels/component.h>
+#include <IPXACTmodels/fileset.h>
+#include <IPXACTmodels/NameIndex.h>
+#include <IPXACTmodels/port.h>
+
+#include <IPXACTmodels/streamReaders/ComponentStreamReader.h>
+
+#include <QBuffer>
+
+class tst_NameIndex : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_NameIndex();
+
+private slots:
+
+    void init();
+    void cleanup();
+
+    void testFindAfterStreamReader();
+    void testRenamedElementIsFound();
+    void testRemovedElementIsNotFound();
+    void testAppendedElementIsFound();
+    void testCopiedListIsIndexedSeparately();
+
+private:
+
+    QSharedPointer<Component> readComponent() const;
+
+    //! The component read for each test.
+    QSharedPointer<Component> component_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::tst_NameIndex()
+//-----------------------------------------------------------------------------
+tst_NameIndex::tst_NameIndex(): component_()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::init()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::init()
+{
+    component_ = readComponent();
+    QVERIFY(!component_.isNull());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::cleanup()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::cleanup()
+{
+    component_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testFindAfterStreamReader()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testFindAfterStreamReader()
+{
+    QCOMPARE(component_->getBusInterfaces().size(), 2);
+
+    QVERIFY(component_->getBusInterface("master") == component_->getBusInterfaces().at(0));
+    QVERIFY(component_->getBusInterface("slave") == component_->getBusInterfaces().at(1));
+    QVERIFY(component_->getBusInterface("missing").isNull());
+
+    QVERIFY(component_->getPort("data_out") == component_->getPorts().at(1));
+    QVERIFY(component_->getPort("missing").isNull());
+
+    QVERIFY(component_->getFileSet("sources") == component_->getFileSets().at(0));
+    QVERIFY(component_->getFileSet("missing").isNull());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testRenamedElementIsFound()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testRenamedElementIsFound()
+{
+    QSharedPointer<BusInterface> master = component_->getBusInterface("master");
+    QVERIFY(!master.isNull());
+
+    // Renamed directly without the component knowing.
+    master->getNameGroup().setName("initiator");
+
+    QVERIFY(component_->getBusInterface("master").isNull());
+    QVERIFY(component_->getBusInterface("initiator") == master);
+
+    QSharedPointer<Port> clock = component_->getPort("clk");
+    QVERIFY(!clock.isNull());
+
+    clock->setName("clock");
+
+    QVERIFY(component_->getPort("clk").isNull());
+    QVERIFY(component_->getPort("clock") == clock);
+
+    // Swapping the names of two elements keeps the list unchanged.
+    QSharedPointer<BusInterface> slave = component_->getBusInterface("slave");
+    master->setName("slave");
+    slave->setName("initiator");
+
+    QVERIFY(component_->getBusInterface("slave") == master);
+    QVERIFY(component_->getBusInterface("initiator") == slave);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testRemovedElementIsNotFound()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testRemovedElementIsNotFound()
+{
+    QSharedPointer<BusInterface> slave = component_->getBusInterface("slave");
+    QVERIFY(!component_->getBusInterface("master").isNull());
+
+    // Removed from the list directly without the component knowing.
+    component_->getBusInterfaces().removeFirst();
+
+    QVERIFY(component_->getBusInterface("master").isNull());
+    QVERIFY(component_->getBusInterface("slave") == slave);
+
+    QVERIFY(!component_->getPort("clk").isNull());
+
+    component_->getPorts().clear();
+
+    QVERIFY(component_->getPort("clk").isNull());
+    QVERIFY(component_->getPort("data_out").isNull());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testAppendedElementIsFound()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testAppendedElementIsFound()
+{
+    QVERIFY(component_->getBusInterface("monitor").isNull());
+
+    // Appended to the list directly without the component knowing.
+    QSharedPointer<BusInterface> monitor(new BusInterface());
+    monitor->setName("monitor");
+    component_->getBusInterfaces().append(monitor);
+
+    QVERIFY(component_->getBusInterface("monitor") == monitor);
+    QVERIFY(!component_->getBusInterface("master").isNull());
+
+    QVERIFY(component_->getFileSet("headers").isNull());
+
+    QSharedPointer<FileSet> headers(new FileSet("headers"));
+    component_->getFileSets().append(headers);
+
+    QVERIFY(component_->getFileSet("headers") == headers);
+
+    QVERIFY(component_->getPort("reset").isNull());
+
+    QSharedPointer<Port> reset(new Port());
+    reset->setName("reset");
+    component_->getPorts().prepend(reset);
+
+    QVERIFY(component_->getPort("reset") == reset);
+    QVERIFY(component_->getPort("clk") == component_->getPorts().at(1));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testCopiedListIsIndexedSeparately()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testCopiedListIsIndexedSeparately()
+{
+    QList<QSharedPointer<Port> > ports = component_->getPorts();
+
+    NameIndex<Port> index;
+    QVERIFY(index.find(ports, "clk") == ports.at(0));
+
+    // The index must not be used for a different list of the same size.
+    QList<QSharedPointer<Port> > reversed;
+    reversed.append(ports.at(1));
+    reversed.append(ports.at(0));
+
+    QVERIFY(index.find(reversed, "clk") == reversed.at(1));
+    QVERIFY(index.find(reversed, "data_out") == reversed.at(0));
+    QVERIFY(index.find(reversed, "missing").isNull());
+
+    index.invalidate();
+    QVERIFY(index.find(ports, "data_out") == ports.at(1));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::readComponent()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> tst_NameIndex::readComponent() const
+{
+    QByteArray xml = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<spirit:component xmlns:spirit=\"http://www.spiritconsortium.org/XMLSchema/SPIRIT/1.5\">\n"
+        "<spirit:vendor>tut.fi</spirit:vendor>\n"
+        "<spirit:library>test</spirit:library>\n"
+        "<spirit:name>indexed</spirit:name>\n"
+        "<spirit:version>1.0</spirit:version>\n"
+        "<spirit:busInterfaces>\n"
+        "  <spirit:busInterface>\n"
+        "    <spirit:name>master</spirit:name>\n"
+        "    <spirit:busType spirit:vendor=\"tut.fi\" spirit:library=\"test\" spirit:name=\"bus\" spirit:version=\"1.0\"/>\n"
+        "    <spirit:master/>\n"
+        "  </spirit:busInterface>\n"
+        "  <spirit:busInterface>\n"
+        "    <spirit:name>slave</spirit:name>\n"
+        "    <spirit:busType spirit:vendor=\"tut.fi\" spirit:library=\"test\" spirit:name=\"bus\" spirit:version=\"1.0\"/>\n"
+        "    <spirit:slave/>\n"
+        "  </spirit:busInterface>\n"
+        "</spirit:busInterfaces>\n"
+        "<spirit:model>\n"
+        "  <spirit:ports>\n"
+        "    <spirit:port>\n"
+        "      <spirit:name>clk</spirit:name>\n"
+        "      <spirit:wire>\n"
+        "        <spirit:direction>in</spirit:direction>\n"
+        "      </spirit:wire>\n"
+        "    </spirit:port>\n"
+        "    <spirit:port>\n"
+        "      <spirit:name>data_out</spirit:name>\n"
+        "      <spirit:wire>\n"
+        "        <spirit:direction>out</spirit:direction>\n"
+        "      </spirit:wire>\n"
+        "    </spirit:port>\n"
+        "  </spirit:ports>\n"
+        "</spirit:model>\n"
+        "<spirit:fileSets>\n"
+        "  <spirit:fileSet>\n"
+        "    <spirit:name>sources</spirit:name>\n"
+        "  </spirit:fileSet>\n"
+        "</spirit:fileSets>\n"
+        "</spirit:component>\n";
+
+    QBuffer buffer(&xml);
+    buffer.open(QIODevice::ReadOnly);
+
+    ComponentStreamReader reader;
+    return reader.read(&buffer);
+}
+
+QTEST_APPLESS_MAIN(tst_NameIndex)
+
+#include "tst_NameIndex.moc"
@@ -0,0 +1,344 @@
+//-----------------------------------------------------------------------------
+// File: tst_PackedRegisterTable.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class PackedRegisterTable.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <IPXACTmodels/PackedRegisterTable.h>
+#include <IPXACTmodels/addressblock.h>
+#include <IPXACTmodels/field.h>
+#include <IPXACTmodels/register.h>
+#include <IPXACTmodels/choice.h>
+
+#include <QBuffer>
+#include <QDomDocument>
+#include <QXmlStreamWriter>
+
+class tst_PackedRegisterTable : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_PackedRegisterTable();
+
+private slots:
+
+    void testPackedRegisterMatchesRegister();
+    void testRegisterWithEnumeratedValuesIsNotPacked();
+
+    void testValidationMatchesRegister();
+    void testValidationMatchesRegister_data();
+
+    void testAddressBlockKeepsRegisterOrder();
+    void testAddressBlockCopiesShareTable();
+
+private:
+
+    QDomDocument createDocument(QString const& xml) const;
+
+    QString createPlainRegister(QString const& name, QString const& offset) const;
+
+    QString writeRegister(QSharedPointer<RegisterModel> reg) const;
+
+    QString writeAddressBlock(AddressBlock& addressBlock) const;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_PackedRegisterTable::tst_PackedRegisterTable()
+//-----------------------------------------------------------------------------
+tst_PackedRegisterTable::tst_PackedRegisterTable()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PackedRegisterTable::testPackedRegisterMatchesRegister()
+//-----------------------------------------------------------------------------
+void tst_PackedRegisterTable::testPackedRegisterMatchesRegister()
+{
+    QDomDocument document = createDocument(
+        "<spirit:register>"
+        "<spirit:name> control </spirit:name>"
+        "<spirit:displayName>Control</spirit:displayName>"
+        "<spirit:description>Controls the block.</spirit:description>"
+        "<spirit:dim>4</spirit:dim>"
+        "<spirit:addressOffset>'h10</spirit:addressOffset>"
+        "<spirit:size>32</spirit:size>"
+        "<spirit:volatile>true</spirit:volatile>"
+        "<spirit:access>read-write</spirit:access>"
+        "<spirit:reset>"
+        "<spirit:value>'h0</spirit:value>"
+        "<spirit:mask>'hFF</spirit:mask>"
+        "</spirit:reset>"
+        "<spirit:field>"
+        "<spirit:name>enable</spirit:name>"
+        "<spirit:description>Enables the block.</spirit:description>"
+        "<spirit:bitOffset>0</spirit:bitOffset>"
+        "<spirit:bitWidth>1</spirit:bitWidth>"
+        "<spirit:volatile>true</spirit:volatile>"
+        "<spirit:access>read-write</spirit:access>"
+        "<spirit:modifiedWriteValue>oneToClear</spirit:modifiedWriteValue>"
+        "<spirit:readAction>clear</spirit:readAction>"
+        "<spirit:testable spirit:testConstraint=\"restore\">true</spirit:testable>"
+        "</spirit:field>"
+        "<spirit:field>"
+        "<spirit:name>mode</spirit:name>"
+        "<spirit:bitOffset>1</spirit:bitOffset>"
+        "<spirit:bitWidth>3</spirit:bitWidth>"
+        "<spirit:testable>false</spirit:testable>"
+        "</spirit:field>"
+        "</spirit:register>");
+
+    QDomNode registerNode = document.firstChildElement();
+
+    PackedRegisterTable table;
+    QVERIFY(table.append(registerNode));
+    QCOMPARE(table.size(), 1);
+    QCOMPARE(table.fieldCount(), 2);
+    QCOMPARE(table.name(0), QString("control"));
+    QCOMPARE(table.addressOffset(0), QString("'h10"));
+
+    QSharedPointer<Register> packedRegister = table.createRegister(0);
+    QCOMPARE(packedRegister->getFields().size(), 2);
+
+    QSharedPointer<RegisterModel> domRegister(new Register(registerNode));
+    QCOMPARE(writeRegister(packedRegister), writeRegister(domRegister));
+
+    // The table writes the register from its columns without creating the register object.
+    QString tableOutput;
+    QXmlStreamWriter writer(&tableOutput);
+    table.write(writer, 0);
+
+    QCOMPARE(tableOutput, writeRegister(domRegister));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PackedRegisterTable::testRegisterWithEnumeratedValuesIsNotPacked()
+//-----------------------------------------------------------------------------
+void tst_PackedRegisterTable::testRegisterWithEnumeratedValuesIsNotPacked()
+{
+    QDomDocument document = createDocument(
+        "<spirit:register>"
+        "<spirit:name>status</spirit:name>"
+        "<spirit:addressOffset>'h0</spirit:addressOffset>"
+        "<spirit:size>8</spirit:size>"
+        "<spirit:field>"
+        "<spirit:name>state</spirit:name>"
+        "<spirit:bitOffset>0</spirit:bitOffset>"
+        "<spirit:bitWidth>2</spirit:bitWidth>"
+        "<spirit:enumeratedValues>"
+        "<spirit:enumeratedValue>"
+        "<spirit:name>idle</spirit:name>"
+        "<spirit:value>0</spirit:value>"
+        "</spirit:enumeratedValue>"
+        "</spirit:enumeratedValues>"
+        "</spirit:field>"
+        "</spirit:register>");
+
+    QDomNode registerNode = document.firstChildElement();
+
+    PackedRegisterTable table;
+    QVERIFY(!table.append(registerNode));
+    QCOMPARE(table.size(), 0);
+    QCOMPARE(table.fieldCount(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PackedRegisterTable::testValidationMatchesRegister()
+//-----------------------------------------------------------------------------
+void tst_PackedRegisterTable::testValidationMatchesRegister()
+{
+    QFETCH(QString, xml);
+    QFETCH(bool, expectedValid);
+
+    QDomNode registerNode = createDocument(xml).firstChildElement();
+
+    PackedRegisterTable table;
+    QVERIFY(table.append(registerNode));
+
+    Register domRegister(registerNode);
+
+    QStringList packedErrors;
+    QStringList domErrors;
+    QSharedPointer<QList<QSharedPointer<Choice> > > noChoices(new QList<QSharedPointer<Choice> >());
+
+    QCOMPARE(table.isValid(0), expectedValid);
+    QCOMPARE(table.isValid(0, packedErrors, "block"), expectedValid);
+    QCOMPARE(domRegister.isValid(noChoices), expectedValid);
+    QCOMPARE(domRegister.isValid(noChoices, domErrors, "block"), expectedValid);
+
+    QCOMPARE(packedErrors, domErrors);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PackedRegisterTable::testValidationMatchesRegister_data()
+//-----------------------------------------------------------------------------
+void tst_PackedRegisterTable::testValidationMatchesRegister_data()
+{
+    QTest::addColumn<QString>("xml");
+    QTest::addColumn<bool>("expectedValid");
+
+    QTest::newRow("valid register") << QString(
+        "<spirit:register><spirit:name>control</spirit:name>"
+        "<spirit:addressOffset>'h0</spirit:addressOffset><spirit:size>8</spirit:size>"
+        "<spirit:field><spirit:name>enable</spirit:name>"
+        "<spirit:bitOffset>0</spirit:bitOffset><spirit:bitWidth>8</spirit:bitWidth></spirit:field>"
+        "</spirit:register>") << true;
+
+    QTest::newRow("no name, offset or size") << QString(
+        "<spirit:register><spirit:name></spirit:name></spirit:register>") << false;
+
+    QTest::newRow("reset without value") << QString(
+        "<spirit:register><spirit:name>control</spirit:name>"
+        "<spirit:addressOffset>'h0</spirit:addressOffset><spirit:size>8</spirit:size>"
+        "<spirit:reset><spirit:mask>'hFF</spirit:mask></spirit:reset>"
+        "</spirit:register>") << false;
+
+    QTest::newRow("field without name and width") << QString(
+        "<spirit:register><spirit:name>control</spirit:name>"
+        "<spirit:addressOffset>'h0</spirit:addressOffset><spirit:size>8</spirit:size>"
+        "<spirit:field><spirit:bitOffset>0</spirit:bitOffset></spirit:field>"
+        "</spirit:register>") << false;
+
+    QTest::newRow("field outside register") << QString(
+        "<spirit:register><spirit:name>control</spirit:name>"
+        "<spirit:addressOffset>'h0</spirit:addressOffset><spirit:size>8</spirit:size>"
+        "<spirit:field><spirit:name>mode</spirit:name>"
+        "<spirit:bitOffset>6</spirit:bitOffset><spirit:bitWidth>4</spirit:bitWidth></spirit:field>"
+        "</spirit:register>") << false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PackedRegisterTable::testAddressBlockKeepsRegisterOrder()
+//-----------------------------------------------------------------------------
+void tst_PackedRegisterTable::testAddressBlockKeepsRegisterOrder()
+{
+    QDomDocument document = createDocument(
+        "<spirit:addressBlock>"
+        "<spirit:name>block</spirit:name>"
+        "<spirit:baseAddress>0</spirit:baseAddress>"
+        "<spirit:range>64</spirit:range>"
+        "<spirit:width>32</spirit:width>" +
+        createPlainRegister("first", "'h0") +
+        createPlainRegister("second", "'h4") +
+        "<spirit:register spirit:id=\"third\">"
+        "<spirit:name>third</spirit:name>"
+        "<spirit:addressOffset>'h8</spirit:addressOffset>"
+        "<spirit:size>32</spirit:size>"
+        "</spirit:register>" +
+        createPlainRegister("fourth", "'hC") +
+        "</spirit:addressBlock>");
+
+    QDomNode blockNode = document.firstChildElement();
+    AddressBlock addressBlock(blockNode);
+
+    QCOMPARE(addressBlock.getLastRegisterAddress(), quint64(12));
+    QCOMPARE(addressBlock.getAllRegisterOffsets(), QStringList() << "'h0" << "'h4" << "'h8" << "'hC");
+
+    QStringList names;
+    QVERIFY(addressBlock.uniqueRegisterNames(names));
+    QCOMPARE(names, QStringList() << "first" << "second" << "third" << "fourth");
+
+    QString packedOutput = writeAddressBlock(addressBlock);
+
+    QList<QSharedPointer<RegisterModel> > const& registers = addressBlock.getRegisterData();
+    QCOMPARE(registers.size(), 4);
+    QCOMPARE(registers.at(0)->getName(), QString("first"));
+    QCOMPARE(registers.at(2)->getName(), QString("third"));
+    QCOMPARE(registers.at(3)->getName(), QString("fourth"));
+
+    QCOMPARE(writeAddressBlock(addressBlock), packedOutput);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PackedRegisterTable::testAddressBlockCopiesShareTable()
+//-----------------------------------------------------------------------------
+void tst_PackedRegisterTable::testAddressBlockCopiesShareTable()
+{
+    QDomDocument document = createDocument(
+        "<spirit:addressBlock>"
+        "<spirit:name>block</spirit:name>"
+        "<spirit:baseAddress>0</spirit:baseAddress>"
+        "<spirit:range>64</spirit:range>"
+        "<spirit:width>32</spirit:width>" +
+        createPlainRegister("first", "'h0") +
+        createPlainRegister("second", "'h4") +
+        "</spirit:addressBlock>");
+
+    QDomNode blockNode = document.firstChildElement();
+    AddressBlock original(blockNode);
+    AddressBlock copy(original);
+
+    // Editing the registers of the copy must not change the original.
+    copy.getRegisterData().first()->setName("renamed");
+
+    QStringList originalNames;
+    QVERIFY(original.uniqueRegisterNames(originalNames));
+    QCOMPARE(originalNames, QStringList() << "first" << "second");
+
+    QCOMPARE(copy.getRegisterData().first()->getName(), QString("renamed"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PackedRegisterTable::createDocument()
+//-----------------------------------------------------------------------------
+QDomDocument tst_PackedRegisterTable::createDocument(QString const& xml) const
+{
+    QDomDocument document;
+    document.setContent(xml);
+
+    return document;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PackedRegisterTable::createPlainRegister()
+//-----------------------------------------------------------------------------
+QString tst_PackedRegisterTable::createPlainRegister(QString const& name, QString const& offset) const
+{
+    return QString("<spirit:register>"
+        "<spirit:name>%1</spirit:name>"
+        "<spirit:addressOffset>%2</spirit:addressOffset>"
+        "<spirit:size>32</spirit:size>"
+        "<spirit:field>"
+        "<spirit:name>value</spirit:name>"
+        "<spirit:bitOffset>0</spirit:bitOffset>"
+        "<spirit:bitWidth>32</spirit:bitWidth>"
+        "</spirit:field>"
+        "</spirit:register>").arg(name, offset);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PackedRegisterTable::writeRegister()
+//-----------------------------------------------------------------------------
+QString tst_PackedRegisterTable::writeRegister(QSharedPointer<RegisterModel> reg) const
+{
+    QString output;
+    QXmlStreamWriter writer(&output);
+
+    reg->write(writer);
+
+    return output;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PackedRegisterTable::writeAddressBlock()
+//-----------------------------------------------------------------------------
+QString tst_PackedRegisterTable::writeAddressBlock(AddressBlock& addressBlock) const
+{
+    QString output;
+    QXmlStreamWriter writer(&output);
+
+    addressBlock.write(writer);
+
+    return output;
+}
+
+QTEST_MAIN(tst_PackedRegisterTable)
+
+#include "tst_PackedRegisterTable.moc"
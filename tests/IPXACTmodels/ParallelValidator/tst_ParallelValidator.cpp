@@ -0,0 +1,190 @@
+//-----------------------------------------------------------------------------
+// File: tst_ParallelValidator.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class ParallelValidator.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <IPXACTmodels/validators/ParallelValidator.h>
+
+#include <QAtomicInt>
+
+//-----------------------------------------------------------------------------
+//! Task reporting a fixed result and counting the validations.
+//-----------------------------------------------------------------------------
+class TestTask : public ParallelValidator::Task
+{
+public:
+
+    TestTask(int index, bool valid, QAtomicInt& runCount): index_(index), valid_(valid), runCount_(runCount) {}
+
+    virtual bool validate(QStringList& errorList) const
+    {
+        runCount_.fetchAndAddOrdered(1);
+        if (!valid_)
+        {
+            errorList.append(QString("error %1a").arg(index_));
+            errorList.append(QString("error %1b").arg(index_));
+        }
+
+        return valid_;
+    }
+
+    virtual bool validate() const
+    {
+        runCount_.fetchAndAddOrdered(1);
+        return valid_;
+    }
+
+private:
+
+    int index_;
+    bool valid_;
+    QAtomicInt& runCount_;
+};
+
+class tst_ParallelValidator : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_ParallelValidator();
+
+private slots:
+
+    void testAllTasksAreRun();
+    void testErrorsAreInTaskOrder();
+    void testAddedErrorsAreInTaskOrder();
+    void testRunWithoutErrors();
+    void testEmptyValidator();
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParallelValidator::tst_ParallelValidator()
+//-----------------------------------------------------------------------------
+tst_ParallelValidator::tst_ParallelValidator()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParallelValidator::testAllTasksAreRun()
+//-----------------------------------------------------------------------------
+void tst_ParallelValidator::testAllTasksAreRun()
+{
+    QAtomicInt runCount(0);
+
+    ParallelValidator validator;
+    for (int i = 0; i < 1000; ++i)
+    {
+        validator.addTask(new TestTask(i, true, runCount));
+    }
+
+    QCOMPARE(validator.taskCount(), 1000);
+
+    QStringList errorList;
+    QVERIFY(validator.run(errorList));
+    QVERIFY(errorList.isEmpty());
+    QCOMPARE(runCount.load(), 1000);
+    QCOMPARE(validator.taskCount(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParallelValidator::testErrorsAreInTaskOrder()
+//-----------------------------------------------------------------------------
+void tst_ParallelValidator::testErrorsAreInTaskOrder()
+{
+    QAtomicInt runCount(0);
+
+    ParallelValidator validator;
+    QStringList expectedErrors;
+    for (int i = 0; i < 500; ++i)
+    {
+        bool valid = i % 3 != 0;
+        validator.addTask(new TestTask(i, valid, runCount));
+
+        if (!valid)
+        {
+            expectedErrors << QString("error %1a").arg(i) << QString("error %1b").arg(i);
+        }
+    }
+
+    QStringList errorList("previous error");
+    QVERIFY(!validator.run(errorList));
+    QCOMPARE(errorList, QStringList("previous error") + expectedErrors);
+    QCOMPARE(runCount.load(), 500);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParallelValidator::testAddedErrorsAreInTaskOrder()
+//-----------------------------------------------------------------------------
+void tst_ParallelValidator::testAddedErrorsAreInTaskOrder()
+{
+    QAtomicInt runCount(0);
+
+    ParallelValidator validator;
+    for (int i = 0; i < 10; ++i)
+    {
+        if (i == 5)
+        {
+            validator.addError("duplicate 5");
+        }
+
+        validator.addTask(new TestTask(i, i != 7, runCount));
+    }
+
+    QStringList errorList;
+    QVERIFY(!validator.run(errorList));
+    QCOMPARE(errorList, QStringList() << "duplicate 5" << "error 7a" << "error 7b");
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParallelValidator::testRunWithoutErrors()
+//-----------------------------------------------------------------------------
+void tst_ParallelValidator::testRunWithoutErrors()
+{
+    QAtomicInt runCount(0);
+
+    ParallelValidator validValidator;
+    for (int i = 0; i < 100; ++i)
+    {
+        validValidator.addTask(new TestTask(i, true, runCount));
+    }
+
+    QVERIFY(validValidator.run());
+    QCOMPARE(runCount.load(), 100);
+
+    ParallelValidator invalidValidator;
+    for (int i = 0; i < 100; ++i)
+    {
+        invalidValidator.addTask(new TestTask(i, i != 50, runCount));
+    }
+
+    QVERIFY(!invalidValidator.run());
+
+    ParallelValidator errorValidator;
+    errorValidator.addError("duplicate");
+    QVERIFY(!errorValidator.run());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParallelValidator::testEmptyValidator()
+//-----------------------------------------------------------------------------
+void tst_ParallelValidator::testEmptyValidator()
+{
+    ParallelValidator validator;
+
+    QStringList errorList;
+    QVERIFY(validator.run(errorList));
+    QVERIFY(errorList.isEmpty());
+    QVERIFY(validator.run());
+}
+
+QTEST_MAIN(tst_ParallelValidator)
+
+#include "tst_ParallelValidator.moc"
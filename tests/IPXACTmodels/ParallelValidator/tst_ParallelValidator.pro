@@ -0,0 +1,50 @@
+#-----------------------------------------------------------------------------
+# File: tst_ParallelValidator.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus 2
+# Author: agent
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file template for running unit tests for ParallelValidator.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+TARGET = tst_ParallelValidator
+
+QT += core xml gui testlib
+CONFIG += testcase console
+
+DEFINES += IPXACTMODELS_LIB
+
+win32:CONFIG(release, debug|release) {
+    LIBS += -L$$PWD/../../../executable/ -lIPXACTmodels
+    DESTDIR = ./release
+}
+else:win32:CONFIG(debug, debug|release) {
+    LIBS += -L$$PWD/../../../executable/ -lIPXACTmodelsd
+    DESTDIR = ./debug
+}
+else:unix {
+    LIBS += -L$$PWD/../../../executable/ -lIPXACTmodels
+    DESTDIR = ./release
+}
+
+INCLUDEPATH += $$PWD/../../../
+INCLUDEPATH += $$PWD/../../../executable
+INCLUDEPATH += $$DESTDIR
+
+DEPENDPATH += $$PWD/../../../
+DEPENDPATH += $$PWD/../../../executable
+DEPENDPATH += .
+INCLUDEPATH += $$DESTDIR
+
+DEPENDPATH += .
+
+OBJECTS_DIR += $$DESTDIR
+
+MOC_DIR += ./generatedFiles
+UI_DIR += ./generatedFiles
+RCC_DIR += ./generatedFiles
+include(tst_ParallelValidator.pri)
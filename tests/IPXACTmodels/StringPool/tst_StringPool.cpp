@@ -0,0 +1,191 @@
+//-----------------------------------------------------------------------------
+// File: tst_StringPool.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class StringPool.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <IPXACTmodels/StringPool.h>
+
+#include <QRunnable>
+#include <QThreadPool>
+#include <QVector>
+
+class tst_StringPool : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_StringPool();
+
+private slots:
+
+    void init();
+    void cleanup();
+
+    void testEmptyStringIsNotPooled();
+    void testEqualStringsShareData();
+    void testDifferentStringsAreNotShared();
+    void testClearRemovesStrings();
+    void testConcurrentIntern();
+};
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! Interns a set of strings in a worker thread.
+    //-----------------------------------------------------------------------------
+    class InternTask : public QRunnable
+    {
+    public:
+        InternTask(int stringCount, QVector<QString>* results): stringCount_(stringCount), results_(results)
+        {
+            setAutoDelete(true);
+        }
+
+        virtual void run()
+        {
+            for (int i = 0; i < stringCount_; ++i)
+            {
+                // Each thread constructs its own instances of the strings.
+                (*results_)[i] = StringPool::intern(QString("identifier_%1").arg(i));
+            }
+        }
+
+    private:
+
+        //! The number of strings to intern.
+        int stringCount_;
+
+        //! The interned strings.
+        QVector<QString>* results_;
+    };
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StringPool::tst_StringPool()
+//-----------------------------------------------------------------------------
+tst_StringPool::tst_StringPool()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StringPool::init()
+//-----------------------------------------------------------------------------
+void tst_StringPool::init()
+{
+    StringPool::clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StringPool::cleanup()
+//-----------------------------------------------------------------------------
+void tst_StringPool::cleanup()
+{
+    StringPool::clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StringPool::testEmptyStringIsNotPooled()
+//-----------------------------------------------------------------------------
+void tst_StringPool::testEmptyStringIsNotPooled()
+{
+    QVERIFY(StringPool::intern(QString()).isNull());
+    QVERIFY(StringPool::intern(QString("")).isEmpty());
+
+    QCOMPARE(StringPool::size(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StringPool::testEqualStringsShareData()
+//-----------------------------------------------------------------------------
+void tst_StringPool::testEqualStringsShareData()
+{
+    QString first("clock");
+    QString second = QString("clo") + QString("ck");
+    QVERIFY(first.constData() != second.constData());
+
+    QString pooledFirst = StringPool::intern(first);
+    QString pooledSecond = StringPool::intern(second);
+
+    QCOMPARE(pooledSecond, second);
+    QVERIFY(pooledFirst.constData() == first.constData());
+    QVERIFY(pooledSecond.constData() == first.constData());
+    QCOMPARE(StringPool::size(), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StringPool::testDifferentStringsAreNotShared()
+//-----------------------------------------------------------------------------
+void tst_StringPool::testDifferentStringsAreNotShared()
+{
+    QString clock = StringPool::intern(QString("clock"));
+    QString reset = StringPool::intern(QString("reset"));
+
+    QCOMPARE(clock, QString("clock"));
+    QCOMPARE(reset, QString("reset"));
+    QVERIFY(clock.constData() != reset.constData());
+    QCOMPARE(StringPool::size(), 2);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StringPool::testClearRemovesStrings()
+//-----------------------------------------------------------------------------
+void tst_StringPool::testClearRemovesStrings()
+{
+    QString original = StringPool::intern(QString("clock"));
+
+    StringPool::clear();
+    QCOMPARE(StringPool::size(), 0);
+
+    // The strings already given out are unaffected, but new ones are pooled from scratch.
+    QCOMPARE(original, QString("clock"));
+
+    QString replacement("clock");
+    QVERIFY(StringPool::intern(replacement).constData() == replacement.constData());
+    QVERIFY(StringPool::intern(original).constData() == replacement.constData());
+    QCOMPARE(StringPool::size(), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StringPool::testConcurrentIntern()
+//-----------------------------------------------------------------------------
+void tst_StringPool::testConcurrentIntern()
+{
+    const int THREAD_COUNT = 4;
+    const int STRING_COUNT = 1000;
+
+    QVector<QVector<QString> > results(THREAD_COUNT);
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(THREAD_COUNT);
+    for (int i = 0; i < THREAD_COUNT; ++i)
+    {
+        results[i].resize(STRING_COUNT);
+        pool.start(new InternTask(STRING_COUNT, &results[i]));
+    }
+    pool.waitForDone();
+
+    QCOMPARE(StringPool::size(), STRING_COUNT);
+
+    // Every thread must have received the same instance of each string.
+    for (int i = 0; i < STRING_COUNT; ++i)
+    {
+        QCOMPARE(results.at(0).at(i), QString("identifier_%1").arg(i));
+
+        for (int thread = 1; thread < THREAD_COUNT; ++thread)
+        {
+            QVERIFY(results.at(thread).at(i).constData() == results.at(0).at(i).constData());
+        }
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_StringPool)
+
+#include "tst_StringPool.moc"
@@ -0,0 +1,519 @@
+//-----------------------------------------------------------------------------
+// File: tst_DocumentStreamReader.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for the stream readers of IP-XACT documents.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <IPXACTmodels/component.h>
+#include <IPXACTmodels/design.h>
+#include <IPXACTmodels/designconfiguration.h>
+#include <IPXACTmodels/busdefinition.h>
+#include <IPXACTmodels/abstractiondefinition.h>
+
+#include <IPXACTmodels/streamReaders/ComponentStreamReader.h>
+#include <IPXACTmodels/streamReaders/DesignStreamReader.h>
+#include <IPXACTmodels/streamReaders/DesignConfigurationStreamReader.h>
+#include <IPXACTmodels/streamReaders/BusDefinitionStreamReader.h>
+#include <IPXACTmodels/streamReaders/AbstractionDefinitionStreamReader.h>
+
+#include <QBuffer>
+#include <QDomDocument>
+#include <QTemporaryFile>
+
+class tst_DocumentStreamReader : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_DocumentStreamReader();
+
+private slots:
+
+    void testComponentMatchesDomReader();
+    void testDesignMatchesDomReader();
+    void testDesignConfigurationMatchesDomReader();
+    void testBusDefinitionMatchesDomReader();
+    void testAbstractionDefinitionMatchesDomReader();
+
+    void testMalformedDocument();
+
+    void testSnapshotMatchesDocument();
+    void testCorruptedSnapshot();
+
+private:
+
+    QByteArray writeModel(QSharedPointer<LibraryComponent> model) const;
+
+    QDomDocument createDomDocument(QByteArray const& xml) const;
+
+    QByteArray documentStart(QString const& element) const;
+
+    QByteArray createDesign() const;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::tst_DocumentStreamReader()
+//-----------------------------------------------------------------------------
+tst_DocumentStreamReader::tst_DocumentStreamReader()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testComponentMatchesDomReader()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testComponentMatchesDomReader()
+{
+    QByteArray xml = documentStart("spirit:component") +
+        "<spirit:vendor>tut.fi</spirit:vendor>\n"
+        "<spirit:library>test</spirit:library>\n"
+        "<spirit:name>streamed</spirit:name>\n"
+        "<spirit:version>1.0</spirit:version>\n"
+        "<spirit:busInterfaces>\n"
+        "  <spirit:busInterface>\n"
+        "    <spirit:name>bus</spirit:name>\n"
+        "    <spirit:busType spirit:vendor=\"tut.fi\" spirit:library=\"test\" spirit:name=\"bus\" spirit:version=\"1.0\"/>\n"
+        "    <spirit:abstractionType spirit:vendor=\"tut.fi\" spirit:library=\"test\" spirit:name=\"bus.absDef\" spirit:version=\"1.0\"/>\n"
+        "    <spirit:master/>\n"
+        "  </spirit:busInterface>\n"
+        "  <!-- A second interface. -->\n"
+        "  <spirit:busInterface>\n"
+        "    <spirit:name>slave</spirit:name>\n"
+        "    <spirit:busType spirit:vendor=\"tut.fi\" spirit:library=\"test\" spirit:name=\"bus\" spirit:version=\"1.0\"/>\n"
+        "    <spirit:slave>\n"
+        "      <spirit:memoryMapRef spirit:memoryMapRef=\"map\"/>\n"
+        "    </spirit:slave>\n"
+        "  </spirit:busInterface>\n"
+        "</spirit:busInterfaces>\n"
+        "<spirit:memoryMaps>\n"
+        "  <spirit:memoryMap>\n"
+        "    <spirit:name>map</spirit:name>\n"
+        "    <spirit:addressBlock>\n"
+        "      <spirit:name>block</spirit:name>\n"
+        "      <spirit:baseAddress>0</spirit:baseAddress>\n"
+        "      <spirit:range>16</spirit:range>\n"
+        "      <spirit:width>32</spirit:width>\n"
+        "      <spirit:register>\n"
+        "        <spirit:name>control</spirit:name>\n"
+        "        <spirit:addressOffset>0</spirit:addressOffset>\n"
+        "        <spirit:size>32</spirit:size>\n"
+        "        <spirit:field>\n"
+        "          <spirit:name>enable</spirit:name>\n"
+        "          <spirit:bitOffset>0</spirit:bitOffset>\n"
+        "          <spirit:bitWidth>1</spirit:bitWidth>\n"
+        "        </spirit:field>\n"
+        "      </spirit:register>\n"
+        "      <spirit:register>\n"
+        "        <spirit:name>status</spirit:name>\n"
+        "        <spirit:addressOffset>4</spirit:addressOffset>\n"
+        "        <spirit:size>32</spirit:size>\n"
+        "      </spirit:register>\n"
+        "    </spirit:addressBlock>\n"
+        "    <spirit:addressBlock>\n"
+        "      <spirit:name>empty</spirit:name>\n"
+        "      <spirit:baseAddress>16</spirit:baseAddress>\n"
+        "      <spirit:range>16</spirit:range>\n"
+        "      <spirit:width>32</spirit:width>\n"
+        "    </spirit:addressBlock>\n"
+        "    <spirit:addressBlock>\n"
+        "      <spirit:name>data</spirit:name>\n"
+        "      <spirit:baseAddress>32</spirit:baseAddress>\n"
+        "      <spirit:range>16</spirit:range>\n"
+        "      <spirit:width>32</spirit:width>\n"
+        "      <spirit:register>\n"
+        "        <spirit:name>value</spirit:name>\n"
+        "        <spirit:addressOffset>0</spirit:addressOffset>\n"
+        "        <spirit:size>32</spirit:size>\n"
+        "      </spirit:register>\n"
+        "    </spirit:addressBlock>\n"
+        "  </spirit:memoryMap>\n"
+        "</spirit:memoryMaps>\n"
+        "<spirit:model>\n"
+        "  <spirit:ports>\n"
+        "    <spirit:port>\n"
+        "      <spirit:name>clk</spirit:name>\n"
+        "      <spirit:wire>\n"
+        "        <spirit:direction>in</spirit:direction>\n"
+        "      </spirit:wire>\n"
+        "    </spirit:port>\n"
+        "    <spirit:port>\n"
+        "      <spirit:name>data_out</spirit:name>\n"
+        "      <spirit:wire>\n"
+        "        <spirit:direction>out</spirit:direction>\n"
+        "        <spirit:vector>\n"
+        "          <spirit:left>7</spirit:left>\n"
+        "          <spirit:right>0</spirit:right>\n"
+        "        </spirit:vector>\n"
+        "      </spirit:wire>\n"
+        "    </spirit:port>\n"
+        "  </spirit:ports>\n"
+        "</spirit:model>\n"
+        "<spirit:fileSets>\n"
+        "  <spirit:fileSet>\n"
+        "    <spirit:name>sources</spirit:name>\n"
+        "    <spirit:file>\n"
+        "      <spirit:name>streamed.vhd</spirit:name>\n"
+        "      <spirit:fileType>vhdlSource</spirit:fileType>\n"
+        "    </spirit:file>\n"
+        "  </spirit:fileSet>\n"
+        "</spirit:fileSets>\n"
+        "<spirit:description><![CDATA[Read in <one> pass.]]></spirit:description>\n"
+        "</spirit:component>\n";
+
+    QDomDocument document = createDomDocument(xml);
+    QSharedPointer<Component> domComponent(new Component(document));
+
+    QBuffer buffer(&xml);
+    buffer.open(QIODevice::ReadOnly);
+
+    ComponentStreamReader reader;
+    QSharedPointer<Component> streamedComponent = reader.read(&buffer);
+
+    QVERIFY2(!streamedComponent.isNull(), qPrintable(reader.errorString()));
+    QCOMPARE(streamedComponent->getBusInterfaces().size(), 2);
+    QCOMPARE(streamedComponent->getFileSets().size(), 1);
+    QCOMPARE(streamedComponent->getPorts().size(), 2);
+
+    QCOMPARE(writeModel(streamedComponent), writeModel(domComponent));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testDesignMatchesDomReader()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testDesignMatchesDomReader()
+{
+    QByteArray xml = createDesign();
+
+    QDomDocument document = createDomDocument(xml);
+    QSharedPointer<Design> domDesign(new Design(document));
+
+    QBuffer buffer(&xml);
+    buffer.open(QIODevice::ReadOnly);
+
+    DesignStreamReader reader;
+    QSharedPointer<Design> streamedDesign = reader.read(&buffer);
+
+    QVERIFY2(!streamedDesign.isNull(), qPrintable(reader.errorString()));
+    QCOMPARE(streamedDesign->getComponentInstances().size(), 2);
+    QCOMPARE(streamedDesign->getInterconnections().size(), 1);
+    QCOMPARE(streamedDesign->getAdHocConnections().size(), 1);
+    QCOMPARE(streamedDesign->getHierarchicalConnections().size(), 1);
+
+    // The routes in the vendor extensions must be applied to the streamed connections.
+    Interconnection interconnection = streamedDesign->getInterconnections().first();
+    QVERIFY(interconnection.isOffPage());
+    QCOMPARE(interconnection.getRoute().size(), 2);
+    QCOMPARE(interconnection.getRoute().last(), QPointF(100, 40));
+
+    AdHocConnection adHocConnection = streamedDesign->getAdHocConnections().first();
+    QVERIFY(!adHocConnection.isOffPage());
+    QCOMPARE(adHocConnection.getRoute().size(), 3);
+    QCOMPARE(adHocConnection.getRoute().at(1), QPointF(60, 80));
+
+    QCOMPARE(writeModel(streamedDesign), writeModel(domDesign));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testDesignConfigurationMatchesDomReader()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testDesignConfigurationMatchesDomReader()
+{
+    QByteArray xml = documentStart("spirit:designConfiguration") +
+        "<spirit:vendor>tut.fi</spirit:vendor>\n"
+        "<spirit:library>test</spirit:library>\n"
+        "<spirit:name>streamed.designcfg</spirit:name>\n"
+        "<spirit:version>1.0</spirit:version>\n"
+        "<spirit:designRef spirit:vendor=\"tut.fi\" spirit:library=\"test\" spirit:name=\"streamed.design\" spirit:version=\"1.0\"/>\n"
+        "<spirit:viewConfiguration>\n"
+        "  <spirit:instanceName>first</spirit:instanceName>\n"
+        "  <spirit:viewName>rtl</spirit:viewName>\n"
+        "</spirit:viewConfiguration>\n"
+        "<spirit:viewConfiguration>\n"
+        "  <spirit:instanceName>second</spirit:instanceName>\n"
+        "  <spirit:viewName>hierarchical</spirit:viewName>\n"
+        "</spirit:viewConfiguration>\n"
+        "</spirit:designConfiguration>\n";
+
+    QDomDocument document = createDomDocument(xml);
+    QSharedPointer<DesignConfiguration> domConfiguration(new DesignConfiguration(document));
+
+    QBuffer buffer(&xml);
+    buffer.open(QIODevice::ReadOnly);
+
+    DesignConfigurationStreamReader reader;
+    QSharedPointer<DesignConfiguration> streamedConfiguration = reader.read(&buffer);
+
+    QVERIFY2(!streamedConfiguration.isNull(), qPrintable(reader.errorString()));
+    QCOMPARE(streamedConfiguration->getActiveView("second"), QString("hierarchical"));
+
+    QCOMPARE(writeModel(streamedConfiguration), writeModel(domConfiguration));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testBusDefinitionMatchesDomReader()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testBusDefinitionMatchesDomReader()
+{
+    QByteArray xml = documentStart("spirit:busDefinition") +
+        "<spirit:vendor>tut.fi</spirit:vendor>\n"
+        "<spirit:library>test</spirit:library>\n"
+        "<spirit:name>bus</spirit:name>\n"
+        "<spirit:version>1.0</spirit:version>\n"
+        "<spirit:directConnection>true</spirit:directConnection>\n"
+        "<spirit:isAddressable>true</spirit:isAddressable>\n"
+        "<spirit:maxMasters>1</spirit:maxMasters>\n"
+        "<spirit:maxSlaves>4</spirit:maxSlaves>\n"
+        "</spirit:busDefinition>\n";
+
+    QDomDocument document = createDomDocument(xml);
+    QSharedPointer<BusDefinition> domDefinition(new BusDefinition(document));
+
+    QBuffer buffer(&xml);
+    buffer.open(QIODevice::ReadOnly);
+
+    BusDefinitionStreamReader reader;
+    QSharedPointer<BusDefinition> streamedDefinition = reader.read(&buffer);
+
+    QVERIFY2(!streamedDefinition.isNull(), qPrintable(reader.errorString()));
+    QCOMPARE(writeModel(streamedDefinition), writeModel(domDefinition));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testAbstractionDefinitionMatchesDomReader()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testAbstractionDefinitionMatchesDomReader()
+{
+    QByteArray xml = documentStart("spirit:abstractionDefinition") +
+        "<spirit:vendor>tut.fi</spirit:vendor>\n"
+        "<spirit:library>test</spirit:library>\n"
+        "<spirit:name>bus.absDef</spirit:name>\n"
+        "<spirit:version>1.0</spirit:version>\n"
+        "<spirit:busType spirit:vendor=\"tut.fi\" spirit:library=\"test\" spirit:name=\"bus\" spirit:version=\"1.0\"/>\n"
+        "<spirit:ports>\n"
+        "  <spirit:port>\n"
+        "    <spirit:logicalName>CLK</spirit:logicalName>\n"
+        "    <spirit:wire>\n"
+        "      <spirit:qualifier>\n"
+        "        <spirit:isClock>true</spirit:isClock>\n"
+        "      </spirit:qualifier>\n"
+        "      <spirit:onMaster>\n"
+        "        <spirit:width>1</spirit:width>\n"
+        "        <spirit:direction>in</spirit:direction>\n"
+        "      </spirit:onMaster>\n"
+        "    </spirit:wire>\n"
+        "  </spirit:port>\n"
+        "  <spirit:port>\n"
+        "    <spirit:logicalName>DATA</spirit:logicalName>\n"
+        "    <spirit:wire>\n"
+        "      <spirit:onMaster>\n"
+        "        <spirit:width>8</spirit:width>\n"
+        "        <spirit:direction>out</spirit:direction>\n"
+        "      </spirit:onMaster>\n"
+        "    </spirit:wire>\n"
+        "  </spirit:port>\n"
+        "</spirit:ports>\n"
+        "</spirit:abstractionDefinition>\n";
+
+    QDomDocument document = createDomDocument(xml);
+    QSharedPointer<AbstractionDefinition> domDefinition(new AbstractionDefinition(document));
+
+    QBuffer buffer(&xml);
+    buffer.open(QIODevice::ReadOnly);
+
+    AbstractionDefinitionStreamReader reader;
+    QSharedPointer<AbstractionDefinition> streamedDefinition = reader.read(&buffer);
+
+    QVERIFY2(!streamedDefinition.isNull(), qPrintable(reader.errorString()));
+    QCOMPARE(streamedDefinition->getPorts().size(), 2);
+
+    QCOMPARE(writeModel(streamedDefinition), writeModel(domDefinition));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testMalformedDocument()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testMalformedDocument()
+{
+    QByteArray xml = documentStart("spirit:component") +
+        "<spirit:vendor>tut.fi</spirit:vendor>\n"
+        "<spirit:busInterfaces>\n"
+        "  <spirit:busInterface>\n"
+        "</spirit:busInterfaces>\n";
+
+    QBuffer buffer(&xml);
+    buffer.open(QIODevice::ReadOnly);
+
+    ComponentStreamReader reader;
+    QSharedPointer<Component> component = reader.read(&buffer);
+
+    QVERIFY(component.isNull());
+    QVERIFY(!reader.errorString().isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testSnapshotMatchesDocument()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testSnapshotMatchesDocument()
+{
+    QByteArray xml = createDesign();
+
+    QBuffer buffer(&xml);
+    buffer.open(QIODevice::ReadOnly);
+
+    QByteArray snapshot;
+    QBuffer snapshotBuffer(&snapshot);
+    snapshotBuffer.open(QIODevice::WriteOnly);
+
+    DesignStreamReader reader;
+    reader.setSnapshotDevice(&snapshotBuffer);
+    QSharedPointer<Design> design = reader.read(&buffer);
+    snapshotBuffer.close();
+
+    QVERIFY2(!design.isNull(), qPrintable(reader.errorString()));
+    QVERIFY(!snapshot.isEmpty());
+
+    snapshotBuffer.open(QIODevice::ReadOnly);
+    QVERIFY(DocumentStreamReader::isSnapshot(&snapshotBuffer));
+
+    DesignStreamReader snapshotReader;
+    QSharedPointer<Design> snapshotDesign = snapshotReader.read(&snapshotBuffer);
+
+    QVERIFY2(!snapshotDesign.isNull(), qPrintable(snapshotReader.errorString()));
+    QCOMPARE(snapshotDesign->getComponentInstances().size(), 2);
+
+    QCOMPARE(writeModel(snapshotDesign), writeModel(design));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::testCorruptedSnapshot()
+//-----------------------------------------------------------------------------
+void tst_DocumentStreamReader::testCorruptedSnapshot()
+{
+    QByteArray xml = createDesign();
+
+    QBuffer buffer(&xml);
+    buffer.open(QIODevice::ReadOnly);
+
+    QByteArray snapshot;
+    QBuffer snapshotBuffer(&snapshot);
+    snapshotBuffer.open(QIODevice::WriteOnly);
+
+    DesignStreamReader reader;
+    reader.setSnapshotDevice(&snapshotBuffer);
+    QVERIFY(!reader.read(&buffer).isNull());
+    snapshotBuffer.close();
+
+    snapshot.truncate(snapshot.size() / 2);
+
+    snapshotBuffer.open(QIODevice::ReadOnly);
+
+    DesignStreamReader snapshotReader;
+    QVERIFY(snapshotReader.read(&snapshotBuffer).isNull());
+    QVERIFY(!snapshotReader.errorString().isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::writeModel()
+//-----------------------------------------------------------------------------
+QByteArray tst_DocumentStreamReader::writeModel(QSharedPointer<LibraryComponent> model) const
+{
+    QTemporaryFile file;
+    if (!file.open())
+    {
+        return QByteArray();
+    }
+
+    model->write(file);
+
+    file.seek(0);
+    return file.readAll();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::createDomDocument()
+//-----------------------------------------------------------------------------
+QDomDocument tst_DocumentStreamReader::createDomDocument(QByteArray const& xml) const
+{
+    QDomDocument document;
+    document.setContent(xml);
+
+    return document;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::documentStart()
+//-----------------------------------------------------------------------------
+QByteArray tst_DocumentStreamReader::documentStart(QString const& element) const
+{
+    return QString("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<!-- Created for the stream reader tests. -->\n"
+        "<%1 xmlns:spirit=\"http://www.spiritconsortium.org/XMLSchema/SPIRIT/1.5\" "
+        "xmlns:kactus2=\"http://funbase.cs.tut.fi/\">\n").arg(element).toUtf8();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentStreamReader::createDesign()
+//-----------------------------------------------------------------------------
+QByteArray tst_DocumentStreamReader::createDesign() const
+{
+    return documentStart("spirit:design") +
+        "<spirit:vendor>tut.fi</spirit:vendor>\n"
+        "<spirit:library>test</spirit:library>\n"
+        "<spirit:name>streamed.design</spirit:name>\n"
+        "<spirit:version>1.0</spirit:version>\n"
+        "<spirit:componentInstances>\n"
+        "  <spirit:componentInstance>\n"
+        "    <spirit:instanceName>first</spirit:instanceName>\n"
+        "    <spirit:componentRef spirit:vendor=\"tut.fi\" spirit:library=\"test\" spirit:name=\"streamed\" spirit:version=\"1.0\"/>\n"
+        "  </spirit:componentInstance>\n"
+        "  <spirit:componentInstance>\n"
+        "    <spirit:instanceName>second</spirit:instanceName>\n"
+        "    <spirit:componentRef spirit:vendor=\"tut.fi\" spirit:library=\"test\" spirit:name=\"streamed\" spirit:version=\"1.0\"/>\n"
+        "  </spirit:componentInstance>\n"
+        "</spirit:componentInstances>\n"
+        "<spirit:interconnections>\n"
+        "  <spirit:interconnection>\n"
+        "    <spirit:name>first_to_second</spirit:name>\n"
+        "    <spirit:activeInterface spirit:componentRef=\"first\" spirit:busRef=\"bus\"/>\n"
+        "    <spirit:activeInterface spirit:componentRef=\"second\" spirit:busRef=\"slave\"/>\n"
+        "  </spirit:interconnection>\n"
+        "</spirit:interconnections>\n"
+        "<spirit:adHocConnections>\n"
+        "  <spirit:adHocConnection>\n"
+        "    <spirit:name>clock</spirit:name>\n"
+        "    <spirit:internalPortReference spirit:componentRef=\"first\" spirit:portRef=\"clk\"/>\n"
+        "    <spirit:internalPortReference spirit:componentRef=\"second\" spirit:portRef=\"clk\"/>\n"
+        "  </spirit:adHocConnection>\n"
+        "</spirit:adHocConnections>\n"
+        "<spirit:hierConnections>\n"
+        "  <spirit:hierConnection spirit:interfaceRef=\"bus\">\n"
+        "    <spirit:interface spirit:componentRef=\"first\" spirit:busRef=\"bus\"/>\n"
+        "  </spirit:hierConnection>\n"
+        "</spirit:hierConnections>\n"
+        "<spirit:vendorExtensions>\n"
+        "  <kactus2:extensions>\n"
+        "    <kactus2:routes>\n"
+        "      <kactus2:route kactus2:connRef=\"first_to_second\" kactus2:offPage=\"true\">\n"
+        "        <kactus2:position x=\"20\" y=\"40\"/>\n"
+        "        <kactus2:position x=\"100\" y=\"40\"/>\n"
+        "      </kactus2:route>\n"
+        "      <kactus2:route kactus2:connRef=\"clock\" kactus2:offPage=\"false\">\n"
+        "        <kactus2:position x=\"20\" y=\"80\"/>\n"
+        "        <kactus2:position x=\"60\" y=\"80\"/>\n"
+        "        <kactus2:position x=\"60\" y=\"120\"/>\n"
+        "      </kactus2:route>\n"
+        "    </kactus2:routes>\n"
+        "  </kactus2:extensions>\n"
+        "</spirit:vendorExtensions>\n"
+        "</spirit:design>\n";
+}
+
+QTEST_MAIN(tst_DocumentStreamReader)
+
+#include "tst_DocumentStreamReader.moc"
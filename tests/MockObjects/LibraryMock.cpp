@@ -57,6 +57,14 @@ QSharedPointer<LibraryComponent> LibraryMock::getModel(const VLNV& vlnv)
     return components_.value(vlnv, QSharedPointer<LibraryComponent>(0));
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryMock::prefetchModels()
+//-----------------------------------------------------------------------------
+void LibraryMock::prefetchModels(QList<VLNV> const& /*vlnvs*/)
+{
+
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryMock::getModelReadOnly()
 //-----------------------------------------------------------------------------
@@ -67,6 +67,13 @@ public:
     */
     virtual QSharedPointer<LibraryComponent const> getModelReadOnly(const VLNV& vlnv);
 
+    /*!
+    *  Does nothing, the mock has all its models in memory.
+    *
+    *      @param [in] vlnvs   The documents to parse.
+    */
+    virtual void prefetchModels(QList<VLNV> const& vlnvs);
+
     /*!
     *  Method description.
     *
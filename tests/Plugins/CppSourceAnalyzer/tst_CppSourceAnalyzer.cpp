@@ -0,0 +1,301 @@
+//-----------------------------------------------------------------------------
+// File: tst_CppSourceAnalyzer.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class CppSourceAnalyzer.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <Plugins/CppSourceAnalyzer/CppSourceAnalyzer.h>
+
+#include <IPXACTmodels/component.h>
+#include <IPXACTmodels/file.h>
+#include <IPXACTmodels/filebuilder.h>
+#include <IPXACTmodels/fileset.h>
+
+class tst_CppSourceAnalyzer : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_CppSourceAnalyzer();
+
+private slots:
+    void init();
+    void cleanup();
+
+    void testFileTypes();
+
+    void testFileInclude();
+    void testFileInclude_data();
+
+    void testIncludeFromFileSetDependency();
+    void testIncludeFromBuilderFlags();
+    void testIncludeFromFileFlags();
+    void testQuotedIncludePrefersSourceDirectory();
+    void testSystemIncludeIgnoresSourceDirectory();
+    void testUnresolvedIncludeIsReturnedAsWritten();
+
+private:
+
+    void writeFile(QString const& path, QString const& content);
+
+    QList<FileDependencyDesc> analyze(QSharedPointer<Component> component, QString const& filePath);
+
+    //! The directory where the test files are created.
+    QDir testDirectory_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_CppSourceAnalyzer::tst_CppSourceAnalyzer()
+//-----------------------------------------------------------------------------
+tst_CppSourceAnalyzer::tst_CppSourceAnalyzer() : testDirectory_()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CppSourceAnalyzer::init()
+//-----------------------------------------------------------------------------
+void tst_CppSourceAnalyzer::init()
+{
+    testDirectory_ = QDir(QDir::currentPath());
+    testDirectory_.mkpath("cppTest/src");
+    testDirectory_.mkpath("cppTest/include/sub");
+    testDirectory_.cd("cppTest");
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CppSourceAnalyzer::cleanup()
+//-----------------------------------------------------------------------------
+void tst_CppSourceAnalyzer::cleanup()
+{
+    QVERIFY(testDirectory_.removeRecursively());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CppSourceAnalyzer::testFileTypes()
+//-----------------------------------------------------------------------------
+void tst_CppSourceAnalyzer::testFileTypes()
+{
+    CppSourceAnalyzer analyzer;
+
+    QStringList supportedFileTypes = analyzer.getSupportedFileTypes();
+
+    QVERIFY(supportedFileTypes.contains("cSource"));
+    QVERIFY(supportedFileTypes.contains("cppSource"));
+    QCOMPARE(supportedFileTypes.count(), 2);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CppSourceAnalyzer::testFileInclude()
+//-----------------------------------------------------------------------------
+void tst_CppSourceAnalyzer::testFileInclude()
+{
+    QFETCH(QString, input);
+    QFETCH(int, expectedDependencyCount);
+    QFETCH(QString, firstDependentFileName);
+
+    writeFile("src/test.c", input);
+
+    QList<FileDependencyDesc> dependencies = analyze(QSharedPointer<Component>(new Component()), "src/test.c");
+
+    QCOMPARE(dependencies.count(), expectedDependencyCount);
+
+    if (expectedDependencyCount > 0)
+    {
+        QCOMPARE(dependencies.first().filename, firstDependentFileName);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CppSourceAnalyzer::testFileInclude_data()
+//-----------------------------------------------------------------------------
+void tst_CppSourceAnalyzer::testFileInclude_data()
+{
+    QTest::addColumn<QString>("input");
+    QTest::addColumn<int>("expectedDependencyCount");
+    QTest::addColumn<QString>("firstDependentFileName");
+
+    QTest::newRow("empty input") << "" << 0 << "";
+
+    QTest::newRow("single include in quotes") << "#include \"definitions.h\"" << 1 << "definitions.h";
+
+    QTest::newRow("single include in angle brackets") << "#include <stdio.h>" << 1 << "stdio.h";
+
+    QTest::newRow("indented include") << "   #include \"definitions.h\"" << 1 << "definitions.h";
+
+    QTest::newRow("whitespace after hash") << "#  include <stdio.h>" << 1 << "stdio.h";
+
+    QTest::newRow("includes in comments") <<
+        "//#include \"globals.h\"\n"
+        "#include \"variables.h\"\n"
+        "/*#include \"parameters.h\"\n"
+        "#include \"other.h\"*/"
+        << 1 << "variables.h";
+
+    QTest::newRow("includes in disabled block") <<
+        "#if 0\n"
+        "#include \"disabled.h\"\n"
+        "#ifdef SOMETHING\n"
+        "#include \"nested.h\"\n"
+        "#endif\n"
+        "#else\n"
+        "#include \"enabled.h\"\n"
+        "#endif\n"
+        "#include \"after.h\"\n"
+        << 2 << "enabled.h";
+
+    QTest::newRow("multiple includes") <<
+        "#include <stdlib.h>\n"
+        "#include \"variables.h\"\n"
+        "#include \"parameters.h\"\n"
+        << 3 << "stdlib.h";
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CppSourceAnalyzer::testIncludeFromFileSetDependency()
+//-----------------------------------------------------------------------------
+void tst_CppSourceAnalyzer::testIncludeFromFileSetDependency()
+{
+    writeFile("src/test.c", "#include \"sub/definitions.h\"\n");
+    writeFile("include/sub/definitions.h", "#define VALUE 1\n");
+
+    QSharedPointer<Component> component(new Component());
+    component->getFileSet("sources")->addDependency("include");
+
+    QList<FileDependencyDesc> dependencies = analyze(component, "src/test.c");
+
+    QCOMPARE(dependencies.count(), 1);
+    QCOMPARE(dependencies.first().filename, QString("../include/sub/definitions.h"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CppSourceAnalyzer::testIncludeFromBuilderFlags()
+//-----------------------------------------------------------------------------
+void tst_CppSourceAnalyzer::testIncludeFromBuilderFlags()
+{
+    writeFile("src/test.c", "#include <definitions.h>\n");
+    writeFile("include/sub/definitions.h", "#define VALUE 1\n");
+
+    QSharedPointer<FileBuilder> builder(new FileBuilder("cSource"));
+    builder->setFlags("-O2 -Iinclude/sub -Wall");
+
+    QSharedPointer<Component> component(new Component());
+    component->getFileSet("sources")->getDefaultFileBuilders().append(builder);
+
+    QList<FileDependencyDesc> dependencies = analyze(component, "src/test.c");
+
+    QCOMPARE(dependencies.count(), 1);
+    QCOMPARE(dependencies.first().filename, QString("../include/sub/definitions.h"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CppSourceAnalyzer::testIncludeFromFileFlags()
+//-----------------------------------------------------------------------------
+void tst_CppSourceAnalyzer::testIncludeFromFileFlags()
+{
+    writeFile("src/test.c", "#include \"definitions.h\"\n");
+    writeFile("include/definitions.h", "#define VALUE 1\n");
+
+    QSettings settings;
+    QSharedPointer<Component> component(new Component());
+    QSharedPointer<File> sourceFile = component->getFileSet("sources")->addFile("src/test.c", settings);
+    sourceFile->addFileType("cSource");
+    sourceFile->setBuildFlags("-I include", false);
+
+    QList<FileDependencyDesc> dependencies = analyze(component, "src/test.c");
+
+    QCOMPARE(dependencies.count(), 1);
+    QCOMPARE(dependencies.first().filename, QString("../include/definitions.h"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CppSourceAnalyzer::testQuotedIncludePrefersSourceDirectory()
+//-----------------------------------------------------------------------------
+void tst_CppSourceAnalyzer::testQuotedIncludePrefersSourceDirectory()
+{
+    writeFile("src/test.c", "#include \"definitions.h\"\n");
+    writeFile("src/definitions.h", "#define VALUE 1\n");
+    writeFile("include/definitions.h", "#define VALUE 2\n");
+
+    QSharedPointer<Component> component(new Component());
+    component->getFileSet("sources")->addDependency("include");
+
+    QList<FileDependencyDesc> dependencies = analyze(component, "src/test.c");
+
+    QCOMPARE(dependencies.count(), 1);
+    QCOMPARE(dependencies.first().filename, QString("definitions.h"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CppSourceAnalyzer::testSystemIncludeIgnoresSourceDirectory()
+//-----------------------------------------------------------------------------
+void tst_CppSourceAnalyzer::testSystemIncludeIgnoresSourceDirectory()
+{
+    writeFile("src/test.c", "#include <definitions.h>\n");
+    writeFile("src/definitions.h", "#define VALUE 1\n");
+    writeFile("include/definitions.h", "#define VALUE 2\n");
+
+    QSharedPointer<Component> component(new Component());
+    component->getFileSet("sources")->addDependency("include");
+
+    QList<FileDependencyDesc> dependencies = analyze(component, "src/test.c");
+
+    QCOMPARE(dependencies.count(), 1);
+    QCOMPARE(dependencies.first().filename, QString("../include/definitions.h"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CppSourceAnalyzer::testUnresolvedIncludeIsReturnedAsWritten()
+//-----------------------------------------------------------------------------
+void tst_CppSourceAnalyzer::testUnresolvedIncludeIsReturnedAsWritten()
+{
+    writeFile("src/test.c", "#include <sys/types.h>\n");
+
+    QSharedPointer<Component> component(new Component());
+    component->getFileSet("sources")->addDependency("include");
+
+    QList<FileDependencyDesc> dependencies = analyze(component, "src/test.c");
+
+    QCOMPARE(dependencies.count(), 1);
+    QCOMPARE(dependencies.first().filename, QString("sys/types.h"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CppSourceAnalyzer::writeFile()
+//-----------------------------------------------------------------------------
+void tst_CppSourceAnalyzer::writeFile(QString const& path, QString const& content)
+{
+    QFile outputFile(testDirectory_.absoluteFilePath(path));
+    QVERIFY(outputFile.open(QIODevice::WriteOnly));
+    outputFile.write(content.toLatin1());
+    outputFile.close();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CppSourceAnalyzer::analyze()
+//-----------------------------------------------------------------------------
+QList<FileDependencyDesc> tst_CppSourceAnalyzer::analyze(QSharedPointer<Component> component,
+    QString const& filePath)
+{
+    QString componentPath = testDirectory_.absolutePath() + "/";
+
+    CppSourceAnalyzer analyzer;
+    analyzer.beginAnalysis(component.data(), componentPath);
+
+    QList<FileDependencyDesc> dependencies = analyzer.getFileDependencies(component.data(), componentPath,
+        testDirectory_.absoluteFilePath(filePath));
+
+    analyzer.endAnalysis(component.data(), componentPath);
+
+    return dependencies;
+}
+
+QTEST_MAIN(tst_CppSourceAnalyzer)
+
+#include "tst_CppSourceAnalyzer.moc"
@@ -0,0 +1,14 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+# This is a reminder that you are using a generated .pro file.
+# Remove it when you are finished editing this file.
+message("You are running qmake on a generated .pro file. This may not work!")
+
+
+HEADERS += ../../../Plugins/CppSourceAnalyzer/CppSourceAnalyzer.h \
+    ../../../Plugins/CppSourceAnalyzer/CppIncludeResolver.h
+SOURCES += ./tst_CppSourceAnalyzer.cpp \
+    ../../../Plugins/CppSourceAnalyzer/CppSourceAnalyzer.cpp \
+    ../../../Plugins/CppSourceAnalyzer/CppIncludeResolver.cpp
@@ -0,0 +1,45 @@
+#-----------------------------------------------------------------------------
+# File: tst_CppSourceAnalyzer.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus 2
+# Author: agent
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file for running unit tests for CppSourceAnalyzer.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+TARGET = tst_CppSourceAnalyzer
+
+DEFINES += CPPSOURCEANALYZER_LIB
+
+QT += core xml gui testlib widgets
+CONFIG += testcase console
+
+win32:CONFIG(release, debug|release) {
+    LIBS += -L$$PWD/../../../executable/ -lIPXACTmodels
+    DESTDIR = ./release
+}
+else:win32:CONFIG(debug, debug|release) {
+    LIBS += -L$$PWD/../../../executable/ -lIPXACTmodelsd
+    DESTDIR = ./debug
+}
+else:unix {
+    LIBS += -L$$PWD/../../../executable/ -lIPXACTmodels
+    DESTDIR = ./release
+}
+
+INCLUDEPATH += $$DESTDIR
+INCLUDEPATH += ../../../
+
+DEPENDPATH += .
+DEPENDPATH += ../../../
+
+OBJECTS_DIR += $$DESTDIR
+
+MOC_DIR += ./generatedFiles
+UI_DIR += ./generatedFiles
+RCC_DIR += ./generatedFiles
+include(tst_CppSourceAnalyzer.pri)
@@ -19,4 +19,5 @@ SUBDIRS += VerilogGenerator/VerilogGenerator.pro \
 			VerilogImport/VerilogImport.pro \
 		    VerilogIncludeImport/tst_VerilogIncludeImport.pro \
 			VerilogSourceAnalyzer/tst_VerilogSourceAnalyzer.pro \
+			CppSourceAnalyzer/tst_CppSourceAnalyzer.pro \
 			MemoryMapHeaderGenerator/tst_MemoryMapHeaderGenerator.pro
\ No newline at end of file
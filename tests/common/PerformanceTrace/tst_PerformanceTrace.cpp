@@ -0,0 +1,247 @@
+//-----------------------------------------------------------------------------
+// File: tst_PerformanceTrace.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for the performance trace and class ScopedTrace.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <common/PerformanceTrace/PerformanceTrace.h>
+#include <common/PerformanceTrace/ScopedTrace.h>
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QRunnable>
+#include <QTemporaryDir>
+#include <QThreadPool>
+
+class tst_PerformanceTrace : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_PerformanceTrace();
+
+private slots:
+
+    void init();
+    void cleanup();
+
+    void testDisabledTraceRecordsNothing();
+    void testScopedTraceRecordsEvent();
+    void testDetailIsWrittenAsArgument();
+    void testDisableDiscardsEvents();
+    void testEventsAreRecordedFromSeveralThreads();
+
+private:
+
+    QJsonArray readEvents(QString const& path) const;
+
+    //! The directory for the written traces.
+    QTemporaryDir outputDirectory_;
+};
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! Records a number of scoped events in a worker thread.
+    //-----------------------------------------------------------------------------
+    class TracingTask : public QRunnable
+    {
+    public:
+        TracingTask(int eventCount): eventCount_(eventCount) {}
+
+        virtual void run()
+        {
+            for (int i = 0; i < eventCount_; ++i)
+            {
+                ScopedTrace trace("TracingTask::run", "test");
+            }
+        }
+
+    private:
+
+        //! The number of events to record.
+        int eventCount_;
+    };
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceTrace::tst_PerformanceTrace()
+//-----------------------------------------------------------------------------
+tst_PerformanceTrace::tst_PerformanceTrace(): outputDirectory_()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceTrace::init()
+//-----------------------------------------------------------------------------
+void tst_PerformanceTrace::init()
+{
+    PerformanceTrace::disable();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceTrace::cleanup()
+//-----------------------------------------------------------------------------
+void tst_PerformanceTrace::cleanup()
+{
+    PerformanceTrace::disable();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceTrace::testDisabledTraceRecordsNothing()
+//-----------------------------------------------------------------------------
+void tst_PerformanceTrace::testDisabledTraceRecordsNothing()
+{
+    QVERIFY(!PerformanceTrace::isEnabled());
+
+    {
+        ScopedTrace trace("tst_PerformanceTrace::testDisabledTraceRecordsNothing", "test");
+    }
+
+    // The detail must not be built when the trace is disabled.
+    int detailCount = 0;
+    {
+        SCOPED_TRACE_DETAIL(trace, "getModel", "test", QString::number(++detailCount));
+    }
+    QCOMPARE(detailCount, 0);
+
+    PerformanceTrace::addEvent("event", "test", QString(), 0, 1);
+
+    QCOMPARE(PerformanceTrace::getEventCount(), 0);
+    QVERIFY(PerformanceTrace::writeTrace());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceTrace::testScopedTraceRecordsEvent()
+//-----------------------------------------------------------------------------
+void tst_PerformanceTrace::testScopedTraceRecordsEvent()
+{
+    QString outputPath = outputDirectory_.path() + "/scoped.json";
+    PerformanceTrace::enable(outputPath);
+    QVERIFY(PerformanceTrace::isEnabled());
+
+    {
+        ScopedTrace trace("tst_PerformanceTrace::testScopedTraceRecordsEvent", "test");
+        QTest::qSleep(2);
+    }
+
+    QCOMPARE(PerformanceTrace::getEventCount(), 1);
+    QVERIFY(PerformanceTrace::writeTrace());
+
+    QJsonArray events = readEvents(outputPath);
+    QCOMPARE(events.size(), 1);
+
+    QJsonObject event = events.first().toObject();
+    QCOMPARE(event.value("name").toString(), QString("tst_PerformanceTrace::testScopedTraceRecordsEvent"));
+    QCOMPARE(event.value("cat").toString(), QString("test"));
+    QCOMPARE(event.value("ph").toString(), QString("X"));
+    QVERIFY(event.value("ts").toDouble() >= 0);
+    QVERIFY(event.value("dur").toDouble() >= 1000);
+    QVERIFY(!event.contains("args"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceTrace::testDetailIsWrittenAsArgument()
+//-----------------------------------------------------------------------------
+void tst_PerformanceTrace::testDetailIsWrittenAsArgument()
+{
+    QString outputPath = outputDirectory_.path() + "/detail.json";
+    PerformanceTrace::enable(outputPath);
+
+    {
+        SCOPED_TRACE_DETAIL(trace, "getModel", "library", QString("TUT:ip.hw:uart:1.0"));
+    }
+
+    QVERIFY(PerformanceTrace::writeTrace());
+
+    QJsonArray events = readEvents(outputPath);
+    QCOMPARE(events.size(), 1);
+
+    QJsonObject event = events.first().toObject();
+    QCOMPARE(event.value("name").toString(), QString("getModel"));
+    QCOMPARE(event.value("cat").toString(), QString("library"));
+    QCOMPARE(event.value("args").toObject().value("detail").toString(), QString("TUT:ip.hw:uart:1.0"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceTrace::testDisableDiscardsEvents()
+//-----------------------------------------------------------------------------
+void tst_PerformanceTrace::testDisableDiscardsEvents()
+{
+    QString outputPath = outputDirectory_.path() + "/discarded.json";
+    PerformanceTrace::enable(outputPath);
+
+    PerformanceTrace::addEvent("first", "test", QString(), 0, 1);
+    PerformanceTrace::addEvent("second", "test", QString(), 1, 1);
+    QCOMPARE(PerformanceTrace::getEventCount(), 2);
+
+    // An event started while enabled is not recorded after the trace is disabled.
+    {
+        ScopedTrace trace("tst_PerformanceTrace::testDisableDiscardsEvents", "test");
+        PerformanceTrace::disable();
+    }
+
+    QVERIFY(!PerformanceTrace::isEnabled());
+    QCOMPARE(PerformanceTrace::getEventCount(), 0);
+
+    QVERIFY(PerformanceTrace::writeTrace());
+    QVERIFY(!QFile::exists(outputPath));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceTrace::testEventsAreRecordedFromSeveralThreads()
+//-----------------------------------------------------------------------------
+void tst_PerformanceTrace::testEventsAreRecordedFromSeveralThreads()
+{
+    const int THREAD_COUNT = 4;
+    const int EVENTS_PER_THREAD = 1000;
+
+    QString outputPath = outputDirectory_.path() + "/threads.json";
+    PerformanceTrace::enable(outputPath);
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(THREAD_COUNT);
+    for (int i = 0; i < THREAD_COUNT; ++i)
+    {
+        pool.start(new TracingTask(EVENTS_PER_THREAD));
+    }
+    pool.waitForDone();
+
+    QCOMPARE(PerformanceTrace::getEventCount(), THREAD_COUNT * EVENTS_PER_THREAD);
+    QVERIFY(PerformanceTrace::writeTrace());
+
+    QJsonArray events = readEvents(outputPath);
+    QCOMPARE(events.size(), THREAD_COUNT * EVENTS_PER_THREAD);
+
+    foreach (QJsonValue const& value, events)
+    {
+        QCOMPARE(value.toObject().value("name").toString(), QString("TracingTask::run"));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceTrace::readEvents()
+//-----------------------------------------------------------------------------
+QJsonArray tst_PerformanceTrace::readEvents(QString const& path) const
+{
+    QFile traceFile(path);
+    if (!traceFile.open(QFile::ReadOnly))
+    {
+        return QJsonArray();
+    }
+
+    return QJsonDocument::fromJson(traceFile.readAll()).object().value("traceEvents").toArray();
+}
+
+QTEST_APPLESS_MAIN(tst_PerformanceTrace)
+
+#include "tst_PerformanceTrace.moc"
@@ -0,0 +1,14 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+# This is a reminder that you are using a generated .pro file.
+# Remove it when you are finished editing this file.
+message("You are running qmake on a generated .pro file. This may not work!")
+
+
+HEADERS += ../../../common/PerformanceTrace/PerformanceTrace.h \
+    ../../../common/PerformanceTrace/ScopedTrace.h
+SOURCES += ./tst_PerformanceTrace.cpp \
+    ../../../common/PerformanceTrace/PerformanceTrace.cpp \
+    ../../../common/PerformanceTrace/ScopedTrace.cpp
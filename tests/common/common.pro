@@ -0,0 +1,17 @@
+#-----------------------------------------------------------------------------
+# File: common.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus 2
+# Author: agent
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file template for running unit tests in common.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = subdirs
+
+CONFIG += testcase
+SUBDIRS += graphicsItems/tst_OrthogonalRouter.pro \
+    graphicsItems/tst_ConnectionSegmentIndex.pro \
+    PerformanceTrace/tst_PerformanceTrace.pro
@@ -0,0 +1,271 @@
+//-----------------------------------------------------------------------------
+// File: tst_ConnectionSegmentIndex.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class ConnectionSegmentIndex.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <common/graphicsItems/ConnectionSegmentIndex.h>
+#include <common/graphicsItems/GraphicsConnection.h>
+
+namespace
+{
+    //! The connections notified by the index in the order of the notifications.
+    QList<GraphicsConnection*> notifiedConnections;
+}
+
+//-----------------------------------------------------------------------------
+// Function: GraphicsConnection::invalidateCrossings()
+//-----------------------------------------------------------------------------
+void GraphicsConnection::invalidateCrossings()
+{
+    // The index only stores the connections and notifies them, so the test records the notifications
+    // instead of linking the diagram the real connections need.
+    notifiedConnections.append(this);
+}
+
+class tst_ConnectionSegmentIndex : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_ConnectionSegmentIndex();
+
+private slots:
+
+    void init();
+
+    void testUpdatedConnectionIsFound();
+    void testUpdatedConnectionIsFound_data();
+    void testMovedConnectionLeavesOldCells();
+    void testUpdateNotifiesConnectionsNearOldAndNewRoute();
+    void testRemovedConnectionIsNotFound();
+    void testRemovalNotifiesConnectionsNearRoute();
+    void testSparseAndDenseSearchFindSameConnections();
+
+private:
+
+    GraphicsConnection* connection(int index);
+
+    QList<QPointF> createRoute(QPointF const& start, QPointF const& corner, QPointF const& end) const;
+
+    //! The width and height of the grid cells in the tests.
+    static const int CELL_SIZE = 100;
+
+    //! The storage whose addresses identify the connections in the tests.
+    char connectionHandles_[8];
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::tst_ConnectionSegmentIndex()
+//-----------------------------------------------------------------------------
+tst_ConnectionSegmentIndex::tst_ConnectionSegmentIndex()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::init()
+//-----------------------------------------------------------------------------
+void tst_ConnectionSegmentIndex::init()
+{
+    notifiedConnections.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::testUpdatedConnectionIsFound()
+//-----------------------------------------------------------------------------
+void tst_ConnectionSegmentIndex::testUpdatedConnectionIsFound()
+{
+    QFETCH(QRectF, area);
+    QFETCH(bool, expectedFound);
+
+    ConnectionSegmentIndex index(CELL_SIZE);
+    index.updateConnection(connection(0),
+        createRoute(QPointF(10, 10), QPointF(250, 10), QPointF(250, 150)));
+
+    // The far away connection makes the small areas use the cell lookup and the large areas the
+    // occupied cells.
+    index.updateConnection(connection(1),
+        createRoute(QPointF(5010, 5010), QPointF(5050, 5010), QPointF(5050, 5050)));
+
+    QCOMPARE(index.findConnections(area).contains(connection(0)), expectedFound);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::testUpdatedConnectionIsFound_data()
+//-----------------------------------------------------------------------------
+void tst_ConnectionSegmentIndex::testUpdatedConnectionIsFound_data()
+{
+    QTest::addColumn<QRectF>("area");
+    QTest::addColumn<bool>("expectedFound");
+
+    QTest::newRow("dense lookup in first cell") << QRectF(20, 20, 10, 10) << true;
+    QTest::newRow("dense lookup in corner cell") << QRectF(260, 110, 10, 10) << true;
+    QTest::newRow("dense lookup in untouched cell") << QRectF(20, 120, 10, 10) << false;
+    QTest::newRow("dense lookup with negative coordinates") << QRectF(-50, -50, 20, 20) << false;
+    QTest::newRow("sparse lookup over the route") << QRectF(-1000, -1000, 2000, 2000) << true;
+    QTest::newRow("sparse lookup beside the route") << QRectF(-1000, 300, 2000, 2000) << false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::testMovedConnectionLeavesOldCells()
+//-----------------------------------------------------------------------------
+void tst_ConnectionSegmentIndex::testMovedConnectionLeavesOldCells()
+{
+    ConnectionSegmentIndex index(CELL_SIZE);
+    index.updateConnection(connection(0),
+        createRoute(QPointF(10, 10), QPointF(50, 10), QPointF(50, 50)));
+
+    QRectF oldArea(0, 0, 90, 90);
+    QRectF newArea(1000, 1000, 90, 90);
+    QVERIFY(index.findConnections(oldArea).contains(connection(0)));
+
+    index.updateConnection(connection(0),
+        createRoute(QPointF(1010, 1010), QPointF(1050, 1010), QPointF(1050, 1050)));
+
+    QVERIFY(index.findConnections(oldArea).isEmpty());
+    QCOMPARE(index.findConnections(newArea), QList<GraphicsConnection*>() << connection(0));
+    QVERIFY(index.findConnections(QRectF(-5000, -5000, 10000, 10000)).contains(connection(0)));
+
+    index.clear();
+    QVERIFY(index.findConnections(newArea).isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::testUpdateNotifiesConnectionsNearOldAndNewRoute()
+//-----------------------------------------------------------------------------
+void tst_ConnectionSegmentIndex::testUpdateNotifiesConnectionsNearOldAndNewRoute()
+{
+    ConnectionSegmentIndex index(CELL_SIZE);
+
+    index.updateConnection(connection(1),
+        createRoute(QPointF(10, 20), QPointF(60, 20), QPointF(60, 80)));
+    index.updateConnection(connection(2),
+        createRoute(QPointF(1010, 20), QPointF(1060, 20), QPointF(1060, 80)));
+    index.updateConnection(connection(3),
+        createRoute(QPointF(3010, 20), QPointF(3060, 20), QPointF(3060, 80)));
+    index.updateConnection(connection(0),
+        createRoute(QPointF(20, 10), QPointF(20, 90), QPointF(80, 90)));
+
+    notifiedConnections.clear();
+
+    // Moving the connection from beside the first one to beside the second one.
+    index.updateConnection(connection(0),
+        createRoute(QPointF(1020, 10), QPointF(1020, 90), QPointF(1080, 90)));
+
+    QVERIFY(notifiedConnections.contains(connection(0)));
+    QVERIFY(notifiedConnections.contains(connection(1)));
+    QVERIFY(notifiedConnections.contains(connection(2)));
+    QVERIFY(!notifiedConnections.contains(connection(3)));
+    QCOMPARE(notifiedConnections.count(connection(1)), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::testRemovedConnectionIsNotFound()
+//-----------------------------------------------------------------------------
+void tst_ConnectionSegmentIndex::testRemovedConnectionIsNotFound()
+{
+    ConnectionSegmentIndex index(CELL_SIZE);
+    index.updateConnection(connection(0),
+        createRoute(QPointF(10, 10), QPointF(150, 10), QPointF(150, 50)));
+    index.updateConnection(connection(1),
+        createRoute(QPointF(20, 20), QPointF(60, 20), QPointF(60, 60)));
+
+    index.removeConnection(connection(0));
+
+    QCOMPARE(index.findConnections(QRectF(0, 0, 90, 90)), QList<GraphicsConnection*>() << connection(1));
+    QVERIFY(index.findConnections(QRectF(110, 0, 80, 80)).isEmpty());
+    QCOMPARE(index.findConnections(QRectF(-5000, -5000, 10000, 10000)),
+        QList<GraphicsConnection*>() << connection(1));
+
+    index.removeConnection(connection(1));
+    QVERIFY(index.findConnections(QRectF(0, 0, 90, 90)).isEmpty());
+    QVERIFY(index.findConnections(QRectF(-5000, -5000, 10000, 10000)).isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::testRemovalNotifiesConnectionsNearRoute()
+//-----------------------------------------------------------------------------
+void tst_ConnectionSegmentIndex::testRemovalNotifiesConnectionsNearRoute()
+{
+    ConnectionSegmentIndex index(CELL_SIZE);
+    index.updateConnection(connection(0),
+        createRoute(QPointF(10, 10), QPointF(50, 10), QPointF(50, 50)));
+    index.updateConnection(connection(1),
+        createRoute(QPointF(20, 20), QPointF(60, 20), QPointF(60, 60)));
+    index.updateConnection(connection(2),
+        createRoute(QPointF(2020, 20), QPointF(2060, 20), QPointF(2060, 60)));
+
+    notifiedConnections.clear();
+    index.removeConnection(connection(0));
+
+    QCOMPARE(notifiedConnections, QList<GraphicsConnection*>() << connection(1));
+
+    // Removing a connection that is not in the index does nothing.
+    notifiedConnections.clear();
+    index.removeConnection(connection(0));
+    index.removeConnection(connection(3));
+
+    QVERIFY(notifiedConnections.isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::testSparseAndDenseSearchFindSameConnections()
+//-----------------------------------------------------------------------------
+void tst_ConnectionSegmentIndex::testSparseAndDenseSearchFindSameConnections()
+{
+    ConnectionSegmentIndex index(CELL_SIZE);
+
+    // Connections in a diagonal row, each covering a few cells.
+    for (int i = 0; i < 8; ++i)
+    {
+        qreal offset = i * 150;
+        index.updateConnection(connection(i), createRoute(QPointF(offset, offset),
+            QPointF(offset + 120, offset), QPointF(offset + 120, offset + 120)));
+    }
+
+    QRectF area(100, 100, 450, 450);
+
+    // The area covers more cells than there are occupied cells, so they are searched instead.
+    QSet<GraphicsConnection*> sparseResult = index.findConnections(area).toSet();
+
+    // A long route elsewhere makes the occupied cells outnumber the cells of the area.
+    index.updateConnection(connection(7),
+        createRoute(QPointF(10000, 10000), QPointF(15000, 10000), QPointF(15000, 10050)));
+
+    QSet<GraphicsConnection*> denseResult = index.findConnections(area).toSet();
+
+    QSet<GraphicsConnection*> expected;
+    expected << connection(0) << connection(1) << connection(2) << connection(3);
+
+    QCOMPARE(sparseResult, expected);
+    QCOMPARE(denseResult, expected);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::connection()
+//-----------------------------------------------------------------------------
+GraphicsConnection* tst_ConnectionSegmentIndex::connection(int index)
+{
+    // The index never dereferences the connections, it only uses them as keys and notifies them.
+    return reinterpret_cast<GraphicsConnection*>(&connectionHandles_[index]);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::createRoute()
+//-----------------------------------------------------------------------------
+QList<QPointF> tst_ConnectionSegmentIndex::createRoute(QPointF const& start, QPointF const& corner,
+    QPointF const& end) const
+{
+    return QList<QPointF>() << start << corner << end;
+}
+
+QTEST_APPLESS_MAIN(tst_ConnectionSegmentIndex)
+
+#include "tst_ConnectionSegmentIndex.moc"
@@ -0,0 +1,12 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+# This is a reminder that you are using a generated .pro file.
+# Remove it when you are finished editing this file.
+message("You are running qmake on a generated .pro file. This may not work!")
+
+
+HEADERS += ../../../common/graphicsItems/ConnectionSegmentIndex.h
+SOURCES += ./tst_ConnectionSegmentIndex.cpp \
+    ../../../common/graphicsItems/ConnectionSegmentIndex.cpp
@@ -0,0 +1,40 @@
+#-----------------------------------------------------------------------------
+# File: tst_ConnectionSegmentIndex.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus 2
+# Author: agent
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file template for running unit tests for ConnectionSegmentIndex.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+TARGET = tst_ConnectionSegmentIndex
+
+QT += core gui widgets testlib
+CONFIG += testcase console
+
+win32:CONFIG(release, debug|release) {
+    DESTDIR = ./release
+}
+else:win32:CONFIG(debug, debug|release) {
+    DESTDIR = ./debug
+}
+else:unix {
+    DESTDIR = ./release
+}
+
+INCLUDEPATH += $$DESTDIR
+INCLUDEPATH += ../../../
+
+DEPENDPATH += .
+DEPENDPATH += ../../../
+
+OBJECTS_DIR += $$DESTDIR
+
+MOC_DIR += ./generatedFiles
+UI_DIR += ./generatedFiles
+RCC_DIR += ./generatedFiles
+include(tst_ConnectionSegmentIndex.pri)
@@ -0,0 +1,302 @@
+//-----------------------------------------------------------------------------
+// File: tst_OrthogonalRouter.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class OrthogonalRouter.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <common/graphicsItems/OrthogonalRouter.h>
+
+class tst_OrthogonalRouter : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_OrthogonalRouter();
+
+private slots:
+
+    void testStraightRouteWithoutObstacles();
+    void testRouteAvoidsObstacle();
+    void testRouteLeavesEndpointsInTheirDirections();
+    void testEnclosedEndpointHasNoRoute();
+
+    void testRoutesInDenseDesignAvoidObstacles();
+
+    void benchmarkRouteAll();
+
+private:
+
+    OrthogonalRouter::Request createRequest(QPointF const& start, QVector2D const& startDirection,
+        QPointF const& end, QVector2D const& endDirection) const;
+
+    QList<QRectF> createComponentGrid(int columns, int rows) const;
+
+    QList<OrthogonalRouter::Request> createGridRequests(int columns, int rows) const;
+
+    bool isOrthogonal(QList<QPointF> const& route) const;
+
+    bool crossesObstacle(QList<QPointF> const& route, QRectF const& obstacle) const;
+
+    //! The clearance used in the tests.
+    static const int CLEARANCE = 10;
+
+    //! The stub length used in the tests.
+    static const int STUB_LENGTH = 20;
+
+    //! The size of the components and the space between them in the synthetic designs.
+    static const int COMPONENT_WIDTH = 100;
+    static const int COMPONENT_HEIGHT = 120;
+    static const int COLUMN_SPACING = 160;
+    static const int ROW_SPACING = 60;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::tst_OrthogonalRouter()
+//-----------------------------------------------------------------------------
+tst_OrthogonalRouter::tst_OrthogonalRouter()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::testStraightRouteWithoutObstacles()
+//-----------------------------------------------------------------------------
+void tst_OrthogonalRouter::testStraightRouteWithoutObstacles()
+{
+    OrthogonalRouter router(QList<QRectF>(), CLEARANCE, STUB_LENGTH);
+
+    QList<QPointF> route = router.route(createRequest(QPointF(0, 0), QVector2D(1, 0),
+        QPointF(200, 0), QVector2D(-1, 0)));
+
+    QCOMPARE(route.size(), 2);
+    QCOMPARE(route.first(), QPointF(0, 0));
+    QCOMPARE(route.last(), QPointF(200, 0));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::testRouteAvoidsObstacle()
+//-----------------------------------------------------------------------------
+void tst_OrthogonalRouter::testRouteAvoidsObstacle()
+{
+    QRectF obstacle(80, -50, 40, 100);
+
+    QList<QRectF> obstacles;
+    obstacles.append(obstacle);
+
+    OrthogonalRouter router(obstacles, CLEARANCE, STUB_LENGTH);
+
+    QList<QPointF> route = router.route(createRequest(QPointF(0, 0), QVector2D(1, 0),
+        QPointF(200, 0), QVector2D(-1, 0)));
+
+    QVERIFY(!route.isEmpty());
+    QCOMPARE(route.first(), QPointF(0, 0));
+    QCOMPARE(route.last(), QPointF(200, 0));
+    QVERIFY(isOrthogonal(route));
+    QVERIFY(!crossesObstacle(route, obstacle));
+
+    // The route should pass the obstacle with the clearance.
+    bool passesWithClearance = false;
+    foreach (QPointF const& point, route)
+    {
+        if (point.y() == obstacle.top() - CLEARANCE || point.y() == obstacle.bottom() + CLEARANCE)
+        {
+            passesWithClearance = true;
+        }
+    }
+
+    QVERIFY(passesWithClearance);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::testRouteLeavesEndpointsInTheirDirections()
+//-----------------------------------------------------------------------------
+void tst_OrthogonalRouter::testRouteLeavesEndpointsInTheirDirections()
+{
+    OrthogonalRouter router(QList<QRectF>(), CLEARANCE, STUB_LENGTH);
+
+    // The end is behind the start so the route must turn around.
+    QList<QPointF> route = router.route(createRequest(QPointF(0, 0), QVector2D(1, 0),
+        QPointF(-200, 100), QVector2D(-1, 0)));
+
+    QVERIFY(route.size() >= 4);
+    QVERIFY(isOrthogonal(route));
+
+    QCOMPARE(route.at(0).y(), route.at(1).y());
+    QVERIFY(route.at(1).x() >= STUB_LENGTH);
+
+    QCOMPARE(route.at(route.size() - 2).y(), route.last().y());
+    QVERIFY(route.at(route.size() - 2).x() <= -200 - STUB_LENGTH);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::testEnclosedEndpointHasNoRoute()
+//-----------------------------------------------------------------------------
+void tst_OrthogonalRouter::testEnclosedEndpointHasNoRoute()
+{
+    // Walls around the end point.
+    QList<QRectF> obstacles;
+    obstacles.append(QRectF(100, -100, 200, 20));
+    obstacles.append(QRectF(100, 80, 200, 20));
+    obstacles.append(QRectF(100, -100, 20, 200));
+    obstacles.append(QRectF(280, -100, 20, 200));
+
+    OrthogonalRouter router(obstacles, CLEARANCE, STUB_LENGTH);
+
+    QList<QPointF> route = router.route(createRequest(QPointF(0, 0), QVector2D(1, 0),
+        QPointF(200, 0), QVector2D(-1, 0)));
+
+    QVERIFY(route.isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::testRoutesInDenseDesignAvoidObstacles()
+//-----------------------------------------------------------------------------
+void tst_OrthogonalRouter::testRoutesInDenseDesignAvoidObstacles()
+{
+    QList<QRectF> obstacles = createComponentGrid(6, 6);
+    QList<OrthogonalRouter::Request> requests = createGridRequests(6, 6);
+
+    OrthogonalRouter router(obstacles, CLEARANCE, STUB_LENGTH);
+    QList<QList<QPointF> > routes = router.routeAll(requests);
+
+    QCOMPARE(routes.size(), requests.size());
+
+    for (int i = 0; i < routes.size(); ++i)
+    {
+        QList<QPointF> const& route = routes.at(i);
+
+        QVERIFY(!route.isEmpty());
+        QCOMPARE(route.first(), requests.at(i).start);
+        QCOMPARE(route.last(), requests.at(i).end);
+        QVERIFY(isOrthogonal(route));
+
+        foreach (QRectF const& obstacle, obstacles)
+        {
+            QVERIFY(!crossesObstacle(route, obstacle));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::benchmarkRouteAll()
+//-----------------------------------------------------------------------------
+void tst_OrthogonalRouter::benchmarkRouteAll()
+{
+    QList<QRectF> obstacles = createComponentGrid(20, 20);
+    QList<OrthogonalRouter::Request> requests = createGridRequests(20, 20);
+
+    OrthogonalRouter router(obstacles, CLEARANCE, STUB_LENGTH);
+
+    QBENCHMARK
+    {
+        router.routeAll(requests);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::createRequest()
+//-----------------------------------------------------------------------------
+OrthogonalRouter::Request tst_OrthogonalRouter::createRequest(QPointF const& start,
+    QVector2D const& startDirection, QPointF const& end, QVector2D const& endDirection) const
+{
+    OrthogonalRouter::Request request;
+    request.start = start;
+    request.startDirection = startDirection;
+    request.end = end;
+    request.endDirection = endDirection;
+
+    return request;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::createComponentGrid()
+//-----------------------------------------------------------------------------
+QList<QRectF> tst_OrthogonalRouter::createComponentGrid(int columns, int rows) const
+{
+    QList<QRectF> components;
+    for (int column = 0; column < columns; ++column)
+    {
+        for (int row = 0; row < rows; ++row)
+        {
+            components.append(QRectF(column * (COMPONENT_WIDTH + COLUMN_SPACING),
+                row * (COMPONENT_HEIGHT + ROW_SPACING), COMPONENT_WIDTH, COMPONENT_HEIGHT));
+        }
+    }
+
+    return components;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::createGridRequests()
+//-----------------------------------------------------------------------------
+QList<OrthogonalRouter::Request> tst_OrthogonalRouter::createGridRequests(int columns, int rows) const
+{
+    // Use a fixed seed so that every run routes the same connections.
+    qsrand(1);
+
+    QList<OrthogonalRouter::Request> requests;
+    for (int column = 0; column < columns - 1; ++column)
+    {
+        for (int row = 0; row < rows; ++row)
+        {
+            // Connect the right side of a component to the left side of a component in the next column.
+            int targetRow = qrand() % rows;
+            int targetColumn = column + 1 + qrand() % (columns - column - 1);
+
+            QPointF start((column + 1) * COMPONENT_WIDTH + column * COLUMN_SPACING,
+                row * (COMPONENT_HEIGHT + ROW_SPACING) + 40);
+            QPointF end(targetColumn * (COMPONENT_WIDTH + COLUMN_SPACING),
+                targetRow * (COMPONENT_HEIGHT + ROW_SPACING) + 80);
+
+            requests.append(createRequest(start, QVector2D(1, 0), end, QVector2D(-1, 0)));
+        }
+    }
+
+    return requests;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::isOrthogonal()
+//-----------------------------------------------------------------------------
+bool tst_OrthogonalRouter::isOrthogonal(QList<QPointF> const& route) const
+{
+    for (int i = 1; i < route.size(); ++i)
+    {
+        if (route.at(i).x() != route.at(i - 1).x() && route.at(i).y() != route.at(i - 1).y())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_OrthogonalRouter::crossesObstacle()
+//-----------------------------------------------------------------------------
+bool tst_OrthogonalRouter::crossesObstacle(QList<QPointF> const& route, QRectF const& obstacle) const
+{
+    for (int i = 1; i < route.size(); ++i)
+    {
+        QRectF segment = QRectF(route.at(i - 1), route.at(i)).normalized();
+
+        // Touching the edges is allowed, only the interior is blocked.
+        if (segment.right() > obstacle.left() && segment.left() < obstacle.right() &&
+            segment.bottom() > obstacle.top() && segment.top() < obstacle.bottom())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+QTEST_MAIN(tst_OrthogonalRouter)
+
+#include "tst_OrthogonalRouter.moc"
@@ -0,0 +1,12 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+# This is a reminder that you are using a generated .pro file.
+# Remove it when you are finished editing this file.
+message("You are running qmake on a generated .pro file. This may not work!")
+
+
+HEADERS += ../../../common/graphicsItems/OrthogonalRouter.h
+SOURCES += ./tst_OrthogonalRouter.cpp \
+    ../../../common/graphicsItems/OrthogonalRouter.cpp
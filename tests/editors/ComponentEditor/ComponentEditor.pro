@@ -19,5 +19,6 @@ SUBDIRS += modelParameters/modelParameters.pro \
 		common/tst_ExpressionEditor.pro \
 		common/tst_ParameterCompleter.pro \
 		common/tst_ValueFormatter.pro \
+		fileSet/dependencyAnalysis/tst_FileDependencyColumnAllocator.pro \
 		parameterReferenceTree/tst_ParameterReferenceTree.pro \
 		memoryMaps/memoryMaps.pro
\ No newline at end of file
@@ -0,0 +1,334 @@
+//-----------------------------------------------------------------------------
+// File: tst_FileDependencyColumnAllocator.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: agent
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class FileDependencyColumnAllocator.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <editors/ComponentEditor/fileSet/dependencyAnalysis/FileDependencyColumnAllocator.h>
+
+class tst_FileDependencyColumnAllocator : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_FileDependencyColumnAllocator();
+
+private slots:
+
+    void testOverlappingIntervalsAreSeparated();
+    void testMarginIsRequiredBetweenIntervals();
+    void testIntervalAboveColumnIsPlacedInColumn();
+    void testReleasedColumnIsReused();
+    void testEmptyColumnsAreRemovedOnRelease();
+
+    void testAllocateAllUsesMinimumColumns();
+    void testAllocateAllUsesMinimumColumns_data();
+
+    void testIncrementalAllocationHasNoCollisions();
+
+    void benchmarkAllocateAll();
+    void benchmarkIncrementalAllocation();
+
+private:
+
+    QVector<FileDependencyColumnAllocator::Interval> createGraph(int rowCount, int edgeCount) const;
+
+    int getMaximumOverlap(QVector<FileDependencyColumnAllocator::Interval> const& intervals) const;
+
+    bool hasCollisions(QVector<FileDependencyColumnAllocator::Interval> const& intervals,
+        QVector<int> const& columns) const;
+
+    //! The margin used in the tests.
+    static const int MARGIN = 2;
+
+    //! The height of a single row in the synthetic graphs.
+    static const int ROW_HEIGHT = 20;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyColumnAllocator::tst_FileDependencyColumnAllocator()
+//-----------------------------------------------------------------------------
+tst_FileDependencyColumnAllocator::tst_FileDependencyColumnAllocator()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyColumnAllocator::testOverlappingIntervalsAreSeparated()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyColumnAllocator::testOverlappingIntervalsAreSeparated()
+{
+    FileDependencyColumnAllocator allocator(MARGIN);
+
+    QCOMPARE(allocator.allocate(10, 50), 0);
+    QCOMPARE(allocator.allocate(40, 80), 1);
+    QCOMPARE(allocator.allocate(0, 100), 2);
+    QCOMPARE(allocator.allocate(100, 120), 0);
+
+    QCOMPARE(allocator.getColumnCount(), 3);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyColumnAllocator::testMarginIsRequiredBetweenIntervals()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyColumnAllocator::testMarginIsRequiredBetweenIntervals()
+{
+    FileDependencyColumnAllocator allocator(MARGIN);
+
+    allocator.allocate(10, 50);
+
+    QVERIFY(!allocator.hasSpace(0, 50 + MARGIN, 60));
+    QVERIFY(allocator.hasSpace(0, 51 + MARGIN, 60));
+    QVERIFY(!allocator.hasSpace(0, 0, 10 - MARGIN));
+    QVERIFY(allocator.hasSpace(0, 0, 9 - MARGIN));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyColumnAllocator::testIntervalAboveColumnIsPlacedInColumn()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyColumnAllocator::testIntervalAboveColumnIsPlacedInColumn()
+{
+    FileDependencyColumnAllocator allocator(MARGIN);
+
+    QCOMPARE(allocator.allocate(100, 120), 0);
+    QCOMPARE(allocator.allocate(50, 110), 1);
+    QCOMPARE(allocator.allocate(0, 40), 0);
+    QCOMPARE(allocator.allocate(130, 140), 0);
+    QCOMPARE(allocator.allocate(0, 60), 2);
+
+    QCOMPARE(allocator.getColumnCount(), 3);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyColumnAllocator::testReleasedColumnIsReused()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyColumnAllocator::testReleasedColumnIsReused()
+{
+    FileDependencyColumnAllocator allocator(MARGIN);
+
+    allocator.allocate(0, 100);
+    allocator.allocate(0, 100);
+    allocator.allocate(0, 100);
+
+    allocator.release(1, 0, 100);
+
+    QCOMPARE(allocator.getColumnCount(), 3);
+    QCOMPARE(allocator.allocate(20, 30), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyColumnAllocator::testEmptyColumnsAreRemovedOnRelease()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyColumnAllocator::testEmptyColumnsAreRemovedOnRelease()
+{
+    FileDependencyColumnAllocator allocator(MARGIN);
+
+    allocator.allocate(0, 100);
+    allocator.allocate(0, 100);
+    allocator.allocate(0, 100);
+
+    allocator.release(1, 0, 100);
+    allocator.release(2, 0, 100);
+
+    QCOMPARE(allocator.getColumnCount(), 1);
+
+    allocator.release(0, 0, 100);
+
+    QCOMPARE(allocator.getColumnCount(), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyColumnAllocator::testAllocateAllUsesMinimumColumns()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyColumnAllocator::testAllocateAllUsesMinimumColumns()
+{
+    QFETCH(int, rowCount);
+    QFETCH(int, edgeCount);
+
+    QVector<FileDependencyColumnAllocator::Interval> intervals = createGraph(rowCount, edgeCount);
+
+    FileDependencyColumnAllocator allocator(MARGIN);
+    QVector<int> columns = allocator.allocateAll(intervals);
+
+    QCOMPARE(columns.size(), intervals.size());
+    QCOMPARE(allocator.getColumnCount(), getMaximumOverlap(intervals));
+    QVERIFY(!hasCollisions(intervals, columns));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyColumnAllocator::testAllocateAllUsesMinimumColumns_data()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyColumnAllocator::testAllocateAllUsesMinimumColumns_data()
+{
+    QTest::addColumn<int>("rowCount");
+    QTest::addColumn<int>("edgeCount");
+
+    QTest::newRow("empty graph") << 10 << 0;
+    QTest::newRow("single edge") << 10 << 1;
+    QTest::newRow("dense small graph") << 10 << 100;
+    QTest::newRow("sparse large graph") << 10000 << 1000;
+    QTest::newRow("dense large graph") << 1000 << 10000;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyColumnAllocator::testIncrementalAllocationHasNoCollisions()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyColumnAllocator::testIncrementalAllocationHasNoCollisions()
+{
+    QVector<FileDependencyColumnAllocator::Interval> intervals = createGraph(1000, 5000);
+
+    FileDependencyColumnAllocator allocator(MARGIN);
+
+    QVector<int> columns;
+    foreach (FileDependencyColumnAllocator::Interval const& interval, intervals)
+    {
+        columns.append(allocator.allocate(interval.top, interval.bottom));
+    }
+
+    QVERIFY(!hasCollisions(intervals, columns));
+
+    // Releasing every other interval must leave room for the same intervals again.
+    for (int i = 0; i < intervals.size(); i += 2)
+    {
+        allocator.release(columns.at(i), intervals.at(i).top, intervals.at(i).bottom);
+    }
+
+    for (int i = 0; i < intervals.size(); i += 2)
+    {
+        QVERIFY(columns.at(i) >= allocator.getColumnCount() ||
+            allocator.hasSpace(columns.at(i), intervals.at(i).top, intervals.at(i).bottom));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyColumnAllocator::benchmarkAllocateAll()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyColumnAllocator::benchmarkAllocateAll()
+{
+    QVector<FileDependencyColumnAllocator::Interval> intervals = createGraph(20000, 100000);
+
+    FileDependencyColumnAllocator allocator(MARGIN);
+
+    QBENCHMARK
+    {
+        allocator.allocateAll(intervals);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyColumnAllocator::benchmarkIncrementalAllocation()
+//-----------------------------------------------------------------------------
+void tst_FileDependencyColumnAllocator::benchmarkIncrementalAllocation()
+{
+    QVector<FileDependencyColumnAllocator::Interval> intervals = createGraph(20000, 100000);
+
+    FileDependencyColumnAllocator allocator(MARGIN);
+
+    QBENCHMARK
+    {
+        allocator.clear();
+        foreach (FileDependencyColumnAllocator::Interval const& interval, intervals)
+        {
+            allocator.allocate(interval.top, interval.bottom);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyColumnAllocator::createGraph()
+//-----------------------------------------------------------------------------
+QVector<FileDependencyColumnAllocator::Interval> tst_FileDependencyColumnAllocator::createGraph(int rowCount,
+    int edgeCount) const
+{
+    // Use a fixed seed so that every run lays out the same graph.
+    qsrand(1);
+
+    QVector<FileDependencyColumnAllocator::Interval> intervals;
+    intervals.reserve(edgeCount);
+
+    for (int i = 0; i < edgeCount; ++i)
+    {
+        int from = qrand() % rowCount;
+
+        // Most dependencies are between files close to each other, a few span the whole list.
+        int distance = 1 + qrand() % 10;
+        if (qrand() % 20 == 0)
+        {
+            distance = qrand() % rowCount;
+        }
+
+        int to = qBound(0, from + (qrand() % 2 == 0 ? distance : -distance), rowCount - 1);
+
+        int top = qMin(from, to) * ROW_HEIGHT + ROW_HEIGHT / 2;
+        int bottom = qMax(from, to) * ROW_HEIGHT + ROW_HEIGHT / 2;
+        intervals.append(FileDependencyColumnAllocator::Interval(top, bottom));
+    }
+
+    return intervals;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyColumnAllocator::getMaximumOverlap()
+//-----------------------------------------------------------------------------
+int tst_FileDependencyColumnAllocator::getMaximumOverlap(
+    QVector<FileDependencyColumnAllocator::Interval> const& intervals) const
+{
+    // Two intervals collide if they are closer than the margin, so extend each interval by the margin
+    // and count the intervals covering each point. Ends sort before starts at the same position.
+    QVector<QPair<int, int> > events;
+    foreach (FileDependencyColumnAllocator::Interval const& interval, intervals)
+    {
+        events.append(qMakePair(interval.top, 1));
+        events.append(qMakePair(interval.bottom + MARGIN + 1, -1));
+    }
+
+    qSort(events);
+
+    int overlap = 0;
+    int maximumOverlap = 0;
+    for (int i = 0; i < events.size(); ++i)
+    {
+        overlap += events.at(i).second;
+        maximumOverlap = qMax(maximumOverlap, overlap);
+    }
+
+    return maximumOverlap;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_FileDependencyColumnAllocator::hasCollisions()
+//-----------------------------------------------------------------------------
+bool tst_FileDependencyColumnAllocator::hasCollisions(
+    QVector<FileDependencyColumnAllocator::Interval> const& intervals, QVector<int> const& columns) const
+{
+    QMap<int, QVector<QPair<int, int> > > intervalsInColumns;
+    for (int i = 0; i < intervals.size(); ++i)
+    {
+        intervalsInColumns[columns.at(i)].append(qMakePair(intervals.at(i).top, intervals.at(i).bottom));
+    }
+
+    foreach (QVector<QPair<int, int> > columnIntervals, intervalsInColumns)
+    {
+        qSort(columnIntervals);
+
+        for (int i = 1; i < columnIntervals.size(); ++i)
+        {
+            if (columnIntervals.at(i).first - MARGIN <= columnIntervals.at(i - 1).second)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+QTEST_MAIN(tst_FileDependencyColumnAllocator)
+
+#include "tst_FileDependencyColumnAllocator.moc"
@@ -67,6 +67,8 @@ private slots:
 
     void testNonPresentField();
 
+    void testFieldOffsetChange();
+
 private:
     void expandItem(RegisterGraphItem* registerItem);
 
@@ -663,6 +665,65 @@ void tst_RegisterGraphItem::testNonPresentField()
     delete registerItem->parentItem();
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterGraphItem::testFieldOffsetChange()
+//-----------------------------------------------------------------------------
+void tst_RegisterGraphItem::testFieldOffsetChange()
+{
+    RegisterGraphItem* registerItem = createRegisterItem();
+
+    FieldGraphItem* firstItem = createFieldItem("first", 0, 4, registerItem);
+
+    QSharedPointer<Field> secondField(new Field());
+    secondField->setName("second");
+    secondField->setBitOffset(4);
+    secondField->setBitWidth(4);
+
+    QSharedPointer<ExpressionParser> expressionParser(new SystemVerilogExpressionParser());
+
+    FieldGraphItem* secondItem = new FieldGraphItem(secondField, expressionParser, registerItem);
+    registerItem->addChild(secondItem);
+
+    expandItem(registerItem);
+
+    QVERIFY(!firstItem->isConflicted());
+    QVERIFY(!secondItem->isConflicted());
+    QCOMPARE(findMemoryGaps(registerItem).count(), 0);
+
+    // Move the second field to overlap the first one and leave the MSBs empty.
+    secondField->setBitOffset(2);
+    secondItem->refresh();
+    registerItem->refresh();
+
+    QVERIFY(firstItem->isConflicted());
+    QVERIFY(secondItem->isConflicted());
+    QCOMPARE(secondItem->getDisplayOffset(), quint64(5));
+    QCOMPARE(secondItem->getDisplayLastAddress(), quint64(2));
+
+    QList<MemoryGapItem*> gaps = findMemoryGaps(registerItem);
+    QCOMPARE(gaps.count(), 1);
+    QCOMPARE(gaps.first()->getDisplayOffset(), quint64(7));
+    QCOMPARE(gaps.first()->getDisplayLastAddress(), quint64(6));
+
+    // Move the second field to the MSBs, leaving a gap between the fields.
+    secondField->setBitOffset(6);
+    secondField->setBitWidth(2);
+    secondItem->refresh();
+    registerItem->refresh();
+
+    QVERIFY(!firstItem->isConflicted());
+    QVERIFY(!secondItem->isConflicted());
+    QCOMPARE(secondItem->getDisplayOffset(), quint64(7));
+    QCOMPARE(secondItem->getDisplayLastAddress(), quint64(6));
+
+    gaps = findMemoryGaps(registerItem);
+    QCOMPARE(gaps.count(), 1);
+    QCOMPARE(gaps.first()->getDisplayOffset(), quint64(5));
+    QCOMPARE(gaps.first()->getDisplayLastAddress(), quint64(4));
+
+    delete registerItem->parentItem();
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_MemoryMapGraphItem::expandItem()
 //-----------------------------------------------------------------------------
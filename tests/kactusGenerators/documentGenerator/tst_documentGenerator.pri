@@ -52,6 +52,11 @@ HEADERS += ../../../designEditors/HWDesign/AdHocEnabled.h \
     ../../../common/graphicsItems/GraphicsColumn.h \
     ../../../common/graphicsItems/GraphicsColumnLayout.h \
     ../../../common/graphicsItems/GraphicsConnection.h \
+    ../../../common/graphicsItems/ConnectionSegmentIndex.h \
+    ../../../common/graphicsItems/LevelOfDetail.h \
+    ../../../common/graphicsItems/DetailTextItem.h \
+    ../../../common/graphicsItems/DetailShadowEffect.h \
+    ../../../common/graphicsItems/OrthogonalRouter.h \
     ../../../designEditors/HWDesign/HWChangeCommands.h \
     ../../../designEditors/HWDesign/columnview/HWColumn.h \
     ../../../designEditors/HWDesign/HWComponentItem.h \
@@ -59,6 +64,8 @@ HEADERS += ../../../designEditors/HWDesign/AdHocEnabled.h \
     ../../../designEditors/HWDesign/HWConnectionEndpoint.h \
     ../../../designEditors/HWDesign/HWDeleteCommands.h \
     ../../../designEditors/HWDesign/HWDesignDiagram.h \
+    ../../../common/PerformanceTrace/PerformanceTrace.h \
+    ../../../common/PerformanceTrace/ScopedTrace.h \
     ../../MockObjects/HWDesignWidgetMock.h \
     ../../../common/IEditProvider.h \
     ../../../common/widgets/kactusAttributeEditor/KactusAttributeEditor.h \
@@ -137,6 +144,11 @@ SOURCES += ../../../designEditors/HWDesign/AdHocEnabled.cpp \
     ../../../common/graphicsItems/GraphicsColumnLayout.cpp \
     ../../../common/graphicsItems/GraphicsColumnUndoCommands.cpp \
     ../../../common/graphicsItems/GraphicsConnection.cpp \
+    ../../../common/graphicsItems/ConnectionSegmentIndex.cpp \
+    ../../../common/graphicsItems/LevelOfDetail.cpp \
+    ../../../common/graphicsItems/DetailTextItem.cpp \
+    ../../../common/graphicsItems/DetailShadowEffect.cpp \
+    ../../../common/graphicsItems/OrthogonalRouter.cpp \
     ../../../designEditors/HWDesign/HWAddCommands.cpp \
     ../../../designEditors/HWDesign/HWChangeCommands.cpp \
     ../../../designEditors/HWDesign/columnview/HWColumn.cpp \
@@ -145,6 +157,8 @@ SOURCES += ../../../designEditors/HWDesign/AdHocEnabled.cpp \
     ../../../designEditors/HWDesign/HWConnectionEndPoint.cpp \
     ../../../designEditors/HWDesign/HWDeleteCommands.cpp \
     ../../../designEditors/HWDesign/HWDesignDiagram.cpp \
+    ../../../common/PerformanceTrace/PerformanceTrace.cpp \
+    ../../../common/PerformanceTrace/ScopedTrace.cpp \
     ../../MockObjects/HWDesignWidgetMock.cpp \
     ../../../designEditors/HWDesign/HWMoveCommands.cpp \
     ../../../common/widgets/kactusAttributeEditor/KactusAttributeEditor.cpp \
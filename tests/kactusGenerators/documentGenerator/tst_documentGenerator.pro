@@ -13,7 +13,7 @@ TEMPLATE = app
 
 TARGET = tst_documentGenerator
 
-QT += core xml gui widgets testlib printsupport
+QT += core xml gui widgets testlib printsupport concurrent
 CONFIG += testcase console
 
 win32:CONFIG(release, debug|release) {
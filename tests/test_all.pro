@@ -14,6 +14,7 @@ TEMPLATE = subdirs
 CONFIG += testcase
 
 SUBDIRS += IPXACTmodels/IPXACTmodels.pro \
+		common/common.pro \
 		editors/editors.pro \
 		wizards/wizards.pro \
 		Plugins/plugins.pro \